@@ -15,6 +15,7 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/Component/DependencySortCache.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Date/DateFormat.h>
 
@@ -1228,6 +1229,9 @@ namespace AZ
                     descriptor->Reflect(context);
                 });
         }
+
+        // Stored component orders may depend on the services of a previously registered descriptor for the same type.
+        DependencySortCache::ClearAll();
     }
 
     //=========================================================================
@@ -1239,6 +1243,8 @@ namespace AZ
         {
             ReflectionEnvironment::GetReflectionManager()->Unreflect(descriptor->GetUuid());
         }
+
+        DependencySortCache::ClearAll();
     }
 
     void ComponentApplication::RegisterEntityAddedEventHandler(EntityAddedEvent::Handler& handler)
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/DependencySortCache.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace DependencySortCacheInternal
+    {
+        static void AppendTypeId(AZStd::vector<u64>& signature, const TypeId& typeId)
+        {
+            u64 words[2];
+            static_assert(sizeof(words) == sizeof(TypeId), "A type id is expected to fit exactly in two 64-bit words.");
+            memcpy(words, typeId.begin(), sizeof(words));
+            signature.push_back(words[0]);
+            signature.push_back(words[1]);
+        }
+
+        static void AppendServices(AZStd::vector<u64>& signature, const ComponentDescriptor::DependencyArrayType& services)
+        {
+            signature.push_back(services.size());
+            for (ComponentServiceType service : services)
+            {
+                signature.push_back(static_cast<u32>(service));
+            }
+        }
+
+        //! Appends everything the descriptor reports about the component that the sort looks at.
+        static void AppendComponentServices(
+            AZStd::vector<u64>& signature, ComponentDescriptor::DependencyArrayType& services, Component* component)
+        {
+            ComponentDescriptor* componentDescriptor = nullptr;
+            ComponentDescriptorBus::EventResult(
+                componentDescriptor, azrtti_typeid(component), &ComponentDescriptorBus::Events::GetDescriptor);
+            if (!componentDescriptor)
+            {
+                // The sort fails without a descriptor, so this signature is never stored.
+                return;
+            }
+
+            services.clear();
+            componentDescriptor->GetProvidedServices(services, component);
+            AppendServices(signature, services);
+            services.clear();
+            componentDescriptor->GetRequiredServices(services, component);
+            AppendServices(signature, services);
+            services.clear();
+            componentDescriptor->GetDependentServices(services, component);
+            AppendServices(signature, services);
+            services.clear();
+            componentDescriptor->GetIncompatibleServices(services, component);
+            AppendServices(signature, services);
+        }
+
+        static AZStd::atomic<u32>& GetClearAllCount()
+        {
+            static EnvironmentVariable<AZStd::atomic<u32>> clearAllCount = nullptr; // shared by every module in the process
+
+            if (!clearAllCount)
+            {
+                clearAllCount = Environment::CreateVariable<AZStd::atomic<u32>>(AZ_CRC_CE("DependencySortCacheClearAllCount"), 0u);
+            }
+
+            return *clearAllCount;
+        }
+    } // namespace DependencySortCacheInternal
+
+    Entity::DependencySortOutcome DependencySortCache::Sort(Entity::ComponentArrayType& components)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        using DependencySortCacheInternal::AppendComponentServices;
+        using DependencySortCacheInternal::AppendTypeId;
+
+        const u32 clearAllCount = DependencySortCacheInternal::GetClearAllCount().load(AZStd::memory_order_acquire);
+        if (m_clearAllCount.exchange(clearAllCount, AZStd::memory_order_acq_rel) != clearAllCount)
+        {
+            // Descriptors were registered or unregistered since the last sort.
+            Clear();
+        }
+
+        Entity::ComponentArrayType unsortedComponents;
+        unsortedComponents.reserve(components.size());
+        AZStd::vector<u64> signature;
+        signature.reserve(components.size() * 16);
+        ComponentDescriptor::DependencyArrayType services;
+        AZStd::vector<size_t> rankOffsets;
+        rankOffsets.reserve(components.size());
+        AZStd::unordered_map<TypeId, AZStd::vector<size_t>> componentsByType;
+        for (Component* component : components)
+        {
+            if (!component)
+            {
+                continue;
+            }
+
+            const TypeId underlyingTypeId = component->GetUnderlyingComponentType();
+            componentsByType[underlyingTypeId].push_back(unsortedComponents.size());
+            unsortedComponents.push_back(component);
+            AppendTypeId(signature, azrtti_typeid(component));
+            AppendTypeId(signature, underlyingTypeId);
+            // Filled in with the rank of the component id once all components are known.
+            rankOffsets.push_back(signature.size());
+            signature.push_back(0);
+            // Descriptors may report different services for each instance of the same type.
+            AppendComponentServices(signature, services, component);
+        }
+
+        // The sort only compares component ids between components of the same type, so instead of the ids themselves the
+        // signature holds their order. This lets entities with newly generated component ids share an entry.
+        for (auto& [typeId, indices] : componentsByType)
+        {
+            if (indices.size() > 1)
+            {
+                AZStd::sort(indices.begin(), indices.end(), [&unsortedComponents](size_t lhs, size_t rhs)
+                    {
+                        return unsortedComponents[lhs]->GetId() < unsortedComponents[rhs]->GetId();
+                    });
+                for (size_t rank = 0; rank < indices.size(); ++rank)
+                {
+                    signature[rankOffsets[indices[rank]]] = rank;
+                }
+            }
+        }
+
+        size_t hash = 0;
+        for (u64 value : signature)
+        {
+            AZStd::hash_combine(hash, value);
+        }
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            auto entryIt = m_entries.find(hash);
+            if (entryIt != m_entries.end() && entryIt->second.m_signature == signature)
+            {
+                const AZStd::vector<u32>& order = entryIt->second.m_order;
+                components.resize(order.size());
+                for (size_t i = 0; i < order.size(); ++i)
+                {
+                    components[i] = unsortedComponents[order[i]];
+                }
+                return AZ::Success();
+            }
+        }
+
+        Entity::ComponentArrayType sortedComponents = unsortedComponents;
+        Entity::DependencySortOutcome outcome = Entity::DependencySort(sortedComponents);
+        if (!outcome.IsSuccess())
+        {
+            return outcome;
+        }
+
+        AZStd::unordered_map<Component*, u32> unsortedIndices;
+        unsortedIndices.reserve(unsortedComponents.size());
+        for (size_t i = 0; i < unsortedComponents.size(); ++i)
+        {
+            unsortedIndices.emplace(unsortedComponents[i], aznumeric_cast<u32>(i));
+        }
+
+        Entry entry;
+        entry.m_signature = AZStd::move(signature);
+        entry.m_order.reserve(sortedComponents.size());
+        for (Component* component : sortedComponents)
+        {
+            entry.m_order.push_back(unsortedIndices[component]);
+        }
+
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            if (m_entries.size() >= MaxEntries)
+            {
+                m_entries.clear();
+            }
+            // On a hash collision the newest order wins.
+            m_entries.insert_or_assign(hash, AZStd::move(entry));
+        }
+
+        components = AZStd::move(sortedComponents);
+        return outcome;
+    }
+
+    void DependencySortCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+    void DependencySortCache::ClearAll()
+    {
+        DependencySortCacheInternal::GetClearAllCount().fetch_add(1, AZStd::memory_order_acq_rel);
+    }
+
+    size_t DependencySortCache::GetSize() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+} // namespace AZ
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZ
+{
+    //! Remembers the order in which Entity::DependencySort placed a set of components, so entities that hold the same
+    //! components, such as the many clones of a single prefab entity, don't each have to be sorted again.
+    //! Orders are keyed on the types, relative id order and services of the components, so components of the same type
+    //! that report different services per instance get their own order. Registering or unregistering a component
+    //! descriptor empties every cache. Only successful sorts are stored, so failures are always reported with full
+    //! details. Safe to use from multiple threads.
+    class DependencySortCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(DependencySortCache, SystemAllocator);
+
+        //! The number of orders kept before the cache is emptied. Entities are usually cloned from a limited number of
+        //! prototypes, so this is only reached if entities are composed at runtime.
+        static constexpr size_t MaxEntries = 1024;
+
+        DependencySortCache() = default;
+        DependencySortCache(const DependencySortCache&) = delete;
+        DependencySortCache& operator=(const DependencySortCache&) = delete;
+
+        //! Sorts the components in the same way as Entity::DependencySort, but reuses the order of an earlier sort of
+        //! components with the same types if available.
+        //! @param components The components to sort. Null entries are removed on success.
+        //! @return The same outcome Entity::DependencySort would return.
+        Entity::DependencySortOutcome Sort(Entity::ComponentArrayType& components);
+
+        //! Removes all stored orders.
+        void Clear();
+
+        //! Removes all stored orders from every cache in the process, each cache is emptied the next time it sorts.
+        //! Called by the component application when component descriptors are registered or unregistered.
+        static void ClearAll();
+
+        //! Returns the number of stored orders.
+        size_t GetSize() const;
+
+    private:
+        struct Entry
+        {
+            //! Everything about the components that affects the sort, used to confirm the entry is for the same components.
+            AZStd::vector<u64> m_signature;
+            //! For every position in the sorted array, the index of the component in the unsorted array.
+            AZStd::vector<u32> m_order;
+        };
+
+        mutable AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<size_t, Entry> m_entries;
+        //! The value of the process wide counter bumped by ClearAll at the time of the last sort.
+        AZStd::atomic<u32> m_clearAllCount{ 0 };
+    };
+} // namespace AZ
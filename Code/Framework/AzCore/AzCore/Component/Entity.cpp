@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/DependencySortCache.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/EntityIdSerializer.h>
 #include <AzCore/Component/EntitySerializer.h>
@@ -267,6 +268,19 @@ namespace AZ
         return outcome;
     }
 
+    Entity::DependencySortOutcome Entity::EvaluateDependenciesGetDetails(DependencySortCache& cache)
+    {
+        DependencySortOutcome outcome = AZ::Success();
+
+        if (!m_isDependencyReady)
+        {
+            outcome = cache.Sort(m_components);
+            m_isDependencyReady = outcome.IsSuccess();
+        }
+
+        return outcome;
+    }
+
     void Entity::InvalidateDependencies()
     {
         m_isDependencyReady = false;
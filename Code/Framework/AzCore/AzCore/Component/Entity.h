@@ -25,6 +25,7 @@ namespace AZ
 {
     class Transform;
     class TransformInterface;
+    class DependencySortCache;
 
     //! An addressable container for a group of components. 
     //! An entity creates, initializes, activates, and deactivates its components.  
@@ -338,6 +339,11 @@ namespace AZ
         //! Otherwise the failed outcome contains details on why the sort failed.
         DependencySortOutcome EvaluateDependenciesGetDetails();
 
+        //! Same as EvaluateDependenciesGetDetails(), but takes the order from the cache if an entity with the same
+        //! components was sorted before. Use this when many entities are created from the same prototype.
+        //! @param cache The cache to look up the order in and to store the order in after a successful sort.
+        DependencySortOutcome EvaluateDependenciesGetDetails(DependencySortCache& cache);
+
         //! Same as EvaluateDependenciesGetDetails(), but if sort fails
         //! only a code is returned, there is no detailed error message.
         DependencySortResult EvaluateDependencies();
@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+
+#include <AzCore/Compression/zstd_dictionary.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <zdict.h>
+
+namespace AZ
+{
+    namespace ZStdDictionaryInternal
+    {
+        //! Decompression context of a thread, reused for every frame the thread decompresses.
+        //! It's allocated with the default zstd allocator because it's only released when the thread exits, which can
+        //! happen after the AZ allocators have been destroyed.
+        struct ThreadDecompressionContext
+        {
+            ThreadDecompressionContext()
+                : m_context(ZSTD_createDCtx())
+            {
+            }
+
+            ~ThreadDecompressionContext()
+            {
+                ZSTD_freeDCtx(m_context);
+            }
+
+            ZSTD_DCtx* m_context;
+        };
+
+        ZSTD_DCtx* GetThreadDecompressionContext()
+        {
+            static thread_local ThreadDecompressionContext t_decompressionContext;
+            return t_decompressionContext.m_context;
+        }
+
+        AZStd::string NormalizeAssetType(AZStd::string_view assetType)
+        {
+            AZStd::string result(assetType);
+            AZStd::to_lower(result.begin(), result.end());
+            return result;
+        }
+
+        template<typename T>
+        bool Read(AZ::IO::GenericStream& stream, T& value)
+        {
+            return stream.Read(sizeof(T), &value) == sizeof(T);
+        }
+
+        template<typename T>
+        bool Write(AZ::IO::GenericStream& stream, const T& value)
+        {
+            return stream.Write(sizeof(T), &value) == sizeof(T);
+        }
+    } // namespace ZStdDictionaryInternal
+
+    //////////////////////////////////////////////////////////////////////////
+    // ZStdDictionary
+
+    ZStdDictionary::TrainOutcome ZStdDictionary::TrainDictionary(Samples samples, size_t maxDictionarySize)
+    {
+        if (samples.empty())
+        {
+            return AZ::Failure(AZStd::string("No samples were provided to train the dictionary with."));
+        }
+
+        // zstd trains from a single buffer containing all samples back to back.
+        size_t totalSize = 0;
+        for (const AZStd::span<const AZ::u8>& sample : samples)
+        {
+            totalSize += sample.size();
+        }
+        AZStd::vector<AZ::u8> sampleBuffer;
+        sampleBuffer.reserve(totalSize);
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (const AZStd::span<const AZ::u8>& sample : samples)
+        {
+            sampleBuffer.insert(sampleBuffer.end(), sample.begin(), sample.end());
+            sampleSizes.push_back(sample.size());
+        }
+
+        AZStd::vector<AZ::u8> dictionary(maxDictionarySize);
+        size_t result = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), sampleBuffer.data(), sampleSizes.data(),
+            aznumeric_cast<unsigned int>(sampleSizes.size()));
+        if (ZDICT_isError(result))
+        {
+            return AZ::Failure(AZStd::string::format(
+                "Failed to train ZStandard dictionary from %zu samples (%zu bytes): %s", samples.size(), totalSize,
+                ZDICT_getErrorName(result)));
+        }
+        dictionary.resize(result);
+        return AZ::Success(AZStd::move(dictionary));
+    }
+
+    ZStdDictionary::ZStdDictionary(AZStd::span<const AZ::u8> dictionaryData, int compressionLevel, IAllocator* workMemAllocator)
+        : m_dictionaryData(dictionaryData.begin(), dictionaryData.end())
+        , m_workMemoryAllocator(workMemAllocator)
+        , m_compressionLevel(compressionLevel)
+    {
+        if (!m_workMemoryAllocator)
+        {
+            m_workMemoryAllocator = &AllocatorInstance<SystemAllocator>::Get();
+        }
+
+        ZSTD_customMem customAlloc;
+        customAlloc.customAlloc = &ZStdDictionary::AllocateMem;
+        customAlloc.customFree = &ZStdDictionary::FreeMem;
+        customAlloc.opaque = m_workMemoryAllocator;
+
+        // Both tables reference the dictionary data owned by this object instead of making their own copy.
+        m_compressionDictionary = ZSTD_createCDict_advanced(m_dictionaryData.data(), m_dictionaryData.size(), ZSTD_dlm_byRef,
+            ZSTD_dct_auto, ZSTD_getCParams(compressionLevel, 0, m_dictionaryData.size()), customAlloc);
+        m_decompressionDictionary = ZSTD_createDDict_advanced(m_dictionaryData.data(), m_dictionaryData.size(), ZSTD_dlm_byRef,
+            ZSTD_dct_auto, customAlloc);
+        AZ_Error("ZStd", m_compressionDictionary && m_decompressionDictionary, "Failed to load ZStandard dictionary of %zu bytes.",
+            m_dictionaryData.size());
+        m_dictionaryId = aznumeric_cast<AZ::u32>(ZSTD_getDictID_fromDict(m_dictionaryData.data(), m_dictionaryData.size()));
+    }
+
+    ZStdDictionary::~ZStdDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    void* ZStdDictionary::AllocateMem(void* userData, size_t size)
+    {
+        IAllocator* allocator = reinterpret_cast<IAllocator*>(userData);
+        return allocator->Allocate(size, 16);
+    }
+
+    void ZStdDictionary::FreeMem(void* userData, void* address)
+    {
+        if (address)
+        {
+            IAllocator* allocator = reinterpret_cast<IAllocator*>(userData);
+            allocator->DeAllocate(address);
+        }
+    }
+
+    bool ZStdDictionary::IsValid() const
+    {
+        return m_compressionDictionary != nullptr && m_decompressionDictionary != nullptr;
+    }
+
+    AZ::u32 ZStdDictionary::GetDictionaryId() const
+    {
+        return m_dictionaryId;
+    }
+
+    int ZStdDictionary::GetCompressionLevel() const
+    {
+        return m_compressionLevel;
+    }
+
+    AZStd::span<const AZ::u8> ZStdDictionary::GetDictionaryData() const
+    {
+        return m_dictionaryData;
+    }
+
+    size_t ZStdDictionary::GetMinCompressedBufferSize(size_t sourceDataSize)
+    {
+        return ZSTD_compressBound(sourceDataSize);
+    }
+
+    size_t ZStdDictionary::Compress(const void* data, size_t dataSize, void* compressedData, size_t compressedDataSize) const
+    {
+        AZ_Assert(IsValid(), "Compressing with a ZStandard dictionary that failed to load.");
+
+        ZSTD_customMem customAlloc;
+        customAlloc.customAlloc = &ZStdDictionary::AllocateMem;
+        customAlloc.customFree = &ZStdDictionary::FreeMem;
+        customAlloc.opaque = m_workMemoryAllocator;
+
+        ZSTD_CCtx* context = ZSTD_createCCtx_advanced(customAlloc);
+        if (!context)
+        {
+            AZ_Error("ZStd", false, "ZStandard internal error - failed to create compression context.");
+            return 0;
+        }
+        size_t result = ZSTD_compress_usingCDict(context, compressedData, compressedDataSize, data, dataSize, m_compressionDictionary);
+        ZSTD_freeCCtx(context);
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Error("ZStd", false, "ZStandard dictionary compression error: %s", ZSTD_getErrorName(result));
+            return 0;
+        }
+        return result;
+    }
+
+    bool ZStdDictionary::Decompress(const void* compressedData, size_t compressedDataSize, void* outputData, size_t outputDataSize) const
+    {
+        AZ_Assert(IsValid(), "Decompressing with a ZStandard dictionary that failed to load.");
+
+        ZSTD_DCtx* context = ZStdDictionaryInternal::GetThreadDecompressionContext();
+        if (!context)
+        {
+            AZ_Error("ZStd", false, "ZStandard internal error - failed to create decompression context.");
+            return false;
+        }
+        size_t result = ZSTD_decompress_usingDDict(
+            context, outputData, outputDataSize, compressedData, compressedDataSize, m_decompressionDictionary);
+        if (ZSTD_isError(result))
+        {
+            AZ_Error("ZStd", false, "ZStandard dictionary decompression error: %s", ZSTD_getErrorName(result));
+            return false;
+        }
+        if (result != outputDataSize)
+        {
+            AZ_Error("ZStd", false, "ZStandard dictionary decompression produced %zu bytes, but %zu were expected.", result, outputDataSize);
+            return false;
+        }
+        return true;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // ZStdDictionarySet
+
+    AZ::IO::Path ZStdDictionarySet::GetDictionaryPath(AZ::IO::PathView archivePath)
+    {
+        AZ::IO::Path result(archivePath);
+        result.Native() += DictionaryFileExtension;
+        return result;
+    }
+
+    auto ZStdDictionarySet::TrainDictionary(AZStd::string_view assetType, ZStdDictionary::Samples samples,
+        size_t maxDictionarySize, int compressionLevel) -> LoadOutcome
+    {
+        ZStdDictionary::TrainOutcome trained = ZStdDictionary::TrainDictionary(samples, maxDictionarySize);
+        if (!trained.IsSuccess())
+        {
+            return AZ::Failure(AZStd::string::format(
+                "Unable to train dictionary for asset type '%.*s': %s", AZ_STRING_ARG(assetType), trained.GetError().c_str()));
+        }
+
+        auto dictionary = AZStd::make_shared<ZStdDictionary>(trained.GetValue(), compressionLevel);
+        if (!dictionary->IsValid())
+        {
+            return AZ::Failure(AZStd::string::format(
+                "The dictionary trained for asset type '%.*s' couldn't be loaded.", AZ_STRING_ARG(assetType)));
+        }
+        AddDictionary(assetType, AZStd::move(dictionary));
+        return AZ::Success();
+    }
+
+    void ZStdDictionarySet::AddDictionary(AZStd::string_view assetType, AZStd::shared_ptr<const ZStdDictionary> dictionary)
+    {
+        m_dictionaries[ZStdDictionaryInternal::NormalizeAssetType(assetType)] = AZStd::move(dictionary);
+    }
+
+    AZStd::shared_ptr<const ZStdDictionary> ZStdDictionarySet::FindDictionary(AZStd::string_view assetType) const
+    {
+        auto it = m_dictionaries.find(ZStdDictionaryInternal::NormalizeAssetType(assetType));
+        return it != m_dictionaries.end() ? it->second : nullptr;
+    }
+
+    AZStd::shared_ptr<const ZStdDictionary> ZStdDictionarySet::FindDictionaryForFile(AZ::IO::PathView filePath) const
+    {
+        return FindDictionary(filePath.Extension().Native());
+    }
+
+    const ZStdDictionary* ZStdDictionarySet::FindDictionaryForFrame(const void* compressedData, size_t compressedDataSize) const
+    {
+        // Frames compressed without a dictionary, or whose header doesn't record it, report id 0.
+        const unsigned int dictionaryId = ZSTD_getDictID_fromFrame(compressedData, compressedDataSize);
+        if (dictionaryId == 0)
+        {
+            return nullptr;
+        }
+        for (const auto& [assetType, dictionary] : m_dictionaries)
+        {
+            if (dictionary->GetDictionaryId() == dictionaryId)
+            {
+                return dictionary.get();
+            }
+        }
+        return nullptr;
+    }
+
+    size_t ZStdDictionarySet::GetDictionaryCount() const
+    {
+        return m_dictionaries.size();
+    }
+
+    void ZStdDictionarySet::Clear()
+    {
+        m_dictionaries.clear();
+    }
+
+    bool ZStdDictionarySet::Save(AZ::IO::GenericStream& stream) const
+    {
+        using namespace ZStdDictionaryInternal;
+
+        // Layout: magic, version, dictionary count, then for every dictionary the length of its asset type, the asset type,
+        // the compression level it was trained for, the size of the dictionary and the dictionary data.
+        bool result = stream.Write(FileMagic.size(), FileMagic.data()) == FileMagic.size();
+        result = result && Write(stream, FileVersion);
+        result = result && Write(stream, aznumeric_cast<AZ::u32>(m_dictionaries.size()));
+        for (const auto& [assetType, dictionary] : m_dictionaries)
+        {
+            AZStd::span<const AZ::u8> data = dictionary->GetDictionaryData();
+            result = result && Write(stream, aznumeric_cast<AZ::u32>(assetType.size()));
+            result = result && stream.Write(assetType.size(), assetType.data()) == assetType.size();
+            result = result && Write(stream, aznumeric_cast<AZ::s32>(dictionary->GetCompressionLevel()));
+            result = result && Write(stream, aznumeric_cast<AZ::u32>(data.size()));
+            result = result && stream.Write(data.size(), data.data()) == data.size();
+        }
+        return result;
+    }
+
+    auto ZStdDictionarySet::Load(AZ::IO::GenericStream& stream) -> LoadOutcome
+    {
+        using namespace ZStdDictionaryInternal;
+
+        m_dictionaries.clear();
+
+        char magic[FileMagic.size()];
+        AZ::u32 version = 0;
+        AZ::u32 count = 0;
+        if (stream.Read(sizeof(magic), magic) != sizeof(magic) || FileMagic != AZStd::string_view(magic, sizeof(magic)))
+        {
+            return AZ::Failure(AZStd::string("Stream doesn't contain ZStandard dictionaries."));
+        }
+        if (!Read(stream, version) || version != FileVersion)
+        {
+            return AZ::Failure(AZStd::string::format("Unsupported dictionary file version %u, expected %u.", version, FileVersion));
+        }
+        if (!Read(stream, count))
+        {
+            return AZ::Failure(AZStd::string("Dictionary file is truncated."));
+        }
+
+        // Every entry has at least its asset type length, compression level and dictionary size.
+        constexpr size_t MinEntrySize = sizeof(AZ::u32) + sizeof(AZ::s32) + sizeof(AZ::u32);
+        auto GetRemainingSize = [&stream]() -> AZ::u64
+        {
+            const AZ::IO::SizeType length = stream.GetLength();
+            const AZ::IO::SizeType position = stream.GetCurPos();
+            return length > position ? length - position : 0;
+        };
+        if (count > GetRemainingSize() / MinEntrySize)
+        {
+            return AZ::Failure(AZStd::string::format("Dictionary file claims %u dictionaries, but is too small to hold them.", count));
+        }
+
+        AZStd::string assetType;
+        AZStd::vector<AZ::u8> data;
+        for (AZ::u32 i = 0; i < count; ++i)
+        {
+            AZ::u32 assetTypeLength = 0;
+            AZ::s32 compressionLevel = 0;
+            AZ::u32 dataSize = 0;
+            if (!Read(stream, assetTypeLength))
+            {
+                m_dictionaries.clear();
+                return AZ::Failure(AZStd::string("Dictionary file is truncated."));
+            }
+            if (assetTypeLength > MaxAssetTypeLength || assetTypeLength > GetRemainingSize())
+            {
+                m_dictionaries.clear();
+                return AZ::Failure(AZStd::string::format("Dictionary file has an invalid asset type length of %u.", assetTypeLength));
+            }
+            assetType.resize_no_construct(assetTypeLength);
+            if (stream.Read(assetTypeLength, assetType.data()) != assetTypeLength || !Read(stream, compressionLevel) ||
+                !Read(stream, dataSize))
+            {
+                m_dictionaries.clear();
+                return AZ::Failure(AZStd::string("Dictionary file is truncated."));
+            }
+            if (dataSize > MaxDictionarySize || dataSize > GetRemainingSize())
+            {
+                m_dictionaries.clear();
+                return AZ::Failure(AZStd::string::format(
+                    "Dictionary for asset type '%s' has an invalid size of %u bytes.", assetType.c_str(), dataSize));
+            }
+            data.resize_no_construct(dataSize);
+            if (stream.Read(dataSize, data.data()) != dataSize)
+            {
+                m_dictionaries.clear();
+                return AZ::Failure(AZStd::string("Dictionary file is truncated."));
+            }
+
+            auto dictionary = AZStd::make_shared<ZStdDictionary>(data, compressionLevel);
+            if (!dictionary->IsValid())
+            {
+                m_dictionaries.clear();
+                return AZ::Failure(AZStd::string::format(
+                    "The dictionary for asset type '%s' couldn't be loaded.", assetType.c_str()));
+            }
+            AddDictionary(assetType, AZStd::move(dictionary));
+        }
+        return AZ::Success();
+    }
+} // namespace AZ
+
+#endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    //! A trained zstd dictionary, loaded once into prepared compression and decompression tables.
+    //! Small files of the same type share most of their structure, which compressing each file on its own can't exploit.
+    //! Compressing and decompressing them with a dictionary trained on files of that type brings their ratio close to
+    //! what compressing them together would give, while keeping every file independently decompressable.
+    //! Compress and Decompress are thread safe.
+    class ZStdDictionary
+    {
+    public:
+        static constexpr int DefaultCompressionLevel = 19;
+        //! Default capacity for trained dictionaries. zstd recommends about 100 times less than the total size of the samples.
+        static constexpr size_t DefaultMaxDictionarySize = 112640;
+
+        using Samples = AZStd::span<const AZStd::span<const AZ::u8>>;
+        using TrainOutcome = AZ::Outcome<AZStd::vector<AZ::u8>, AZStd::string>;
+
+        //! Trains a dictionary from a set of sample files. Training needs a reasonable number of samples, typically
+        //! a few hundred, and fails if the samples are too few or too small.
+        //! @return The raw dictionary data, which can be passed to the ZStdDictionary constructor.
+        static TrainOutcome TrainDictionary(Samples samples, size_t maxDictionarySize = DefaultMaxDictionarySize);
+
+        //! Prepares the dictionary for use. The dictionary data is copied.
+        //! @param compressionLevel The level used by Compress. Doesn't affect decompression.
+        ZStdDictionary(AZStd::span<const AZ::u8> dictionaryData, int compressionLevel = DefaultCompressionLevel,
+            IAllocator* workMemAllocator = nullptr);
+        ~ZStdDictionary();
+
+        ZStdDictionary(const ZStdDictionary&) = delete;
+        ZStdDictionary& operator=(const ZStdDictionary&) = delete;
+
+        //! Returns false if the dictionary data couldn't be loaded.
+        bool IsValid() const;
+        //! The id zstd stores in the dictionary and in every frame compressed with it.
+        AZ::u32 GetDictionaryId() const;
+        int GetCompressionLevel() const;
+        AZStd::span<const AZ::u8> GetDictionaryData() const;
+
+        //! Returns the size of the buffer needed to compress sourceDataSize bytes with Compress.
+        static size_t GetMinCompressedBufferSize(size_t sourceDataSize);
+
+        //! Compresses the data into a single zstd frame.
+        //! @return The size of the compressed frame, or 0 if compressing failed.
+        size_t Compress(const void* data, size_t dataSize, void* compressedData, size_t compressedDataSize) const;
+        //! Decompresses a frame that was compressed with this dictionary. The decompression context of the calling
+        //! thread is reused between calls, so the only per-call setup is resetting it.
+        //! @return True if the frame decompressed to exactly outputDataSize bytes.
+        bool Decompress(const void* compressedData, size_t compressedDataSize, void* outputData, size_t outputDataSize) const;
+
+    private:
+        static void* AllocateMem(void* userData, size_t size);
+        static void FreeMem(void* userData, void* address);
+
+        AZStd::vector<AZ::u8> m_dictionaryData;
+        IAllocator* m_workMemoryAllocator;
+        ZSTD_CDict* m_compressionDictionary{};
+        ZSTD_DDict* m_decompressionDictionary{};
+        AZ::u32 m_dictionaryId{};
+        int m_compressionLevel{};
+    };
+
+    //! The dictionaries of an archive, one per asset type, stored in a file next to the archive.
+    //! The asset bundler trains a dictionary for every asset type that has enough small files and saves the set next to
+    //! each bundle before adding files to it. AZ::IO::ZipDir::Cache loads the set when the archive is opened, compresses
+    //! files of those types with their dictionary and picks the dictionary to decompress an entry with from the dictionary
+    //! id zstd stores in the frame, so entries compressed without a dictionary keep working.
+    //! Asset types are identified by file extension, including the leading dot, e.g. ".azmaterial".
+    class ZStdDictionarySet
+    {
+    public:
+        //! Extension appended to the archive path to get the path of its dictionary file.
+        static constexpr AZStd::string_view DictionaryFileExtension = ".zdict";
+        //! Identifies a dictionary file and the version of its layout.
+        static constexpr AZStd::string_view FileMagic = "O3DEZDIC";
+        static constexpr AZ::u32 FileVersion = 1;
+        //! Limits Load enforces on the sizes read from a dictionary file before allocating anything for them.
+        static constexpr AZ::u32 MaxAssetTypeLength = 256;
+        static constexpr AZ::u32 MaxDictionarySize = 4 * 1024 * 1024;
+        //! Larger files gain little from a dictionary and are compressed without one.
+        static constexpr size_t MaxFileSize = 256 * 1024;
+
+        using LoadOutcome = AZ::Outcome<void, AZStd::string>;
+
+        //! Returns the path of the dictionary file stored alongside the archive, e.g. "level.pak.zdict" for "level.pak".
+        static AZ::IO::Path GetDictionaryPath(AZ::IO::PathView archivePath);
+
+        //! Trains a dictionary for the asset type from sample files of that type and adds it to the set, replacing
+        //! any previous dictionary for the type.
+        LoadOutcome TrainDictionary(AZStd::string_view assetType, ZStdDictionary::Samples samples,
+            size_t maxDictionarySize = ZStdDictionary::DefaultMaxDictionarySize,
+            int compressionLevel = ZStdDictionary::DefaultCompressionLevel);
+        void AddDictionary(AZStd::string_view assetType, AZStd::shared_ptr<const ZStdDictionary> dictionary);
+
+        //! Returns the dictionary for the asset type, or nullptr if the set doesn't have one.
+        AZStd::shared_ptr<const ZStdDictionary> FindDictionary(AZStd::string_view assetType) const;
+        //! Returns the dictionary for the asset type of the file, or nullptr if the set doesn't have one.
+        AZStd::shared_ptr<const ZStdDictionary> FindDictionaryForFile(AZ::IO::PathView filePath) const;
+        //! Returns the dictionary the zstd frame was compressed with, or nullptr if the frame was compressed without a
+        //! dictionary or with one that isn't in the set. The dictionary is owned by the set.
+        const ZStdDictionary* FindDictionaryForFrame(const void* compressedData, size_t compressedDataSize) const;
+
+        size_t GetDictionaryCount() const;
+        void Clear();
+
+        //! Writes all dictionaries to the stream.
+        bool Save(AZ::IO::GenericStream& stream) const;
+        //! Replaces the dictionaries in the set with the ones read from the stream and prepares them for use.
+        //! Fails without allocating if a size in the stream exceeds the data left in the stream or the limits above.
+        LoadOutcome Load(AZ::IO::GenericStream& stream);
+
+    private:
+        AZStd::unordered_map<AZStd::string, AZStd::shared_ptr<const ZStdDictionary>> m_dictionaries;
+    };
+} // namespace AZ
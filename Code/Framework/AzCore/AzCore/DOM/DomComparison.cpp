@@ -46,11 +46,17 @@ namespace AZ::Dom
         {
             desiredKeys.clear();
             Path subPath = path;
-            for (auto it = after.MemberBegin(); it != after.MemberEnd(); ++it)
+            size_t memberIndex = 0;
+            for (auto it = after.MemberBegin(); it != after.MemberEnd(); ++it, ++memberIndex)
             {
                 desiredKeys.insert(it->first.GetHash());
                 subPath.Push(it->first);
-                auto beforeIt = before.FindMember(it->first);
+                // Members usually keep their order, so check the member at the same position before searching for it.
+                auto beforeIt = before.MemberBegin() + AZStd::min(memberIndex, before.MemberCount());
+                if (beforeIt == before.MemberEnd() || beforeIt->first != it->first)
+                {
+                    beforeIt = before.FindMember(it->first);
+                }
                 if (beforeIt == before.MemberEnd())
                 {
                     AddPatch(PatchOperation::AddOperation(subPath, it->second), PatchOperation::RemoveOperation(subPath));
@@ -190,7 +196,63 @@ namespace AZ::Dom
             }
         };
 
-        entriesToCompare.emplace(Path(), beforeState, afterState);
+        if (params.m_dirtyPaths.empty())
+        {
+            entriesToCompare.emplace(Path(), beforeState, afterState);
+        }
+        else
+        {
+            // Compare each dirty path at the deepest entry that exists in both states. If an entry was added or removed, this
+            // is its parent, which will detect the addition or removal.
+            // Unlike Value::FindChild, this also handles paths that go through a value of a different type in one of the states.
+            auto findChild = [](const Value& root, const Path& path) -> const Value*
+            {
+                const Value* value = &root;
+                for (const PathEntry& entry : path)
+                {
+                    const bool canContainEntry =
+                        value->IsNode() || (entry.IsKey() ? value->IsObject() : value->IsArray());
+                    value = canContainEntry ? value->FindChild(entry) : nullptr;
+                    if (value == nullptr)
+                    {
+                        return nullptr;
+                    }
+                }
+                return value;
+            };
+
+            AZStd::vector<Path> roots;
+            roots.reserve(params.m_dirtyPaths.size());
+            for (const Path& dirtyPath : params.m_dirtyPaths)
+            {
+                Path root = dirtyPath;
+                while (!root.IsEmpty() && (findChild(beforeState, root) == nullptr || findChild(afterState, root) == nullptr))
+                {
+                    root.Pop();
+                }
+                roots.push_back(AZStd::move(root));
+            }
+
+            auto isSameOrParent = [](const Path& parent, const Path& path)
+            {
+                return parent.Size() <= path.Size() && AZStd::equal(parent.begin(), parent.end(), path.begin());
+            };
+
+            // Skip paths that are covered by another path, so every subtree is only compared once.
+            for (size_t i = 0; i < roots.size(); ++i)
+            {
+                bool isCovered = false;
+                for (size_t j = 0; j < roots.size() && !isCovered; ++j)
+                {
+                    isCovered = i != j && isSameOrParent(roots[j], roots[i]) && (roots[j] != roots[i] || j < i);
+                }
+                if (!isCovered)
+                {
+                    entriesToCompare.emplace(roots[i], *findChild(beforeState, roots[i]), *findChild(afterState, roots[i]));
+                }
+            }
+        }
+
         while (!entriesToCompare.empty())
         {
             PendingComparison& comparison = entriesToCompare.front();
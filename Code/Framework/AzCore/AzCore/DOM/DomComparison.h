@@ -37,11 +37,18 @@ namespace AZ::Dom
         /*! this is an optional function that specifies whether to allow generation of a delta replacement patch that replaces the
         *   entire \param before value with the \param after value once at least m_replaceThreshold changes have been detected */
         AZStd::function<bool(const Value& before, const Value& after)> m_allowReplacement;
+
+        //! If not empty, only the values at these paths are compared, instead of the whole documents. The caller guarantees
+        //! that the documents are identical outside of these paths, e.g. by recording the paths it modified.
+        //! If a path doesn't exist in one of the documents, its closest parent that exists in both is compared instead.
+        AZStd::vector<Path> m_dirtyPaths;
     };
 
     //! Generates a set of patches such that m_forwardPatches.Apply(beforeState) shall produce a document equivalent to afterState, and
     //! a subsequent m_inversePatches.Apply(beforeState) shall produce the original document. This patch generation strategy does a
     //! hierarchical comparison and is not guaranteed to create the minimal set of patches required to transform between the two states.
+    //! Only subtrees that share their storage are skipped without being compared, \see DeltaPatchGenerationParameters::m_dirtyPaths
+    //! for restricting the comparison of documents that don't.
     PatchUndoRedoInfo GenerateHierarchicalDeltaPatch(
         const Value& beforeState, const Value& afterState, const DeltaPatchGenerationParameters& params = {});
 } // namespace AZ::Dom
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Threading/EpochMutex.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * EBusEpochDispatchTraits is a custom mutex type and lock guards for read heavy buses that are dispatched from many threads
+     * at once, but where handlers rarely connect or disconnect.
+     *
+     * Unlike EBusSharedDispatchTraits, event dispatches don't touch any shared lock. Dispatches are readers of an AZ::EpochMutex,
+     * so each dispatching thread only registers itself in its own reader epoch counter. Bus connects / disconnects pay for this
+     * instead: they lock the EpochMutex exclusively, which waits for every in flight dispatch to leave its epoch before the
+     * handler list is modified.
+     *
+     * Features:
+     *   - Event dispatches execute in parallel without contending on a lock
+     *   - Bus connects / disconnects will only execute when no event dispatches are executing
+     *   - Event dispatches can call other event dispatches on the same bus recursively
+     *
+     * Limitations:
+     *   - Connects / disconnects are considerably more expensive than with the default mutex, as they have to wait for all
+     *     dispatches to finish. Only use this on buses where handlers connect and disconnect rarely.
+     *   - If the bus contains custom connect / disconnect logic, it must not call any event dispatches on the same bus.
+     *   - Bus connects / disconnects cannot happen within event dispatches on the same bus.
+     *
+     * Usage:
+     *   To use the traits, inherit from EBusEpochDispatchTraits<BusType>:
+     *      class MyBus : public AZ::EBusEpochDispatchTraits<MyBus>
+     */
+
+    // Custom mutex class that tracks in flight dispatches with an EpochMutex, which connects / disconnects lock exclusively,
+    // plus a separate mutex for callstack tracking thread protection.
+    class EBusEpochDispatchMutex
+    {
+    public:
+        // Threads are spread across this many reader counters. More threads than this still work, they just share counters.
+        static constexpr uint32_t ReaderSlotCount = EpochMutex::ReaderSlotCount;
+
+        EBusEpochDispatchMutex() = default;
+        ~EBusEpochDispatchMutex() = default;
+
+        void CallstackMutexLock()
+        {
+            m_callstackMutex.lock();
+        }
+
+        void CallstackMutexUnlock()
+        {
+            m_callstackMutex.unlock();
+        }
+
+        // Enters the dispatch epoch of the calling thread. Only blocks while a connect / disconnect is in progress.
+        void ReaderEnter()
+        {
+            m_epochMutex.lock_shared();
+        }
+
+        void ReaderExit()
+        {
+            m_epochMutex.unlock_shared();
+        }
+
+        // Blocks new dispatches and waits until all dispatches in flight have finished.
+        void WriterLock()
+        {
+            m_epochMutex.lock();
+        }
+
+        void WriterUnlock()
+        {
+            m_epochMutex.unlock();
+        }
+
+    private:
+        EpochMutex m_epochMutex;
+        AZStd::mutex m_callstackMutex;
+
+        // This custom mutex type should only be used with the lock guards below since it needs additional context to know which
+        // kind of lock to take. If you get a compile error due to these methods being private, the EBus declaration is likely
+        // missing one or more of the lock guards below.
+        void lock(){}
+        void unlock(){}
+    };
+
+    // Custom lock guard to handle Connection lock management.
+    // This takes the writer side of the mutex, which waits for every dispatch in flight to finish.
+    // It will assert and disallow connects / disconnects from inside of a dispatch on the same bus, as that would wait forever.
+    template<class EBusType>
+    class EBusEpochDispatchMutexConnectLockGuard
+    {
+    public:
+        EBusEpochDispatchMutexConnectLockGuard(EBusEpochDispatchMutex& mutex, AZStd::adopt_lock_t)
+            : m_mutex(mutex)
+        {
+        }
+
+        explicit EBusEpochDispatchMutexConnectLockGuard(EBusEpochDispatchMutex& mutex)
+            : m_mutex(mutex)
+        {
+            AZ_Assert(!EBusType::IsInDispatchThisThread(), "Can't connect/disconnect while inside an event dispatch.");
+            m_mutex.WriterLock();
+        }
+
+        ~EBusEpochDispatchMutexConnectLockGuard()
+        {
+            m_mutex.WriterUnlock();
+        }
+
+    private:
+        EBusEpochDispatchMutexConnectLockGuard(EBusEpochDispatchMutexConnectLockGuard const&) = delete;
+        EBusEpochDispatchMutexConnectLockGuard& operator=(EBusEpochDispatchMutexConnectLockGuard const&) = delete;
+        EBusEpochDispatchMutex& m_mutex;
+    };
+
+    // Custom lock guard to handle Dispatch lock management.
+    // Only the outermost dispatch on a thread enters the epoch. Nested dispatches are already covered by it, and re-entering
+    // could otherwise wait on a connect / disconnect that is itself waiting for the outer dispatch to finish.
+    template<class EBusType>
+    class EBusEpochDispatchMutexDispatchLockGuard
+    {
+    public:
+        EBusEpochDispatchMutexDispatchLockGuard(EBusEpochDispatchMutex& mutex, AZStd::adopt_lock_t)
+            : m_mutex(mutex)
+        {
+        }
+
+        explicit EBusEpochDispatchMutexDispatchLockGuard(EBusEpochDispatchMutex& mutex)
+            : m_mutex(mutex)
+        {
+            if (!EBusType::IsInDispatchThisThread())
+            {
+                m_ownEpochOnThread = true;
+                m_mutex.ReaderEnter();
+            }
+        }
+
+        ~EBusEpochDispatchMutexDispatchLockGuard()
+        {
+            if (m_ownEpochOnThread)
+            {
+                m_mutex.ReaderExit();
+            }
+        }
+
+    private:
+        EBusEpochDispatchMutexDispatchLockGuard(EBusEpochDispatchMutexDispatchLockGuard const&) = delete;
+        EBusEpochDispatchMutexDispatchLockGuard& operator=(EBusEpochDispatchMutexDispatchLockGuard const&) = delete;
+        EBusEpochDispatchMutex& m_mutex;
+        bool m_ownEpochOnThread = false;
+    };
+
+    // Custom lock guard to handle callstack tracking lock management.
+    // This uses a separate always-exclusive lock for the callstack tracking, which is only taken the first time a thread
+    // dispatches on the bus.
+    template<class EBusType>
+    class EBusEpochDispatchMutexCallstackLockGuard
+    {
+    public:
+        EBusEpochDispatchMutexCallstackLockGuard(EBusEpochDispatchMutex& mutex, AZStd::adopt_lock_t)
+            : m_mutex(mutex)
+        {
+        }
+
+        explicit EBusEpochDispatchMutexCallstackLockGuard(EBusEpochDispatchMutex& mutex)
+            : m_mutex(mutex)
+        {
+            m_mutex.CallstackMutexLock();
+        }
+
+        ~EBusEpochDispatchMutexCallstackLockGuard()
+        {
+            m_mutex.CallstackMutexUnlock();
+        }
+
+    private:
+        EBusEpochDispatchMutexCallstackLockGuard(EBusEpochDispatchMutexCallstackLockGuard const&) = delete;
+        EBusEpochDispatchMutexCallstackLockGuard& operator=(EBusEpochDispatchMutexCallstackLockGuard const&) = delete;
+        EBusEpochDispatchMutex& m_mutex;
+    };
+
+    // The EBusTraits that can be inherited from to automatically set up the MutexType and LockGuards.
+    // To inherit, use "class MyBus : public AZ::EBusEpochDispatchTraits<MyBus>"
+    template<class BusType>
+    struct EBusEpochDispatchTraits : EBusTraits
+    {
+        using MutexType = AZ::EBusEpochDispatchMutex;
+
+        template<typename MutexType, bool IsLocklessDispatch>
+        using DispatchLockGuard = AZ::EBusEpochDispatchMutexDispatchLockGuard<AZ::EBus<BusType>>;
+
+        template<typename MutexType>
+        using ConnectLockGuard = AZ::EBusEpochDispatchMutexConnectLockGuard<AZ::EBus<BusType>>;
+
+        template<typename MutexType>
+        using BindLockGuard = AZ::EBusEpochDispatchMutexConnectLockGuard<AZ::EBus<BusType>>;
+
+        template<typename MutexType>
+        using CallstackTrackerLockGuard = AZ::EBusEpochDispatchMutexCallstackLockGuard<AZ::EBus<BusType>>;
+    };
+
+} // namespace AZ
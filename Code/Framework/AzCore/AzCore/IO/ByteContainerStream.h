@@ -80,6 +80,11 @@ namespace AZ::IO
             return IsOpen() ? m_buffer : nullptr;
         }
 
+        const void* GetContiguousData() const override
+        {
+            return IsOpen() ? m_buffer->data() : nullptr;
+        }
+
         bool ReOpen() override
         {
             AZ_Warning("ByteContainerStream", IsOpen(), "The stream is already open."
@@ -48,6 +48,9 @@ namespace AZ::IO
         virtual SizeType    ReadAtOffset(SizeType bytes, void* oBuffer, OffsetType offset = -1);
         virtual SizeType    WriteAtOffset(SizeType bytes, const void* iBuffer, OffsetType offset = -1);
         virtual bool        IsCompressed() const { return false; }
+        //! Returns the start of the stream contents if they can be addressed directly in memory, for instance when the stream
+        //! wraps a memory buffer or a memory mapped file, otherwise null. Readers can use this to avoid copying the data.
+        virtual const void* GetContiguousData() const { return nullptr; }
         virtual const char* GetFilename() const { return ""; }
         virtual OpenMode    GetModeFlags() const { return OpenMode(); }
         virtual bool        ReOpen() { return true; }
@@ -149,6 +152,7 @@ namespace AZ::IO
         SizeType    Write(SizeType bytes, const void* iBuffer) override;
         SizeType    WriteFromStream(SizeType bytes, GenericStream* inputStream) override;
         virtual const void* GetData() const { return m_buffer; }
+        const void* GetContiguousData() const override { return m_buffer; }
         SizeType    GetCurPos() const override { return m_curOffset; }
         SizeType    GetLength() const override { return m_curLen; }
 
@@ -46,7 +46,8 @@ namespace AZ::IO
         }
 
         auto stackEntry = AZStd::make_shared<BlockCache>(
-            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false);
+            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false,
+            m_evictionPolicy);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -61,15 +62,22 @@ namespace AZ::IO
                 ->Value("MemoryAlignment", BlockSize::MemoryAlignment)
                 ->Value("SizeAlignment", BlockSize::SizeAlignment);
 
-            serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
+            serializeContext->Enum<EvictionPolicy>()
                 ->Version(1)
+                ->Value("LRU", EvictionPolicy::LeastRecentlyUsed)
+                ->Value("2Q", EvictionPolicy::TwoQueue);
+
+            serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
+                ->Version(2)
                 ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
-                ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
+                ->Field("BlockSize", &BlockCacheConfig::m_blockSize)
+                ->Field("EvictionPolicy", &BlockCacheConfig::m_evictionPolicy);
         }
     }
 
     static constexpr char CacheHitRateName[] = "Cache hit rate";
     static constexpr char CacheableName[] = "Cacheable";
+    static constexpr char LookupCostName[] = "Lookup cost";
 
     void BlockCache::Section::Prefix(const Section& section)
     {
@@ -99,10 +107,11 @@ namespace AZ::IO
         m_blockOffset = 0; // Two merged sections do not support caching.
     }
 
-    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, EvictionPolicy evictionPolicy)
         : StreamStackEntry("Block cache")
         , m_alignment(alignment)
         , m_onlyEpilogWrites(onlyEpilogWrites)
+        , m_evictionPolicy(evictionPolicy)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
         AZ_Assert(IStreamerTypes::IsAlignedTo(blockSize, alignment), "Block size needs to be a multiple of the alignment.");
@@ -119,8 +128,15 @@ namespace AZ::IO
             m_cacheSize, alignment));
         m_cachedPaths = AZStd::unique_ptr<RequestPath[]>(new RequestPath[m_numBlocks]);
         m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
-        m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
         m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+        m_blockQueues = AZStd::unique_ptr<BlockQueue[]>(new BlockQueue[m_numBlocks]);
+        m_blockOlder = AZStd::unique_ptr<u32[]>(new u32[m_numBlocks]);
+        m_blockNewer = AZStd::unique_ptr<u32[]>(new u32[m_numBlocks]);
+
+        // Use the common 2Q tuning of a quarter of the cache for probation and remember recycled blocks for half the cache size.
+        m_maxProbationBlocks = AZStd::max(m_numBlocks / 4, 1u);
+        m_maxGhostEntries = AZStd::max(m_numBlocks / 2, 1u);
+        m_blockIndex.rehash(m_numBlocks);
 
         ResetCache();
     }
@@ -390,6 +406,10 @@ namespace AZ::IO
             "The percentage of requests that were candidates for caching. The percentage of requests that could be (partially) serviced "
             "with cached data. When running from loose files a lower value is better as it indicate full file reads. When running from "
             "archives higher values are better as it indicates better scheduling efficiency and/or better archive layouts."));
+        statistics.push_back(Statistic::CreateFloatRange(
+            m_name, LookupCostName, CalculateAverageLookupCost(), m_lookupCostStat.GetMinimum(), m_lookupCostStat.GetMaximum(),
+            "The average number of cache blocks that had to be inspected to find a block in the cache. This should be close to 1. "
+            "Higher values indicate hash collisions between file paths and offsets."));
         statistics.push_back(Statistic::CreateInteger(
             m_name, "Available slots", CalculateAvailableRequestSlots(),
             "The total number of slots available to processing cache-able requests with. If this value is low more memory may need to be "
@@ -408,6 +428,11 @@ namespace AZ::IO
         return m_cacheableStat.GetAverage();
     }
 
+    double BlockCache::CalculateAverageLookupCost() const
+    {
+        return m_lookupCostStat.GetAverage();
+    }
+
     s32 BlockCache::CalculateAvailableRequestSlots() const
     {
         return  aznumeric_cast<s32>(m_numBlocks) - m_numInFlightRequests - m_numMetaDataRetrievalInProgress -
@@ -688,51 +713,190 @@ namespace AZ::IO
     void BlockCache::TouchBlock(u32 index)
     {
         AZ_Assert(index < m_numBlocks, "Index for touch a cache entry in the BlockCache is out of bounds.");
-        m_blockLastTouched[index] = AZStd::chrono::steady_clock::now();
+        // Blocks in probation are recycled in the order they were cached, so only blocks in the protected queue move up.
+        if (m_blockQueues[index] == BlockQueue::Protected)
+        {
+            UnlinkBlock(index);
+            LinkBlock(index, BlockQueue::Protected);
+        }
     }
 
     u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
     {
         AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
 
-        // Find the oldest cache block.
-        TimePoint oldest = m_blockLastTouched[0];
-        u32 oldestIndex = 0;
-        for (u32 i = 1; i < m_numBlocks; ++i)
+        u32 index = FindOldestBlock(BlockQueue::Free);
+        if (index == s_fileNotCached)
         {
-            if (m_blockLastTouched[i] < oldest && !m_inFlightRequests[i])
+            if (m_evictionPolicy == EvictionPolicy::TwoQueue &&
+                m_blockLists[static_cast<size_t>(BlockQueue::Probation)].m_count >= m_maxProbationBlocks)
             {
-                oldest = m_blockLastTouched[i];
-                oldestIndex = i;
+                // Keep recycling blocks from probation while it's at capacity so a sweep through a file only replaces blocks
+                // that were part of the same sweep.
+                index = FindOldestBlock(BlockQueue::Probation);
             }
+            if (index == s_fileNotCached)
+            {
+                index = FindOldestBlock(BlockQueue::Protected);
+            }
+            if (index == s_fileNotCached)
+            {
+                index = FindOldestBlock(BlockQueue::Probation);
+            }
+            if (index == s_fileNotCached)
+            {
+                // All blocks are waiting for data to be read.
+                return s_fileNotCached;
+            }
+        }
+
+        if (m_blockQueues[index] == BlockQueue::Probation)
+        {
+            AddToGhostQueue(CalculateBlockKey(m_cachedPaths[index], m_cachedOffsets[index]));
         }
+        RemoveFromIndex(index);
+        UnlinkBlock(index);
 
-        if (!IsCacheBlockInFlight(oldestIndex))
+        // Recycle the block.
+        size_t blockKey = CalculateBlockKey(filePath, offset);
+        m_cachedPaths[index] = filePath;
+        m_cachedOffsets[index] = offset;
+        m_blockIndex.emplace(blockKey, index);
+
+        // With 2Q only blocks that were recently recycled from probation and are requested again have proven to be reused.
+        bool isReused = m_evictionPolicy == EvictionPolicy::LeastRecentlyUsed || TakeFromGhostQueue(blockKey);
+        LinkBlock(index, isReused ? BlockQueue::Protected : BlockQueue::Probation);
+        return index;
+    }
+
+    u32 BlockCache::FindOldestBlock(BlockQueue queue) const
+    {
+        // Blocks that are in-flight were recently added so searching from the back will typically find a block immediately.
+        u32 index = m_blockLists[static_cast<size_t>(queue)].m_tail;
+        while (index != s_fileNotCached && IsCacheBlockInFlight(index))
+        {
+            index = m_blockNewer[index];
+        }
+        return index;
+    }
+
+    void BlockCache::LinkBlock(u32 index, BlockQueue queue)
+    {
+        BlockList& list = m_blockLists[static_cast<size_t>(queue)];
+        m_blockQueues[index] = queue;
+        m_blockNewer[index] = s_fileNotCached;
+        m_blockOlder[index] = list.m_head;
+        if (list.m_head != s_fileNotCached)
         {
-            // Recycle the block.
-            m_cachedPaths[oldestIndex] = filePath;
-            m_cachedOffsets[oldestIndex] = offset;
-            TouchBlock(oldestIndex);
-            return oldestIndex;
+            m_blockNewer[list.m_head] = index;
         }
         else
         {
-            return s_fileNotCached;
+            list.m_tail = index;
         }
+        list.m_head = index;
+        list.m_count++;
     }
 
-    u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset) const
+    void BlockCache::UnlinkBlock(u32 index)
+    {
+        BlockList& list = m_blockLists[static_cast<size_t>(m_blockQueues[index])];
+        AZ_Assert(list.m_count > 0, "Unlinking cache block %u from an empty queue.", index);
+
+        u32 older = m_blockOlder[index];
+        u32 newer = m_blockNewer[index];
+        if (newer != s_fileNotCached)
+        {
+            m_blockOlder[newer] = older;
+        }
+        else
+        {
+            list.m_head = older;
+        }
+        if (older != s_fileNotCached)
+        {
+            m_blockNewer[older] = newer;
+        }
+        else
+        {
+            list.m_tail = newer;
+        }
+        m_blockOlder[index] = s_fileNotCached;
+        m_blockNewer[index] = s_fileNotCached;
+        list.m_count--;
+    }
+
+    u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset)
     {
         AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to find a block in the block cache needs to be a multiple of the block size.");
-        for (u32 i = 0; i < m_numBlocks; ++i)
+
+        u32 result = s_fileNotCached;
+        u32 numCompared = 0;
+        auto range = m_blockIndex.equal_range(CalculateBlockKey(filePath, offset));
+        for (auto it = range.first; it != range.second; ++it)
         {
-            if (m_cachedPaths[i] == filePath && m_cachedOffsets[i] == offset)
+            numCompared++;
+            u32 index = it->second;
+            if (m_cachedOffsets[index] == offset && m_cachedPaths[index] == filePath)
             {
-                return i;
+                result = index;
+                break;
             }
         }
 
-        return s_fileNotCached;
+        m_lookupCostStat.PushSample(aznumeric_cast<double>(numCompared));
+        Statistic::PlotImmediate(m_name, LookupCostName, m_lookupCostStat.GetMostRecentSample());
+        return result;
+    }
+
+    size_t BlockCache::CalculateBlockKey(const RequestPath& filePath, u64 offset)
+    {
+        size_t key = filePath.GetHash();
+        AZStd::hash_combine(key, offset);
+        return key;
+    }
+
+    void BlockCache::RemoveFromIndex(u32 index)
+    {
+        if (m_blockQueues[index] == BlockQueue::Free)
+        {
+            return;
+        }
+
+        auto range = m_blockIndex.equal_range(CalculateBlockKey(m_cachedPaths[index], m_cachedOffsets[index]));
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == index)
+            {
+                m_blockIndex.erase(it);
+                return;
+            }
+        }
+        AZ_Assert(false, "Cache block %u is in use but wasn't found in the block cache index.", index);
+    }
+
+    void BlockCache::AddToGhostQueue(size_t blockKey)
+    {
+        // Ghost entries only store the key, not the data. Two different blocks with the same key will only cause a block to be
+        // considered reused early, which doesn't affect correctness.
+        if (m_ghostQueue.size() >= m_maxGhostEntries)
+        {
+            auto [oldestKey, oldestSequence] = m_ghostQueue.front();
+            if (auto it = m_ghostLookup.find(oldestKey); it != m_ghostLookup.end() && it->second == oldestSequence)
+            {
+                m_ghostLookup.erase(it);
+            }
+            m_ghostQueue.pop_front();
+        }
+        u64 sequence = m_ghostSequence++;
+        m_ghostQueue.emplace_back(blockKey, sequence);
+        m_ghostLookup[blockKey] = sequence;
+    }
+
+    bool BlockCache::TakeFromGhostQueue(size_t blockKey)
+    {
+        // The entry in the ghost queue is left behind and will be ignored once it reaches the front as the sequence no longer matches.
+        return m_ghostLookup.erase(blockKey) != 0;
     }
 
     bool BlockCache::IsCacheBlockInFlight(u32 index) const
@@ -745,17 +909,29 @@ namespace AZ::IO
     {
         AZ_Assert(index < m_numBlocks, "Index for resetting a cache entry in the BlockCache is out of bounds.");
 
+        RemoveFromIndex(index);
+        UnlinkBlock(index);
         m_cachedPaths[index].Clear();
         m_cachedOffsets[index] = 0;
-        m_blockLastTouched[index] = TimePoint::min();
         m_inFlightRequests[index] = nullptr;
+        LinkBlock(index, BlockQueue::Free);
     }
 
     void BlockCache::ResetCache()
     {
+        m_blockIndex.clear();
+        m_ghostQueue.clear();
+        m_ghostLookup.clear();
+        for (BlockList& list : m_blockLists)
+        {
+            list = BlockList{};
+        }
         for (u32 i = 0; i < m_numBlocks; ++i)
         {
-            ResetCacheEntry(i);
+            m_cachedPaths[i].Clear();
+            m_cachedOffsets[i] = 0;
+            m_inFlightRequests[i] = nullptr;
+            LinkBlock(i, BlockQueue::Free);
         }
         m_numInFlightRequests = 0;
     }
@@ -783,6 +959,10 @@ namespace AZ::IO
             data.m_output.push_back(Statistic::CreateBoolean(
                 m_name, "Only epilog writes", m_onlyEpilogWrites,
                 "Whether or not only the epilog is considered or that both prolog and epilog are used for caching."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Eviction policy", m_evictionPolicy == EvictionPolicy::TwoQueue ? AZStd::string_view("2Q") : AZStd::string_view("LRU"),
+                "The policy used to pick the cache block to recycle. LRU recycles the block that was least recently used. 2Q keeps "
+                "blocks that have been reused apart from newly cached blocks so reading through a large file doesn't flush the cache."));
             data.m_output.push_back(Statistic::CreateReferenceString(
                 m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
                 "The name of the node that follows this node or none."));
@@ -51,17 +51,34 @@ namespace AZ::IO
             SizeAlignment = MemoryAlignment - 1 //!< The minimal read size required by the storage device.
         };
 
+        //! The policy used to pick the cache block that will be recycled when a new block needs to be cached.
+        enum class EvictionPolicy : u8
+        {
+            //! Recycle the block that was least recently read from.
+            LeastRecentlyUsed,
+            //! Simplified 2Q. Newly cached blocks go into a probation queue that's recycled in first-in-first-out order. Blocks
+            //! that are requested again shortly after being recycled from probation are moved to a protected queue that's
+            //! recycled in least-recently-used order. This prevents a single sweep through a large file from flushing blocks
+            //! that are frequently reused.
+            TwoQueue
+        };
+
         //! The overall size of the cache in megabytes.
         u32 m_cacheSizeMib{ 8 };
         //! The size of the individual blocks inside the cache.
         BlockSize m_blockSize{ BlockSize::MemoryAlignment };
+        //! The policy used to determine which cache block to recycle.
+        EvictionPolicy m_evictionPolicy{ EvictionPolicy::LeastRecentlyUsed };
     };
 
     class BlockCache
         : public StreamStackEntry
     {
     public:
-        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+        using EvictionPolicy = BlockCacheConfig::EvictionPolicy;
+
+        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+            EvictionPolicy evictionPolicy = EvictionPolicy::LeastRecentlyUsed);
         BlockCache(BlockCache&& rhs) = delete;
         BlockCache(const BlockCache& rhs) = delete;
         ~BlockCache() override;
@@ -85,11 +102,30 @@ namespace AZ::IO
 
         double CalculateHitRatePercentage() const;
         double CalculateCacheableRatePercentage() const;
+        double CalculateAverageLookupCost() const;
         s32 CalculateAvailableRequestSlots() const;
 
     protected:
         static constexpr u32 s_fileNotCached = static_cast<u32>(-1);
 
+        //! The queue a cache block is assigned to. With LeastRecentlyUsed all cached blocks are in the Protected queue.
+        enum class BlockQueue : u8
+        {
+            Free, //!< The block doesn't hold any data.
+            Probation, //!< The block was recently cached and hasn't proven to be reused yet. Only used by 2Q.
+            Protected, //!< The block holds data that's been requested more than once.
+
+            Count
+        };
+
+        //! Intrusive doubly linked list of cache blocks. The head holds the most recently added or touched block.
+        struct BlockList
+        {
+            u32 m_head{ s_fileNotCached };
+            u32 m_tail{ s_fileNotCached };
+            u32 m_count{ 0 };
+        };
+
         enum class CacheResult
         {
             ReadFromCache, //!< Data was found in the cache and reused.
@@ -114,8 +150,6 @@ namespace AZ::IO
             void Prefix(const Section& section);
         };
 
-        using TimePoint = AZStd::chrono::steady_clock::time_point;
-
         void ReadFile(FileRequest* request, Requests::ReadData& data);
         void ContinueReadFile(FileRequest* request, u64 fileLength);
         CacheResult ReadFromCache(FileRequest* request, Section& section, const RequestPath& filePath);
@@ -128,7 +162,14 @@ namespace AZ::IO
         u8* GetCacheBlockData(u32 index);
         void TouchBlock(u32 index);
         AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset);
-        u32 FindInCache(const RequestPath& filePath, u64 offset) const;
+        u32 FindOldestBlock(BlockQueue queue) const;
+        void LinkBlock(u32 index, BlockQueue queue);
+        void UnlinkBlock(u32 index);
+        u32 FindInCache(const RequestPath& filePath, u64 offset);
+        static size_t CalculateBlockKey(const RequestPath& filePath, u64 offset);
+        void RemoveFromIndex(u32 index);
+        void AddToGhostQueue(size_t blockKey);
+        bool TakeFromGhostQueue(size_t blockKey);
         bool IsCacheBlockInFlight(u32 index) const;
         void ResetCacheEntry(u32 index);
         void ResetCache();
@@ -142,6 +183,17 @@ namespace AZ::IO
 
         AZ::Statistics::RunningStatistic m_hitRateStat;
         AZ::Statistics::RunningStatistic m_cacheableStat;
+        //! The number of cache blocks that had to be compared for a single lookup.
+        AZ::Statistics::RunningStatistic m_lookupCostStat;
+
+        //! Index from the combined hash of a file path and block offset to the cache block holding that data. Multiple blocks can
+        //! share the same key, so the path and offset of a found block still need to be compared.
+        AZStd::unordered_multimap<size_t, u32> m_blockIndex;
+        //! Keys of blocks that were recently recycled from the probation queue, in the order they were recycled. Only used by 2Q.
+        AZStd::deque<AZStd::pair<size_t, u64>> m_ghostQueue;
+        //! Lookup for the keys in the ghost queue and the sequence number of their latest entry in the ghost queue.
+        AZStd::unordered_map<size_t, u64> m_ghostLookup;
+        u64 m_ghostSequence{ 0 };
 
         u8* m_cache;
         u64 m_cacheSize;
@@ -153,19 +205,32 @@ namespace AZ::IO
         AZStd::unique_ptr<RequestPath[]> m_cachedPaths; // Array of m_numBlocks size.
         //! The offset into the file the cache blocks starts at.
         AZStd::unique_ptr<u64[]> m_cachedOffsets; // Array of m_numBlocks size.
-        //! The last time the cache block was read from.
-        AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
         //! The file request that's currently read data into the cache block. If null, the block has been read.
         AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+        //! The eviction queue the cache block is currently assigned to.
+        AZStd::unique_ptr<BlockQueue[]> m_blockQueues; // Array of m_numBlocks size.
+        //! The next older block in the same eviction queue.
+        AZStd::unique_ptr<u32[]> m_blockOlder; // Array of m_numBlocks size.
+        //! The next newer block in the same eviction queue.
+        AZStd::unique_ptr<u32[]> m_blockNewer; // Array of m_numBlocks size.
+        //! The blocks in each of the eviction queues, ordered from newest to oldest.
+        BlockList m_blockLists[static_cast<size_t>(BlockQueue::Count)];
+
+        //! The maximum number of blocks that can be in probation before probation blocks are recycled first. Only used by 2Q.
+        u32 m_maxProbationBlocks;
+        //! The maximum number of keys kept in the ghost queue. Only used by 2Q.
+        u32 m_maxGhostEntries;
 
         //! The number of requests waiting for meta data to be retrieved.
         s32 m_numMetaDataRetrievalInProgress{ 0 };
         //! Whether or not only the epilog ever writes to the cache.
         bool m_onlyEpilogWrites;
+        EvictionPolicy m_evictionPolicy;
     };
 } // namespace AZ::IO
 
 namespace AZ
 {
     AZ_TYPE_INFO_SPECIALIZE(AZ::IO::BlockCacheConfig::BlockSize, "{5D4D597D-4605-462D-A27D-8046115C5381}");
+    AZ_TYPE_INFO_SPECIALIZE(AZ::IO::BlockCacheConfig::EvictionPolicy, "{D2F58E40-3C0B-4B8E-9A0B-6E4C1F7A92D5}");
 } // namespace AZ
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Transform.h>
+
+namespace AZ::BatchMath
+{
+    namespace
+    {
+        using Simd::Vec8;
+
+        template<typename T>
+        bool IsValid(const Vector3View<T>& view)
+        {
+            return view.m_x.size() == view.m_y.size() && view.m_x.size() == view.m_z.size();
+        }
+
+        template<typename T>
+        bool IsValid(const AabbView<T>& view)
+        {
+            return IsValid(view.m_min) && IsValid(view.m_max) && view.m_min.size() == view.m_max.size();
+        }
+
+        template<typename T>
+        bool IsValid(const SphereView<T>& view)
+        {
+            return IsValid(view.m_center) && view.m_center.size() == view.m_radius.size();
+        }
+
+        //! The elements of a 3x4 matrix, each splatted across all lanes.
+        struct SplatMatrix3x4
+        {
+            explicit SplatMatrix3x4(const Matrix3x4& matrix)
+            {
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    for (int32_t col = 0; col < 4; ++col)
+                    {
+                        m_elements[row][col] = Vec8::Splat(matrix.GetElement(row, col));
+                    }
+                }
+            }
+
+            Vec8::FloatType m_elements[3][4];
+        };
+
+        //! The planes of a frustum, each component splatted across all lanes.
+        struct SplatFrustumPlanes
+        {
+            explicit SplatFrustumPlanes(const Frustum& frustum)
+            {
+                for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Plane plane = frustum.GetPlane(planeId);
+                    const Vector3 normal = plane.GetNormal();
+                    const Vector3 absNormal = normal.GetAbs();
+                    m_normal[planeId][0] = Vec8::Splat(normal.GetX());
+                    m_normal[planeId][1] = Vec8::Splat(normal.GetY());
+                    m_normal[planeId][2] = Vec8::Splat(normal.GetZ());
+                    m_absNormal[planeId][0] = Vec8::Splat(absNormal.GetX());
+                    m_absNormal[planeId][1] = Vec8::Splat(absNormal.GetY());
+                    m_absNormal[planeId][2] = Vec8::Splat(absNormal.GetZ());
+                    m_distance[planeId] = Vec8::Splat(plane.GetDistance());
+                }
+            }
+
+            Vec8::FloatType GetPointDist(int32_t planeId, Vec8::FloatArgType x, Vec8::FloatArgType y, Vec8::FloatArgType z) const
+            {
+                const Vec8::FloatType* normal = m_normal[planeId];
+                return Vec8::Madd(normal[2], z, Vec8::Madd(normal[1], y, Vec8::Madd(normal[0], x, m_distance[planeId])));
+            }
+
+            Vec8::FloatType m_normal[Frustum::PlaneId::MAX][3];
+            Vec8::FloatType m_absNormal[Frustum::PlaneId::MAX][3];
+            Vec8::FloatType m_distance[Frustum::PlaneId::MAX];
+        };
+
+        //! Converts a lane mask from a compare into one bit per lane.
+        uint32_t GetLaneBits(Vec8::FloatArgType mask)
+        {
+            alignas(32) static const int32_t laneBits[Vec8::ElementCount] = { 1 << 0, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+            alignas(32) int32_t bits[Vec8::ElementCount];
+            Vec8::StoreAligned(bits, Vec8::And(Vec8::CastToInt(mask), Vec8::LoadAligned(laneBits)));
+            return static_cast<uint32_t>(bits[0] | bits[1] | bits[2] | bits[3] | bits[4] | bits[5] | bits[6] | bits[7]);
+        }
+
+        void SetMaskBits(AZStd::span<uint32_t> outMask, size_t index, uint32_t bits)
+        {
+            outMask[index / 32] |= bits << (index % 32);
+        }
+
+        size_t ResetMask(AZStd::span<uint32_t> outMask, size_t elementCount)
+        {
+            const size_t wordCount = GetMaskWordCount(elementCount);
+            AZ_Assert(outMask.size() >= wordCount, "The mask must hold at least %zu words for %zu elements", wordCount, elementCount);
+            for (size_t word = 0; word < wordCount; ++word)
+            {
+                outMask[word] = 0;
+            }
+            return wordCount;
+        }
+
+        size_t CountMaskBits(AZStd::span<const uint32_t> mask)
+        {
+            size_t count = 0;
+            for (uint32_t word : mask)
+            {
+                count += az_popcnt_u32(word);
+            }
+            return count;
+        }
+
+        template<bool IncludeTranslation>
+        void TransformVector3s(const Matrix3x4& matrix, ConstVector3Span in, Vector3Span out)
+        {
+            AZ_Assert(IsValid(in) && IsValid(out), "All components of a Vector3 span must have the same size");
+            AZ_Assert(in.size() == out.size(), "Input and output spans must have the same size");
+
+            const SplatMatrix3x4 splat(matrix);
+            const size_t count = in.size();
+            size_t index = 0;
+            for (; index + Vec8::ElementCount <= count; index += Vec8::ElementCount)
+            {
+                const Vec8::FloatType x = Vec8::LoadUnaligned(in.m_x.data() + index);
+                const Vec8::FloatType y = Vec8::LoadUnaligned(in.m_y.data() + index);
+                const Vec8::FloatType z = Vec8::LoadUnaligned(in.m_z.data() + index);
+
+                Vec8::FloatType result[3];
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    const Vec8::FloatType* elements = splat.m_elements[row];
+                    Vec8::FloatType sum = IncludeTranslation ? Vec8::Madd(elements[0], x, elements[3]) : Vec8::Mul(elements[0], x);
+                    sum = Vec8::Madd(elements[1], y, sum);
+                    result[row] = Vec8::Madd(elements[2], z, sum);
+                }
+
+                Vec8::StoreUnaligned(out.m_x.data() + index, result[0]);
+                Vec8::StoreUnaligned(out.m_y.data() + index, result[1]);
+                Vec8::StoreUnaligned(out.m_z.data() + index, result[2]);
+            }
+
+            for (; index < count; ++index)
+            {
+                const Vector3 value(in.m_x[index], in.m_y[index], in.m_z[index]);
+                const Vector3 result = IncludeTranslation ? matrix.TransformPoint(value) : matrix.Multiply3x3(value);
+                out.m_x[index] = result.GetX();
+                out.m_y[index] = result.GetY();
+                out.m_z[index] = result.GetZ();
+            }
+        }
+    }
+
+    void TransformPoints(const Transform& transform, ConstVector3Span points, Vector3Span outPoints)
+    {
+        TransformVector3s<true>(Matrix3x4::CreateFromTransform(transform), points, outPoints);
+    }
+
+    void TransformPoints(const Matrix3x4& matrix, ConstVector3Span points, Vector3Span outPoints)
+    {
+        TransformVector3s<true>(matrix, points, outPoints);
+    }
+
+    void TransformVectors(const Transform& transform, ConstVector3Span vectors, Vector3Span outVectors)
+    {
+        TransformVector3s<false>(Matrix3x4::CreateFromTransform(transform), vectors, outVectors);
+    }
+
+    void TransformVectors(const Matrix3x4& matrix, ConstVector3Span vectors, Vector3Span outVectors)
+    {
+        TransformVector3s<false>(matrix, vectors, outVectors);
+    }
+
+    void TransformAabbs(const Transform& transform, ConstAabbSpan aabbs, AabbSpan outAabbs)
+    {
+        TransformAabbs(Matrix3x4::CreateFromTransform(transform), aabbs, outAabbs);
+    }
+
+    void TransformAabbs(const Matrix3x4& matrix, ConstAabbSpan aabbs, AabbSpan outAabbs)
+    {
+        AZ_Assert(IsValid(aabbs) && IsValid(outAabbs), "All components of an Aabb span must have the same size");
+        AZ_Assert(aabbs.size() == outAabbs.size(), "Input and output spans must have the same size");
+
+        // See Aabb::ApplyMatrix3x4, the contributions of each axis are independent so the min and max of each can be summed.
+        const SplatMatrix3x4 splat(matrix);
+        const size_t count = aabbs.size();
+        size_t index = 0;
+        for (; index + Vec8::ElementCount <= count; index += Vec8::ElementCount)
+        {
+            const Vec8::FloatType min[3] = { Vec8::LoadUnaligned(aabbs.m_min.m_x.data() + index),
+                                             Vec8::LoadUnaligned(aabbs.m_min.m_y.data() + index),
+                                             Vec8::LoadUnaligned(aabbs.m_min.m_z.data() + index) };
+            const Vec8::FloatType max[3] = { Vec8::LoadUnaligned(aabbs.m_max.m_x.data() + index),
+                                             Vec8::LoadUnaligned(aabbs.m_max.m_y.data() + index),
+                                             Vec8::LoadUnaligned(aabbs.m_max.m_z.data() + index) };
+
+            Vec8::FloatType newMin[3];
+            Vec8::FloatType newMax[3];
+            for (int32_t row = 0; row < 3; ++row)
+            {
+                newMin[row] = splat.m_elements[row][3];
+                newMax[row] = splat.m_elements[row][3];
+                for (int32_t col = 0; col < 3; ++col)
+                {
+                    const Vec8::FloatType fromMin = Vec8::Mul(splat.m_elements[row][col], min[col]);
+                    const Vec8::FloatType fromMax = Vec8::Mul(splat.m_elements[row][col], max[col]);
+                    newMin[row] = Vec8::Add(newMin[row], Vec8::Min(fromMin, fromMax));
+                    newMax[row] = Vec8::Add(newMax[row], Vec8::Max(fromMin, fromMax));
+                }
+            }
+
+            Vec8::StoreUnaligned(outAabbs.m_min.m_x.data() + index, newMin[0]);
+            Vec8::StoreUnaligned(outAabbs.m_min.m_y.data() + index, newMin[1]);
+            Vec8::StoreUnaligned(outAabbs.m_min.m_z.data() + index, newMin[2]);
+            Vec8::StoreUnaligned(outAabbs.m_max.m_x.data() + index, newMax[0]);
+            Vec8::StoreUnaligned(outAabbs.m_max.m_y.data() + index, newMax[1]);
+            Vec8::StoreUnaligned(outAabbs.m_max.m_z.data() + index, newMax[2]);
+        }
+
+        for (; index < count; ++index)
+        {
+            const Aabb aabb = Aabb::CreateFromMinMaxValues(
+                aabbs.m_min.m_x[index], aabbs.m_min.m_y[index], aabbs.m_min.m_z[index],
+                aabbs.m_max.m_x[index], aabbs.m_max.m_y[index], aabbs.m_max.m_z[index]).GetTransformedAabb(matrix);
+            outAabbs.m_min.m_x[index] = aabb.GetMin().GetX();
+            outAabbs.m_min.m_y[index] = aabb.GetMin().GetY();
+            outAabbs.m_min.m_z[index] = aabb.GetMin().GetZ();
+            outAabbs.m_max.m_x[index] = aabb.GetMax().GetX();
+            outAabbs.m_max.m_y[index] = aabb.GetMax().GetY();
+            outAabbs.m_max.m_z[index] = aabb.GetMax().GetZ();
+        }
+    }
+
+    size_t OverlapsFrustum(const Frustum& frustum, ConstAabbSpan aabbs, AZStd::span<uint32_t> outMask)
+    {
+        AZ_Assert(IsValid(aabbs), "All components of an Aabb span must have the same size");
+
+        const size_t count = aabbs.size();
+        const size_t wordCount = ResetMask(outMask, count);
+        const SplatFrustumPlanes planes(frustum);
+        const Vec8::FloatType half = Vec8::Splat(0.5f);
+        const Vec8::FloatType zero = Vec8::ZeroFloat();
+
+        size_t index = 0;
+        for (; index + Vec8::ElementCount <= count; index += Vec8::ElementCount)
+        {
+            const Vec8::FloatType min[3] = { Vec8::LoadUnaligned(aabbs.m_min.m_x.data() + index),
+                                             Vec8::LoadUnaligned(aabbs.m_min.m_y.data() + index),
+                                             Vec8::LoadUnaligned(aabbs.m_min.m_z.data() + index) };
+            const Vec8::FloatType max[3] = { Vec8::LoadUnaligned(aabbs.m_max.m_x.data() + index),
+                                             Vec8::LoadUnaligned(aabbs.m_max.m_y.data() + index),
+                                             Vec8::LoadUnaligned(aabbs.m_max.m_z.data() + index) };
+
+            // Same as ShapeIntersection::Overlaps, the extents are computed with separate multiplies so aabbs with FLT_MAX
+            // extremes don't overflow.
+            Vec8::FloatType center[3];
+            Vec8::FloatType extents[3];
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                center[axis] = Vec8::Mul(half, Vec8::Add(min[axis], max[axis]));
+                extents[axis] = Vec8::Sub(Vec8::Mul(half, max[axis]), Vec8::Mul(half, min[axis]));
+            }
+
+            Vec8::FloatType overlaps = Vec8::CmpEq(zero, zero);
+            for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vec8::FloatType* absNormal = planes.m_absNormal[planeId];
+                const Vec8::FloatType distance = planes.GetPointDist(planeId, center[0], center[1], center[2]);
+                const Vec8::FloatType radius =
+                    Vec8::Madd(extents[2], absNormal[2], Vec8::Madd(extents[1], absNormal[1], Vec8::Mul(extents[0], absNormal[0])));
+                overlaps = Vec8::And(overlaps, Vec8::CmpGt(Vec8::Add(distance, radius), zero));
+            }
+            SetMaskBits(outMask, index, GetLaneBits(overlaps));
+        }
+
+        for (; index < count; ++index)
+        {
+            const Aabb aabb = Aabb::CreateFromMinMaxValues(
+                aabbs.m_min.m_x[index], aabbs.m_min.m_y[index], aabbs.m_min.m_z[index],
+                aabbs.m_max.m_x[index], aabbs.m_max.m_y[index], aabbs.m_max.m_z[index]);
+            SetMaskBits(outMask, index, ShapeIntersection::Overlaps(frustum, aabb) ? 1 : 0);
+        }
+
+        return CountMaskBits(outMask.first(wordCount));
+    }
+
+    size_t OverlapsFrustum(const Frustum& frustum, ConstSphereSpan spheres, AZStd::span<uint32_t> outMask)
+    {
+        AZ_Assert(IsValid(spheres), "All components of a Sphere span must have the same size");
+
+        const size_t count = spheres.size();
+        const size_t wordCount = ResetMask(outMask, count);
+        const SplatFrustumPlanes planes(frustum);
+        const Vec8::FloatType zero = Vec8::ZeroFloat();
+
+        size_t index = 0;
+        for (; index + Vec8::ElementCount <= count; index += Vec8::ElementCount)
+        {
+            const Vec8::FloatType x = Vec8::LoadUnaligned(spheres.m_center.m_x.data() + index);
+            const Vec8::FloatType y = Vec8::LoadUnaligned(spheres.m_center.m_y.data() + index);
+            const Vec8::FloatType z = Vec8::LoadUnaligned(spheres.m_center.m_z.data() + index);
+            const Vec8::FloatType radius = Vec8::LoadUnaligned(spheres.m_radius.data() + index);
+
+            Vec8::FloatType overlaps = Vec8::CmpEq(zero, zero);
+            for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vec8::FloatType distance = planes.GetPointDist(planeId, x, y, z);
+                overlaps = Vec8::And(overlaps, Vec8::CmpGtEq(Vec8::Add(distance, radius), zero));
+            }
+            SetMaskBits(outMask, index, GetLaneBits(overlaps));
+        }
+
+        for (; index < count; ++index)
+        {
+            const Sphere sphere(Vector3(spheres.m_center.m_x[index], spheres.m_center.m_y[index], spheres.m_center.m_z[index]),
+                spheres.m_radius[index]);
+            SetMaskBits(outMask, index, ShapeIntersection::Overlaps(frustum, sphere) ? 1 : 0);
+        }
+
+        return CountMaskBits(outMask.first(wordCount));
+    }
+
+    size_t OverlapsAabb(const Aabb& aabb, ConstAabbSpan aabbs, AZStd::span<uint32_t> outMask)
+    {
+        AZ_Assert(IsValid(aabbs), "All components of an Aabb span must have the same size");
+
+        const size_t count = aabbs.size();
+        const size_t wordCount = ResetMask(outMask, count);
+        const Vec8::FloatType min[3] = { Vec8::Splat(aabb.GetMin().GetX()), Vec8::Splat(aabb.GetMin().GetY()),
+                                         Vec8::Splat(aabb.GetMin().GetZ()) };
+        const Vec8::FloatType max[3] = { Vec8::Splat(aabb.GetMax().GetX()), Vec8::Splat(aabb.GetMax().GetY()),
+                                         Vec8::Splat(aabb.GetMax().GetZ()) };
+        const float* const otherMin[3] = { aabbs.m_min.m_x.data(), aabbs.m_min.m_y.data(), aabbs.m_min.m_z.data() };
+        const float* const otherMax[3] = { aabbs.m_max.m_x.data(), aabbs.m_max.m_y.data(), aabbs.m_max.m_z.data() };
+
+        size_t index = 0;
+        for (; index + Vec8::ElementCount <= count; index += Vec8::ElementCount)
+        {
+            // Same as Aabb::Overlaps, the boxes overlap if they overlap on every axis, touching counts as overlapping.
+            Vec8::FloatType overlaps = Vec8::CmpLtEq(min[0], Vec8::LoadUnaligned(otherMax[0] + index));
+            overlaps = Vec8::And(overlaps, Vec8::CmpGtEq(max[0], Vec8::LoadUnaligned(otherMin[0] + index)));
+            for (int32_t axis = 1; axis < 3; ++axis)
+            {
+                overlaps = Vec8::And(overlaps, Vec8::CmpLtEq(min[axis], Vec8::LoadUnaligned(otherMax[axis] + index)));
+                overlaps = Vec8::And(overlaps, Vec8::CmpGtEq(max[axis], Vec8::LoadUnaligned(otherMin[axis] + index)));
+            }
+            SetMaskBits(outMask, index, GetLaneBits(overlaps));
+        }
+
+        for (; index < count; ++index)
+        {
+            const Aabb other = Aabb::CreateFromMinMaxValues(
+                aabbs.m_min.m_x[index], aabbs.m_min.m_y[index], aabbs.m_min.m_z[index],
+                aabbs.m_max.m_x[index], aabbs.m_max.m_y[index], aabbs.m_max.m_z[index]);
+            SetMaskBits(outMask, index, ShapeIntersection::Overlaps(aabb, other) ? 1 : 0);
+        }
+
+        return CountMaskBits(outMask.first(wordCount));
+    }
+} // namespace AZ::BatchMath
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/typetraits/is_convertible.h>
+
+namespace AZ
+{
+    class Aabb;
+    class Frustum;
+    class Matrix3x4;
+    class Transform;
+
+    //! Batch versions of common per object math operations.
+    //! The data is passed in structure of arrays layout, one span per component, which lets the kernels process eight
+    //! elements per iteration using Simd::Vec8. This is considerably faster than looping over Transform::TransformPoint,
+    //! Aabb::GetTransformedAabb or ShapeIntersection::Overlaps when there are many elements to process.
+    //! All the spans of a view must have the same size. Inputs and outputs may alias each other exactly, but must not
+    //! partially overlap.
+    namespace BatchMath
+    {
+        //! A structure of arrays view over a number of 3d points or vectors.
+        template<typename T>
+        struct Vector3View
+        {
+            Vector3View() = default;
+            Vector3View(AZStd::span<T> x, AZStd::span<T> y, AZStd::span<T> z);
+            //! Allows passing a mutable view where a const view is expected.
+            template<typename U, typename = AZStd::enable_if_t<AZStd::is_convertible_v<U(*)[], T(*)[]>>>
+            Vector3View(const Vector3View<U>& rhs);
+
+            size_t size() const;
+
+            AZStd::span<T> m_x;
+            AZStd::span<T> m_y;
+            AZStd::span<T> m_z;
+        };
+
+        //! A structure of arrays view over a number of axis aligned bounding boxes.
+        template<typename T>
+        struct AabbView
+        {
+            AabbView() = default;
+            AabbView(const Vector3View<T>& min, const Vector3View<T>& max);
+            template<typename U, typename = AZStd::enable_if_t<AZStd::is_convertible_v<U(*)[], T(*)[]>>>
+            AabbView(const AabbView<U>& rhs);
+
+            size_t size() const;
+
+            Vector3View<T> m_min;
+            Vector3View<T> m_max;
+        };
+
+        //! A structure of arrays view over a number of spheres.
+        template<typename T>
+        struct SphereView
+        {
+            SphereView() = default;
+            SphereView(const Vector3View<T>& center, AZStd::span<T> radius);
+            template<typename U, typename = AZStd::enable_if_t<AZStd::is_convertible_v<U(*)[], T(*)[]>>>
+            SphereView(const SphereView<U>& rhs);
+
+            size_t size() const;
+
+            Vector3View<T> m_center;
+            AZStd::span<T> m_radius;
+        };
+
+        using Vector3Span = Vector3View<float>;
+        using ConstVector3Span = Vector3View<const float>;
+        using AabbSpan = AabbView<float>;
+        using ConstAabbSpan = AabbView<const float>;
+        using SphereSpan = SphereView<float>;
+        using ConstSphereSpan = SphereView<const float>;
+
+        //! Returns the number of 32 bit words needed to hold a result bitmask for elementCount elements.
+        constexpr size_t GetMaskWordCount(size_t elementCount)
+        {
+            return (elementCount + 31) / 32;
+        }
+
+        //! Transforms each point by the transform, including translation.
+        //! Equivalent to calling Transform::TransformPoint on every element.
+        void TransformPoints(const Transform& transform, ConstVector3Span points, Vector3Span outPoints);
+        void TransformPoints(const Matrix3x4& matrix, ConstVector3Span points, Vector3Span outPoints);
+
+        //! Transforms each vector by the transform, ignoring translation.
+        //! Equivalent to calling Transform::TransformVector on every element.
+        void TransformVectors(const Transform& transform, ConstVector3Span vectors, Vector3Span outVectors);
+        void TransformVectors(const Matrix3x4& matrix, ConstVector3Span vectors, Vector3Span outVectors);
+
+        //! Computes the axis aligned bounds of each transformed aabb.
+        //! Equivalent to calling Aabb::GetTransformedAabb on every element.
+        void TransformAabbs(const Transform& transform, ConstAabbSpan aabbs, AabbSpan outAabbs);
+        void TransformAabbs(const Matrix3x4& matrix, ConstAabbSpan aabbs, AabbSpan outAabbs);
+
+        //! Tests each aabb against the frustum. Bit (i % 32) of outMask[i / 32] is set if aabb i overlaps the frustum and
+        //! cleared otherwise, unused bits of the last word are cleared.
+        //! Equivalent to calling ShapeIntersection::Overlaps(frustum, aabb) on every element.
+        //! @param outMask must hold at least GetMaskWordCount(aabbs.size()) words.
+        //! @return the number of aabbs overlapping the frustum.
+        size_t OverlapsFrustum(const Frustum& frustum, ConstAabbSpan aabbs, AZStd::span<uint32_t> outMask);
+
+        //! Tests each sphere against the frustum, the result is written the same way as for aabbs.
+        //! Equivalent to calling ShapeIntersection::Overlaps(frustum, sphere) on every element.
+        size_t OverlapsFrustum(const Frustum& frustum, ConstSphereSpan spheres, AZStd::span<uint32_t> outMask);
+
+        //! Tests each aabb against another aabb, the result is written the same way as for frustums.
+        //! Equivalent to calling ShapeIntersection::Overlaps(aabb, element) on every element.
+        size_t OverlapsAabb(const Aabb& aabb, ConstAabbSpan aabbs, AZStd::span<uint32_t> outMask);
+
+        template<typename T>
+        inline Vector3View<T>::Vector3View(AZStd::span<T> x, AZStd::span<T> y, AZStd::span<T> z)
+            : m_x(x)
+            , m_y(y)
+            , m_z(z)
+        {
+        }
+
+        template<typename T>
+        template<typename U, typename>
+        inline Vector3View<T>::Vector3View(const Vector3View<U>& rhs)
+            : m_x(rhs.m_x)
+            , m_y(rhs.m_y)
+            , m_z(rhs.m_z)
+        {
+        }
+
+        template<typename T>
+        inline size_t Vector3View<T>::size() const
+        {
+            return m_x.size();
+        }
+
+        template<typename T>
+        inline AabbView<T>::AabbView(const Vector3View<T>& min, const Vector3View<T>& max)
+            : m_min(min)
+            , m_max(max)
+        {
+        }
+
+        template<typename T>
+        template<typename U, typename>
+        inline AabbView<T>::AabbView(const AabbView<U>& rhs)
+            : m_min(rhs.m_min)
+            , m_max(rhs.m_max)
+        {
+        }
+
+        template<typename T>
+        inline size_t AabbView<T>::size() const
+        {
+            return m_min.size();
+        }
+
+        template<typename T>
+        inline SphereView<T>::SphereView(const Vector3View<T>& center, AZStd::span<T> radius)
+            : m_center(center)
+            , m_radius(radius)
+        {
+        }
+
+        template<typename T>
+        template<typename U, typename>
+        inline SphereView<T>::SphereView(const SphereView<U>& rhs)
+            : m_center(rhs.m_center)
+            , m_radius(rhs.m_radius)
+        {
+        }
+
+        template<typename T>
+        inline size_t SphereView<T>::size() const
+        {
+            return m_radius.size();
+        }
+    } // namespace BatchMath
+} // namespace AZ
@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Avx
+        {
+            AZ_MATH_INLINE __m256 LoadAligned(const float* __restrict addr)
+            {
+                AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+                return _mm256_load_ps(addr);
+            }
+
+            AZ_MATH_INLINE __m256i LoadAligned(const int32_t* __restrict addr)
+            {
+                AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+                return _mm256_load_si256((const __m256i *)addr);
+            }
+
+            AZ_MATH_INLINE __m256 LoadUnaligned(const float* __restrict addr)
+            {
+                return _mm256_loadu_ps(addr);
+            }
+
+            AZ_MATH_INLINE __m256i LoadUnaligned(const int32_t* __restrict addr)
+            {
+                return _mm256_loadu_si256((const __m256i *)addr);
+            }
+
+            AZ_MATH_INLINE void StoreAligned(float* __restrict addr, __m256 value)
+            {
+                AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+                _mm256_store_ps(addr, value);
+            }
+
+            AZ_MATH_INLINE void StoreAligned(int32_t* __restrict addr, __m256i value)
+            {
+                AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+                _mm256_store_si256((__m256i *)addr, value);
+            }
+
+            AZ_MATH_INLINE void StoreUnaligned(float* __restrict addr, __m256 value)
+            {
+                _mm256_storeu_ps(addr, value);
+            }
+
+            AZ_MATH_INLINE void StoreUnaligned(int32_t* __restrict addr, __m256i value)
+            {
+                _mm256_storeu_si256((__m256i *)addr, value);
+            }
+
+            AZ_MATH_INLINE void StreamAligned(float* __restrict addr, __m256 value)
+            {
+                AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+                _mm256_stream_ps(addr, value);
+            }
+
+            AZ_MATH_INLINE void StreamAligned(int32_t* __restrict addr, __m256i value)
+            {
+                AZ_MATH_ASSERT(IsAligned<32>(addr), "Alignment failure");
+                _mm256_stream_si256((__m256i *)addr, value);
+            }
+
+            AZ_MATH_INLINE __m256 ConvertToFloat(__m256i value)
+            {
+                return _mm256_cvtepi32_ps(value);
+            }
+
+            AZ_MATH_INLINE __m256i ConvertToInt(__m256 value)
+            {
+                return _mm256_cvttps_epi32(value);
+            }
+
+            AZ_MATH_INLINE __m256i ConvertToIntNearest(__m256 value)
+            {
+                return _mm256_cvtps_epi32(value);
+            }
+
+            AZ_MATH_INLINE __m256 CastToFloat(__m256i value)
+            {
+                return _mm256_castsi256_ps(value);
+            }
+
+            AZ_MATH_INLINE __m256i CastToInt(__m256 value)
+            {
+                return _mm256_castps_si256(value);
+            }
+
+            AZ_MATH_INLINE __m256 ZeroFloat()
+            {
+                return _mm256_setzero_ps();
+            }
+
+            AZ_MATH_INLINE __m256i ZeroInt()
+            {
+                return _mm256_setzero_si256();
+            }
+
+            AZ_MATH_INLINE __m256 Splat(float value)
+            {
+                return _mm256_set1_ps(value);
+            }
+
+            AZ_MATH_INLINE __m256i Splat(int32_t value)
+            {
+                return _mm256_set1_epi32(value);
+            }
+
+            AZ_MATH_INLINE __m256 Add(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_add_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Sub(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_sub_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Mul(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_mul_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Madd(__m256 mul1, __m256 mul2, __m256 add)
+            {
+                return _mm256_fmadd_ps(mul1, mul2, add);
+            }
+
+            AZ_MATH_INLINE __m256 Div(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_div_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Abs(__m256 value)
+            {
+                const __m256 signMask = CastToFloat(Splat(0x7FFFFFFF));
+                return _mm256_and_ps(value, signMask);
+            }
+
+            AZ_MATH_INLINE __m256i Add(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_add_epi32(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i Sub(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_sub_epi32(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i Mul(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_mullo_epi32(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i Madd(__m256i mul1, __m256i mul2, __m256i add)
+            {
+                return Add(Mul(mul1, mul2), add);
+            }
+
+            AZ_MATH_INLINE __m256i Abs(__m256i value)
+            {
+                return _mm256_abs_epi32(value);
+            }
+
+            AZ_MATH_INLINE __m256 Not(__m256 value)
+            {
+                const __m256i invert = Splat(static_cast<int32_t>(0xFFFFFFFF));
+                return _mm256_andnot_ps(value, CastToFloat(invert));
+            }
+
+            AZ_MATH_INLINE __m256 And(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_and_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 AndNot(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_andnot_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Or(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_or_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Xor(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_xor_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i Not(__m256i value)
+            {
+                return _mm256_xor_si256(value, Splat(static_cast<int32_t>(0xFFFFFFFF)));
+            }
+
+            AZ_MATH_INLINE __m256i And(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_and_si256(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i AndNot(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_andnot_si256(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i Or(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_or_si256(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i Xor(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_xor_si256(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Floor(__m256 value)
+            {
+                return _mm256_floor_ps(value);
+            }
+
+            AZ_MATH_INLINE __m256 Ceil(__m256 value)
+            {
+                return _mm256_ceil_ps(value);
+            }
+
+            AZ_MATH_INLINE __m256 Round(__m256 value)
+            {
+                return _mm256_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+
+            AZ_MATH_INLINE __m256 Truncate(__m256 value)
+            {
+                return _mm256_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            }
+
+            AZ_MATH_INLINE __m256 Min(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_min_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Max(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_max_ps(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256 Clamp(__m256 value, __m256 min, __m256 max)
+            {
+                return Max(min, Min(value, max));
+            }
+
+            AZ_MATH_INLINE __m256i Min(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_min_epi32(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i Max(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_max_epi32(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i Clamp(__m256i value, __m256i min, __m256i max)
+            {
+                return Max(min, Min(value, max));
+            }
+
+            // The predicates match the behaviour of the SSE compares, so only not-equal is true for NaNs
+            AZ_MATH_INLINE __m256 CmpEq(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_cmp_ps(arg1, arg2, _CMP_EQ_OQ);
+            }
+
+            AZ_MATH_INLINE __m256 CmpNeq(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_cmp_ps(arg1, arg2, _CMP_NEQ_UQ);
+            }
+
+            AZ_MATH_INLINE __m256 CmpGt(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_cmp_ps(arg1, arg2, _CMP_GT_OQ);
+            }
+
+            AZ_MATH_INLINE __m256 CmpGtEq(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_cmp_ps(arg1, arg2, _CMP_GE_OQ);
+            }
+
+            AZ_MATH_INLINE __m256 CmpLt(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_cmp_ps(arg1, arg2, _CMP_LT_OQ);
+            }
+
+            AZ_MATH_INLINE __m256 CmpLtEq(__m256 arg1, __m256 arg2)
+            {
+                return _mm256_cmp_ps(arg1, arg2, _CMP_LE_OQ);
+            }
+
+            AZ_MATH_INLINE bool AllTrue(__m256 compare)
+            {
+                return _mm256_movemask_ps(compare) == 0xFF;
+            }
+
+            AZ_MATH_INLINE __m256i CmpEq(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_cmpeq_epi32(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i CmpNeq(__m256i arg1, __m256i arg2)
+            {
+                return Not(CmpEq(arg1, arg2));
+            }
+
+            AZ_MATH_INLINE __m256i CmpGt(__m256i arg1, __m256i arg2)
+            {
+                return _mm256_cmpgt_epi32(arg1, arg2);
+            }
+
+            AZ_MATH_INLINE __m256i CmpGtEq(__m256i arg1, __m256i arg2)
+            {
+                return Not(CmpGt(arg2, arg1));
+            }
+
+            AZ_MATH_INLINE __m256i CmpLt(__m256i arg1, __m256i arg2)
+            {
+                return CmpGt(arg2, arg1);
+            }
+
+            AZ_MATH_INLINE __m256i CmpLtEq(__m256i arg1, __m256i arg2)
+            {
+                return Not(CmpGt(arg1, arg2));
+            }
+
+            AZ_MATH_INLINE bool AllTrue(__m256i compare)
+            {
+                return _mm256_movemask_epi8(compare) == static_cast<int32_t>(0xFFFFFFFF);
+            }
+
+            AZ_MATH_INLINE __m256 Select(__m256 arg1, __m256 arg2, __m256 mask)
+            {
+                return _mm256_blendv_ps(arg2, arg1, mask);
+            }
+
+            AZ_MATH_INLINE __m256i Select(__m256i arg1, __m256i arg2, __m256i mask)
+            {
+                return _mm256_blendv_epi8(arg2, arg1, mask);
+            }
+
+            AZ_MATH_INLINE __m256 Reciprocal(__m256 value)
+            {
+                return Div(Splat(1.0f), value);
+            }
+
+            AZ_MATH_INLINE __m256 ReciprocalEstimate(__m256 value)
+            {
+                return _mm256_rcp_ps(value);
+            }
+
+            AZ_MATH_INLINE __m256 Sqrt(__m256 value)
+            {
+                return _mm256_sqrt_ps(value);
+            }
+
+            AZ_MATH_INLINE __m256 SqrtInv(__m256 value)
+            {
+                return Div(Splat(1.0f), Sqrt(value));
+            }
+
+            AZ_MATH_INLINE __m256 SqrtInvEstimate(__m256 value)
+            {
+                return _mm256_rsqrt_ps(value);
+            }
+
+            AZ_MATH_INLINE __m256 SqrtEstimate(__m256 value)
+            {
+                // sqrt(x) = x * (1 / sqrt(x)), masked so that 0 doesn't become 0 * inf = NaN
+                const __m256 result = Mul(value, SqrtInvEstimate(value));
+                return And(result, CmpNeq(value, ZeroFloat()));
+            }
+
+            //! Multiplies two pairs of 4x4 matrix rows at a time, each lane of the 256 bit registers holds one row.
+            //! The accumulation order matches Common::Mat4x4MultiplyAdd, so the results are identical to the 128 bit FMA path.
+            AZ_MATH_INLINE __m256 MatRowPairMultiplyAdd(__m256 rowPairA, __m256 b0, __m256 b1, __m256 b2, __m256 b3, __m256 add)
+            {
+                __m256 result = Madd(_mm256_permute_ps(rowPairA, 0x00), b0, add);
+                result = Madd(_mm256_permute_ps(rowPairA, 0x55), b1, result);
+                result = Madd(_mm256_permute_ps(rowPairA, 0xAA), b2, result);
+                return Madd(_mm256_permute_ps(rowPairA, 0xFF), b3, result);
+            }
+
+            AZ_MATH_INLINE void Mat4x4MultiplyAdd(const __m128* __restrict rowsA, const __m128* __restrict rowsB, const __m128* __restrict add, __m128* __restrict out)
+            {
+                const __m256 b0 = _mm256_broadcast_ps(&rowsB[0]);
+                const __m256 b1 = _mm256_broadcast_ps(&rowsB[1]);
+                const __m256 b2 = _mm256_broadcast_ps(&rowsB[2]);
+                const __m256 b3 = _mm256_broadcast_ps(&rowsB[3]);
+                const __m256 add01 = add ? _mm256_loadu_ps(reinterpret_cast<const float*>(add)) : ZeroFloat();
+                const __m256 add23 = add ? _mm256_loadu_ps(reinterpret_cast<const float*>(add + 2)) : ZeroFloat();
+                const __m256 rows01 = _mm256_loadu_ps(reinterpret_cast<const float*>(rowsA));
+                const __m256 rows23 = _mm256_loadu_ps(reinterpret_cast<const float*>(rowsA + 2));
+                _mm256_storeu_ps(reinterpret_cast<float*>(out), MatRowPairMultiplyAdd(rows01, b0, b1, b2, b3, add01));
+                _mm256_storeu_ps(reinterpret_cast<float*>(out + 2), MatRowPairMultiplyAdd(rows23, b0, b1, b2, b3, add23));
+            }
+
+            AZ_MATH_INLINE void Mat3x4Multiply(const __m128* __restrict rowsA, const __m128* __restrict rowsB, __m128* __restrict out)
+            {
+                // The implicit fourth row of a 3x4 matrix is (0, 0, 0, 1)
+                const __m128 fourth = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+                const __m256 b0 = _mm256_broadcast_ps(&rowsB[0]);
+                const __m256 b1 = _mm256_broadcast_ps(&rowsB[1]);
+                const __m256 b2 = _mm256_broadcast_ps(&rowsB[2]);
+                const __m256 b3 = _mm256_broadcast_ps(&fourth);
+                const __m256 rows01 = _mm256_loadu_ps(reinterpret_cast<const float*>(rowsA));
+                _mm256_storeu_ps(reinterpret_cast<float*>(out), MatRowPairMultiplyAdd(rows01, b0, b1, b2, b3, ZeroFloat()));
+
+                const __m128 row2 = rowsA[2];
+                __m128 result = _mm_mul_ps(_mm_shuffle_ps(row2, row2, 0x00), rowsB[0]);
+                result = _mm_fmadd_ps(_mm_shuffle_ps(row2, row2, 0x55), rowsB[1], result);
+                result = _mm_fmadd_ps(_mm_shuffle_ps(row2, row2, 0xAA), rowsB[2], result);
+                out[2] = _mm_fmadd_ps(_mm_shuffle_ps(row2, row2, 0xFF), fourth, result);
+            }
+        }
+    }
+}
@@ -10,6 +10,9 @@
 
 #include <AzCore/Math/Internal/SimdMathCommon_sse.inl>
 #include <AzCore/Math/Internal/SimdMathCommon_simd.inl>
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+#   include <AzCore/Math/Internal/SimdMathCommon_avx.inl>
+#endif
 
 namespace AZ
 {
@@ -637,7 +640,11 @@ namespace AZ
 
         AZ_MATH_INLINE void Vec4::Mat3x4Multiply(const FloatType* __restrict rowsA, const FloatType* __restrict rowsB, FloatType* __restrict out)
         {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+            Avx::Mat3x4Multiply(rowsA, rowsB, out);
+#else
             Common::Mat3x4Multiply<Vec4>(rowsA, rowsB, out);
+#endif
         }
 
         AZ_MATH_INLINE void Vec4::Mat4x4InverseFast(const FloatType* __restrict rows, FloatType* __restrict out)
@@ -659,12 +666,20 @@ namespace AZ
 
         AZ_MATH_INLINE void Vec4::Mat4x4Multiply(const FloatType* __restrict rowsA, const FloatType* __restrict rowsB, FloatType* __restrict out)
         {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+            Avx::Mat4x4MultiplyAdd(rowsA, rowsB, nullptr, out);
+#else
             Common::Mat4x4Multiply<Vec4>(rowsA, rowsB, out);
+#endif
         }
 
         AZ_MATH_INLINE void Vec4::Mat4x4MultiplyAdd(const FloatType* __restrict rowsA, const FloatType* __restrict rowsB, const FloatType* __restrict add, FloatType* __restrict out)
         {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+            Avx::Mat4x4MultiplyAdd(rowsA, rowsB, add, out);
+#else
             Common::Mat4x4MultiplyAdd<Vec4>(rowsA, rowsB, add, out);
+#endif
         }
 
         AZ_MATH_INLINE void Vec4::Mat4x4TransposeMultiply(const FloatType* __restrict rowsA, const FloatType* __restrict rowsB, FloatType* __restrict out)
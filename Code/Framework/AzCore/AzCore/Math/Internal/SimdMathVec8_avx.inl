@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Internal/SimdMathCommon_avx.inl>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        AZ_MATH_INLINE Vec4::FloatType Vec8::ToVec4Low(FloatArgType value)
+        {
+            return _mm256_castps256_ps128(value);
+        }
+
+        AZ_MATH_INLINE Vec4::FloatType Vec8::ToVec4High(FloatArgType value)
+        {
+            return _mm256_extractf128_ps(value, 1);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::FromVec4(Vec4::FloatArgType low, Vec4::FloatArgType high)
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadAligned(const float* __restrict addr)
+        {
+            return Avx::LoadAligned(addr);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadAligned(const int32_t* __restrict addr)
+        {
+            return Avx::LoadAligned(addr);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadUnaligned(const float* __restrict addr)
+        {
+            return Avx::LoadUnaligned(addr);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return Avx::LoadUnaligned(addr);
+        }
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            Avx::StoreAligned(addr, value);
+        }
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            Avx::StoreAligned(addr, value);
+        }
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            Avx::StoreUnaligned(addr, value);
+        }
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            Avx::StoreUnaligned(addr, value);
+        }
+
+        AZ_MATH_INLINE void Vec8::StreamAligned(float* __restrict addr, FloatArgType value)
+        {
+            Avx::StreamAligned(addr, value);
+        }
+
+        AZ_MATH_INLINE void Vec8::StreamAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            Avx::StreamAligned(addr, value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Splat(float value)
+        {
+            return Avx::Splat(value);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Splat(int32_t value)
+        {
+            return Avx::Splat(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::Add(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::Sub(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::Mul(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return Avx::Madd(mul1, mul2, add);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::Div(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Abs(FloatArgType value)
+        {
+            return Avx::Abs(value);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::Add(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::Sub(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Mul(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::Mul(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Madd(Int32ArgType mul1, Int32ArgType mul2, Int32ArgType add)
+        {
+            return Avx::Madd(mul1, mul2, add);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Abs(Int32ArgType value)
+        {
+            return Avx::Abs(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Not(FloatArgType value)
+        {
+            return Avx::Not(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::And(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::AndNot(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::Or(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::Xor(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Not(Int32ArgType value)
+        {
+            return Avx::Not(value);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::And(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::AndNot(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::AndNot(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::Or(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Xor(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::Xor(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Floor(FloatArgType value)
+        {
+            return Avx::Floor(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Ceil(FloatArgType value)
+        {
+            return Avx::Ceil(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Round(FloatArgType value)
+        {
+            return Avx::Round(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Truncate(FloatArgType value)
+        {
+            return Avx::Truncate(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::Min(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::Max(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return Avx::Clamp(value, min, max);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Min(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::Min(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Max(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::Max(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Clamp(Int32ArgType value, Int32ArgType min, Int32ArgType max)
+        {
+            return Avx::Clamp(value, min, max);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::CmpEq(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::CmpNeq(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::CmpGt(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::CmpGtEq(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::CmpLt(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::CmpLtEq(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE bool Vec8::CmpAllEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::AllTrue(Avx::CmpEq(arg1, arg2));
+        }
+
+        AZ_MATH_INLINE bool Vec8::CmpAllLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::AllTrue(Avx::CmpLt(arg1, arg2));
+        }
+
+        AZ_MATH_INLINE bool Vec8::CmpAllLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::AllTrue(Avx::CmpLtEq(arg1, arg2));
+        }
+
+        AZ_MATH_INLINE bool Vec8::CmpAllGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::AllTrue(Avx::CmpGt(arg1, arg2));
+        }
+
+        AZ_MATH_INLINE bool Vec8::CmpAllGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx::AllTrue(Avx::CmpGtEq(arg1, arg2));
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::CmpEq(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpNeq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::CmpNeq(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpGt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::CmpGt(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpGtEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::CmpGtEq(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpLt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::CmpLt(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpLtEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::CmpLtEq(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE bool Vec8::CmpAllEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return Avx::AllTrue(Avx::CmpEq(arg1, arg2));
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return Avx::Select(arg1, arg2, mask);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return Avx::Select(arg1, arg2, mask);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Reciprocal(FloatArgType value)
+        {
+            return Avx::Reciprocal(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ReciprocalEstimate(FloatArgType value)
+        {
+            return Avx::ReciprocalEstimate(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sqrt(FloatArgType value)
+        {
+            return Avx::Sqrt(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtEstimate(FloatArgType value)
+        {
+            return Avx::SqrtEstimate(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtInv(FloatArgType value)
+        {
+            return Avx::SqrtInv(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtInvEstimate(FloatArgType value)
+        {
+            return Avx::SqrtInvEstimate(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ConvertToFloat(Int32ArgType value)
+        {
+            return Avx::ConvertToFloat(value);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToInt(FloatArgType value)
+        {
+            return Avx::ConvertToInt(value);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToIntNearest(FloatArgType value)
+        {
+            return Avx::ConvertToIntNearest(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CastToFloat(Int32ArgType value)
+        {
+            return Avx::CastToFloat(value);
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CastToInt(FloatArgType value)
+        {
+            return Avx::CastToInt(value);
+        }
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ZeroFloat()
+        {
+            return Avx::ZeroFloat();
+        }
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ZeroInt()
+        {
+            return Avx::ZeroInt();
+        }
+    }
+}
@@ -21,6 +21,11 @@
 #   endif
 #endif
 
+// The AVX2 backend is an extension of the SSE backend, which is only available when the build targets AVX2 and FMA
+#if !defined(AZ_TRAIT_USE_PLATFORM_SIMD_AVX2)
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+#endif
+
 namespace AZ
 {
     namespace Simd
@@ -50,6 +55,7 @@ namespace AZ
 #include <AzCore/Math/SimdMathVec2.h>
 #include <AzCore/Math/SimdMathVec3.h>
 #include <AzCore/Math/SimdMathVec4.h>
+#include <AzCore/Math/SimdMathVec8.h>
 
 namespace AZ
 {
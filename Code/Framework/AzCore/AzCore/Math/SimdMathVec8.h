@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Internal/MathTypes.h>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        //! Eight wide float and int32 vector for batch kernels that process structure of arrays data, such as
+        //! transforming or culling many points at once. With AVX2 this maps to a single 256 bit register, on all
+        //! other platforms it's implemented as a pair of Vec4 registers.
+        //! Unlike the other vector types there are no geometric ops, as every lane is expected to hold a different element.
+        struct Vec8
+        {
+            static constexpr int32_t ElementCount = 8;
+
+#if   AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+            using FloatType = __m256;
+            using Int32Type = __m256i;
+            using FloatArgType = FloatType;
+            using Int32ArgType = Int32Type;
+#else
+            using FloatType = struct { Vec4::FloatType v[2]; };
+            using Int32Type = struct { Vec4::Int32Type v[2]; };
+            using FloatArgType = const FloatType&;
+            using Int32ArgType = const Int32Type&;
+#endif
+
+            static Vec4::FloatType ToVec4Low(FloatArgType value); // Returns elements 0 to 3
+            static Vec4::FloatType ToVec4High(FloatArgType value); // Returns elements 4 to 7
+            static FloatType FromVec4(Vec4::FloatArgType low, Vec4::FloatArgType high);
+
+            static FloatType LoadAligned(const float* __restrict addr); // addr *must* be 32-byte aligned
+            static Int32Type LoadAligned(const int32_t* __restrict addr); // addr *must* be 32-byte aligned
+            static FloatType LoadUnaligned(const float* __restrict addr);
+            static Int32Type LoadUnaligned(const int32_t* __restrict addr);
+
+            static void StoreAligned(float* __restrict addr, FloatArgType value); // addr *must* be 32-byte aligned
+            static void StoreAligned(int32_t* __restrict addr, Int32ArgType value); // addr *must* be 32-byte aligned
+            static void StoreUnaligned(float* __restrict addr, FloatArgType value);
+            static void StoreUnaligned(int32_t* __restrict addr, Int32ArgType value);
+
+            static void StreamAligned(float* __restrict addr, FloatArgType value); // addr *must* be 32-byte aligned
+            static void StreamAligned(int32_t* __restrict addr, Int32ArgType value); // addr *must* be 32-byte aligned
+
+            static FloatType Splat(float value);
+            static Int32Type Splat(int32_t value);
+
+            static FloatType Add(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Sub(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Mul(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add); // Fused with AVX2
+            static FloatType Div(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Abs(FloatArgType value);
+
+            static Int32Type Add(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Sub(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Mul(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Madd(Int32ArgType mul1, Int32ArgType mul2, Int32ArgType add);
+            static Int32Type Abs(Int32ArgType value);
+
+            static FloatType Not(FloatArgType value);
+            static FloatType And(FloatArgType arg1, FloatArgType arg2);
+            static FloatType AndNot(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Or(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Xor(FloatArgType arg1, FloatArgType arg2);
+
+            static Int32Type Not(Int32ArgType value);
+            static Int32Type And(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type AndNot(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Or(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Xor(Int32ArgType arg1, Int32ArgType arg2);
+
+            static FloatType Floor(FloatArgType value);
+            static FloatType Ceil(FloatArgType value);
+            static FloatType Round(FloatArgType value); // Ties to even (banker's rounding)
+            static FloatType Truncate(FloatArgType value);
+            static FloatType Min(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Max(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Clamp(FloatArgType value, FloatArgType min, FloatArgType max);
+
+            static Int32Type Min(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Max(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Clamp(Int32ArgType value, Int32ArgType min, Int32ArgType max);
+
+            static FloatType CmpEq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpNeq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpGt(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpGtEq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpLt(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpLtEq(FloatArgType arg1, FloatArgType arg2);
+
+            static bool CmpAllEq(FloatArgType arg1, FloatArgType arg2);
+            static bool CmpAllLt(FloatArgType arg1, FloatArgType arg2);
+            static bool CmpAllLtEq(FloatArgType arg1, FloatArgType arg2);
+            static bool CmpAllGt(FloatArgType arg1, FloatArgType arg2);
+            static bool CmpAllGtEq(FloatArgType arg1, FloatArgType arg2);
+
+            static Int32Type CmpEq(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpNeq(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpGt(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpGtEq(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpLt(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpLtEq(Int32ArgType arg1, Int32ArgType arg2);
+
+            static bool CmpAllEq(Int32ArgType arg1, Int32ArgType arg2);
+
+            static FloatType Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask);
+            static Int32Type Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask);
+
+            static FloatType Reciprocal(FloatArgType value); // Slow, but full accuracy
+            static FloatType ReciprocalEstimate(FloatArgType value); // Fastest, but roughly half precision on supported platforms
+
+            static FloatType Sqrt(FloatArgType value); // Slow, but full accuracy
+            static FloatType SqrtEstimate(FloatArgType value); // Fastest, but roughly half precision on supported platforms
+            static FloatType SqrtInv(FloatArgType value); // Slow, but full accuracy
+            static FloatType SqrtInvEstimate(FloatArgType value); // Fastest, but roughly half precision on supported platforms
+
+            static FloatType ConvertToFloat(Int32ArgType value);
+            static Int32Type ConvertToInt(FloatArgType value); // Truncates
+            static Int32Type ConvertToIntNearest(FloatArgType value); // Rounds to nearest int with ties to even (banker's rounding)
+
+            static FloatType CastToFloat(Int32ArgType value);
+            static Int32Type CastToInt(FloatArgType value);
+
+            static FloatType ZeroFloat();
+            static Int32Type ZeroInt();
+        };
+    }
+}
+
+#if   AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+#   include <AzCore/Math/Internal/SimdMathVec8_avx.inl>
+#else
+#   include <AzCore/Math/Internal/SimdMathVec8_simd.inl>
+#endif
@@ -0,0 +1,467 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/LinearAllocator.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    //! Header at the start of every page. Pages of a thread form a stack through m_previous so they can be
+    //! released in the reverse order they were acquired in.
+    struct alignas(16) LinearAllocatorPage
+    {
+        LinearAllocatorPage* m_previous;
+        size_t m_size; // Size of the page, including this header.
+    };
+
+    //! Pages and bump pointer of a single thread.
+    struct LinearAllocatorArena
+    {
+        AZStd::thread_id m_threadId;
+        LinearAllocatorArena* m_next{ nullptr };
+        LinearAllocatorPage* m_currentPage{ nullptr };
+        LinearAllocatorPage* m_freePages{ nullptr };
+        char* m_top{ nullptr };
+        // The most recent allocation and the value of m_top before it was made, so it can be released or resized.
+        char* m_lastAllocation{ nullptr };
+        char* m_lastTop{ nullptr };
+        u64 m_lastUsedFrame{ 0 };
+        // Only written by the owning thread, but read by any thread that requests statistics.
+        AZStd::atomic<size_t> m_usedBytes{ 0 };
+        AZStd::atomic<size_t> m_reservedBytes{ 0 };
+    };
+
+    namespace LinearAllocatorInternal
+    {
+        // Id 0 is never handed out so zero-initialized thread slots never match an allocator.
+        static AZStd::atomic<u64> s_nextAllocatorId{ 1 };
+
+        static char* GetPageBegin(LinearAllocatorPage* page)
+        {
+            return reinterpret_cast<char*>(page) + sizeof(LinearAllocatorPage);
+        }
+
+        static char* GetPageEnd(LinearAllocatorPage* page)
+        {
+            return reinterpret_cast<char*>(page) + page->m_size;
+        }
+
+        static char* AlignUp(char* address, size_t alignment)
+        {
+            return reinterpret_cast<char*>(AZ::SizeAlignUp(reinterpret_cast<size_t>(address), alignment));
+        }
+
+        //! Finds the page of the arena that holds the address, or returns null if the address isn't in any page in use.
+        static LinearAllocatorPage* FindPage(const LinearAllocatorArena& arena, const char* address)
+        {
+            for (LinearAllocatorPage* page = arena.m_currentPage; page; page = page->m_previous)
+            {
+                if (address >= GetPageBegin(page) && address < GetPageEnd(page))
+                {
+                    return page;
+                }
+            }
+            return nullptr;
+        }
+
+        // Every allocation is preceded by its size so it can be looked up later.
+        static constexpr size_t SizeHeaderBytes = sizeof(size_t);
+
+        static char* AlignAllocation(char* top, size_t alignment)
+        {
+            // Keeping the allocation aligned to at least the header keeps the header itself aligned.
+            return AlignUp(top + SizeHeaderBytes, AZStd::max(alignment, alignof(size_t)));
+        }
+
+        static size_t GetAllocationSize(const char* address)
+        {
+            return *reinterpret_cast<const size_t*>(address - SizeHeaderBytes);
+        }
+
+        static void SetAllocationSize(char* address, size_t byteSize)
+        {
+            *reinterpret_cast<size_t*>(address - SizeHeaderBytes) = byteSize;
+        }
+
+        static void AddUsedBytes(LinearAllocatorArena& arena, ptrdiff_t delta)
+        {
+            // Only the owning thread writes, so there's no need for a read-modify-write operation.
+            arena.m_usedBytes.store(arena.m_usedBytes.load(AZStd::memory_order_relaxed) + delta, AZStd::memory_order_relaxed);
+        }
+    } // namespace LinearAllocatorInternal
+
+    LinearAllocatorBase::LinearAllocatorBase(GetThreadSlot getThreadSlot, size_type pageSize)
+        : m_getThreadSlot(getThreadSlot)
+        , m_pageSize(AZ::SizeAlignUp(AZStd::max(pageSize, size_type{ 2 * sizeof(LinearAllocatorPage) }), alignof(LinearAllocatorPage)))
+        , m_allocatorId(LinearAllocatorInternal::s_nextAllocatorId.fetch_add(1))
+    {
+        PostCreate();
+    }
+
+    LinearAllocatorBase::~LinearAllocatorBase()
+    {
+        PreDestroy();
+
+        AZStd::scoped_lock lock(m_arenasMutex);
+        IAllocator& systemAllocator = AllocatorInstance<SystemAllocator>::Get();
+        while (m_arenas)
+        {
+            LinearAllocatorArena* arena = m_arenas;
+            m_arenas = arena->m_next;
+            ReleasePagesUntil(*arena, nullptr);
+            ReleaseFreePages(*arena);
+            arena->~LinearAllocatorArena();
+            systemAllocator.deallocate(arena, sizeof(LinearAllocatorArena), alignof(LinearAllocatorArena));
+        }
+    }
+
+    AllocateAddress LinearAllocatorBase::allocate(size_type byteSize, size_type alignment)
+    {
+        using namespace LinearAllocatorInternal;
+
+        byteSize = AZStd::max(byteSize, size_type{ 1 });
+        alignment = AZStd::max(alignment, size_type{ 1 });
+
+        LinearAllocatorArena& arena = GetArena();
+        char* top = arena.m_top;
+        char* address = AlignAllocation(top, alignment);
+        if (!arena.m_currentPage || address + byteSize > GetPageEnd(arena.m_currentPage))
+        {
+            if (!PushPage(arena, byteSize, alignment))
+            {
+                return AllocateAddress{};
+            }
+            top = arena.m_top;
+            address = AlignAllocation(top, alignment);
+        }
+
+        SetAllocationSize(address, byteSize);
+        arena.m_top = address + byteSize;
+        arena.m_lastAllocation = address;
+        arena.m_lastTop = top;
+        arena.m_lastUsedFrame = m_frame.load(AZStd::memory_order_relaxed);
+        AddUsedBytes(arena, arena.m_top - top);
+        return AllocateAddress(address, byteSize);
+    }
+
+    auto LinearAllocatorBase::deallocate(pointer ptr, [[maybe_unused]] size_type byteSize, [[maybe_unused]] size_type alignment) -> size_type
+    {
+        if (!ptr)
+        {
+            return 0;
+        }
+
+        LinearAllocatorArena& arena = GetArena();
+        if (ptr != arena.m_lastAllocation)
+        {
+            return 0;
+        }
+
+        const size_type releasedBytes = arena.m_top - arena.m_lastAllocation;
+        LinearAllocatorInternal::AddUsedBytes(arena, -(arena.m_top - arena.m_lastTop));
+        arena.m_top = arena.m_lastTop;
+        arena.m_lastAllocation = nullptr;
+        return releasedBytes;
+    }
+
+    AllocateAddress LinearAllocatorBase::reallocate(pointer ptr, size_type newSize, align_type newAlignment)
+    {
+        using namespace LinearAllocatorInternal;
+
+        if (!ptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            deallocate(ptr);
+            return AllocateAddress{};
+        }
+
+        LinearAllocatorArena& arena = GetArena();
+        char* address = reinterpret_cast<char*>(ptr);
+        size_type oldSize = 0;
+        if (address == arena.m_lastAllocation)
+        {
+            oldSize = arena.m_top - address;
+            if (AlignUp(address, newAlignment) == address && address + newSize <= GetPageEnd(arena.m_currentPage))
+            {
+                AddUsedBytes(arena, static_cast<ptrdiff_t>(newSize) - static_cast<ptrdiff_t>(oldSize));
+                SetAllocationSize(address, newSize);
+                arena.m_top = address + newSize;
+                return AllocateAddress(address, newSize);
+            }
+        }
+        else
+        {
+            if (!FindPage(arena, address))
+            {
+                AZ_Assert(false, "LinearAllocator can only reallocate memory that was allocated by the calling thread in the current frame.");
+                return AllocateAddress{};
+            }
+            oldSize = GetAllocationSize(address);
+        }
+
+        // The old block stays in place until the memory is released in bulk.
+        AllocateAddress newAddress = allocate(newSize, newAlignment);
+        if (newAddress)
+        {
+            memcpy(newAddress, address, AZStd::min(oldSize, newSize));
+        }
+        return newAddress;
+    }
+
+    auto LinearAllocatorBase::get_allocated_size(pointer ptr, [[maybe_unused]] align_type alignment) const -> size_type
+    {
+        using namespace LinearAllocatorInternal;
+
+        // Only the calling thread's own arena is checked. It's reached through the thread slot so this doesn't need to
+        // lock, and pages of other threads can change while they're being searched.
+        const LinearAllocatorThreadSlot& slot = m_getThreadSlot();
+        if (!ptr || slot.m_allocatorId != m_allocatorId)
+        {
+            return 0;
+        }
+
+        const LinearAllocatorArena& arena = *slot.m_arena;
+        const char* address = reinterpret_cast<const char*>(ptr);
+        LinearAllocatorPage* page = FindPage(arena, address);
+        if (!page || (page == arena.m_currentPage && address >= arena.m_top))
+        {
+            return 0;
+        }
+        return GetAllocationSize(address);
+    }
+
+    void LinearAllocatorBase::GarbageCollect()
+    {
+        if (LinearAllocatorArena* arena = FindArena(); arena)
+        {
+            ReleaseFreePages(*arena);
+        }
+    }
+
+    auto LinearAllocatorBase::NumAllocatedBytes() const -> size_type
+    {
+        size_type result = 0;
+        AZStd::scoped_lock lock(m_arenasMutex);
+        for (const LinearAllocatorArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            result += arena->m_usedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    AllocatorDebugConfig LinearAllocatorBase::GetDebugConfig()
+    {
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    void LinearAllocatorBase::ResetFrame()
+    {
+        AZStd::scoped_lock lock(m_arenasMutex);
+        const u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+        for (LinearAllocatorArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            const bool wasUsed = arena->m_lastUsedFrame == frame && arena->m_currentPage != nullptr;
+            ReleasePagesUntil(*arena, nullptr);
+            arena->m_top = nullptr;
+            arena->m_lastAllocation = nullptr;
+            arena->m_lastTop = nullptr;
+            arena->m_usedBytes.store(0, AZStd::memory_order_relaxed);
+            // Threads that stopped allocating, or have exited, shouldn't hold on to memory.
+            if (!wasUsed)
+            {
+                ReleaseFreePages(*arena);
+            }
+        }
+        m_frame.store(frame + 1, AZStd::memory_order_release);
+    }
+
+    u64 LinearAllocatorBase::GetFrame() const
+    {
+        return m_frame.load(AZStd::memory_order_acquire);
+    }
+
+    auto LinearAllocatorBase::GetMarker() -> Marker
+    {
+        LinearAllocatorArena& arena = GetArena();
+        Marker marker;
+        marker.m_arena = &arena;
+        marker.m_page = arena.m_currentPage;
+        marker.m_top = arena.m_top;
+        marker.m_usedBytes = arena.m_usedBytes.load(AZStd::memory_order_relaxed);
+        marker.m_frame = m_frame.load(AZStd::memory_order_relaxed);
+        return marker;
+    }
+
+    void LinearAllocatorBase::Rewind(const Marker& marker)
+    {
+        LinearAllocatorArena& arena = GetArena();
+        AZ_Assert(marker.m_arena == &arena, "LinearAllocator marker is rewound on a different thread than it was taken on.");
+        if (marker.m_frame != m_frame.load(AZStd::memory_order_relaxed))
+        {
+            // The frame has been reset since the marker was taken, so everything it covers has already been released.
+            AZ_Assert(arena.m_currentPage == nullptr, "LinearAllocator marker from a previous frame is rewound after new allocations were made.");
+            return;
+        }
+
+        ReleasePagesUntil(arena, marker.m_page);
+        arena.m_top = reinterpret_cast<char*>(marker.m_top);
+        arena.m_lastAllocation = nullptr;
+        arena.m_lastTop = nullptr;
+        arena.m_usedBytes.store(marker.m_usedBytes, AZStd::memory_order_relaxed);
+    }
+
+    auto LinearAllocatorBase::GetReservedBytes() const -> size_type
+    {
+        size_type result = 0;
+        AZStd::scoped_lock lock(m_arenasMutex);
+        for (const LinearAllocatorArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            result += arena->m_reservedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    auto LinearAllocatorBase::GetPageSize() const -> size_type
+    {
+        return m_pageSize;
+    }
+
+    LinearAllocatorArena& LinearAllocatorBase::GetArena()
+    {
+        // The thread slot only caches one allocator per type, so alternating between multiple instances of the
+        // same allocator type on a thread will go through the slower registration path.
+        LinearAllocatorThreadSlot& slot = m_getThreadSlot();
+        if (slot.m_allocatorId == m_allocatorId)
+        {
+            return *slot.m_arena;
+        }
+        return RegisterThread(slot);
+    }
+
+    LinearAllocatorArena* LinearAllocatorBase::FindArena() const
+    {
+        const LinearAllocatorThreadSlot& slot = m_getThreadSlot();
+        if (slot.m_allocatorId == m_allocatorId)
+        {
+            return slot.m_arena;
+        }
+
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        AZStd::scoped_lock lock(m_arenasMutex);
+        for (LinearAllocatorArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            if (arena->m_threadId == threadId)
+            {
+                return arena;
+            }
+        }
+        return nullptr;
+    }
+
+    LinearAllocatorArena& LinearAllocatorBase::RegisterThread(LinearAllocatorThreadSlot& slot)
+    {
+        // Arenas are never destroyed while the allocator is alive. If a thread id gets reused by a new thread, the
+        // arena of the exited thread is picked up again.
+        LinearAllocatorArena* arena = FindArena();
+        if (!arena)
+        {
+            void* memory = AllocatorInstance<SystemAllocator>::Get().allocate(sizeof(LinearAllocatorArena), alignof(LinearAllocatorArena));
+            arena = new (memory) LinearAllocatorArena();
+            arena->m_threadId = AZStd::this_thread::get_id();
+            arena->m_lastUsedFrame = m_frame.load(AZStd::memory_order_relaxed);
+
+            AZStd::scoped_lock lock(m_arenasMutex);
+            arena->m_next = m_arenas;
+            m_arenas = arena;
+        }
+
+        slot.m_allocatorId = m_allocatorId;
+        slot.m_arena = arena;
+        return *arena;
+    }
+
+    bool LinearAllocatorBase::PushPage(LinearAllocatorArena& arena, size_type byteSize, size_type alignment)
+    {
+        const size_type requiredSize = sizeof(LinearAllocatorPage) + LinearAllocatorInternal::SizeHeaderBytes +
+            AZStd::max(alignment, alignof(size_t)) + byteSize;
+
+        LinearAllocatorPage* page = nullptr;
+        if (requiredSize <= m_pageSize && arena.m_freePages)
+        {
+            page = arena.m_freePages;
+            arena.m_freePages = page->m_previous;
+        }
+        else
+        {
+            // Allocations that don't fit in a regular page get a dedicated page, which is released instead of reused.
+            const size_type pageSize = AZStd::max(requiredSize, m_pageSize);
+            void* memory = AllocatorInstance<SystemAllocator>::Get().allocate(pageSize, alignof(LinearAllocatorPage));
+            if (!memory)
+            {
+                return false;
+            }
+            page = reinterpret_cast<LinearAllocatorPage*>(memory);
+            page->m_size = pageSize;
+            arena.m_reservedBytes.store(arena.m_reservedBytes.load(AZStd::memory_order_relaxed) + pageSize, AZStd::memory_order_relaxed);
+        }
+
+        page->m_previous = arena.m_currentPage;
+        arena.m_currentPage = page;
+        arena.m_top = LinearAllocatorInternal::GetPageBegin(page);
+        return true;
+    }
+
+    void LinearAllocatorBase::ReleasePagesUntil(LinearAllocatorArena& arena, LinearAllocatorPage* page)
+    {
+        while (arena.m_currentPage != page)
+        {
+            AZ_Assert(arena.m_currentPage, "LinearAllocator page to rewind to is no longer in use by the thread.");
+            LinearAllocatorPage* released = arena.m_currentPage;
+            arena.m_currentPage = released->m_previous;
+            if (released->m_size == m_pageSize)
+            {
+                released->m_previous = arena.m_freePages;
+                arena.m_freePages = released;
+            }
+            else
+            {
+                arena.m_reservedBytes.store(
+                    arena.m_reservedBytes.load(AZStd::memory_order_relaxed) - released->m_size, AZStd::memory_order_relaxed);
+                AllocatorInstance<SystemAllocator>::Get().deallocate(released, released->m_size, alignof(LinearAllocatorPage));
+            }
+        }
+    }
+
+    void LinearAllocatorBase::ReleaseFreePages(LinearAllocatorArena& arena)
+    {
+        while (arena.m_freePages)
+        {
+            LinearAllocatorPage* page = arena.m_freePages;
+            arena.m_freePages = page->m_previous;
+            arena.m_reservedBytes.store(
+                arena.m_reservedBytes.load(AZStd::memory_order_relaxed) - page->m_size, AZStd::memory_order_relaxed);
+            AllocatorInstance<SystemAllocator>::Get().deallocate(page, page->m_size, alignof(LinearAllocatorPage));
+        }
+    }
+
+    LinearAllocatorScope::LinearAllocatorScope(IAllocator& allocator)
+        : m_allocator(*static_cast<LinearAllocatorBase*>(&allocator))
+    {
+        AZ_Assert(azrtti_cast<LinearAllocatorBase*>(&allocator), "LinearAllocatorScope requires an allocator derived from LinearAllocatorBase.");
+        m_marker = m_allocator.GetMarker();
+    }
+
+    LinearAllocatorScope::~LinearAllocatorScope()
+    {
+        m_allocator.Rewind(m_marker);
+    }
+} // namespace AZ
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/AllocatorInstance.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    struct LinearAllocatorArena;
+    struct LinearAllocatorPage;
+
+    //! Thread local slot that caches the arena of a thread for a linear allocator.
+    struct LinearAllocatorThreadSlot
+    {
+        u64 m_allocatorId;
+        LinearAllocatorArena* m_arena;
+    };
+
+    /**
+     * Linear (bump pointer) allocator for short lived memory.
+     * Every thread allocates from its own arena of pages, so allocations don't need any synchronization. Memory isn't
+     * returned on deallocate, except for the most recent allocation of a thread. Instead all memory is released in bulk,
+     * either for all threads at once by calling ResetFrame or for the calling thread by rewinding to a Marker, which is
+     * typically done through a LinearAllocatorScope.
+     * Allocations are not recorded in the allocation records, as they would never be released individually.
+     * Inherit from LinearAllocatorHelper to create a new linear allocator, as every allocator type needs its own thread local slot.
+     */
+    class LinearAllocatorBase
+        : public AllocatorBase
+    {
+    public:
+        AZ_RTTI(LinearAllocatorBase, "{5A7C7D0E-4C8E-4C4B-9B52-7E0C9B6D2F31}", AllocatorBase);
+
+        static constexpr size_type DefaultPageSize = 64 * 1024;
+
+        using GetThreadSlot = LinearAllocatorThreadSlot& (*)();
+
+        //! Position in the arena of a thread. All allocations made by the thread after the marker was taken
+        //! can be released at once by rewinding to it.
+        struct Marker
+        {
+            LinearAllocatorArena* m_arena{ nullptr };
+            LinearAllocatorPage* m_page{ nullptr };
+            void* m_top{ nullptr };
+            size_type m_usedBytes{ 0 };
+            u64 m_frame{ 0 };
+        };
+
+        LinearAllocatorBase(GetThreadSlot getThreadSlot, size_type pageSize);
+        ~LinearAllocatorBase() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override;
+        //! Only the most recent allocation of the calling thread is released, all other deallocations are ignored
+        //! until the memory is released in bulk.
+        size_type deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        //! The most recent allocation of the calling thread is grown in place if possible. Any other allocation is copied to
+        //! a new allocation and the old block stays in place until the memory is released in bulk.
+        AllocateAddress reallocate(pointer ptr, size_type newSize, align_type newAlignment) override;
+        //! Returns the size of an allocation made by the calling thread in the current frame, or 0 for any other address.
+        size_type get_allocated_size(pointer ptr, align_type alignment = 1) const override;
+        //! Returns the pages the calling thread keeps for reuse to the system allocator.
+        void GarbageCollect() override;
+        size_type NumAllocatedBytes() const override;
+        AllocatorDebugConfig GetDebugConfig() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Releases all allocations made on any thread. This has to be called at a synchronization point, such as the end
+        //! of a frame, when no memory from this allocator is in use and no thread is allocating from it.
+        //! Pages of threads that didn't allocate anything since the previous reset are returned to the system allocator.
+        void ResetFrame();
+        //! Returns the number of times ResetFrame has been called.
+        u64 GetFrame() const;
+
+        //! Returns the current position in the arena of the calling thread.
+        Marker GetMarker();
+        //! Releases all allocations the calling thread made after the marker was taken. Markers have to be rewound
+        //! in the reverse order they were taken in and can't be used after the next call to ResetFrame.
+        void Rewind(const Marker& marker);
+
+        //! Returns the number of bytes in pages that are reserved by the arenas of all threads.
+        size_type GetReservedBytes() const;
+        size_type GetPageSize() const;
+
+    private:
+        LinearAllocatorArena& GetArena();
+        LinearAllocatorArena* FindArena() const;
+        LinearAllocatorArena& RegisterThread(LinearAllocatorThreadSlot& slot);
+        bool PushPage(LinearAllocatorArena& arena, size_type byteSize, size_type alignment);
+        void ReleasePagesUntil(LinearAllocatorArena& arena, LinearAllocatorPage* page);
+        void ReleaseFreePages(LinearAllocatorArena& arena);
+
+        GetThreadSlot m_getThreadSlot;
+        LinearAllocatorArena* m_arenas{ nullptr };
+        mutable AZStd::mutex m_arenasMutex;
+        size_type m_pageSize;
+        u64 m_allocatorId;
+        AZStd::atomic<u64> m_frame{ 0 };
+    };
+
+    /**
+     * Template to create your own linear allocators. Every allocator type gets its own thread local slot
+     * to quickly find the arena of the calling thread.
+     */
+    template<class Allocator>
+    class LinearAllocatorHelper
+        : public LinearAllocatorBase
+    {
+    public:
+        explicit LinearAllocatorHelper(size_type pageSize = DefaultPageSize)
+            : LinearAllocatorBase(&GetThreadSlot, pageSize)
+        {
+        }
+
+    protected:
+        static LinearAllocatorThreadSlot& GetThreadSlot()
+        {
+            return s_threadSlot;
+        }
+
+        static AZ_THREAD_LOCAL LinearAllocatorThreadSlot s_threadSlot;
+    };
+
+    template<class Allocator>
+    AZ_THREAD_LOCAL LinearAllocatorThreadSlot LinearAllocatorHelper<Allocator>::s_threadSlot = {};
+
+    /**
+     * Linear allocator for memory that doesn't outlive the frame it was allocated in, such as the containers used while
+     * culling or building draw lists. The owner of the frame loop calls ResetFrame once all work for the frame has completed.
+     * Use FrameAllocator_for_std_t as the allocator of AZStd containers, or FrameAllocator as the AZ_CLASS_ALLOCATOR of a class.
+     */
+    class FrameAllocator final
+        : public LinearAllocatorHelper<FrameAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameAllocator, SystemAllocator);
+        AZ_RTTI(FrameAllocator, "{B9E2F0C4-6A1D-4E47-8F2B-3D5A9C1E7B60}", LinearAllocatorBase);
+    };
+
+    using FrameAllocator_for_std_t = AZStdAlloc<FrameAllocator>;
+
+    /**
+     * Releases all allocations that the current thread made from a linear allocator during the lifetime of the scope.
+     * Scopes can be nested, but need to be destroyed on the thread they were created on.
+     * For example: `LinearAllocatorScope scope(AllocatorInstance<FrameAllocator>::Get());`
+     */
+    class LinearAllocatorScope
+    {
+    public:
+        explicit LinearAllocatorScope(IAllocator& allocator);
+        ~LinearAllocatorScope();
+
+        LinearAllocatorScope(const LinearAllocatorScope&) = delete;
+        LinearAllocatorScope& operator=(const LinearAllocatorScope&) = delete;
+
+    private:
+        LinearAllocatorBase& m_allocator;
+        LinearAllocatorBase::Marker m_marker;
+    };
+} // namespace AZ
@@ -0,0 +1,1126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Metrics/BinaryTraceEventLogger.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ::Metrics
+{
+    namespace BinaryTraceInternal
+    {
+        //! Written once at the start of a binary trace stream
+        struct FileHeader
+        {
+            char m_magic[8];
+            AZ::u32 m_version;
+            AZ::u32 m_recordSize;
+            AZ::u64 m_processId;
+        };
+
+        //! Precedes the records drained from the buffer of one thread
+        struct BlockHeader
+        {
+            AZ::u64 m_threadId;
+            AZ::u32 m_recordCount;
+            AZ::u32 m_reserved;
+        };
+
+        //! Layout of the start of the first record of an event. It's followed by the payload, which holds the name,
+        //! category, the optional id and scope strings and finally the args object
+        struct EventHeader
+        {
+            AZ::s64 m_timestamp;
+            AZ::s64 m_duration;
+            AZ::s64 m_threadDuration;
+            AZ::u32 m_payloadSize;
+            char m_phase;
+            AZ::u8 m_flags;
+            char m_instantScope;
+            AZ::u8 m_reserved;
+        };
+        static_assert(sizeof(EventHeader) == 32, "The event header is expected to use half of the first record");
+
+        enum EventFlags : AZ::u8
+        {
+            HasId = 1 << 0,
+            HasScope = 1 << 1,
+            HasInstantScope = 1 << 2,
+            HasThreadDuration = 1 << 3
+        };
+
+        //! Tags the type of each value in the args payload
+        enum class ValueType : AZ::u8
+        {
+            String,
+            Bool,
+            Int64,
+            Uint64,
+            Double,
+            Array,
+            Object
+        };
+
+        //! Limits how deep nested args are decoded, so corrupted data can't overflow the stack
+        constexpr int MaxArgsDepth = 64;
+
+        static size_t GetStringSize(AZStd::string_view value)
+        {
+            return sizeof(AZ::u32) + value.size();
+        }
+
+        static size_t GetObjectSize(AZStd::span<EventField> fields);
+
+        static size_t GetValueSize(const EventValue& value)
+        {
+            auto GetSize = [](auto&& fieldValue) -> size_t
+            {
+                using FieldType = AZStd::remove_cvref_t<decltype(fieldValue)>;
+                if constexpr (AZStd::same_as<FieldType, AZStd::string_view>)
+                {
+                    return GetStringSize(fieldValue);
+                }
+                else if constexpr (AZStd::same_as<FieldType, bool>)
+                {
+                    return sizeof(AZ::u8);
+                }
+                else if constexpr (AZStd::same_as<FieldType, EventArray>)
+                {
+                    size_t size = sizeof(AZ::u32);
+                    for (const EventValue& element : fieldValue.GetArrayValues())
+                    {
+                        size += GetValueSize(element);
+                    }
+                    return size;
+                }
+                else if constexpr (AZStd::same_as<FieldType, EventObject>)
+                {
+                    return GetObjectSize(fieldValue.GetObjectFields());
+                }
+                else
+                {
+                    return sizeof(FieldType);
+                }
+            };
+            return sizeof(ValueType) + AZStd::visit(GetSize, value.m_value);
+        }
+
+        static size_t GetObjectSize(AZStd::span<EventField> fields)
+        {
+            size_t size = sizeof(AZ::u32);
+            for (const EventField& field : fields)
+            {
+                size += GetStringSize(field.m_name) + GetValueSize(field.m_value);
+            }
+            return size;
+        }
+
+        //! Writes bytes to a ring buffer, wrapping around at its end
+        struct RingWriter
+        {
+            void Write(const void* source, size_t size)
+            {
+                const size_t offset = m_position & m_mask;
+                const size_t firstSize = AZStd::min(size, m_mask + 1 - offset);
+                memcpy(m_data + offset, source, firstSize);
+                memcpy(m_data, static_cast<const AZ::u8*>(source) + firstSize, size - firstSize);
+                m_position += size;
+            }
+
+            template<class T>
+            void WriteValue(const T& value)
+            {
+                Write(&value, sizeof(T));
+            }
+
+            void WriteString(AZStd::string_view value)
+            {
+                WriteValue(static_cast<AZ::u32>(value.size()));
+                Write(value.data(), value.size());
+            }
+
+            void WriteEventValue(const EventValue& value)
+            {
+                auto WriteField = [this](auto&& fieldValue)
+                {
+                    using FieldType = AZStd::remove_cvref_t<decltype(fieldValue)>;
+                    if constexpr (AZStd::same_as<FieldType, AZStd::string_view>)
+                    {
+                        WriteValue(ValueType::String);
+                        WriteString(fieldValue);
+                    }
+                    else if constexpr (AZStd::same_as<FieldType, bool>)
+                    {
+                        WriteValue(ValueType::Bool);
+                        WriteValue(static_cast<AZ::u8>(fieldValue));
+                    }
+                    else if constexpr (AZStd::same_as<FieldType, AZ::s64>)
+                    {
+                        WriteValue(ValueType::Int64);
+                        WriteValue(fieldValue);
+                    }
+                    else if constexpr (AZStd::same_as<FieldType, AZ::u64>)
+                    {
+                        WriteValue(ValueType::Uint64);
+                        WriteValue(fieldValue);
+                    }
+                    else if constexpr (AZStd::same_as<FieldType, double>)
+                    {
+                        WriteValue(ValueType::Double);
+                        WriteValue(fieldValue);
+                    }
+                    else if constexpr (AZStd::same_as<FieldType, EventArray>)
+                    {
+                        WriteValue(ValueType::Array);
+                        AZStd::span<EventValue> elements = fieldValue.GetArrayValues();
+                        WriteValue(static_cast<AZ::u32>(elements.size()));
+                        for (const EventValue& element : elements)
+                        {
+                            WriteEventValue(element);
+                        }
+                    }
+                    else if constexpr (AZStd::same_as<FieldType, EventObject>)
+                    {
+                        WriteValue(ValueType::Object);
+                        WriteObject(fieldValue.GetObjectFields());
+                    }
+                };
+                AZStd::visit(WriteField, value.m_value);
+            }
+
+            void WriteObject(AZStd::span<EventField> fields)
+            {
+                WriteValue(static_cast<AZ::u32>(fields.size()));
+                for (const EventField& field : fields)
+                {
+                    WriteString(field.m_name);
+                    WriteEventValue(field.m_value);
+                }
+            }
+
+            AZ::u8* m_data{};
+            size_t m_mask{};
+            size_t m_position{};
+        };
+
+        //! Reads the payload of an event and rebuilds its args. Arrays and objects are stored in the supplied containers,
+        //! strings refer to the payload
+        struct PayloadReader
+        {
+            bool Read(void* target, size_t size)
+            {
+                if (m_size - m_position < size)
+                {
+                    return false;
+                }
+                memcpy(target, m_data + m_position, size);
+                m_position += size;
+                return true;
+            }
+
+            template<class T>
+            bool ReadValue(T& value)
+            {
+                return Read(&value, sizeof(T));
+            }
+
+            bool ReadString(AZStd::string_view& value)
+            {
+                AZ::u32 size{};
+                if (!ReadValue(size) || m_size - m_position < size)
+                {
+                    return false;
+                }
+                value = AZStd::string_view(reinterpret_cast<const char*>(m_data + m_position), size);
+                m_position += size;
+                return true;
+            }
+
+            bool ReadEventValue(EventValue& value, int depth)
+            {
+                ValueType valueType{};
+                if (!ReadValue(valueType))
+                {
+                    return false;
+                }
+
+                switch (valueType)
+                {
+                case ValueType::String:
+                {
+                    AZStd::string_view stringValue;
+                    value.m_value = stringValue;
+                    return ReadString(AZStd::get<AZStd::string_view>(value.m_value));
+                }
+                case ValueType::Bool:
+                {
+                    AZ::u8 boolValue{};
+                    value.m_value = false;
+                    if (!ReadValue(boolValue))
+                    {
+                        return false;
+                    }
+                    value.m_value = boolValue != 0;
+                    return true;
+                }
+                case ValueType::Int64:
+                {
+                    AZ::s64 intValue{};
+                    const bool result = ReadValue(intValue);
+                    value.m_value = intValue;
+                    return result;
+                }
+                case ValueType::Uint64:
+                {
+                    AZ::u64 uintValue{};
+                    const bool result = ReadValue(uintValue);
+                    value.m_value = uintValue;
+                    return result;
+                }
+                case ValueType::Double:
+                {
+                    double doubleValue{};
+                    const bool result = ReadValue(doubleValue);
+                    value.m_value = doubleValue;
+                    return result;
+                }
+                case ValueType::Array:
+                {
+                    AZ::u32 elementCount{};
+                    if (depth >= MaxArgsDepth || !ReadValue(elementCount) || elementCount > m_size - m_position)
+                    {
+                        return false;
+                    }
+                    AZStd::vector<EventValue> elements(elementCount);
+                    for (EventValue& element : elements)
+                    {
+                        if (!ReadEventValue(element, depth + 1))
+                        {
+                            return false;
+                        }
+                    }
+                    value.m_value = EventArray(elements);
+                    m_arrayStorage.push_back(AZStd::move(elements));
+                    return true;
+                }
+                case ValueType::Object:
+                {
+                    EventObject objectValue;
+                    if (depth >= MaxArgsDepth || !ReadObject(objectValue, depth + 1))
+                    {
+                        return false;
+                    }
+                    value.m_value = objectValue;
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            bool ReadObject(EventObject& objectValue, int depth)
+            {
+                AZ::u32 fieldCount{};
+                if (!ReadValue(fieldCount) || fieldCount > m_size - m_position)
+                {
+                    return false;
+                }
+                AZStd::vector<EventField> fields(fieldCount);
+                for (EventField& field : fields)
+                {
+                    if (!ReadString(field.m_name) || !ReadEventValue(field.m_value, depth))
+                    {
+                        return false;
+                    }
+                }
+                // Moving the vector keeps its elements at the same address
+                objectValue.SetObjectFields(fields);
+                m_objectStorage.push_back(AZStd::move(fields));
+                return true;
+            }
+
+            const AZ::u8* m_data{};
+            size_t m_size{};
+            size_t m_position{};
+            AZStd::vector<AZStd::vector<EventValue>> m_arrayStorage;
+            AZStd::vector<AZStd::vector<EventField>> m_objectStorage;
+        };
+
+        //! Exposes writing an event with a given timestamp and thread to the JSON trace format
+        class JsonTraceConverter
+            : public JsonTraceEventLogger
+        {
+        public:
+            using JsonTraceEventLogger::JsonTraceEventLogger;
+            using JsonTraceEventLogger::FlushRequest;
+        };
+
+        static AZ::u64 GetNumericThreadId(AZStd::thread::id threadId)
+        {
+            // Matches the conversion the JsonTraceEventLogger uses to write the "tid" field
+            static_assert(sizeof(AZStd::thread::id) <= sizeof(AZ::u64), "The thread id is expected to fit in 64 bits");
+            AZ::u64 numericThreadId{};
+            memcpy(&numericThreadId, &threadId, sizeof(threadId));
+            return numericThreadId;
+        }
+
+        static AZStd::thread::id GetThreadId(AZ::u64 numericThreadId)
+        {
+            AZStd::thread::id threadId;
+            memcpy(&threadId, &numericThreadId, sizeof(threadId));
+            return threadId;
+        }
+
+        //! Rounds the record count up to a power of two, so positions in the ring buffer can be masked
+        static size_t GetRecordsPerThread(size_t recordCount)
+        {
+            size_t powerOfTwoCount = 2;
+            while (powerOfTwoCount < recordCount)
+            {
+                powerOfTwoCount <<= 1;
+            }
+            return powerOfTwoCount;
+        }
+
+        static AZStd::atomic<AZ::u64> s_nextLoggerInstanceId{ 1 };
+
+        //! Guards the list of loggers that exist, which threads check on exit before touching the buffers they recorded to
+        static AZStd::mutex& GetLiveLoggersMutex()
+        {
+            static AZStd::mutex s_liveLoggersMutex;
+            return s_liveLoggersMutex;
+        }
+    } // namespace BinaryTraceInternal
+
+    //! Ring buffer of records written by a single thread and drained by the flush
+    struct BinaryTraceEventLogger::ThreadBuffer
+    {
+        ThreadBuffer(size_t recordCount, AZStd::thread::id threadId)
+            : m_recordCount(recordCount)
+            , m_threadId(threadId)
+            , m_numericThreadId(BinaryTraceInternal::GetNumericThreadId(threadId))
+        {
+            m_records.resize_no_construct(recordCount * RecordSize);
+        }
+
+        AZStd::vector<AZ::u8> m_records;
+        const size_t m_recordCount;
+        const AZStd::thread::id m_threadId;
+        const AZ::u64 m_numericThreadId;
+
+        //! Total number of records written, only stored by the recording thread
+        alignas(64) AZStd::atomic<AZ::u64> m_head{};
+        //! Total number of records written to the stream, only stored by the flush
+        alignas(64) AZStd::atomic<AZ::u64> m_tail{};
+        //! Set when the recording thread exits, after which the buffer is freed once all of its records are written
+        AZStd::atomic_bool m_threadExited{};
+    };
+
+    //! Remembers the buffers of a thread, so they can be found without taking a lock and reclaimed once the thread exits
+    struct BinaryTraceEventLogger::ThreadBufferCache
+    {
+        //! Number of loggers whose buffers are tracked per thread. Buffers a thread creates beyond this aren't reclaimed when the
+        //! thread exits, they are only freed along with their logger
+        static constexpr size_t MaxTrackedBuffers = 8;
+
+        struct Entry
+        {
+            AZ::u64 m_instanceId{};
+            ThreadBuffer* m_threadBuffer{};
+        };
+
+        ~ThreadBufferCache()
+        {
+            OnThreadExit(*this);
+        }
+
+        //! The buffer the thread used last, which avoids the search as long as a thread records to one logger
+        Entry m_lastUsed;
+        AZStd::fixed_vector<Entry, MaxTrackedBuffers> m_entries;
+    };
+
+    //! Loggers that haven't been destroyed yet, guarded by the live loggers mutex
+    static BinaryTraceEventLogger* s_liveLoggers{};
+
+    //! Everything an event needs in addition to the common event args
+    struct BinaryTraceEventLogger::EventRecordDesc
+    {
+        EventPhase m_phase{ EventPhase::Complete };
+        const EventArgs* m_eventArgs{};
+        AZStd::optional<AZStd::string_view> m_id;
+        AZStd::optional<AZStd::string_view> m_scope;
+        AZStd::optional<InstantEventScope> m_instantScope;
+        AZStd::chrono::microseconds m_duration{};
+        AZStd::optional<AZStd::chrono::microseconds> m_threadDuration;
+    };
+
+    BinaryTraceEventLogger::BinaryTraceEventLogger(BinaryTraceEventLoggerConfig config)
+        : BinaryTraceEventLogger(nullptr, AZStd::move(config))
+    {
+    }
+
+    BinaryTraceEventLogger::BinaryTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream)
+        : BinaryTraceEventLogger(AZStd::move(stream), BinaryTraceEventLoggerConfig{})
+    {
+    }
+
+    BinaryTraceEventLogger::BinaryTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream, BinaryTraceEventLoggerConfig config)
+        : m_instanceId(BinaryTraceInternal::s_nextLoggerInstanceId++)
+        , m_recordsPerThread(BinaryTraceInternal::GetRecordsPerThread(config.m_recordsPerThread))
+        , m_flushInterval(config.m_flushInterval)
+        , m_name(config.m_loggerName)
+        , m_settingsRegistry{ config.m_settingsRegistry }
+    {
+        {
+            AZStd::scoped_lock liveLoggersLock(BinaryTraceInternal::GetLiveLoggersMutex());
+            m_nextLiveLogger = s_liveLoggers;
+            s_liveLoggers = this;
+        }
+
+        ResetSettingsHandler();
+        ResetStream(AZStd::move(stream));
+
+        if (m_flushInterval.count() > 0)
+        {
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "BinaryTraceEventLogger Flush";
+            m_flushThread = AZStd::thread(threadDesc, [this]()
+            {
+                FlushThreadMain();
+            });
+        }
+    }
+
+    BinaryTraceEventLogger::~BinaryTraceEventLogger()
+    {
+        {
+            // Threads that exit from now on leave the buffers alone, they are freed along with the logger
+            AZStd::scoped_lock liveLoggersLock(BinaryTraceInternal::GetLiveLoggersMutex());
+            BinaryTraceEventLogger** liveLogger = &s_liveLoggers;
+            while (*liveLogger != this)
+            {
+                liveLogger = &(*liveLogger)->m_nextLiveLogger;
+            }
+            *liveLogger = m_nextLiveLogger;
+        }
+
+        StopFlushThread();
+        FlushThreadBuffers();
+    }
+
+    bool BinaryTraceEventLogger::GetDefaultActiveState()
+    {
+#if !defined(AZ_RELEASE_BUILD)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void BinaryTraceEventLogger::SetName(AZStd::string_view name)
+    {
+        const bool nameChanged = m_name != name;
+        m_name = name;
+        if (nameChanged)
+        {
+            ResetSettingsHandler();
+        }
+    }
+
+    AZStd::string_view BinaryTraceEventLogger::GetName() const
+    {
+        return m_name;
+    }
+
+    void BinaryTraceEventLogger::Flush()
+    {
+        FlushThreadBuffers();
+    }
+
+    auto BinaryTraceEventLogger::RecordDurationEventBegin(const DurationArgs& durationArgs) -> ResultOutcome
+    {
+        EventRecordDesc eventRecordDesc;
+        eventRecordDesc.m_phase = EventPhase::DurationBegin;
+        eventRecordDesc.m_eventArgs = &durationArgs;
+        eventRecordDesc.m_id = durationArgs.m_id;
+        return RecordEvent(eventRecordDesc);
+    }
+
+    auto BinaryTraceEventLogger::RecordDurationEventEnd(const DurationArgs& durationArgs) -> ResultOutcome
+    {
+        EventRecordDesc eventRecordDesc;
+        eventRecordDesc.m_phase = EventPhase::DurationEnd;
+        eventRecordDesc.m_eventArgs = &durationArgs;
+        eventRecordDesc.m_id = durationArgs.m_id;
+        return RecordEvent(eventRecordDesc);
+    }
+
+    auto BinaryTraceEventLogger::RecordCompleteEvent(const CompleteArgs& completeArgs) -> ResultOutcome
+    {
+        EventRecordDesc eventRecordDesc;
+        eventRecordDesc.m_phase = EventPhase::Complete;
+        eventRecordDesc.m_eventArgs = &completeArgs;
+        eventRecordDesc.m_id = completeArgs.m_id;
+        eventRecordDesc.m_duration = completeArgs.m_dur;
+        eventRecordDesc.m_threadDuration = completeArgs.m_tdur;
+        return RecordEvent(eventRecordDesc);
+    }
+
+    auto BinaryTraceEventLogger::RecordInstantEvent(const InstantArgs& instantArgs) -> ResultOutcome
+    {
+        EventRecordDesc eventRecordDesc;
+        eventRecordDesc.m_phase = EventPhase::Instant;
+        eventRecordDesc.m_eventArgs = &instantArgs;
+        eventRecordDesc.m_id = instantArgs.m_id;
+        eventRecordDesc.m_instantScope = instantArgs.m_scope;
+        return RecordEvent(eventRecordDesc);
+    }
+
+    auto BinaryTraceEventLogger::RecordCounterEvent(const CounterArgs& counterArgs) -> ResultOutcome
+    {
+        EventRecordDesc eventRecordDesc;
+        eventRecordDesc.m_phase = EventPhase::Counter;
+        eventRecordDesc.m_eventArgs = &counterArgs;
+        eventRecordDesc.m_id = counterArgs.m_id;
+        return RecordEvent(eventRecordDesc);
+    }
+
+    auto BinaryTraceEventLogger::RecordAsyncEventStart(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        EventRecordDesc eventRecordDesc;
+        eventRecordDesc.m_phase = EventPhase::AsyncStart;
+        eventRecordDesc.m_eventArgs = &asyncArgs;
+        eventRecordDesc.m_id = asyncArgs.m_id;
+        eventRecordDesc.m_scope = asyncArgs.m_scope;
+        return RecordEvent(eventRecordDesc);
+    }
+
+    auto BinaryTraceEventLogger::RecordAsyncEventInstant(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        EventRecordDesc eventRecordDesc;
+        eventRecordDesc.m_phase = EventPhase::AsyncInstant;
+        eventRecordDesc.m_eventArgs = &asyncArgs;
+        eventRecordDesc.m_id = asyncArgs.m_id;
+        eventRecordDesc.m_scope = asyncArgs.m_scope;
+        return RecordEvent(eventRecordDesc);
+    }
+
+    auto BinaryTraceEventLogger::RecordAsyncEventEnd(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        EventRecordDesc eventRecordDesc;
+        eventRecordDesc.m_phase = EventPhase::AsyncEnd;
+        eventRecordDesc.m_eventArgs = &asyncArgs;
+        eventRecordDesc.m_id = asyncArgs.m_id;
+        eventRecordDesc.m_scope = asyncArgs.m_scope;
+        return RecordEvent(eventRecordDesc);
+    }
+
+    auto BinaryTraceEventLogger::RecordEvent(const EventRecordDesc& eventRecordDesc) -> ResultOutcome
+    {
+        using namespace BinaryTraceInternal;
+
+        if (!m_active.load(AZStd::memory_order_relaxed))
+        {
+            // Event logger isn't active, return success
+            return AZ::Success();
+        }
+
+        const EventArgs& eventArgs = *eventRecordDesc.m_eventArgs;
+
+        EventHeader eventHeader{};
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventHeader.m_timestamp = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()).count();
+        eventHeader.m_duration = eventRecordDesc.m_duration.count();
+        eventHeader.m_phase = static_cast<char>(eventRecordDesc.m_phase);
+
+        size_t payloadSize = GetStringSize(eventArgs.m_name) + GetStringSize(eventArgs.m_cat) + GetObjectSize(eventArgs.m_args);
+        if (eventRecordDesc.m_id)
+        {
+            eventHeader.m_flags |= HasId;
+            payloadSize += GetStringSize(*eventRecordDesc.m_id);
+        }
+        if (eventRecordDesc.m_scope)
+        {
+            eventHeader.m_flags |= HasScope;
+            payloadSize += GetStringSize(*eventRecordDesc.m_scope);
+        }
+        if (eventRecordDesc.m_instantScope)
+        {
+            eventHeader.m_flags |= HasInstantScope;
+            eventHeader.m_instantScope = static_cast<char>(*eventRecordDesc.m_instantScope);
+        }
+        if (eventRecordDesc.m_threadDuration)
+        {
+            eventHeader.m_flags |= HasThreadDuration;
+            eventHeader.m_threadDuration = eventRecordDesc.m_threadDuration->count();
+        }
+        eventHeader.m_payloadSize = static_cast<AZ::u32>(payloadSize);
+
+        const size_t recordCount = (sizeof(EventHeader) + payloadSize + RecordSize - 1) / RecordSize;
+
+        ThreadBuffer& threadBuffer = GetThreadBuffer();
+        const AZ::u64 head = threadBuffer.m_head.load(AZStd::memory_order_relaxed);
+        const AZ::u64 tail = threadBuffer.m_tail.load(AZStd::memory_order_acquire);
+        if (head + recordCount - tail > threadBuffer.m_recordCount)
+        {
+            m_droppedEventCount.fetch_add(1, AZStd::memory_order_relaxed);
+            return AZ::Failure(recordCount > threadBuffer.m_recordCount
+                    ? ErrorString("The event is larger than the thread buffer of the logger and cannot be recorded")
+                    : ErrorString("The thread buffer of the logger is full. The event has been dropped"));
+        }
+
+        RingWriter writer{ threadBuffer.m_records.data(), threadBuffer.m_records.size() - 1, head * RecordSize };
+        writer.WriteValue(eventHeader);
+        writer.WriteString(eventArgs.m_name);
+        writer.WriteString(eventArgs.m_cat);
+        if (eventRecordDesc.m_id)
+        {
+            writer.WriteString(*eventRecordDesc.m_id);
+        }
+        if (eventRecordDesc.m_scope)
+        {
+            writer.WriteString(*eventRecordDesc.m_scope);
+        }
+        writer.WriteObject(eventArgs.m_args);
+
+        // Publish the records to the flush
+        threadBuffer.m_head.store(head + recordCount, AZStd::memory_order_release);
+        return AZ::Success();
+    }
+
+    auto BinaryTraceEventLogger::GetThreadBuffer() -> ThreadBuffer&
+    {
+        static thread_local ThreadBufferCache t_threadBufferCache;
+
+        if (t_threadBufferCache.m_lastUsed.m_instanceId == m_instanceId)
+        {
+            return *t_threadBufferCache.m_lastUsed.m_threadBuffer;
+        }
+
+        for (const ThreadBufferCache::Entry& entry : t_threadBufferCache.m_entries)
+        {
+            if (entry.m_instanceId == m_instanceId)
+            {
+                t_threadBufferCache.m_lastUsed = entry;
+                return *entry.m_threadBuffer;
+            }
+        }
+
+        const AZStd::thread::id threadId = AZStd::this_thread::get_id();
+        ThreadBuffer* threadBuffer = nullptr;
+        {
+            AZStd::scoped_lock threadBuffersLock(m_threadBuffersMutex);
+            // The buffer of a thread that wasn't tracked by its cache. Buffers of threads that exited are skipped, as the id
+            // may have been reused by a new thread
+            for (const AZStd::unique_ptr<ThreadBuffer>& existingBuffer : m_threadBuffers)
+            {
+                if (existingBuffer->m_threadId == threadId && !existingBuffer->m_threadExited.load(AZStd::memory_order_relaxed))
+                {
+                    threadBuffer = existingBuffer.get();
+                    break;
+                }
+            }
+
+            if (threadBuffer == nullptr)
+            {
+                threadBuffer = m_threadBuffers.emplace_back(AZStd::make_unique<ThreadBuffer>(m_recordsPerThread, threadId)).get();
+            }
+        }
+
+        if (t_threadBufferCache.m_entries.full())
+        {
+            // Make room by forgetting the buffers of loggers that were destroyed
+            AZStd::scoped_lock liveLoggersLock(BinaryTraceInternal::GetLiveLoggersMutex());
+            AZStd::erase_if(t_threadBufferCache.m_entries, [](const ThreadBufferCache::Entry& entry)
+            {
+                return !IsLoggerAlive(entry.m_instanceId);
+            });
+        }
+
+        t_threadBufferCache.m_lastUsed = { m_instanceId, threadBuffer };
+        if (!t_threadBufferCache.m_entries.full())
+        {
+            t_threadBufferCache.m_entries.push_back(t_threadBufferCache.m_lastUsed);
+        }
+        return *threadBuffer;
+    }
+
+    void BinaryTraceEventLogger::OnThreadExit(ThreadBufferCache& threadBufferCache)
+    {
+        AZStd::scoped_lock liveLoggersLock(BinaryTraceInternal::GetLiveLoggersMutex());
+        for (const ThreadBufferCache::Entry& entry : threadBufferCache.m_entries)
+        {
+            // Buffers of destroyed loggers have already been freed
+            if (IsLoggerAlive(entry.m_instanceId))
+            {
+                entry.m_threadBuffer->m_threadExited.store(true, AZStd::memory_order_release);
+            }
+        }
+        threadBufferCache.m_entries.clear();
+        threadBufferCache.m_lastUsed = {};
+    }
+
+    bool BinaryTraceEventLogger::IsLoggerAlive(AZ::u64 instanceId)
+    {
+        for (const BinaryTraceEventLogger* liveLogger = s_liveLoggers; liveLogger != nullptr; liveLogger = liveLogger->m_nextLiveLogger)
+        {
+            if (liveLogger->m_instanceId == instanceId)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void BinaryTraceEventLogger::FlushThreadBuffers()
+    {
+        using namespace BinaryTraceInternal;
+
+        AZStd::scoped_lock flushLock(m_flushToStreamMutex);
+        if (m_stream == nullptr)
+        {
+            return;
+        }
+
+        {
+            AZStd::scoped_lock threadBuffersLock(m_threadBuffersMutex);
+            m_flushThreadBuffers.clear();
+            for (const AZStd::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+            {
+                m_flushThreadBuffers.push_back(threadBuffer.get());
+            }
+        }
+
+        for (ThreadBuffer* threadBuffer : m_flushThreadBuffers)
+        {
+            const AZ::u64 head = threadBuffer->m_head.load(AZStd::memory_order_acquire);
+            const AZ::u64 tail = threadBuffer->m_tail.load(AZStd::memory_order_relaxed);
+            if (head == tail)
+            {
+                continue;
+            }
+
+            BlockHeader blockHeader{ threadBuffer->m_numericThreadId, static_cast<AZ::u32>(head - tail), 0 };
+            m_stream->Write(sizeof(blockHeader), &blockHeader);
+
+            // The records can wrap around the end of the buffer
+            const size_t bufferSize = threadBuffer->m_records.size();
+            const size_t byteOffset = (tail * RecordSize) & (bufferSize - 1);
+            const size_t byteCount = (head - tail) * RecordSize;
+            const size_t firstByteCount = AZStd::min(byteCount, bufferSize - byteOffset);
+            m_stream->Write(firstByteCount, threadBuffer->m_records.data() + byteOffset);
+            if (firstByteCount < byteCount)
+            {
+                m_stream->Write(byteCount - firstByteCount, threadBuffer->m_records.data());
+            }
+
+            // Hand the records back to the recording thread
+            threadBuffer->m_tail.store(head, AZStd::memory_order_release);
+        }
+        m_flushThreadBuffers.clear();
+
+        // Free the buffers of threads that exited once all of their records are written. The exit is checked first, so no
+        // records can be published after the head is compared
+        AZStd::scoped_lock threadBuffersLock(m_threadBuffersMutex);
+        for (auto threadBufferIt = m_threadBuffers.begin(); threadBufferIt != m_threadBuffers.end();)
+        {
+            ThreadBuffer& threadBuffer = **threadBufferIt;
+            if (threadBuffer.m_threadExited.load(AZStd::memory_order_acquire) &&
+                threadBuffer.m_head.load(AZStd::memory_order_acquire) == threadBuffer.m_tail.load(AZStd::memory_order_relaxed))
+            {
+                threadBufferIt = m_threadBuffers.erase(threadBufferIt);
+            }
+            else
+            {
+                ++threadBufferIt;
+            }
+        }
+    }
+
+    void BinaryTraceEventLogger::FlushThreadMain()
+    {
+        AZStd::unique_lock<AZStd::mutex> flushThreadLock(m_flushThreadMutex);
+        while (!m_stopFlushThread)
+        {
+            m_flushThreadCondition.wait_for(flushThreadLock, m_flushInterval, [this]()
+            {
+                return m_stopFlushThread;
+            });
+
+            flushThreadLock.unlock();
+            FlushThreadBuffers();
+            flushThreadLock.lock();
+        }
+    }
+
+    void BinaryTraceEventLogger::StopFlushThread()
+    {
+        if (m_flushThread.joinable())
+        {
+            {
+                AZStd::scoped_lock flushThreadLock(m_flushThreadMutex);
+                m_stopFlushThread = true;
+            }
+            m_flushThreadCondition.notify_all();
+            m_flushThread.join();
+        }
+    }
+
+    void BinaryTraceEventLogger::ResetStream(AZStd::unique_ptr<AZ::IO::GenericStream> stream)
+    {
+        // Write the events recorded so far to the previous stream
+        FlushThreadBuffers();
+
+        AZStd::scoped_lock flushLock(m_flushToStreamMutex);
+        AZStd::swap(stream, m_stream);
+        if (m_stream != nullptr)
+        {
+            BinaryTraceInternal::FileHeader fileHeader{};
+            memcpy(fileHeader.m_magic, FileMagic.data(), sizeof(fileHeader.m_magic));
+            fileHeader.m_version = FileVersion;
+            fileHeader.m_recordSize = static_cast<AZ::u32>(RecordSize);
+            fileHeader.m_processId = AZ::Platform::GetCurrentProcessId();
+            m_stream->Write(sizeof(fileHeader), &fileHeader);
+        }
+    }
+
+    size_t BinaryTraceEventLogger::GetDroppedEventCount() const
+    {
+        return m_droppedEventCount.load(AZStd::memory_order_relaxed);
+    }
+
+    size_t BinaryTraceEventLogger::GetThreadBufferCount() const
+    {
+        AZStd::scoped_lock threadBuffersLock(m_threadBuffersMutex);
+        return m_threadBuffers.size();
+    }
+
+    void BinaryTraceEventLogger::ResetSettingsHandler()
+    {
+        // Reset the active option back to default active state based on the build configuration
+        // and then query it from the Settings Registry again
+        m_active = GetDefaultActiveState();
+
+        if (auto settingsRegistry = m_settingsRegistry != nullptr ? m_settingsRegistry : AZ::SettingsRegistry::Get();
+            settingsRegistry != nullptr)
+        {
+            // Read the "/O3DE/Metrics/<Name>/Active" setting from the Settings Registry
+            const AZStd::fixed_string<128> eventLoggerActiveSettingKey(SettingsKey(m_name + "/Active"));
+            if (bool active{}; settingsRegistry->Get(active, eventLoggerActiveSettingKey))
+            {
+                m_active = active;
+            }
+
+            auto ActiveStateUpdateFunc = [this](const AZ::SettingsRegistryInterface::NotifyEventArgs& notifyArgs)
+            {
+                const AZStd::fixed_string<128> activeSettingKey(SettingsKey(m_name + "/Active"));
+                if (AZ::SettingsRegistryMergeUtils::IsPathAncestorDescendantOrEqual(notifyArgs.m_jsonKeyPath, activeSettingKey))
+                {
+                    if (auto settingsRegistry = m_settingsRegistry != nullptr ? m_settingsRegistry : AZ::SettingsRegistry::Get();
+                        settingsRegistry != nullptr)
+                    {
+                        // If the key has been deleted, then reset the active state to the default active state
+                        if (settingsRegistry->GetType(activeSettingKey).m_type == AZ::SettingsRegistryInterface::Type::NoType)
+                        {
+                            m_active = GetDefaultActiveState();
+                        }
+                        else if (bool active{}; settingsRegistry->Get(active, activeSettingKey))
+                        {
+                            m_active = active;
+                        }
+                    }
+                }
+            };
+            m_settingsHandler = settingsRegistry->RegisterNotifier(ActiveStateUpdateFunc);
+        }
+    }
+
+    IEventLogger::ResultOutcome ConvertBinaryTraceToJson(
+        AZ::IO::GenericStream& binaryTraceStream, AZStd::unique_ptr<AZ::IO::GenericStream> jsonTraceStream)
+    {
+        using namespace BinaryTraceInternal;
+        using ErrorString = IEventLogger::ErrorString;
+
+        FileHeader fileHeader{};
+        if (binaryTraceStream.Read(sizeof(fileHeader), &fileHeader) != sizeof(fileHeader) ||
+            AZStd::string_view(fileHeader.m_magic, sizeof(fileHeader.m_magic)) != BinaryTraceEventLogger::FileMagic)
+        {
+            return AZ::Failure(ErrorString("The stream doesn't contain a binary trace"));
+        }
+        if (fileHeader.m_version != BinaryTraceEventLogger::FileVersion)
+        {
+            return AZ::Failure(ErrorString::format("Binary trace version %u isn't supported, expected version %u",
+                fileHeader.m_version, BinaryTraceEventLogger::FileVersion));
+        }
+        if (fileHeader.m_recordSize != BinaryTraceEventLogger::RecordSize)
+        {
+            return AZ::Failure(ErrorString::format("Binary trace record size %u isn't supported, expected size %zu",
+                fileHeader.m_recordSize, BinaryTraceEventLogger::RecordSize));
+        }
+
+        JsonTraceConverter jsonTraceWriter(AZStd::move(jsonTraceStream));
+
+        constexpr AZStd::string_view DurationKey = "dur";
+        constexpr AZStd::string_view ThreadDurationKey = "tdur";
+        constexpr AZStd::string_view InstantScopeKey = "s";
+        constexpr AZStd::string_view AsyncScopeKey = "scope";
+
+        AZStd::vector<AZ::u8> blockData;
+        PayloadReader payloadReader;
+        for (;;)
+        {
+            BlockHeader blockHeader{};
+            const AZ::IO::SizeType headerBytesRead = binaryTraceStream.Read(sizeof(blockHeader), &blockHeader);
+            if (headerBytesRead == 0)
+            {
+                // End of the trace
+                break;
+            }
+
+            blockData.resize_no_construct(blockHeader.m_recordCount * BinaryTraceEventLogger::RecordSize);
+            if (headerBytesRead != sizeof(blockHeader) || binaryTraceStream.Read(blockData.size(), blockData.data()) != blockData.size())
+            {
+                return AZ::Failure(ErrorString("The binary trace is truncated"));
+            }
+
+            const AZStd::thread::id threadId = GetThreadId(blockHeader.m_threadId);
+            size_t offset = 0;
+            while (offset < blockData.size())
+            {
+                EventHeader eventHeader;
+                memcpy(&eventHeader, blockData.data() + offset, sizeof(eventHeader));
+                const size_t eventSize = ((sizeof(EventHeader) + eventHeader.m_payloadSize + BinaryTraceEventLogger::RecordSize - 1) /
+                    BinaryTraceEventLogger::RecordSize) * BinaryTraceEventLogger::RecordSize;
+                if (eventSize > blockData.size() - offset)
+                {
+                    return AZ::Failure(ErrorString("The binary trace contains an event that is larger than its block"));
+                }
+
+                payloadReader.m_data = blockData.data() + offset + sizeof(EventHeader);
+                payloadReader.m_size = eventHeader.m_payloadSize;
+                payloadReader.m_position = 0;
+                payloadReader.m_arrayStorage.clear();
+                payloadReader.m_objectStorage.clear();
+
+                AZStd::string_view name;
+                AZStd::string_view category;
+                AZStd::string_view id;
+                AZStd::string_view scope;
+                EventObject args;
+                const bool payloadRead = payloadReader.ReadString(name) && payloadReader.ReadString(category) &&
+                    ((eventHeader.m_flags & HasId) == 0 || payloadReader.ReadString(id)) &&
+                    ((eventHeader.m_flags & HasScope) == 0 || payloadReader.ReadString(scope)) &&
+                    payloadReader.ReadObject(args, 0);
+                if (!payloadRead)
+                {
+                    return AZ::Failure(ErrorString("The binary trace contains an event with corrupted data"));
+                }
+
+                EventDesc eventDesc;
+                eventDesc.SetName(name);
+                eventDesc.SetCategory(category);
+                eventDesc.SetEventPhase(static_cast<EventPhase>(eventHeader.m_phase));
+                eventDesc.SetProcessId(static_cast<AZ::Platform::ProcessId>(fileHeader.m_processId));
+                eventDesc.SetThreadId(threadId);
+                eventDesc.SetTimestamp(AZStd::chrono::microseconds(eventHeader.m_timestamp));
+                eventDesc.SetArgs(args.GetObjectFields());
+                if (eventHeader.m_flags & HasId)
+                {
+                    eventDesc.SetId(id);
+                }
+
+                // Add the same extra parameters the JsonTraceEventLogger adds for each kind of event
+                constexpr size_t MaxExtraFieldCount = 8;
+                AZStd::fixed_vector<EventField, MaxExtraFieldCount> extraParams;
+                if (eventDesc.GetEventPhase() == EventPhase::Complete)
+                {
+                    extraParams.emplace_back(DurationKey, EventValue{ AZStd::in_place_type<AZ::s64>, eventHeader.m_duration });
+                    if (eventHeader.m_flags & HasThreadDuration)
+                    {
+                        extraParams.emplace_back(ThreadDurationKey, EventValue{ AZStd::in_place_type<AZ::s64>, eventHeader.m_threadDuration });
+                    }
+                }
+                if (eventHeader.m_flags & HasInstantScope)
+                {
+                    extraParams.emplace_back(InstantScopeKey,
+                        EventValue{ AZStd::in_place_type<AZStd::string_view>, &eventHeader.m_instantScope, 1 });
+                }
+                if (eventHeader.m_flags & HasScope)
+                {
+                    extraParams.emplace_back(AsyncScopeKey, EventValue{ AZStd::in_place_type<AZStd::string_view>, scope });
+                }
+                eventDesc.SetExtraParams(extraParams);
+
+                if (!jsonTraceWriter.FlushRequest(eventDesc))
+                {
+                    return AZ::Failure(ErrorString("Failed to write an event to the JSON trace stream"));
+                }
+
+                offset += eventSize;
+            }
+        }
+
+        // Completes the JSON array and closes the stream
+        jsonTraceWriter.ResetStream(nullptr);
+        return AZ::Success();
+    }
+
+    static void ConvertBinaryTrace(const AZ::ConsoleCommandContainer& commandArgs)
+    {
+        constexpr const char* ConvertBinaryTraceCommandName = "metrics_ConvertBinaryTrace";
+        if (commandArgs.empty() || commandArgs.size() > 2)
+        {
+            AZ_Error(ConvertBinaryTraceCommandName, false, "Expected the path of a binary trace and optionally the path of the JSON trace.");
+            return;
+        }
+
+        const AZ::IO::FixedMaxPath binaryTracePath(commandArgs[0]);
+        AZ::IO::FixedMaxPath jsonTracePath;
+        if (commandArgs.size() > 1)
+        {
+            jsonTracePath = commandArgs[1];
+        }
+        else
+        {
+            jsonTracePath = binaryTracePath;
+            jsonTracePath.ReplaceExtension(".json");
+        }
+
+        AZ::IO::SystemFileStream binaryTraceStream(binaryTracePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!binaryTraceStream.IsOpen())
+        {
+            AZ_Error(ConvertBinaryTraceCommandName, false, R"(Unable to open binary trace "%s".)", binaryTracePath.c_str());
+            return;
+        }
+
+        constexpr AZ::IO::OpenMode jsonOpenMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath;
+        auto jsonTraceStream = AZStd::make_unique<AZ::IO::SystemFileStream>(jsonTracePath.c_str(), jsonOpenMode);
+        if (!jsonTraceStream->IsOpen())
+        {
+            AZ_Error(ConvertBinaryTraceCommandName, false, R"(Unable to open JSON trace "%s" for writing.)", jsonTracePath.c_str());
+            return;
+        }
+
+        if (auto convertOutcome = ConvertBinaryTraceToJson(binaryTraceStream, AZStd::move(jsonTraceStream)); !convertOutcome)
+        {
+            AZ_Error(ConvertBinaryTraceCommandName, false, R"(Failed to convert binary trace "%s": %s)", binaryTracePath.c_str(),
+                convertOutcome.GetError().c_str());
+            return;
+        }
+        AZ_TracePrintf("Console", R"(Converted binary trace "%s" to "%s")" "\n", binaryTracePath.c_str(), jsonTracePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC("metrics_ConvertBinaryTrace", ConvertBinaryTrace, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Converts a trace written by a BinaryTraceEventLogger to the JSON trace format.\n"
+        "Usage: metrics_ConvertBinaryTrace <binary trace path> [<JSON trace path>]\n"
+        "If no JSON trace path is given, the binary trace path with a .json extension is used.\n");
+} // namespace AZ::Metrics
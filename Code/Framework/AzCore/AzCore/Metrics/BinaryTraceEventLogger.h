@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Metrics/IEventLogger.h>
+
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace AZ::Metrics
+{
+    // Contains BinaryTraceEventLogger specific configuration
+    struct BinaryTraceEventLoggerConfig
+    {
+        //! Name of the BinaryTraceEventLogger
+        AZStd::string_view m_loggerName;
+        //! Settings Registry used to read the "/O3DE/Metrics/<LoggerName>/Active" setting
+        //! If nullptr, the global settings registry is used
+        AZ::SettingsRegistryInterface* m_settingsRegistry{};
+        //! Number of records in the ring buffer of each recording thread. Rounded up to a power of two.
+        //! Events are dropped while the buffer of a thread is full, so this needs to hold all events a thread
+        //! records within one flush interval
+        size_t m_recordsPerThread{ 16384 };
+        //! Interval at which the background thread writes the recorded events to the stream
+        //! If zero, no background thread is started and events are only written when Flush is called
+        AZStd::chrono::milliseconds m_flushInterval{ 100 };
+    };
+
+    //! Event logger with a low enough per-event cost to stay enabled during long captures.
+    //! Instead of formatting JSON on the recording thread, events are copied as fixed-size binary records into a ring buffer
+    //! owned by the recording thread, without taking a lock. A background thread drains the buffers into a compact binary
+    //! stream, which can be converted to the JSON trace format offline with ConvertBinaryTraceToJson.
+    //! An event takes one record for its header and its first bytes of strings and args, plus one more record for every
+    //! RecordSize bytes that don't fit.
+    //! The buffer of a thread is freed by the first flush after the thread exited and its records were written.
+    //! The "metrics_ConvertBinaryTrace" console command converts a binary trace file to a JSON trace file.
+    class BinaryTraceEventLogger
+        : public IEventLogger
+    {
+    public:
+        static constexpr size_t RecordSize = 64;
+
+        //! Identifies a binary trace stream and the version of its layout
+        static constexpr AZStd::string_view FileMagic = "O3DEBTRC";
+        static constexpr AZ::u32 FileVersion = 1;
+
+        explicit BinaryTraceEventLogger(BinaryTraceEventLoggerConfig config = {});
+        //! Generic stream which is owned by the BinaryTraceEventLogger
+        explicit BinaryTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream);
+        BinaryTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream, BinaryTraceEventLoggerConfig config);
+
+        //! Stops the background thread and writes any remaining events to the stream
+        ~BinaryTraceEventLogger();
+
+        //! Set the name associated of this event logger
+        void SetName(AZStd::string_view) override;
+
+        //! Returns the name associated with this event logger
+        AZStd::string_view GetName() const override;
+
+        //! Writes all events recorded so far to the stream
+        void Flush() override;
+
+        ResultOutcome RecordDurationEventBegin(const DurationArgs&) override;
+        ResultOutcome RecordDurationEventEnd(const DurationArgs&) override;
+        ResultOutcome RecordCompleteEvent(const CompleteArgs&) override;
+        ResultOutcome RecordInstantEvent(const InstantArgs&) override;
+        ResultOutcome RecordCounterEvent(const CounterArgs&) override;
+        ResultOutcome RecordAsyncEventStart(const AsyncArgs&) override;
+        ResultOutcome RecordAsyncEventInstant(const AsyncArgs&) override;
+        ResultOutcome RecordAsyncEventEnd(const AsyncArgs&) override;
+
+        //! Writes the recorded events to the previous stream and associates a new stream
+        //! Events recorded while no stream is associated stay in the thread buffers until a stream is set
+        void ResetStream(AZStd::unique_ptr<AZ::IO::GenericStream> stream);
+
+        //! Returns the number of events that couldn't be recorded because the buffer of the recording thread was full
+        size_t GetDroppedEventCount() const;
+
+        //! Returns the number of thread buffers that haven't been freed yet
+        size_t GetThreadBufferCount() const;
+
+    private:
+        struct ThreadBuffer;
+        struct ThreadBufferCache;
+        struct EventRecordDesc;
+
+        ResultOutcome RecordEvent(const EventRecordDesc& eventRecordDesc);
+
+        //! Returns the buffer of the calling thread, creating it on the first event recorded by the thread
+        ThreadBuffer& GetThreadBuffer();
+
+        //! Writes the contents of all thread buffers to the stream, then frees the buffers of threads that exited
+        void FlushThreadBuffers();
+
+        //! Called when a thread that recorded events exits, marks its buffers in all loggers that still exist as reclaimable
+        static void OnThreadExit(ThreadBufferCache& threadBufferCache);
+
+        //! Returns true if the logger with the instance id still exists. The live loggers mutex must be held
+        static bool IsLoggerAlive(AZ::u64 instanceId);
+
+        void FlushThreadMain();
+        void StopFlushThread();
+
+        //! Reads the "/O3DE/Metrics/<Name>/Active" setting and listens for changes to it
+        void ResetSettingsHandler();
+
+        static bool GetDefaultActiveState();
+
+        //! Unique id of this logger, used to validate the buffer cached by each thread
+        const AZ::u64 m_instanceId;
+        //! Next logger in the list of loggers that exist, which is used to tell exiting threads which buffers are still valid
+        BinaryTraceEventLogger* m_nextLiveLogger{};
+        size_t m_recordsPerThread{};
+        AZStd::chrono::milliseconds m_flushInterval{};
+
+        //! Buffers of all threads that recorded an event, only locked when a thread records its first event
+        //! and when flushing
+        mutable AZStd::mutex m_threadBuffersMutex;
+        AZStd::vector<AZStd::unique_ptr<ThreadBuffer>> m_threadBuffers;
+        //! Snapshot of the buffers which is written while the buffers mutex isn't held
+        AZStd::vector<ThreadBuffer*> m_flushThreadBuffers;
+
+        AZStd::mutex m_flushToStreamMutex;
+        AZStd::unique_ptr<AZ::IO::GenericStream> m_stream;
+
+        AZStd::thread m_flushThread;
+        AZStd::mutex m_flushThreadMutex;
+        AZStd::condition_variable m_flushThreadCondition;
+        bool m_stopFlushThread{};
+
+        AZStd::atomic<size_t> m_droppedEventCount{};
+
+        AZStd::string m_name;
+        AZStd::atomic_bool m_active{ GetDefaultActiveState() };
+        AZ::SettingsRegistryInterface* m_settingsRegistry{};
+        AZ::SettingsRegistryInterface::NotifyEventHandler m_settingsHandler;
+    };
+
+    //! Converts a stream written by a BinaryTraceEventLogger to the Google Trace Event JSON format written by the
+    //! JsonTraceEventLogger
+    //! @param binaryTraceStream stream to read the binary trace from
+    //! @param jsonTraceStream stream to write the JSON trace to. The JSON array is completed before the stream is closed
+    //! @return Success if the whole binary trace was converted
+    IEventLogger::ResultOutcome ConvertBinaryTraceToJson(
+        AZ::IO::GenericStream& binaryTraceStream, AZStd::unique_ptr<AZ::IO::GenericStream> jsonTraceStream);
+} // namespace AZ::Metrics
@@ -12,6 +12,8 @@
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -96,6 +98,9 @@ namespace AZ
     
     NameDictionary::~NameDictionary()
     {
+        // Make sure no thread can find name data through its cache while it's being deleted.
+        DetachThreadCaches();
+
         // Unload deferred names
         UnloadDeferredNames();
 
@@ -106,21 +111,24 @@ namespace AZ
 
         [[maybe_unused]] bool leaksDetected = false;
 
-        for (auto i = m_dictionary.begin(), last = m_dictionary.end(); i != last;)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = i->second.m_nameData;
-            const int useCount = nameData->m_useCount;
-
-            if (useCount == 0)
+            for (auto i = shard.m_entries.begin(), last = shard.m_entries.end(); i != last;)
             {
-                i = m_dictionary.erase(i);
-                delete nameData;
-            }
-            else
-            {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
-                ++i;
+                Internal::NameData* nameData = i->second.m_nameData;
+                const int useCount = nameData->m_useCount;
+
+                if (useCount == 0)
+                {
+                    i = shard.m_entries.erase(i);
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
+                    ++i;
+                }
             }
         }
 
@@ -129,7 +137,8 @@ namespace AZ
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        const Shard& shard = GetShard(hash);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
         // The NameData m_useCount check is to avoid a multithread race condition
         // where thread B is in NameData::release and reduces the m_useCount to 0
@@ -138,14 +147,25 @@ namespace AZ
         // If thread A continues along and releases the NameData again, before thread B can run
         // the the m_useCount can be reduced to 0 and multiple threads can be in the
         // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        if (auto iter = shard.m_entries.find(hash);
+            iter != shard.m_entries.end() && iter->second.m_nameData->m_useCount > 0)
         {
             return Name(iter->second.m_nameData);
         }
         return Name();
     }
 
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t count = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+            count += shard.m_entries.size();
+        }
+        return count;
+    }
+
     void NameDictionary::LoadLiteral(Name& nameLiteral)
     {
         if (nameLiteral.m_data == nullptr)
@@ -224,8 +244,30 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        const Name::Hash stringHash = CalcHash(nameString);
 
+        // Names that were recently created on this thread can be resolved without taking any of the shard locks.
+        ThreadCache* threadCache = GetThreadCache();
+        if (threadCache)
+        {
+            Name name = FindInThreadCache(*threadCache, nameString, stringHash);
+            if (!name.IsEmpty())
+            {
+                return name;
+            }
+        }
+
+        Name name = FindOrAddName(nameString, stringHash);
+        if (threadCache)
+        {
+            AZStd::scoped_lock lock(threadCache->m_mutex);
+            threadCache->m_entries[stringHash & (ThreadCacheSize - 1)] = name.m_data.get();
+        }
+        return name;
+    }
+
+    Name NameDictionary::FindOrAddName(AZStd::string_view nameString, Name::Hash hash)
+    {
         // If we find the same name with the same hash, just return it. 
         // This path is faster than the loop below because FindName() takes a shared_lock whereas the
         // loop requires a unique_lock to modify the dictionary.
@@ -235,20 +277,24 @@ namespace AZ
             return AZStd::move(name);
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
+        // The name doesn't exist in the dictionary, so we have to lock and add it.
+        // Only the shard that holds the hash that's currently being probed is locked. This is safe because an
+        // entry that has been involved in a collision is never removed, so the sequence of hashes that's probed
+        // for a name can't change while moving to the next shard.
         bool collisionDetected = false;
         while (true)
         {
+            Shard& shard = GetShard(hash);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+
+            auto iter = shard.m_entries.find(hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_entries.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
-                m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                shard.m_entries.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -262,7 +308,6 @@ namespace AZ
                 collisionDetected = true;
                 iter->second.m_nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -281,10 +326,11 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        Shard& shard = GetShard(hash);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
+        auto dictIt = shard.m_entries.find(hash);
+        if (dictIt == shard.m_entries.end())
         {
             // This check is to safeguard around the following scenario
             // T1, gets into TryReleaseName
@@ -311,13 +357,151 @@ namespace AZ
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
+            shard.m_entries.erase(dictIt);
+            lock.unlock();
+
+            // The entry can no longer be found in the dictionary, but threads could still find it in their cache.
+            RemoveFromThreadCaches(nameData);
             delete nameData;
         }
+        else
+        {
+            lock.unlock();
+        }
 
         ReportStats();
     }
 
+    auto NameDictionary::GetShard(Name::Hash hash) -> Shard&
+    {
+        return m_shards[hash & (ShardCount - 1)];
+    }
+
+    auto NameDictionary::GetShard(Name::Hash hash) const -> const Shard&
+    {
+        return m_shards[hash & (ShardCount - 1)];
+    }
+
+    auto NameDictionary::GetThreadCache() -> ThreadCache*
+    {
+        thread_local ThreadCache threadCache;
+
+        NameDictionary* owner = threadCache.m_owner.load(AZStd::memory_order_acquire);
+        if (owner == this)
+        {
+            return &threadCache;
+        }
+        else if (owner != nullptr)
+        {
+            // A thread only caches names for a single dictionary at a time. This is typically the global
+            // dictionary, so there's no need to switch between dictionaries.
+            return nullptr;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_threadCachesMutex);
+        m_threadCaches.push_back(&threadCache);
+        threadCache.m_owner.store(this, AZStd::memory_order_release);
+        return &threadCache;
+    }
+
+    Name NameDictionary::FindInThreadCache(ThreadCache& cache, AZStd::string_view nameString, Name::Hash stringHash) const
+    {
+        AZStd::scoped_lock lock(cache.m_mutex);
+
+        // The name data can't be deleted while the lock is held as it has to be removed from this cache first.
+        Internal::NameData* nameData = cache.m_entries[stringHash & (ThreadCacheSize - 1)];
+        if (nameData == nullptr || nameData->GetName() != nameString)
+        {
+            return Name();
+        }
+
+        // Only take a reference if the name is still alive. If the use count already dropped to zero the name is about
+        // to be released, in which case the regular lookup will either revive or recreate it.
+        int32_t useCount = nameData->m_useCount.load();
+        do
+        {
+            if (useCount <= 0)
+            {
+                return Name();
+            }
+        } while (!nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1));
+
+        Name result(nameData);
+        // Give up the reference that was taken above, as the Name holds its own now.
+        --nameData->m_useCount;
+        return result;
+    }
+
+    void NameDictionary::RemoveFromThreadCaches(const Internal::NameData* nameData)
+    {
+        const size_t slot = CalcHash(nameData->GetName()) & (ThreadCacheSize - 1);
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_threadCachesMutex);
+        for (ThreadCache* cache : m_threadCaches)
+        {
+            AZStd::scoped_lock cacheLock(cache->m_mutex);
+            if (cache->m_entries[slot] == nameData)
+            {
+                cache->m_entries[slot] = nullptr;
+            }
+        }
+    }
+
+    void NameDictionary::DetachThreadCaches()
+    {
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_threadCachesMutex);
+            for (ThreadCache* cache : m_threadCaches)
+            {
+                AZStd::scoped_lock cacheLock(cache->m_mutex);
+                cache->m_owner.store(nullptr, AZStd::memory_order_release);
+                AZStd::fill(AZStd::begin(cache->m_entries), AZStd::end(cache->m_entries), nullptr);
+            }
+            m_threadCaches.clear();
+        }
+
+        // Threads that are exiting could have picked up this dictionary before it was detached from their cache. Wait for them
+        // to finish unregistering so they don't touch this dictionary after it's been destroyed.
+        while (m_pendingThreadCacheDetaches.load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    void NameDictionary::UnregisterThreadCache(ThreadCache* cache)
+    {
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_threadCachesMutex);
+            if (auto it = AZStd::find(m_threadCaches.begin(), m_threadCaches.end(), cache); it != m_threadCaches.end())
+            {
+                *it = m_threadCaches.back();
+                m_threadCaches.pop_back();
+            }
+        }
+        // This has to be the last access to the dictionary as it may be destroyed immediately after.
+        --m_pendingThreadCacheDetaches;
+    }
+
+    NameDictionary::ThreadCache::~ThreadCache()
+    {
+        NameDictionary* owner = nullptr;
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            owner = m_owner.load();
+            if (owner)
+            {
+                // Registered while holding the cache lock so the dictionary either sees the pending detach or has
+                // already cleared the owner.
+                ++owner->m_pendingThreadCacheDetaches;
+            }
+        }
+
+        if (owner)
+        {
+            owner->UnregisterThreadCache(this);
+        }
+    }
+
     void NameDictionary::ReportStats() const
     {
 #ifdef AZ_DEBUG_BUILD
@@ -333,35 +517,41 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            for (const Shard& shard : m_shards)
             {
-                Internal::NameData* nameData = iter.second.m_nameData;
-                const size_t nameLength = nameData->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
-
-                if (!longestName || longestName->m_name.size() < nameLength)
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+                nameCount += shard.m_entries.size();
+                for (auto& iter : shard.m_entries)
                 {
-                    longestName = nameData;
-                }
+                    Internal::NameData* nameData = iter.second.m_nameData;
+                    const size_t nameLength = nameData->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = nameData;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = nameData;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = nameData;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = nameData;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
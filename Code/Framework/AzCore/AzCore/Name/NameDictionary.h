@@ -11,7 +11,10 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/spin_mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -43,6 +46,10 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! Entries are spread over a number of independently locked shards so threads creating different
+    //! names rarely contend. In addition every thread keeps a small cache of the names it recently
+    //! created, which allows repeated lookups of the same name to complete without taking any shard lock.
     class NameDictionary final
     {
     public:
@@ -87,7 +94,14 @@ namespace AZ
         //! into our list of deferred load names.
         void LoadDeferredNames(Name* deferredHead);
 
+        //! Returns the number of names currently stored in the dictionary.
+        size_t GetEntryCount() const;
+
     private:
+        //! Number of independently locked partitions of the dictionary. Must be a power of 2.
+        static constexpr size_t ShardCount = 32;
+        //! Number of entries in the per-thread cache of recently created names. Must be a power of 2.
+        static constexpr size_t ThreadCacheSize = 64;
 
         void ReportStats() const;
 
@@ -127,8 +141,51 @@ namespace AZ
             NameDictionary& m_nameDictionary;
         };
 
-        AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        //! A partition of the dictionary. Hashes are assigned to shards by their lowest bits so the hashes
+        //! visited while resolving a collision are spread over neighboring shards.
+        struct alignas(64) Shard // Aligned to avoid false sharing between the locks of neighboring shards.
+        {
+            AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_entries;
+            mutable AZStd::shared_mutex m_sharedMutex;
+        };
+
+        //! Direct mapped cache of the names recently created on a thread, indexed by the hash of the name string.
+        //! The cache doesn't hold a reference to the NameData, instead the dictionary removes the NameData from all
+        //! thread caches before deleting it. The spin mutex is only contended while that happens.
+        struct ThreadCache
+        {
+            ~ThreadCache();
+
+            AZStd::spin_mutex m_mutex;
+            AZStd::atomic<NameDictionary*> m_owner{ nullptr };
+            Internal::NameData* m_entries[ThreadCacheSize]{};
+        };
+
+        //! Finds the entry for the name string or adds a new one, resolving hash collisions along the way.
+        Name FindOrAddName(AZStd::string_view nameString, Name::Hash hash);
+
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        //! Returns the cache for the calling thread or null if the thread's cache is in use by another dictionary.
+        ThreadCache* GetThreadCache();
+        //! Returns a Name for the cached entry of the provided name string if there is one that's still alive.
+        Name FindInThreadCache(ThreadCache& cache, AZStd::string_view nameString, Name::Hash stringHash) const;
+        //! Removes the NameData from the caches of all threads. Must be called before the NameData is deleted.
+        void RemoveFromThreadCaches(const Internal::NameData* nameData);
+        //! Stops all thread caches from referring to this dictionary.
+        void DetachThreadCaches();
+        //! Called when a thread exits to remove its cache from this dictionary.
+        void UnregisterThreadCache(ThreadCache* cache);
+
+
+        Shard m_shards[ShardCount];
+
+        //! Caches of all threads that created names through this dictionary.
+        AZStd::vector<ThreadCache*> m_threadCaches;
+        mutable AZStd::shared_mutex m_threadCachesMutex;
+        //! Number of exiting threads that are still in the process of unregistering their cache.
+        AZStd::atomic<u32> m_pendingThreadCacheDetaches{ 0 };
 
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
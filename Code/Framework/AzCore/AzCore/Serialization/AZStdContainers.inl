@@ -469,6 +469,23 @@ namespace AZ
                 }
                 return nullptr;
             }
+
+        public:
+            /// Resizes the container and returns the address of the first element. Trivial elements are left uninitialized,
+            /// since they're loaded right after.
+            void* ResizeContiguousElements(void* instance, size_t numElements) override
+            {
+                auto arrayPtr = reinterpret_cast<T*>(instance);
+                if constexpr (AZStd::is_trivially_default_constructible_v<typename T::value_type>)
+                {
+                    arrayPtr->resize_no_construct(numElements);
+                }
+                else
+                {
+                    arrayPtr->resize(numElements);
+                }
+                return arrayPtr->data();
+            }
         };
         template<class T, bool IsStableIterators, size_t N>
         class AZStdFixedCapacityRandomAccessContainer
@@ -500,6 +517,15 @@ namespace AZ
                 }
                 return nullptr;
             }
+
+            void* ResizeContiguousElements(void* instance, size_t numElements) override
+            {
+                if (numElements > N)
+                {
+                    return nullptr;
+                }
+                return AZStdRandomAccessContainer<T, IsStableIterators>::ResizeContiguousElements(instance, numElements);
+            }
         };
 
         class AZStdArrayEvents : public SerializeContext::IEventHandler
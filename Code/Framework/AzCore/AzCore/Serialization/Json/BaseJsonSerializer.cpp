@@ -19,10 +19,12 @@ namespace AZ
     //
 
     JsonBaseContext::JsonBaseContext(JsonSerializationMetadata& metadata, JsonSerializationResult::JsonIssueCallback reporting,
-        StackedString::Format pathFormat, SerializeContext* serializeContext, JsonRegistrationContext* registrationContext)
+        StackedString::Format pathFormat, SerializeContext* serializeContext, JsonRegistrationContext* registrationContext,
+        JsonSerializationPlanCache* planCache)
         : m_metadata(metadata)
         , m_serializeContext(serializeContext)
         , m_registrationContext(registrationContext)
+        , m_planCache(planCache)
         , m_path(pathFormat)
     {
         m_reporters.push(AZStd::move(reporting));
@@ -116,6 +118,11 @@ namespace AZ
         return m_registrationContext;
     }
 
+    JsonSerializationPlanCache* JsonBaseContext::GetPlanCache()
+    {
+        return m_planCache;
+    }
+
 
 
     //
@@ -124,7 +131,7 @@ namespace AZ
 
     JsonDeserializerContext::JsonDeserializerContext(JsonDeserializerSettings& settings)
         : JsonBaseContext(settings.m_metadata, settings.m_reporting,
-            StackedString::Format::JsonPointer, settings.m_serializeContext, settings.m_registrationContext)
+            StackedString::Format::JsonPointer, settings.m_serializeContext, settings.m_registrationContext, settings.m_planCache)
         , m_clearContainers(settings.m_clearContainers)
     {
     }
@@ -142,7 +149,7 @@ namespace AZ
 
     JsonSerializerContext::JsonSerializerContext(JsonSerializerSettings& settings, rapidjson::Document::AllocatorType& jsonAllocator)
         : JsonBaseContext(settings.m_metadata, settings.m_reporting, StackedString::Format::ContextPath,
-            settings.m_serializeContext, settings.m_registrationContext)
+            settings.m_serializeContext, settings.m_registrationContext, settings.m_planCache)
         , m_jsonAllocator(jsonAllocator)
         , m_keepDefaults(settings.m_keepDefaults)
     {
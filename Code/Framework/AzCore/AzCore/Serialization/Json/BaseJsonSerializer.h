@@ -23,7 +23,8 @@ namespace AZ
     {
     public:
         JsonBaseContext(JsonSerializationMetadata& metadata, JsonSerializationResult::JsonIssueCallback reporting,
-            StackedString::Format pathFormat, SerializeContext* serializeContext, JsonRegistrationContext* registrationContext);
+            StackedString::Format pathFormat, SerializeContext* serializeContext, JsonRegistrationContext* registrationContext,
+            JsonSerializationPlanCache* planCache);
         virtual ~JsonBaseContext() = default;
 
         //! Report progress and issues. Users can change the return code to change the behavior of the (de)serializer.
@@ -66,6 +67,9 @@ namespace AZ
         JsonRegistrationContext* GetRegistrationContext();
         const JsonRegistrationContext* GetRegistrationContext() const;
 
+        //! Optional cache with precompiled plans per type. Returns null if no cache was provided through the settings.
+        JsonSerializationPlanCache* GetPlanCache();
+
     protected:
         //! Callback used to report progress and issues. Users of the serialization can update the return code to change
         //! the behavior of the serializer.
@@ -82,6 +86,8 @@ namespace AZ
         SerializeContext* m_serializeContext = nullptr;
         //! The registration context for the json serialization. This can be used to retrieve the handlers for specific types.
         JsonRegistrationContext* m_registrationContext = nullptr;
+        //! Optional cache of per type plans to avoid repeatedly looking up the members of classes.
+        JsonSerializationPlanCache* m_planCache = nullptr;
     };
 
     class JsonDeserializerContext final
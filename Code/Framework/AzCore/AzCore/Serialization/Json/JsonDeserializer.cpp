@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/CastingHelpers.h>
 #include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
 #include <AzCore/Serialization/Json/JsonStringConversionUtils.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
@@ -191,6 +192,10 @@ namespace AZ
 
         AZ_Assert(context.GetRegistrationContext() && context.GetSerializeContext(), "Expected valid registration context and serialize context.");
 
+        const JsonClassPlan* plan = context.GetPlanCache()
+            ? &context.GetPlanCache()->GetPlan(classData, *context.GetSerializeContext(), *context.GetRegistrationContext())
+            : nullptr;
+
         size_t numLoads = 0;
         ResultCode retVal(Tasks::ReadField);
         for (auto iter = value.MemberBegin(); iter != value.MemberEnd(); ++iter)
@@ -202,12 +207,30 @@ namespace AZ
                 continue;
             }
             Crc32 nameCrc(name);
-            ElementDataResult foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            ElementDataResult foundElementData;
+            BaseJsonSerializer* serializer = nullptr;
+            if (plan)
+            {
+                if (const JsonClassPlan::LoadField* field = plan->FindLoadField(nameCrc))
+                {
+                    foundElementData.m_data = reinterpret_cast<char*>(object) + field->m_offset;
+                    foundElementData.m_info = field->m_element;
+                    foundElementData.m_found = true;
+                    serializer = field->m_serializer;
+                }
+            }
+            else
+            {
+                foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            }
 
             ScopedContextPath subPath(context, name);
             if (foundElementData.m_found)
             {
-                ResultCode result = LoadWithClassElement(foundElementData.m_data, val, *foundElementData.m_info, context);
+                // The plan already resolved the serializer for the member, so skip straight to it instead of looking it up again.
+                ResultCode result = serializer
+                    ? DeserializerDefaultCheck(serializer, foundElementData.m_data, foundElementData.m_info->m_typeId, val, false, context)
+                    : LoadWithClassElement(foundElementData.m_data, val, *foundElementData.m_info, context);
                 retVal.Combine(result);
 
                 if (result.GetProcessing() == Processing::Halted)
@@ -226,7 +249,7 @@ namespace AZ
             }
         }
 
-        size_t elementCount = CountElements(*context.GetSerializeContext(), classData);
+        size_t elementCount = plan ? plan->GetElementCount() : CountElements(*context.GetSerializeContext(), classData);
         if (elementCount > numLoads)
         {
             retVal.Combine(ResultCode(Tasks::ReadField, numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    //
+    // JsonClassPlan
+    //
+
+    JsonClassPlan::JsonClassPlan(const SerializeContext::ClassData& classData, const SerializeContext& serializeContext,
+        const JsonRegistrationContext& registrationContext)
+        : m_classData(&classData)
+    {
+        m_storeFields.reserve(classData.m_elements.size());
+        for (const SerializeContext::ClassElement& element : classData.m_elements)
+        {
+            StoreField& field = m_storeFields.emplace_back();
+            field.m_element = &element;
+            const SerializeContext::ClassData* elementClassData = serializeContext.FindClassData(element.m_typeId);
+            // Leave incomplete type information to the regular lookup, so the issue gets reported.
+            field.m_classData = (elementClassData && elementClassData->m_azRtti) ? elementClassData : nullptr;
+        }
+
+        AddLoadFields(classData, 0, serializeContext, registrationContext);
+        BuildLookupTable();
+    }
+
+    const SerializeContext::ClassData& JsonClassPlan::GetClassData() const
+    {
+        return *m_classData;
+    }
+
+    const JsonClassPlan::LoadField* JsonClassPlan::FindLoadField(Crc32 nameCrc) const
+    {
+        const u32 crc = static_cast<u32>(nameCrc);
+        if (m_slots.empty())
+        {
+            // No perfect hash could be created, which should be very rare, so fall back to a linear search.
+            auto it = AZStd::find_if(m_loadFields.begin(), m_loadFields.end(),
+                [crc](const LoadField& field)
+                {
+                    return field.m_nameCrc == crc;
+                });
+            return it != m_loadFields.end() ? &*it : nullptr;
+        }
+
+        const u16 index = m_slots[GetSlot(crc)];
+        if (index != 0 && m_loadFields[index - 1].m_nameCrc == crc)
+        {
+            return &m_loadFields[index - 1];
+        }
+        return nullptr;
+    }
+
+    AZStd::span<const JsonClassPlan::StoreField> JsonClassPlan::GetStoreFields() const
+    {
+        return m_storeFields;
+    }
+
+    size_t JsonClassPlan::GetElementCount() const
+    {
+        return m_elementCount;
+    }
+
+    void JsonClassPlan::AddLoadFields(const SerializeContext::ClassData& classData, size_t baseOffset,
+        const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext)
+    {
+        // This visits the elements in the same order as JsonDeserializer::FindElementByNameCrc. Base class information is
+        // stored first in the elements, so walking them in reverse lets members of derived classes take precedence over
+        // members with the same name in a base class. Only the first occurrence of a name is kept.
+        for (auto element = classData.m_elements.crbegin(); element != classData.m_elements.crend(); ++element)
+        {
+            const size_t offset = baseOffset + element->m_offset;
+            const u32 nameCrc = static_cast<u32>(element->m_nameCrc);
+            auto existing = AZStd::find_if(m_loadFields.begin(), m_loadFields.end(),
+                [nameCrc](const LoadField& field)
+                {
+                    return field.m_nameCrc == nameCrc;
+                });
+            if (existing == m_loadFields.end())
+            {
+                LoadField& field = m_loadFields.emplace_back();
+                field.m_element = &*element;
+                field.m_offset = offset;
+                field.m_nameCrc = nameCrc;
+                // Pointers are resolved first, so the serializer for the type can't be used directly.
+                if ((element->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) == 0)
+                {
+                    field.m_serializer = registrationContext.GetSerializerForType(element->m_typeId);
+                }
+            }
+
+            if (element->m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS)
+            {
+                if (const SerializeContext::ClassData* baseClassData = serializeContext.FindClassData(element->m_typeId))
+                {
+                    AddLoadFields(*baseClassData, offset, serializeContext, registrationContext);
+                }
+            }
+            else
+            {
+                m_elementCount++;
+            }
+        }
+    }
+
+    namespace JsonClassPlanInternal
+    {
+        static u32 HashName(u32 nameCrc, u32 seed)
+        {
+            // The name crcs are already well distributed, but still need to be mixed with the seed.
+            u32 hash = nameCrc ^ (seed * 0x9E3779B9u);
+            hash ^= hash >> 16;
+            hash *= 0x85EBCA6Bu;
+            hash ^= hash >> 13;
+            hash *= 0xC2B2AE35u;
+            hash ^= hash >> 16;
+            return hash;
+        }
+    } // namespace JsonClassPlanInternal
+
+    void JsonClassPlan::BuildLookupTable()
+    {
+        if (m_loadFields.empty() || m_loadFields.size() >= AZStd::numeric_limits<u16>::max())
+        {
+            return;
+        }
+
+        // Aim for about four names per bucket and a table with at least twice as many slots as names. This practically
+        // always succeeds the first time, but in case it doesn't the number of slots is increased.
+        size_t bucketCount = 1;
+        while (bucketCount * 4 < m_loadFields.size())
+        {
+            bucketCount <<= 1;
+        }
+        size_t slotCount = 2;
+        while (slotCount < m_loadFields.size() * 2)
+        {
+            slotCount <<= 1;
+        }
+
+        constexpr size_t MaxSlotCount = size_t{ 1 } << 16;
+        for (; slotCount <= MaxSlotCount; slotCount <<= 1)
+        {
+            if (TryBuildLookupTable(bucketCount, slotCount))
+            {
+                return;
+            }
+        }
+        m_bucketSeeds = {};
+        m_slots = {};
+    }
+
+    bool JsonClassPlan::TryBuildLookupTable(size_t bucketCount, size_t slotCount)
+    {
+        using namespace JsonClassPlanInternal;
+
+        constexpr u32 MaxSeed = 1024;
+
+        m_bucketSeeds.assign(bucketCount, 0);
+        m_slots.assign(slotCount, 0);
+
+        AZStd::vector<AZStd::vector<u16>> buckets(bucketCount);
+        for (size_t i = 0; i < m_loadFields.size(); ++i)
+        {
+            buckets[HashName(m_loadFields[i].m_nameCrc, 0) & (bucketCount - 1)].push_back(static_cast<u16>(i));
+        }
+
+        // Place the largest buckets first while there's still plenty of room in the table.
+        AZStd::vector<size_t> bucketOrder(bucketCount);
+        for (size_t i = 0; i < bucketCount; ++i)
+        {
+            bucketOrder[i] = i;
+        }
+        AZStd::sort(bucketOrder.begin(), bucketOrder.end(),
+            [&buckets](size_t lhs, size_t rhs)
+            {
+                return buckets[lhs].size() != buckets[rhs].size() ? buckets[lhs].size() > buckets[rhs].size() : lhs < rhs;
+            });
+
+        AZStd::vector<size_t> bucketSlots;
+        for (size_t bucketIndex : bucketOrder)
+        {
+            const AZStd::vector<u16>& bucket = buckets[bucketIndex];
+            if (bucket.empty())
+            {
+                break;
+            }
+
+            bool placed = false;
+            for (u32 seed = 1; seed < MaxSeed && !placed; ++seed)
+            {
+                bucketSlots.clear();
+                placed = true;
+                for (u16 fieldIndex : bucket)
+                {
+                    const size_t slot = HashName(m_loadFields[fieldIndex].m_nameCrc, seed) & (slotCount - 1);
+                    if (m_slots[slot] != 0 || AZStd::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                    {
+                        placed = false;
+                        break;
+                    }
+                    bucketSlots.push_back(slot);
+                }
+
+                if (placed)
+                {
+                    for (size_t i = 0; i < bucket.size(); ++i)
+                    {
+                        m_slots[bucketSlots[i]] = static_cast<u16>(bucket[i] + 1);
+                    }
+                    m_bucketSeeds[bucketIndex] = static_cast<u16>(seed);
+                }
+            }
+
+            if (!placed)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t JsonClassPlan::GetSlot(u32 nameCrc) const
+    {
+        using namespace JsonClassPlanInternal;
+
+        const u32 seed = m_bucketSeeds[HashName(nameCrc, 0) & (m_bucketSeeds.size() - 1)];
+        return HashName(nameCrc, seed) & (m_slots.size() - 1);
+    }
+
+
+
+    //
+    // JsonSerializationPlanCache
+    //
+
+    const JsonClassPlan& JsonSerializationPlanCache::GetPlan(const SerializeContext::ClassData& classData,
+        const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            if (m_serializeContext == &serializeContext && m_registrationContext == &registrationContext)
+            {
+                if (auto it = m_plans.find(&classData); it != m_plans.end())
+                {
+                    return *it->second;
+                }
+            }
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+        if (m_serializeContext != &serializeContext || m_registrationContext != &registrationContext)
+        {
+            m_plans.clear();
+            m_serializeContext = &serializeContext;
+            m_registrationContext = &registrationContext;
+        }
+
+        auto [it, inserted] = m_plans.try_emplace(&classData);
+        if (inserted)
+        {
+            it->second = AZStd::make_unique<JsonClassPlan>(classData, serializeContext, registrationContext);
+        }
+        return *it->second;
+    }
+
+    void JsonSerializationPlanCache::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_plans.clear();
+        m_serializeContext = nullptr;
+        m_registrationContext = nullptr;
+    }
+
+    size_t JsonSerializationPlanCache::GetPlanCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_plans.size();
+    }
+} // namespace AZ
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class BaseJsonSerializer;
+    class JsonRegistrationContext;
+
+    //! Precompiled information the Json Serialization needs to load and store a reflected class.
+    //! Without a plan the Json (de)serializer walks the class elements, including those of all base classes, by name for
+    //! every member of every object and looks up the class data and custom serializer of each member as it goes. A plan does
+    //! this once per type: it flattens the members, with their final offsets, into a perfect hash table keyed by the member
+    //! name crc and keeps the class data and serializers of the members around.
+    class JsonClassPlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(JsonClassPlan, SystemAllocator);
+
+        struct LoadField
+        {
+            //! The element that will be loaded into. For members of base classes this is the element in the base class.
+            const SerializeContext::ClassElement* m_element{ nullptr };
+            //! The offset of the member from the start of the object, including the offsets of any base classes.
+            size_t m_offset{ 0 };
+            //! The custom serializer registered for the member type, if any.
+            BaseJsonSerializer* m_serializer{ nullptr };
+            u32 m_nameCrc{ 0 };
+        };
+
+        struct StoreField
+        {
+            const SerializeContext::ClassElement* m_element{ nullptr };
+            //! The class data of the member type or null if it couldn't be resolved, in which case the (de)serializer will
+            //! report the issue as usual.
+            const SerializeContext::ClassData* m_classData{ nullptr };
+        };
+
+        JsonClassPlan(const SerializeContext::ClassData& classData, const SerializeContext& serializeContext,
+            const JsonRegistrationContext& registrationContext);
+
+        const SerializeContext::ClassData& GetClassData() const;
+
+        //! Finds the member to load a json field with the provided name into. If both a derived class and one of its base
+        //! classes have a member with the same name, the member of the derived class will be returned.
+        const LoadField* FindLoadField(Crc32 nameCrc) const;
+        //! The elements of the class in reflection order. Base classes are listed as elements as well.
+        AZStd::span<const StoreField> GetStoreFields() const;
+        //! The total number of members that can be loaded, including the members of the base classes.
+        size_t GetElementCount() const;
+
+    private:
+        void AddLoadFields(const SerializeContext::ClassData& classData, size_t baseOffset,
+            const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext);
+        void BuildLookupTable();
+        bool TryBuildLookupTable(size_t bucketCount, size_t slotCount);
+        size_t GetSlot(u32 nameCrc) const;
+
+        AZStd::vector<LoadField> m_loadFields;
+        AZStd::vector<StoreField> m_storeFields;
+        //! The perfect hash table uses hash and displace. The names are first hashed into buckets, each bucket stores the
+        //! seed for a second hash that maps all names in that bucket to unused slots.
+        AZStd::vector<u16> m_bucketSeeds;
+        //! The index + 1 into m_loadFields for each slot, or 0 for unused slots.
+        AZStd::vector<u16> m_slots;
+        const SerializeContext::ClassData* m_classData{ nullptr };
+        size_t m_elementCount{ 0 };
+    };
+
+    //! Cache of JsonClassPlans that can be passed to the Json Serialization through the JsonDeserializerSettings and the
+    //! JsonSerializerSettings. Plans are created the first time a class is loaded or stored and reused by all following
+    //! calls, so keeping a cache around across calls is where most of the savings come from, for instance when loading
+    //! many prefabs in a row.
+    //! Plans are tied to the Serialize Context and the Json Registration Context they were created with. The cache resets
+    //! itself when it's used with different contexts, but needs to be cleared manually if types are reflected or
+    //! unreflected or if serializers are (un)registered while it's alive. The cache can be used from multiple threads,
+    //! but clearing it can't happen while a load or store using it is in progress.
+    class JsonSerializationPlanCache final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(JsonSerializationPlanCache, SystemAllocator);
+
+        JsonSerializationPlanCache() = default;
+        JsonSerializationPlanCache(const JsonSerializationPlanCache&) = delete;
+        JsonSerializationPlanCache& operator=(const JsonSerializationPlanCache&) = delete;
+
+        //! Returns the plan for the provided class, creating it if needed.
+        const JsonClassPlan& GetPlan(const SerializeContext::ClassData& classData, const SerializeContext& serializeContext,
+            const JsonRegistrationContext& registrationContext);
+
+        //! Removes all plans.
+        void Clear();
+
+        size_t GetPlanCount() const;
+
+    private:
+        AZStd::flat_hash_map<const SerializeContext::ClassData*, AZStd::unique_ptr<JsonClassPlan>> m_plans;
+        mutable AZStd::shared_mutex m_mutex;
+        const SerializeContext* m_serializeContext{ nullptr };
+        const JsonRegistrationContext* m_registrationContext{ nullptr };
+    };
+} // namespace AZ
@@ -16,6 +16,7 @@
 namespace AZ
 {
     class JsonRegistrationContext;
+    class JsonSerializationPlanCache;
     class SerializeContext;
 
     //! Optional settings used while loading a json value to an object.
@@ -31,6 +32,9 @@ namespace AZ
         SerializeContext* m_serializeContext = nullptr;
         //! Optional json registration context. If not provided the default instance will be retrieved through an EBus call.
         JsonRegistrationContext* m_registrationContext = nullptr;
+        //! Optional cache with precompiled plans per type. If provided, the members of classes are resolved through the plans
+        //! instead of being searched for in the Serialize Context for every object. Reuse the cache across calls for the best results.
+        JsonSerializationPlanCache* m_planCache = nullptr;
 
         //! If true this will clear all containers in the object before applying the data from the json document. If set to false
         //! any values in the container will be kept and not overwritten.
@@ -51,6 +55,9 @@ namespace AZ
         SerializeContext* m_serializeContext = nullptr;
         //! Optional json registration context. If not provided the default instance will be retrieved through an EBus call.
         JsonRegistrationContext* m_registrationContext = nullptr;
+        //! Optional cache with precompiled plans per type. If provided, the members of classes are resolved through the plans
+        //! instead of being searched for in the Serialize Context for every object. Reuse the cache across calls for the best results.
+        JsonSerializationPlanCache* m_planCache = nullptr;
 
         //! If true default value will be stored, otherwise only changed values will be stored. This will automatically be set to false
         //! if the Store function is given a default object.
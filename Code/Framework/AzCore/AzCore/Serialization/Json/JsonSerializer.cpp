@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/Json/JsonSerializer.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/any.h>
@@ -185,14 +186,17 @@ namespace AZ
     }
 
     JsonSerializationResult::ResultCode JsonSerializer::StoreWithClassElement(rapidjson::Value& parentNode, const void* object,
-        const void* defaultObject, const SerializeContext::ClassElement& classElement, JsonSerializerContext& context)
+        const void* defaultObject, const SerializeContext::ClassElement& classElement,
+        const SerializeContext::ClassData* elementClassData, JsonSerializerContext& context)
     {
         using namespace JsonSerializationResult;
 
         ScopedContextPath elementPath(context, classElement.m_name);
 
-        const SerializeContext::ClassData* elementClassData =
-            context.GetSerializeContext()->FindClassData(classElement.m_typeId);
+        if (!elementClassData)
+        {
+            elementClassData = context.GetSerializeContext()->FindClassData(classElement.m_typeId);
+        }
         if (!elementClassData)
         {
             return context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
@@ -252,13 +256,28 @@ namespace AZ
         if (!classData.m_elements.empty())
         {
             ResultCode result(Tasks::WriteValue);
+            if (JsonSerializationPlanCache* planCache = context.GetPlanCache())
+            {
+                const JsonClassPlan& plan =
+                    planCache->GetPlan(classData, *context.GetSerializeContext(), *context.GetRegistrationContext());
+                for (const JsonClassPlan::StoreField& field : plan.GetStoreFields())
+                {
+                    const void* elementPtr = reinterpret_cast<const uint8_t*>(object) + field.m_element->m_offset;
+                    const void* elementDefaultPtr = defaultObject ?
+                        (reinterpret_cast<const uint8_t*>(defaultObject) + field.m_element->m_offset) : nullptr;
+
+                    result.Combine(StoreWithClassElement(output, elementPtr, elementDefaultPtr, *field.m_element, field.m_classData, context));
+                }
+                return result;
+            }
+
             for (const SerializeContext::ClassElement& element : classData.m_elements)
             {
                 const void* elementPtr = reinterpret_cast<const uint8_t*>(object) + element.m_offset;
                 const void* elementDefaultPtr = defaultObject ?
                     (reinterpret_cast<const uint8_t*>(defaultObject) + element.m_offset) : nullptr;
 
-                result.Combine(StoreWithClassElement(output, elementPtr, elementDefaultPtr, element, context));
+                result.Combine(StoreWithClassElement(output, elementPtr, elementDefaultPtr, element, nullptr, context));
             }
             return result;
         }
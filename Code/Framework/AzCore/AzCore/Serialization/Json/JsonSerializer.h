@@ -59,8 +59,10 @@ namespace AZ
             const void* defaultObject, const SerializeContext::ClassData& classData, UseTypeSerializer custom,
             JsonSerializerContext& context);
 
+        //! Stores a single element of a class. If elementClassData is null, the class data for the element's type will be looked up.
         static JsonSerializationResult::ResultCode StoreWithClassElement(rapidjson::Value& parentNode, const void* object,
-            const void* defaultObject, const SerializeContext::ClassElement& classElement, JsonSerializerContext& context);
+            const void* defaultObject, const SerializeContext::ClassElement& classElement,
+            const SerializeContext::ClassData* elementClassData, JsonSerializerContext& context);
 
         static JsonSerializationResult::ResultCode StoreClass(rapidjson::Value& output, const void* object, const void* defaultObject,
             const SerializeContext::ClassData& classData, JsonSerializerContext& context);
@@ -9,6 +9,7 @@
 #include <AzCore/RTTI/AttributeReader.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/ObjectStreamPackedLayout.h>
 #include <AzCore/Serialization/DataOverlayInstanceMsgs.h>
 #include <AzCore/Serialization/DataOverlayProviderMsgs.h>
 #include <AzCore/Serialization/DynamicSerializableField.h>
@@ -72,6 +73,8 @@ namespace AZ
     namespace ObjectStreamInternal
     {
         static const u32 s_objectStreamVersion = 3;
+        // Packed binary streams can't be read by older versions, so they get their own version. Text streams stay at version 3.
+        static const u32 s_packedBinaryStreamVersion = 4;
         static const u8 s_binaryStreamTag = 0;
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
@@ -106,6 +109,36 @@ namespace AZ
                 ST_BINARYFLAG_ELEMENT_END       = 0
             };
 
+            // Tags used by packed binary streams (version 4) in addition to the regular elements. None of them have the
+            // ST_BINARYFLAG_ELEMENT_HEADER flag set, so they can't be mistaken for element headers.
+            enum BinaryPackedTags
+            {
+                ST_BINARYTAG_PACKED_LAYOUT      = 1, // The description of a PackedLayout, which gets the next layout index.
+                ST_BINARYTAG_PACKED_OBJECT      = 2, // An object stored as a single block.
+                ST_BINARYTAG_PACKED_ARRAY       = 3, // A sequence container stored as consecutive blocks of its elements.
+            };
+
+            // A packed element that was read from the stream and can be copied directly into the reflected object.
+            struct PackedElement
+            {
+                const PackedLayout* m_layout = nullptr;
+                const char* m_data = nullptr;
+                u32 m_count = 0;
+                bool m_isArray = false;
+            };
+
+            struct PackedElementHeader
+            {
+                u32 m_nameCrc = 0;
+                u32 m_layoutIndex = 0;
+                u32 m_count = 1;
+                bool m_isArray = false;
+                // Only used for arrays.
+                u32 m_elementNameCrc = 0;
+                Uuid m_containerTypeId;
+                u32 m_containerVersion = 0;
+            };
+
             AZ_CLASS_ALLOCATOR(ObjectStreamImpl, SystemAllocator);
 
             ObjectStreamImpl(IO::GenericStream* stream, SerializeContext* sc, const ClassReadyCB& readyCB, const CompletionCB& doneCB, const FilterDescriptor& filterDesc = FilterDescriptor(), int flags = 0, const InplaceLoadRootInfoCB& inplaceLoadInfoCB = InplaceLoadRootInfoCB())
@@ -119,6 +152,8 @@ namespace AZ
                 , m_pending(0)
                 , m_inStream(&m_buffer1)
                 , m_outStream(&m_buffer2)
+                , m_packedLayoutBuilder(*sc)
+                , m_expandedStream(&m_expandedBuffer)
                 , m_localeScope(false) // do not automatically activate the locale.
             {
                 // Assign default asset filter if none was provided by the user.
@@ -138,6 +173,27 @@ namespace AZ
             bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement);
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
+            // finds the class data of a binary element that was just read
+            void FindBinaryElementClassData(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool isTopElement);
+
+            bool IsBinaryType() const { return GetType() == ST_BINARY || GetType() == ST_BINARY_PACKED; }
+
+            /// Writes the header of a binary element, including the size of the value if it has one.
+            static void WriteBinaryElementHeader(IO::GenericStream& stream, u32 nameCrc, unsigned int version, const Uuid& typeId, bool hasValue, size_t valueSize);
+
+            // packed binary streams
+            bool WritePackedElement(const void* objectPtr, const SerializeContext::ClassData& classData, const SerializeContext::ClassElement* classElement);
+            void WritePendingPackedLayouts();
+            bool ReadPackedLayoutDefinition();
+            void ReportCorruptPackedData();
+            bool ReadPackedElementHeader(PackedElementHeader& header, bool isArray);
+            bool ReadPackedElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement, bool isArray);
+            bool LoadPackedElement(const PackedElement& packedElement, const SerializeContext::ClassData* classData, void* dataAddress);
+            /// Converts a packed element that can't be copied directly into regular elements, which are read from then on.
+            void ExpandPackedElement(const PackedElementHeader& header, const char* data);
+            void ExpandPackedBlock(const PackedLayout& layout, u32 nameCrc, const char* block);
+            /// Continues with the rest of the stream once all elements that were expanded have been read.
+            void PopExpandedStream();
 
             bool WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData) override;
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
@@ -237,6 +293,18 @@ namespace AZ
             IO::ByteContainerStream<AZStd::vector<char> > m_inStream;
             IO::ByteContainerStream<AZStd::vector<char> > m_outStream;
 
+            // used for packed binary streams
+            PackedLayoutBuilder                 m_packedLayoutBuilder;
+            size_t                              m_writtenLayoutCount = 0;
+            AZStd::vector<PackedLayout>         m_streamLayouts;    // layouts read from the stream, in stream order
+            PackedElement                       m_packedElement;    // the element returned by the last ReadElement, if it was packed
+            AZStd::vector<char>                 m_packedBuffer;     // blocks for streams that aren't contiguous in memory
+            AZStd::vector<char>                 m_expandedBuffer;
+            IO::ByteContainerStream<AZStd::vector<char> > m_expandedStream;
+            IO::GenericStream*                  m_expandedParentStream = nullptr;
+            int                                 m_expandPackedElements = 0; // packed elements are always expanded while this is non-zero
+            bool                                m_hasCorruptPackedData = false;
+
             // other state info
             // keep tracks of the number of WriteElements that have
             // completed successfully to make sure the equivalent amount
@@ -269,6 +337,9 @@ namespace AZ
             childElement.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
             childElement.m_dataSize = 0;
 
+            // Converters work on the element tree, so packed elements need to be expanded into regular elements.
+            ++m_expandPackedElements;
+
             const SerializeContext::ClassData* childClass = nullptr;
             bool nextLevel = true;
             while (ReadElement(sc, childClass, childElement, elementClass, nextLevel, false))
@@ -328,6 +399,7 @@ namespace AZ
                     PreparseOldVersion(sc, childNode, stream, childClass);
                 }
             }
+            --m_expandPackedElements;
 #if defined(AZ_ENABLE_TRACING)
             m_errorLogger.Pop();
 #endif // AZ_ENABLE_TRACING
@@ -412,6 +484,7 @@ namespace AZ
             {
                 // reset the class info
                 const SerializeContext::ClassData* classData = nullptr;
+                PackedElement packedElement;
 
                 bool isConvertedData = false;
                 // read from the converted list (if we have something)
@@ -445,6 +518,7 @@ namespace AZ
                         break;
                     }
                     nextLevel = false;
+                    packedElement = m_packedElement;
                 }
 
                 // Handle conversion of deprecated classes to non-deprecated ones.
@@ -836,16 +910,24 @@ namespace AZ
                     }
                 }
 
-                // If it is a container, clear it before loading the child
-                // nodes, otherwise we end up with more elements than the ones
-                // we should have
-                if (classData->m_container && dataAddress)
+                if (packedElement.m_layout)
                 {
-                    classData->m_container->ClearElements(dataAddress, m_sc);
+                    // Packed elements hold the data of all their members and have no child nodes.
+                    result = LoadPackedElement(packedElement, classData, dataAddress) && result;
                 }
+                else
+                {
+                    // If it is a container, clear it before loading the child
+                    // nodes, otherwise we end up with more elements than the ones
+                    // we should have
+                    if (classData->m_container && dataAddress)
+                    {
+                        classData->m_container->ClearElements(dataAddress, m_sc);
+                    }
 
-                // Read child nodes
-                result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                    // Read child nodes
+                    result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                }
 
                 if (classContainer)
                 {
@@ -1044,6 +1126,7 @@ namespace AZ
             element.m_id = AZ::Uuid::CreateNull();
 
             cd = nullptr;
+            m_packedElement = {};
 
             if (GetType() == ST_XML)
             {
@@ -1289,6 +1372,8 @@ namespace AZ
             }
             else /*ST_BINARY*/
             {
+                PopExpandedStream();
+
                 if (m_stream->GetCurPos() == m_stream->GetLength())
                 {
                     // Reached the end of the stream. We may reach this state if we just skipped the root element
@@ -1300,6 +1385,24 @@ namespace AZ
                 IO::SizeType nBytesRead = m_stream->Read(sizeof(u8), &flagsSize);
                 AZ_Assert(nBytesRead == sizeof(u8), "Failed trying to read binary element tag!");
                 (void)nBytesRead;
+
+                if (m_version >= s_packedBinaryStreamVersion)
+                {
+                    // Layouts are written right before the first packed element that uses them.
+                    while (flagsSize == ST_BINARYTAG_PACKED_LAYOUT)
+                    {
+                        if (!ReadPackedLayoutDefinition() || m_stream->Read(sizeof(u8), &flagsSize) != sizeof(u8))
+                        {
+                            return false;
+                        }
+                    }
+
+                    if (flagsSize == ST_BINARYTAG_PACKED_OBJECT || flagsSize == ST_BINARYTAG_PACKED_ARRAY)
+                    {
+                        return ReadPackedElement(sc, cd, element, parent, nextLevel, isTopElement, flagsSize == ST_BINARYTAG_PACKED_ARRAY);
+                    }
+                }
+
                 if (flagsSize == ST_BINARYFLAG_ELEMENT_END)
                 {
                     return false;
@@ -1351,22 +1454,7 @@ namespace AZ
 
                 element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
 
-                // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd && ShouldLookUpSpecializedTypeId(element))
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
-
-                // Root elements may require classInfo to be provided by the in-place load callback.
-                if (!cd && isTopElement && m_inplaceLoadInfoCB)
-                {
-                    m_inplaceLoadInfoCB(nullptr, &cd, element.m_id, &sc);
-                }
+                FindBinaryElementClassData(sc, cd, element, parent, isTopElement);
 
                 // Read value
                 if (flagsSize & ST_BINARYFLAG_HAS_VALUE)
@@ -1430,7 +1518,13 @@ namespace AZ
         //=========================================================================
         void ObjectStreamImpl::SkipElement()
         {
-            if (GetType() == ST_BINARY)
+            if (m_packedElement.m_layout)
+            {
+                // Packed elements have already been read completely.
+                return;
+            }
+
+            if (IsBinaryType())
             {
                 int endTagsNeeded = 1;
                 while (endTagsNeeded > 0)
@@ -1444,6 +1538,23 @@ namespace AZ
                     {
                         --endTagsNeeded;
                     }
+                    else if (m_version >= s_packedBinaryStreamVersion && flagsSize == ST_BINARYTAG_PACKED_LAYOUT)
+                    {
+                        // Layouts still need to be read, since packed elements after the skipped element can refer to them.
+                        if (!ReadPackedLayoutDefinition())
+                        {
+                            return;
+                        }
+                    }
+                    else if (m_version >= s_packedBinaryStreamVersion && (flagsSize == ST_BINARYTAG_PACKED_OBJECT || flagsSize == ST_BINARYTAG_PACKED_ARRAY))
+                    {
+                        PackedElementHeader header;
+                        if (!ReadPackedElementHeader(header, flagsSize == ST_BINARYTAG_PACKED_ARRAY))
+                        {
+                            return;
+                        }
+                        m_stream->Seek(static_cast<IO::OffsetType>(size_t{ header.m_count } * m_streamLayouts[header.m_layoutIndex].m_size), IO::GenericStream::ST_SEEK_CUR);
+                    }
                     else
                     {
                         ++endTagsNeeded;
@@ -1508,6 +1619,282 @@ namespace AZ
             }
         }
 
+        //=========================================================================
+        // FindBinaryElementClassData
+        //=========================================================================
+        void ObjectStreamImpl::FindBinaryElementClassData(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool isTopElement)
+        {
+            // find the registered class data
+            cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+            if (cd && ShouldLookUpSpecializedTypeId(element))
+            {
+                // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                {
+                    element.m_id = genericClassInfo->GetSpecializedTypeId();
+                }
+            }
+
+            // Root elements may require classInfo to be provided by the in-place load callback.
+            if (!cd && isTopElement && m_inplaceLoadInfoCB)
+            {
+                m_inplaceLoadInfoCB(nullptr, &cd, element.m_id, &sc);
+            }
+        }
+
+        //=========================================================================
+        // ReportCorruptPackedData
+        //=========================================================================
+        void ObjectStreamImpl::ReportCorruptPackedData()
+        {
+            AZStd::string error = AZStd::string::format("ObjectStream binary load error: Packed data is corrupted or truncated. The rest of the stream will be ignored.  File %s",
+                GetStreamFilename());
+            m_errorLogger.ReportError(error.c_str());
+
+            // this is considered a "fatal" error since the rest of the stream is unreadable.
+            m_hasCorruptPackedData = true;
+            m_stream->Seek(0, IO::GenericStream::ST_SEEK_END);
+        }
+
+        //=========================================================================
+        // ReadPackedLayoutDefinition
+        //=========================================================================
+        bool ObjectStreamImpl::ReadPackedLayoutDefinition()
+        {
+            PackedLayout layout;
+            if (!ReadPackedLayout(*m_stream, layout, m_streamLayouts))
+            {
+                ReportCorruptPackedData();
+                return false;
+            }
+
+            // Layouts that don't match the reflected class anymore are kept as well, so their elements can still be expanded.
+            m_packedLayoutBuilder.Match(layout, m_streamLayouts);
+            m_streamLayouts.push_back(AZStd::move(layout));
+            return true;
+        }
+
+        //=========================================================================
+        // ReadPackedElementHeader
+        //=========================================================================
+        bool ObjectStreamImpl::ReadPackedElementHeader(PackedElementHeader& header, bool isArray)
+        {
+            header.m_isArray = isArray;
+            bool isValid = m_stream->Read(sizeof(header.m_nameCrc), &header.m_nameCrc) == sizeof(header.m_nameCrc) &&
+                m_stream->Read(sizeof(header.m_layoutIndex), &header.m_layoutIndex) == sizeof(header.m_layoutIndex);
+            if (isValid && isArray)
+            {
+                const IO::SizeType typeIdSize = header.m_containerTypeId.end() - header.m_containerTypeId.begin();
+                isValid = m_stream->Read(sizeof(header.m_elementNameCrc), &header.m_elementNameCrc) == sizeof(header.m_elementNameCrc) &&
+                    m_stream->Read(typeIdSize, header.m_containerTypeId.begin()) == typeIdSize &&
+                    m_stream->Read(sizeof(header.m_containerVersion), &header.m_containerVersion) == sizeof(header.m_containerVersion) &&
+                    m_stream->Read(sizeof(header.m_count), &header.m_count) == sizeof(header.m_count);
+            }
+
+            isValid = isValid && header.m_layoutIndex < m_streamLayouts.size() &&
+                u64{ header.m_count } * m_streamLayouts[header.m_layoutIndex].m_size <= m_stream->GetLength() - m_stream->GetCurPos();
+            if (!isValid)
+            {
+                ReportCorruptPackedData();
+            }
+            return isValid;
+        }
+
+        //=========================================================================
+        // ReadPackedElement
+        //=========================================================================
+        bool ObjectStreamImpl::ReadPackedElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement, bool isArray)
+        {
+            PackedElementHeader header;
+            if (!ReadPackedElementHeader(header, isArray))
+            {
+                return false;
+            }
+
+            const PackedLayout& layout = m_streamLayouts[header.m_layoutIndex];
+            const size_t dataSize = size_t{ header.m_count } * layout.m_size;
+            const char* data = nullptr;
+            if (const void* streamData = m_stream->GetContiguousData())
+            {
+                // Streams backed by memory, including memory mapped files, are copied from directly.
+                data = reinterpret_cast<const char*>(streamData) + m_stream->GetCurPos();
+                m_stream->Seek(static_cast<IO::OffsetType>(dataSize), IO::GenericStream::ST_SEEK_CUR);
+            }
+            else
+            {
+                m_packedBuffer.resize_no_construct(dataSize);
+                m_stream->Read(dataSize, m_packedBuffer.data());
+                data = m_packedBuffer.data();
+            }
+
+            element.m_nameCrc = header.m_nameCrc;
+            element.m_id = isArray ? header.m_containerTypeId : layout.m_typeId;
+            element.m_version = isArray ? header.m_containerVersion : layout.m_version;
+            element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
+            FindBinaryElementClassData(sc, cd, element, parent, isTopElement);
+
+            if (m_expandPackedElements == 0 && layout.m_classData && cd)
+            {
+                bool canCopy = false;
+                if (!isArray)
+                {
+                    // Matching layouts have the same version as the reflected class.
+                    canCopy = cd == layout.m_classData;
+                }
+                else if (cd->m_version == element.m_version && !cd->IsDeprecated())
+                {
+                    const u32 arrayLayoutIndex = m_packedLayoutBuilder.GetArrayLayoutIndex(*cd);
+                    canCopy = arrayLayoutIndex != PackedLayout::InvalidIndex && m_packedLayoutBuilder.GetLayout(arrayLayoutIndex).m_classData == layout.m_classData;
+                }
+
+                if (canCopy)
+                {
+                    m_packedElement.m_layout = &layout;
+                    m_packedElement.m_data = data;
+                    m_packedElement.m_count = header.m_count;
+                    m_packedElement.m_isArray = isArray;
+                    return true;
+                }
+            }
+
+            // The data can't be copied as is, for instance because members were added or the class version changed. Turn it
+            // into regular elements, so it goes through the same member matching and version conversion as any other element.
+            ExpandPackedElement(header, data);
+            return ReadElement(sc, cd, element, parent, nextLevel, isTopElement);
+        }
+
+        //=========================================================================
+        // LoadPackedElement
+        //=========================================================================
+        bool ObjectStreamImpl::LoadPackedElement(const PackedElement& packedElement, const SerializeContext::ClassData* classData, void* dataAddress)
+        {
+            if (!dataAddress)
+            {
+                return true;
+            }
+
+            const PackedLayout& layout = *packedElement.m_layout;
+            if (!packedElement.m_isArray)
+            {
+                layout.CopyToObject(dataAddress, packedElement.m_data);
+                return true;
+            }
+
+            SerializeContext::IDataContainer* container = classData->m_container;
+            const SerializeContext::ClassElement* classElement = nullptr;
+            m_packedLayoutBuilder.GetArrayLayoutIndex(*classData, &classElement);
+
+            container->ClearElements(dataAddress, m_sc);
+            if (void* elements = container->ResizeContiguousElements(dataAddress, packedElement.m_count))
+            {
+                char* elementData = reinterpret_cast<char*>(elements);
+                if (layout.IsIdentity(classElement->m_dataSize))
+                {
+                    memcpy(elementData, packedElement.m_data, size_t{ packedElement.m_count } * layout.m_size);
+                }
+                else
+                {
+                    for (u32 i = 0; i < packedElement.m_count; ++i)
+                    {
+                        layout.CopyToObject(elementData + size_t{ i } * classElement->m_dataSize, packedElement.m_data + size_t{ i } * layout.m_size);
+                    }
+                }
+                return true;
+            }
+
+            bool result = true;
+            for (u32 i = 0; i < packedElement.m_count; ++i)
+            {
+                void* elementAddress = container->CanAccessElementsByIndex() && container->Size(dataAddress) > i
+                    ? container->GetElementByIndex(dataAddress, classElement, i)
+                    : container->ReserveElement(dataAddress, classElement);
+                if (!elementAddress)
+                {
+                    AZStd::string error = AZStd::string::format("Failed to reserve element in container. The container may be full. Element %u will not be added to container.", i);
+
+                    result = (m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0;  // in strict mode, this is a complete failure.
+                    m_errorLogger.ReportError(error.c_str());
+                    break;
+                }
+
+                layout.CopyToObject(elementAddress, packedElement.m_data + size_t{ i } * layout.m_size);
+                container->StoreElement(dataAddress, elementAddress);
+            }
+            return result;
+        }
+
+        //=========================================================================
+        // ExpandPackedElement
+        //=========================================================================
+        void ObjectStreamImpl::ExpandPackedElement(const PackedElementHeader& header, const char* data)
+        {
+            AZ_Assert(m_expandedParentStream == nullptr, "Expanded elements can't contain packed elements.");
+
+            m_expandedBuffer.clear();
+            m_expandedStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+            const PackedLayout& layout = m_streamLayouts[header.m_layoutIndex];
+            if (header.m_isArray)
+            {
+                WriteBinaryElementHeader(m_expandedStream, header.m_nameCrc, header.m_containerVersion, header.m_containerTypeId, false, 0);
+                for (u32 i = 0; i < header.m_count; ++i)
+                {
+                    ExpandPackedBlock(layout, header.m_elementNameCrc, data + size_t{ i } * layout.m_size);
+                }
+                u8 endTag = ST_BINARYFLAG_ELEMENT_END;
+                m_expandedStream.Write(sizeof(u8), &endTag);
+            }
+            else
+            {
+                ExpandPackedBlock(layout, header.m_nameCrc, data);
+            }
+
+            m_expandedStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            m_expandedParentStream = m_stream;
+            m_stream = &m_expandedStream;
+        }
+
+        //=========================================================================
+        // ExpandPackedBlock
+        //=========================================================================
+        void ObjectStreamImpl::ExpandPackedBlock(const PackedLayout& layout, u32 nameCrc, const char* block)
+        {
+            if (layout.m_isValue)
+            {
+                // Packed values are stored in the native (little endian) byte order, while element values are big endian.
+                char value[sizeof(u64)];
+                for (u32 i = 0; i < layout.m_size; ++i)
+                {
+                    value[i] = block[layout.m_size - 1 - i];
+                }
+                WriteBinaryElementHeader(m_expandedStream, nameCrc, layout.m_version, layout.m_typeId, true, layout.m_size);
+                m_expandedStream.Write(layout.m_size, value);
+            }
+            else
+            {
+                WriteBinaryElementHeader(m_expandedStream, nameCrc, layout.m_version, layout.m_typeId, false, 0);
+                for (const PackedLayout::Field& field : layout.m_fields)
+                {
+                    ExpandPackedBlock(m_streamLayouts[field.m_layoutIndex], field.m_nameCrc, block + field.m_offset);
+                }
+            }
+
+            u8 endTag = ST_BINARYFLAG_ELEMENT_END;
+            m_expandedStream.Write(sizeof(u8), &endTag);
+        }
+
+        //=========================================================================
+        // PopExpandedStream
+        //=========================================================================
+        void ObjectStreamImpl::PopExpandedStream()
+        {
+            if (m_expandedParentStream && m_stream->GetCurPos() == m_stream->GetLength())
+            {
+                m_stream = m_expandedParentStream;
+                m_expandedParentStream = nullptr;
+            }
+        }
+
         //=========================================================================
         // WriteClass
         // [6/22/2012]
@@ -1704,6 +2091,12 @@ namespace AZ
                 }
             }
 
+            // Plain data structures and arrays of them are written as a single block without child elements.
+            if (GetType() == ST_BINARY_PACKED && objectPtr && WritePackedElement(objectPtr, *classData, classElement))
+            {
+                return false;
+            }
+
             SerializeContext::DataElement element;
             if (classElement)
             {
@@ -1719,7 +2112,7 @@ namespace AZ
 
             if (classData->m_serializer)
             {
-                element.m_dataSize = classData->m_serializer->Save(objectPtr, m_inStream, GetType() == ST_BINARY);
+                element.m_dataSize = classData->m_serializer->Save(objectPtr, m_inStream, IsBinaryType());
             }
 
             if (GetType() == ST_XML)
@@ -1813,110 +2206,195 @@ namespace AZ
             }
             else /*ST_BINARY*/
             {
-                u8 flagsSize = ST_BINARYFLAG_ELEMENT_HEADER;
-                if (element.m_nameCrc)
+                WriteBinaryElementHeader(*m_stream, element.m_nameCrc, element.m_version, element.m_id, classData->m_serializer != nullptr, element.m_dataSize);
+
+                // Write value
+                if (classData->m_serializer)
                 {
-                    flagsSize |= ST_BINARYFLAG_HAS_NAME;
+                    if (element.m_dataSize)
+                    {
+                        element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+                        // Directly copy data from element.m_stream into m_stream
+                        m_stream->WriteFromStream(element.m_dataSize, element.m_stream);
+                    }
+
+                    element.m_stream = nullptr;
                 }
-                if (classData->m_serializer)
+            }
+
+            return true;
+        }
+
+        //=========================================================================
+        // WriteBinaryElementHeader
+        //=========================================================================
+        void ObjectStreamImpl::WriteBinaryElementHeader(IO::GenericStream& stream, u32 nameCrc, unsigned int version, const Uuid& typeId, bool hasValue, size_t valueSize)
+        {
+            u8 flagsSize = ST_BINARYFLAG_ELEMENT_HEADER;
+            if (nameCrc)
+            {
+                flagsSize |= ST_BINARYFLAG_HAS_NAME;
+            }
+            if (hasValue)
+            {
+                flagsSize |= ST_BINARYFLAG_HAS_VALUE;
+                if (valueSize < 8)
                 {
-                    flagsSize |= ST_BINARYFLAG_HAS_VALUE;
-                    if (element.m_dataSize < 8)
+                    flagsSize |= static_cast<u8>(valueSize);
+                }
+                else
+                {
+                    flagsSize |= ST_BINARYFLAG_EXTRA_SIZE_FIELD;
+                    if (valueSize < 0x100)
+                    {
+                        flagsSize |= sizeof(u8);
+                    }
+                    else if (valueSize < 0x10000)
+                    {
+                        flagsSize |= sizeof(u16);
+                    }
+                    else if (valueSize < 0x100000000)
                     {
-                        flagsSize |= static_cast<u8>(element.m_dataSize);
+                        flagsSize |= sizeof(u32);
                     }
                     else
                     {
-                        flagsSize |= ST_BINARYFLAG_EXTRA_SIZE_FIELD;
-                        if (element.m_dataSize < 0x100)
-                        {
-                            flagsSize |= sizeof(u8);
-                        }
-                        else if (element.m_dataSize < 0x10000)
-                        {
-                            flagsSize |= sizeof(u16);
-                        }
-                        else if (element.m_dataSize < 0x100000000)
-                        {
-                            flagsSize |= sizeof(u32);
-                        }
-                        else
-                        {
-                            AZ_Assert(false, "We don't have enough bits to store a value size of %llu", (u64)element.m_dataSize);
-                        }
+                        AZ_Assert(false, "We don't have enough bits to store a value size of %llu", (u64)valueSize);
                     }
                 }
-                if (element.m_version)
+            }
+            if (version)
+            {
+                flagsSize |= ST_BINARYFLAG_HAS_VERSION;
+            }
+            stream.Write(sizeof(flagsSize), &flagsSize);
+
+            // Write name
+            if (nameCrc)
+            {
+                AZStd::endian_swap(nameCrc);
+                stream.Write(sizeof(nameCrc), &nameCrc);
+            }
+
+            // Write version
+            if (version)
+            {
+                AZ_Assert(version < 0x100, "element.version is too high for the current binary format!");
+                u8 versionByte = static_cast<u8>(version);
+                stream.Write(sizeof(versionByte), &versionByte);
+            }
+
+            // Write Uuid
+            stream.Write(typeId.end() - typeId.begin(), typeId.begin());
+
+            // Write extra size field if necessary
+            if (flagsSize & ST_BINARYFLAG_EXTRA_SIZE_FIELD)
+            {
+                size_t sizeBytes = flagsSize & ST_BINARY_VALUE_SIZE_MASK;
+                switch (sizeBytes)
+                {
+                case sizeof(u8):
                 {
-                    flagsSize |= ST_BINARYFLAG_HAS_VERSION;
+                    u8 size = static_cast<u8>(valueSize);
+                    stream.Write(sizeBytes, &size);
+                    break;
                 }
-                m_stream->Write(sizeof(flagsSize), &flagsSize);
-
-                // Write name
-                if (element.m_nameCrc)
+                case sizeof(u16):
                 {
-                    u32 nameCrc = element.m_nameCrc;
-                    AZStd::endian_swap(nameCrc);
-                    m_stream->Write(sizeof(nameCrc), &nameCrc);
+                    u16 size = static_cast<u16>(valueSize);
+                    AZStd::endian_swap(size);
+                    stream.Write(sizeBytes, &size);
+                    break;
                 }
-
-                // Write version
-                if (element.m_version)
+                case sizeof(u32):
                 {
-                    AZ_Assert(element.m_version < 0x100, "element.version is too high for the current binary format!");
-                    u8 version = static_cast<u8>(element.m_version);
-                    m_stream->Write(sizeof(version), &version);
+                    u32 size = static_cast<u32>(valueSize);
+                    AZStd::endian_swap(size);
+                    stream.Write(sizeBytes, &size);
+                    break;
                 }
+                }
+            }
+        }
 
-                // Write Uuid
-                m_stream->Write(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
-
-                // Write value
-                if (classData->m_serializer)
+        //=========================================================================
+        // WritePackedElement
+        //=========================================================================
+        bool ObjectStreamImpl::WritePackedElement(const void* objectPtr, const SerializeContext::ClassData& classData, const SerializeContext::ClassElement* classElement)
+        {
+            // Packed data is stored in the native byte order, which like the rest of the engine assumes little endian.
+            const u32 nameCrc = classElement ? static_cast<u32>(classElement->m_nameCrc) : 0;
+            if (classData.m_container)
+            {
+                const SerializeContext::ClassElement* arrayElement = nullptr;
+                const u32 layoutIndex = m_packedLayoutBuilder.GetArrayLayoutIndex(classData, &arrayElement);
+                if (layoutIndex == PackedLayout::InvalidIndex)
                 {
-                    // Write extra size field if necessary
-                    if (flagsSize & ST_BINARYFLAG_EXTRA_SIZE_FIELD)
-                    {
-                        size_t sizeBytes = flagsSize & ST_BINARY_VALUE_SIZE_MASK;
-                        switch (sizeBytes)
-                        {
-                        case sizeof(u8):
-                        {
-                            u8 size = static_cast<u8>(element.m_dataSize);
-                            m_stream->Write(sizeBytes, &size);
-                            break;
-                        }
-                        case sizeof(u16):
-                        {
-                            u16 size = static_cast<u16>(element.m_dataSize);
-                            AZStd::endian_swap(size);
-                            m_stream->Write(sizeBytes, &size);
-                            break;
-                        }
-                        case sizeof(u32):
-                        {
-                            u32 size = static_cast<u32>(element.m_dataSize);
-                            AZStd::endian_swap(size);
-                            m_stream->Write(sizeBytes, &size);
-                            break;
-                        }
-                        }
-                    }
+                    return false;
+                }
 
-                    if (element.m_dataSize)
-                    {
-                        element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
-                        // Directly copy data from element.m_stream into m_stream
-                        m_stream->WriteFromStream(element.m_dataSize, element.m_stream);
-                    }
+                WritePendingPackedLayouts();
+                const PackedLayout& layout = m_packedLayoutBuilder.GetLayout(layoutIndex);
+                void* instance = const_cast<void*>(objectPtr);
+                const u32 count = aznumeric_cast<u32>(classData.m_container->Size(instance));
+                const u32 elementNameCrc = arrayElement->m_nameCrc;
+                const u32 containerVersion = classData.m_version;
 
-                    element.m_stream = nullptr;
+                const u8 tag = ST_BINARYTAG_PACKED_ARRAY;
+                m_stream->Write(sizeof(tag), &tag);
+                m_stream->Write(sizeof(nameCrc), &nameCrc);
+                m_stream->Write(sizeof(layoutIndex), &layoutIndex);
+                m_stream->Write(sizeof(elementNameCrc), &elementNameCrc);
+                m_stream->Write(classData.m_typeId.end() - classData.m_typeId.begin(), classData.m_typeId.begin());
+                m_stream->Write(sizeof(containerVersion), &containerVersion);
+                m_stream->Write(sizeof(count), &count);
+
+                m_packedBuffer.resize_no_construct(size_t{ count } * layout.m_size);
+                for (u32 i = 0; i < count; ++i)
+                {
+                    const void* element = classData.m_container->GetElementByIndex(instance, arrayElement, i);
+                    layout.CopyToBlock(m_packedBuffer.data() + size_t{ i } * layout.m_size, element);
                 }
+                m_stream->Write(m_packedBuffer.size(), m_packedBuffer.data());
             }
+            else
+            {
+                // Values on their own are left to their serializers, which keeps mixed classes identical to regular binary streams.
+                const u32 layoutIndex = m_packedLayoutBuilder.GetLayoutIndex(classData);
+                if (layoutIndex == PackedLayout::InvalidIndex || m_packedLayoutBuilder.GetLayout(layoutIndex).m_isValue)
+                {
+                    return false;
+                }
+
+                WritePendingPackedLayouts();
+                const PackedLayout& layout = m_packedLayoutBuilder.GetLayout(layoutIndex);
 
+                const u8 tag = ST_BINARYTAG_PACKED_OBJECT;
+                m_stream->Write(sizeof(tag), &tag);
+                m_stream->Write(sizeof(nameCrc), &nameCrc);
+                m_stream->Write(sizeof(layoutIndex), &layoutIndex);
+
+                m_packedBuffer.resize_no_construct(layout.m_size);
+                layout.CopyToBlock(m_packedBuffer.data(), objectPtr);
+                m_stream->Write(m_packedBuffer.size(), m_packedBuffer.data());
+            }
             return true;
         }
 
+        //=========================================================================
+        // WritePendingPackedLayouts
+        //=========================================================================
+        void ObjectStreamImpl::WritePendingPackedLayouts()
+        {
+            // All layouts are written in the order the builder created them, so the stream and the builder use the same indices.
+            for (; m_writtenLayoutCount < m_packedLayoutBuilder.GetLayoutCount(); ++m_writtenLayoutCount)
+            {
+                const u8 tag = ST_BINARYTAG_PACKED_LAYOUT;
+                m_stream->Write(sizeof(tag), &tag);
+                WritePackedLayout(*m_stream, m_packedLayoutBuilder.GetLayout(aznumeric_cast<u32>(m_writtenLayoutCount)));
+            }
+        }
+
         //=========================================================================
         // GotoParentNode
         // [10/25/2012]
@@ -1987,7 +2465,7 @@ namespace AZ
                 else
                 {
                     u8 binaryTag = s_binaryStreamTag;
-                    u32 version = static_cast<u32>(m_version);
+                    u32 version = m_type == ST_BINARY_PACKED ? s_packedBinaryStreamVersion : static_cast<u32>(m_version);
                     AZStd::endian_swap(binaryTag);
                     AZStd::endian_swap(version);
                     m_stream->Write(sizeof(binaryTag), &binaryTag);
@@ -2014,14 +2492,15 @@ namespace AZ
                         AZStd::endian_swap(version);
                         m_version = version;
 
-                        if (m_version <= s_objectStreamVersion)
+                        if (m_version <= s_packedBinaryStreamVersion)
                         {
                             result = LoadClass(m_inStream, convertedClassElement, nullptr, nullptr, m_flags) && result;
+                            result = result && !m_hasCorruptPackedData;
                         }
                         else
                         {
                             AZStd::string newVersionError = AZStd::string::format("ObjectStream binary load error: Stream is a newer version than object stream supports. ObjectStream version: %u, load stream version: %u",
-                                s_objectStreamVersion, m_version);
+                                s_packedBinaryStreamVersion, m_version);
                             m_errorLogger.ReportError(newVersionError.c_str());
 
                             // this is considered a "fatal" error since the entire stream is unreadable.
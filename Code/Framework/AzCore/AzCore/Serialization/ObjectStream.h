@@ -69,6 +69,10 @@ namespace AZ
             ST_XML,
             ST_JSON,
             ST_BINARY,
+            /// Binary stream that stores classes made up only of trivially copyable values, and sequence containers of them,
+            /// as raw blocks that are copied straight into the objects when loading. All other data is stored as in ST_BINARY.
+            /// Streams written with this type can't be loaded by versions that predate it.
+            ST_BINARY_PACKED,
             ST_MAX // insert new types before this.
         };
 
@@ -167,6 +171,9 @@ namespace AZ
         };
 
         /// Create objects from a stream. All processing happens in the caller thread. Returns true on success.
+        /// For packed binary streams the blocks are copied directly from memory when the stream exposes its contents through
+        /// IO::GenericStream::GetContiguousData, so wrapping a memory mapped file in an IO::MemoryStream avoids reading it into
+        /// an intermediate buffer. Blocks whose layout no longer matches the reflected classes are loaded element by element.
         static bool LoadBlocking(IO::GenericStream* stream, SerializeContext& sc, const ClassReadyCB& readyCB, const FilterDescriptor& filterDesc = FilterDescriptor(), const InplaceLoadRootInfoCB& inplaceRootInfo = InplaceLoadRootInfoCB());
 
         /// Create a new object stream for writing
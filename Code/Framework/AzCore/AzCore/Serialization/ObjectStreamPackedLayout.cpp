@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Serialization/ObjectStreamPackedLayout.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ::ObjectStreamInternal
+{
+    namespace PackedLayoutInternal
+    {
+        // Returns the size of the types the SerializeContext stores as is, apart from the byte order, or 0 for all other types.
+        // long and unsigned long are left out because their size differs between platforms.
+        static u32 GetValueSize(const Uuid& typeId)
+        {
+            static const AZStd::pair<Uuid, u32> s_valueTypes[] = {
+                { azrtti_typeid<bool>(), static_cast<u32>(sizeof(bool)) },
+                { azrtti_typeid<char>(), static_cast<u32>(sizeof(char)) },
+                { azrtti_typeid<s8>(), static_cast<u32>(sizeof(s8)) },
+                { azrtti_typeid<u8>(), static_cast<u32>(sizeof(u8)) },
+                { azrtti_typeid<s16>(), static_cast<u32>(sizeof(s16)) },
+                { azrtti_typeid<u16>(), static_cast<u32>(sizeof(u16)) },
+                { azrtti_typeid<s32>(), static_cast<u32>(sizeof(s32)) },
+                { azrtti_typeid<u32>(), static_cast<u32>(sizeof(u32)) },
+                { azrtti_typeid<s64>(), static_cast<u32>(sizeof(s64)) },
+                { azrtti_typeid<u64>(), static_cast<u32>(sizeof(u64)) },
+                { azrtti_typeid<float>(), static_cast<u32>(sizeof(float)) },
+                { azrtti_typeid<double>(), static_cast<u32>(sizeof(double)) },
+            };
+
+            for (const auto& [valueTypeId, size] : s_valueTypes)
+            {
+                if (valueTypeId == typeId)
+                {
+                    return size;
+                }
+            }
+            return 0;
+        }
+
+        static void AddCopyRuns(AZStd::vector<PackedLayout::CopyRun>& copyRuns, const PackedLayout& memberLayout, u32 blockOffset, u32 objectOffset)
+        {
+            for (const PackedLayout::CopyRun& run : memberLayout.m_copyRuns)
+            {
+                copyRuns.push_back({ run.m_blockOffset + blockOffset, run.m_objectOffset + objectOffset, run.m_size });
+            }
+        }
+
+        // Sorts the runs by their position in the block and joins runs that are adjacent in both the block and the object.
+        static void MergeCopyRuns(AZStd::vector<PackedLayout::CopyRun>& copyRuns)
+        {
+            AZStd::sort(copyRuns.begin(), copyRuns.end(),
+                [](const PackedLayout::CopyRun& lhs, const PackedLayout::CopyRun& rhs)
+                {
+                    return lhs.m_blockOffset < rhs.m_blockOffset;
+                });
+
+            size_t count = 0;
+            for (size_t i = 0; i < copyRuns.size(); ++i)
+            {
+                const PackedLayout::CopyRun run = copyRuns[i];
+                if (run.m_size == 0)
+                {
+                    continue;
+                }
+                if (count > 0)
+                {
+                    PackedLayout::CopyRun& last = copyRuns[count - 1];
+                    if (last.m_blockOffset + last.m_size == run.m_blockOffset && last.m_objectOffset + last.m_size == run.m_objectOffset)
+                    {
+                        last.m_size += run.m_size;
+                        continue;
+                    }
+                }
+                copyRuns[count++] = run;
+            }
+            copyRuns.resize(count);
+        }
+
+        template<typename T>
+        static void WriteValue(IO::GenericStream& stream, const T& value)
+        {
+            stream.Write(sizeof(T), &value);
+        }
+
+        template<typename T>
+        static bool ReadValue(IO::GenericStream& stream, T& value)
+        {
+            return stream.Read(sizeof(T), &value) == sizeof(T);
+        }
+    } // namespace PackedLayoutInternal
+
+    //
+    // PackedLayout
+    //
+
+    void PackedLayout::CopyToObject(void* object, const char* block) const
+    {
+        for (const CopyRun& run : m_copyRuns)
+        {
+            memcpy(reinterpret_cast<char*>(object) + run.m_objectOffset, block + run.m_blockOffset, run.m_size);
+        }
+    }
+
+    void PackedLayout::CopyToBlock(char* block, const void* object) const
+    {
+        for (const CopyRun& run : m_copyRuns)
+        {
+            memcpy(block + run.m_blockOffset, reinterpret_cast<const char*>(object) + run.m_objectOffset, run.m_size);
+        }
+    }
+
+    bool PackedLayout::IsIdentity(size_t objectSize) const
+    {
+        return m_copyRuns.size() == 1 && m_copyRuns[0].m_blockOffset == 0 && m_copyRuns[0].m_objectOffset == 0 &&
+            m_copyRuns[0].m_size == m_size && m_size == objectSize;
+    }
+
+    //
+    // PackedLayoutBuilder
+    //
+
+    PackedLayoutBuilder::PackedLayoutBuilder(const SerializeContext& serializeContext)
+        : m_serializeContext(serializeContext)
+    {
+    }
+
+    u32 PackedLayoutBuilder::GetLayoutIndex(const SerializeContext::ClassData& classData)
+    {
+        if (auto it = m_layoutIndices.find(&classData); it != m_layoutIndices.end())
+        {
+            return it->second;
+        }
+
+        // The class is considered unpackable while its layout is being built, so reflection that refers back to the class
+        // can't cause endless recursion.
+        m_layoutIndices.emplace(&classData, PackedLayout::InvalidIndex);
+
+        PackedLayout layout;
+        if (!BuildLayout(classData, layout))
+        {
+            return PackedLayout::InvalidIndex;
+        }
+
+        const u32 index = aznumeric_cast<u32>(m_layouts.size());
+        m_layouts.push_back(AZStd::move(layout));
+        m_layoutIndices[&classData] = index;
+        return index;
+    }
+
+    u32 PackedLayoutBuilder::GetArrayLayoutIndex(const SerializeContext::ClassData& containerClassData, const SerializeContext::ClassElement** elementOut)
+    {
+        auto it = m_arrayLayouts.find(&containerClassData);
+        if (it == m_arrayLayouts.end())
+        {
+            ArrayLayout arrayLayout;
+            SerializeContext::IDataContainer* container = containerClassData.m_container;
+            if (container && !containerClassData.m_serializer && container->IsSequenceContainer() && container->CanAccessElementsByIndex() &&
+                !container->IsSmartPointer())
+            {
+                const SerializeContext::ClassElement* element = nullptr;
+                size_t elementTypeCount = 0;
+                container->EnumTypes(
+                    [&element, &elementTypeCount](const Uuid&, const SerializeContext::ClassElement* genericElement)
+                    {
+                        element = genericElement;
+                        ++elementTypeCount;
+                        return true;
+                    });
+
+                if (elementTypeCount == 1 && element && (element->m_flags & SerializeContext::ClassElement::FLG_POINTER) == 0)
+                {
+                    const SerializeContext::ClassData* elementClassData = element->m_genericClassInfo
+                        ? element->m_genericClassInfo->GetClassData()
+                        : m_serializeContext.FindClassData(element->m_typeId);
+                    const u32 layoutIndex = elementClassData ? GetLayoutIndex(*elementClassData) : PackedLayout::InvalidIndex;
+                    if (layoutIndex != PackedLayout::InvalidIndex &&
+                        (!m_layouts[layoutIndex].m_isValue || m_layouts[layoutIndex].m_size == element->m_dataSize))
+                    {
+                        arrayLayout.m_layoutIndex = layoutIndex;
+                        arrayLayout.m_element = element;
+                    }
+                }
+            }
+            it = m_arrayLayouts.emplace(&containerClassData, arrayLayout).first;
+        }
+
+        if (elementOut)
+        {
+            *elementOut = it->second.m_element;
+        }
+        return it->second.m_layoutIndex;
+    }
+
+    const PackedLayout& PackedLayoutBuilder::GetLayout(u32 index) const
+    {
+        AZ_Assert(index < m_layouts.size(), "Packed layout index %u is out of range.", index);
+        return m_layouts[index];
+    }
+
+    size_t PackedLayoutBuilder::GetLayoutCount() const
+    {
+        return m_layouts.size();
+    }
+
+    bool PackedLayoutBuilder::Match(PackedLayout& layout, AZStd::span<const PackedLayout> streamLayouts)
+    {
+        using namespace PackedLayoutInternal;
+
+        layout.m_classData = nullptr;
+        layout.m_copyRuns.clear();
+
+        const SerializeContext::ClassData* classData = m_serializeContext.FindClassData(layout.m_typeId);
+        const u32 reflectedIndex = classData ? GetLayoutIndex(*classData) : PackedLayout::InvalidIndex;
+        if (reflectedIndex == PackedLayout::InvalidIndex)
+        {
+            return false;
+        }
+
+        const PackedLayout& reflectedLayout = m_layouts[reflectedIndex];
+        if (reflectedLayout.m_isValue != layout.m_isValue || reflectedLayout.m_version != layout.m_version ||
+            reflectedLayout.m_fields.size() != layout.m_fields.size())
+        {
+            return false;
+        }
+
+        AZStd::vector<PackedLayout::CopyRun> copyRuns;
+        if (layout.m_isValue)
+        {
+            if (reflectedLayout.m_size != layout.m_size)
+            {
+                return false;
+            }
+            copyRuns = reflectedLayout.m_copyRuns;
+        }
+        else
+        {
+            // Members are matched by name, so reordered members still match, as long as their types didn't change.
+            for (const PackedLayout::Field& field : layout.m_fields)
+            {
+                auto reflectedField = AZStd::find_if(reflectedLayout.m_fields.begin(), reflectedLayout.m_fields.end(),
+                    [nameCrc = field.m_nameCrc](const PackedLayout::Field& candidate)
+                    {
+                        return candidate.m_nameCrc == nameCrc;
+                    });
+                if (reflectedField == reflectedLayout.m_fields.end())
+                {
+                    return false;
+                }
+
+                const PackedLayout& fieldLayout = streamLayouts[field.m_layoutIndex];
+                if (!fieldLayout.m_classData || fieldLayout.m_classData != m_layouts[reflectedField->m_layoutIndex].m_classData)
+                {
+                    return false;
+                }
+                AddCopyRuns(copyRuns, fieldLayout, field.m_offset, reflectedField->m_objectOffset);
+            }
+            MergeCopyRuns(copyRuns);
+        }
+
+        layout.m_classData = classData;
+        layout.m_copyRuns = AZStd::move(copyRuns);
+        return true;
+    }
+
+    bool PackedLayoutBuilder::BuildLayout(const SerializeContext::ClassData& classData, PackedLayout& layout)
+    {
+        using namespace PackedLayoutInternal;
+
+        layout.m_typeId = classData.m_typeId;
+        layout.m_version = classData.m_version;
+        layout.m_classData = &classData;
+
+        if (const u32 valueSize = GetValueSize(classData.m_typeId); valueSize != 0)
+        {
+            layout.m_isValue = true;
+            layout.m_size = valueSize;
+            layout.m_copyRuns.push_back({ 0, 0, valueSize });
+            return true;
+        }
+
+        // Anything that runs code while loading or storing, such as custom serializers, event handlers or write overrides,
+        // needs the regular element by element path.
+        if (classData.m_serializer || classData.m_container || classData.m_eventHandler || classData.m_doSave || classData.IsDeprecated() ||
+            classData.FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride))
+        {
+            return false;
+        }
+
+        constexpr u32 UnpackableFlags = SerializeContext::ClassElement::FLG_POINTER | SerializeContext::ClassElement::FLG_DYNAMIC_FIELD |
+            SerializeContext::ClassElement::FLG_UI_ELEMENT;
+
+        layout.m_fields.reserve(classData.m_elements.size());
+        for (const SerializeContext::ClassElement& element : classData.m_elements)
+        {
+            if (element.m_flags & UnpackableFlags)
+            {
+                return false;
+            }
+
+            const SerializeContext::ClassData* elementClassData = element.m_genericClassInfo
+                ? element.m_genericClassInfo->GetClassData()
+                : m_serializeContext.FindClassData(element.m_typeId, &classData, element.m_nameCrc);
+            const u32 layoutIndex = elementClassData ? GetLayoutIndex(*elementClassData) : PackedLayout::InvalidIndex;
+            if (layoutIndex == PackedLayout::InvalidIndex ||
+                (m_layouts[layoutIndex].m_isValue && m_layouts[layoutIndex].m_size != element.m_dataSize))
+            {
+                return false;
+            }
+
+            PackedLayout::Field& field = layout.m_fields.emplace_back();
+            field.m_nameCrc = element.m_nameCrc;
+            field.m_layoutIndex = layoutIndex;
+            field.m_objectOffset = aznumeric_cast<u32>(element.m_offset);
+        }
+
+        // Blocks store the members in the order they appear in the object, so members that are next to each other in the
+        // object end up next to each other in the block and can be copied together.
+        AZStd::vector<size_t> blockOrder(layout.m_fields.size());
+        for (size_t i = 0; i < blockOrder.size(); ++i)
+        {
+            blockOrder[i] = i;
+        }
+        AZStd::sort(blockOrder.begin(), blockOrder.end(),
+            [&fields = layout.m_fields](size_t lhs, size_t rhs)
+            {
+                return fields[lhs].m_objectOffset != fields[rhs].m_objectOffset ? fields[lhs].m_objectOffset < fields[rhs].m_objectOffset
+                                                                                 : lhs < rhs;
+            });
+
+        u32 blockOffset = 0;
+        for (size_t index : blockOrder)
+        {
+            PackedLayout::Field& field = layout.m_fields[index];
+            const PackedLayout& fieldLayout = m_layouts[field.m_layoutIndex];
+            field.m_offset = blockOffset;
+            AddCopyRuns(layout.m_copyRuns, fieldLayout, field.m_offset, field.m_objectOffset);
+            blockOffset += fieldLayout.m_size;
+        }
+        layout.m_size = blockOffset;
+        MergeCopyRuns(layout.m_copyRuns);
+        return true;
+    }
+
+    //
+    // Stream functions
+    //
+
+    void WritePackedLayout(IO::GenericStream& stream, const PackedLayout& layout)
+    {
+        using namespace PackedLayoutInternal;
+
+        stream.Write(layout.m_typeId.end() - layout.m_typeId.begin(), layout.m_typeId.begin());
+        WriteValue(stream, layout.m_version);
+        WriteValue(stream, layout.m_size);
+        WriteValue(stream, static_cast<u8>(layout.m_isValue ? 1 : 0));
+        WriteValue(stream, aznumeric_cast<u32>(layout.m_fields.size()));
+        for (const PackedLayout::Field& field : layout.m_fields)
+        {
+            WriteValue(stream, field.m_nameCrc);
+            WriteValue(stream, field.m_layoutIndex);
+            WriteValue(stream, field.m_offset);
+        }
+    }
+
+    bool ReadPackedLayout(IO::GenericStream& stream, PackedLayout& layout, AZStd::span<const PackedLayout> streamLayouts)
+    {
+        using namespace PackedLayoutInternal;
+
+        constexpr size_t FieldSize = 3 * sizeof(u32);
+        const IO::SizeType typeIdSize = layout.m_typeId.end() - layout.m_typeId.begin();
+
+        u8 isValue = 0;
+        u32 fieldCount = 0;
+        if (stream.Read(typeIdSize, layout.m_typeId.begin()) != typeIdSize || !ReadValue(stream, layout.m_version) ||
+            !ReadValue(stream, layout.m_size) || !ReadValue(stream, isValue) || !ReadValue(stream, fieldCount))
+        {
+            return false;
+        }
+
+        layout.m_isValue = isValue != 0;
+        if (layout.m_isValue && (fieldCount != 0 || layout.m_size == 0 || layout.m_size > sizeof(u64)))
+        {
+            return false;
+        }
+        if (fieldCount > (stream.GetLength() - stream.GetCurPos()) / FieldSize)
+        {
+            return false;
+        }
+
+        layout.m_fields.resize(fieldCount);
+        for (PackedLayout::Field& field : layout.m_fields)
+        {
+            if (!ReadValue(stream, field.m_nameCrc) || !ReadValue(stream, field.m_layoutIndex) || !ReadValue(stream, field.m_offset))
+            {
+                return false;
+            }
+            // Members can only use layouts that were written before, which also rules out cycles.
+            if (field.m_layoutIndex >= streamLayouts.size() ||
+                u64{ field.m_offset } + streamLayouts[field.m_layoutIndex].m_size > u64{ layout.m_size })
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace AZ::ObjectStreamInternal
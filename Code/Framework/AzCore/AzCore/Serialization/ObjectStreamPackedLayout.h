@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace AZ::ObjectStreamInternal
+{
+    //! Describes how instances of a reflected class are stored in a packed binary object stream.
+    //! Classes whose reflected members are all trivially copyable values, directly or through other such classes and base
+    //! classes, are stored as a single block of bytes instead of as an element per member. The layout of a class is written
+    //! to the stream before the first block that uses it, so blocks can always be read back, even after the class changed.
+    struct PackedLayout
+    {
+        static constexpr u32 InvalidIndex = 0xFFFFFFFF;
+
+        struct Field
+        {
+            u32 m_nameCrc{ 0 };
+            //! The layout of the member, which is either a value or another class.
+            u32 m_layoutIndex{ InvalidIndex };
+            //! The offset of the member in a block.
+            u32 m_offset{ 0 };
+            //! The offset of the member in an object. Only known for layouts created from reflection.
+            u32 m_objectOffset{ 0 };
+        };
+
+        //! A range of bytes that can be copied in one go between a block and an object.
+        struct CopyRun
+        {
+            u32 m_blockOffset{ 0 };
+            u32 m_objectOffset{ 0 };
+            u32 m_size{ 0 };
+        };
+
+        //! Copies a block into an object. Only valid if the layout has class data.
+        void CopyToObject(void* object, const char* block) const;
+        //! Copies an object into a block. Only valid if the layout has class data.
+        void CopyToBlock(char* block, const void* object) const;
+        //! Returns true if a block is an exact copy of an object of the provided size.
+        bool IsIdentity(size_t objectSize) const;
+
+        Uuid m_typeId;
+        u32 m_version{ 0 };
+        //! The size of a block in bytes.
+        u32 m_size{ 0 };
+        //! True for the trivially copyable values, in which case there are no fields.
+        bool m_isValue{ false };
+        //! The members of the class in reflection order.
+        AZStd::vector<Field> m_fields;
+
+        //! The reflected class the layout applies to. Layouts read from a stream only get this if they match the currently
+        //! reflected class, in which case blocks can be copied using the copy runs.
+        const SerializeContext::ClassData* m_classData{ nullptr };
+        AZStd::vector<CopyRun> m_copyRuns;
+    };
+
+    //! Creates and caches the packed layouts of reflected classes. Layouts are stored in the order they're completed, so the
+    //! layouts of members always come before the layout of the class that holds them.
+    class PackedLayoutBuilder
+    {
+    public:
+        explicit PackedLayoutBuilder(const SerializeContext& serializeContext);
+
+        //! Returns the index of the layout for the class or InvalidIndex if the class can't be packed.
+        u32 GetLayoutIndex(const SerializeContext::ClassData& classData);
+        //! Returns the index of the layout of the elements of a container if it can be stored as a packed array, otherwise
+        //! InvalidIndex. This is limited to sequence containers with index access and elements that are stored by value.
+        u32 GetArrayLayoutIndex(const SerializeContext::ClassData& containerClassData, const SerializeContext::ClassElement** elementOut = nullptr);
+
+        const PackedLayout& GetLayout(u32 index) const;
+        size_t GetLayoutCount() const;
+
+        //! Checks if a layout read from a stream matches the currently reflected class and if so sets its class data and
+        //! copy runs. The layouts of its members need to have been matched before.
+        bool Match(PackedLayout& layout, AZStd::span<const PackedLayout> streamLayouts);
+
+    private:
+        struct ArrayLayout
+        {
+            u32 m_layoutIndex{ PackedLayout::InvalidIndex };
+            const SerializeContext::ClassElement* m_element{ nullptr };
+        };
+
+        bool BuildLayout(const SerializeContext::ClassData& classData, PackedLayout& layout);
+
+        const SerializeContext& m_serializeContext;
+        AZStd::vector<PackedLayout> m_layouts;
+        AZStd::unordered_map<const SerializeContext::ClassData*, u32> m_layoutIndices;
+        AZStd::unordered_map<const SerializeContext::ClassData*, ArrayLayout> m_arrayLayouts;
+    };
+
+    //! Writes the description of a layout, excluding the class data and copy runs.
+    void WritePackedLayout(IO::GenericStream& stream, const PackedLayout& layout);
+    //! Reads the description of a layout. Returns false if the stream is truncated or the layout refers to layouts that
+    //! weren't read before it.
+    bool ReadPackedLayout(IO::GenericStream& stream, PackedLayout& layout, AZStd::span<const PackedLayout> streamLayouts);
+} // namespace AZ::ObjectStreamInternal
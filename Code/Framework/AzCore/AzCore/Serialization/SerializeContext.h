@@ -1169,6 +1169,14 @@ namespace AZ::Serialize
         }
         /// Get an element's address by its index (called before the element is loaded).
         virtual void* GetElementByIndex(void* instance, const ClassElement* classElement, size_t index) = 0;
+        /// Resizes the container to the requested number of elements and returns the address of the first element, if the
+        /// elements are stored contiguously. Elements that are added are only guaranteed to be constructed if the element type
+        /// is not trivial, so they have to be loaded after this call. Returns null if this isn't supported or the container
+        /// can't hold the requested number of elements, in which case the container is left untouched.
+        virtual void* ResizeContiguousElements([[maybe_unused]] void* instance, [[maybe_unused]] size_t numElements)
+        {
+            return nullptr;
+        }
         /// Store the element that was reserved before (called post loading)
         virtual void    StoreElement(void* instance, void* element) = 0;
         /// Remove element in the container. Returns true if the element was removed, otherwise false. If deletePointerDataContext is NOT null, this indicated that you want the remove function to delete/destroy any Elements that are pointer!
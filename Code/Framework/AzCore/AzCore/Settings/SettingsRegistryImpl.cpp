@@ -18,6 +18,7 @@
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Serialization/Locale.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
@@ -49,6 +50,65 @@ namespace AZ::SettingsRegistryImplInternal
 
         return Type::NoType;
     }
+
+    //! Converts a JSON value to the requested type. Strings are appended to the result.
+    template<typename T>
+    bool GetValueFromJson(T& result, const rapidjson::Value* value)
+    {
+        if constexpr (AZStd::is_same_v<T, bool>)
+        {
+            if (value && value->IsBool())
+            {
+                result = value->GetBool();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, AZ::s64>)
+        {
+            if (value && value->IsInt64())
+            {
+                result = value->GetInt64();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, AZ::u64>)
+        {
+            if (value && value->IsUint64())
+            {
+                result = value->GetUint64();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, double>)
+        {
+            if (value && value->IsDouble())
+            {
+                result = value->GetDouble();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, AZ::SettingsRegistryInterface::FixedValueString>)
+        {
+            if (value && value->IsString())
+            {
+                result.append(value->GetString(), value->GetStringLength());
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, AZStd::string_view>)
+        {
+            if (value && value->IsString())
+            {
+                result = AZStd::string_view(value->GetString(), value->GetStringLength());
+                return true;
+            }
+        }
+        else
+        {
+            static_assert(!AZStd::is_same_v<T,T>, "GetValueFromJson called with unsupported type.");
+        }
+        return false;
+    }
 }
 
 namespace AZ
@@ -90,6 +150,7 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
+            IncrementGeneration();
             if constexpr (AZStd::is_same_v<T, bool> || AZStd::is_same_v<T, double>)
             {
                 pointer.Set(m_settings, value);
@@ -134,51 +195,7 @@ namespace AZ
         {
             AZStd::scoped_lock lock(LockForReading());
 
-            const rapidjson::Value* value = pointer.Get(m_settings);
-            if constexpr (AZStd::is_same_v<T, bool>)
-            {
-                if (value && value->IsBool())
-                {
-                    result = value->GetBool();
-                    return true;
-                }
-            }
-            else if constexpr (AZStd::is_same_v<T, s64>)
-            {
-                if (value && value->IsInt64())
-                {
-                    result = value->GetInt64();
-                    return true;
-                }
-            }
-            else if constexpr (AZStd::is_same_v<T, u64>)
-            {
-                if (value && value->IsUint64())
-                {
-                    result = value->GetUint64();
-                    return true;
-                }
-            }
-            else if constexpr (AZStd::is_same_v<T, double>)
-            {
-                if (value && value->IsDouble())
-                {
-                    result = value->GetDouble();
-                    return true;
-                }
-            }
-            else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
-            {
-                if (value && value->IsString())
-                {
-                    result.append(value->GetString(), value->GetStringLength());
-                    return true;
-                }
-            }
-            else
-            {
-                static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
-            }
+            return SettingsRegistryImplInternal::GetValueFromJson(result, pointer.Get(m_settings));
         }
         return false;
     }
@@ -572,6 +589,7 @@ namespace AZ
                 SettingsType anchorType;
                 {
                     AZStd::scoped_lock lock(LockForWriting());
+                    IncrementGeneration();
                     rapidjson::Value& setting = pointer.Create(m_settings, m_settings.GetAllocator());
                     setting = AZStd::move(store);
                     anchorType = GetTypeNoLock(path);
@@ -602,6 +620,10 @@ namespace AZ
         {
             AZStd::scoped_lock lock(LockForWriting());
             removeSuccess = pointerPath.Erase(m_settings);
+            if (removeSuccess)
+            {
+                IncrementGeneration();
+            }
         }
 
         // The removal type is Type::NoType
@@ -1429,6 +1451,7 @@ namespace AZ
         SettingsType anchorType;
         {
             AZStd::scoped_lock lock(LockForWriting());
+            IncrementGeneration();
 
             rapidjson::Value& anchorRoot = anchorPath.IsValid() ? anchorPath.Create(m_settings, m_settings.GetAllocator())
                 : m_settings;
@@ -1474,6 +1497,204 @@ namespace AZ
         m_useFileIo = useFileIo;
     }
 
+    SettingsPathHandle SettingsRegistryImpl::ResolvePathHandle(AZStd::string_view path)
+    {
+        if (path.empty())
+        {
+            // rapidjson::Pointer asserts that the supplied string
+            // is not nullptr even if the supplied size is 0
+            // Setting to empty string to prevent assert
+            path = "";
+        }
+
+        AZStd::scoped_lock lock(m_pathHandleMutex);
+        if (auto foundIt = m_pathHandleIndices.find(path); foundIt != m_pathHandleIndices.end())
+        {
+            return SettingsPathHandle{ foundIt->second };
+        }
+
+        rapidjson::Pointer pointer(path.data(), path.length());
+        if (!pointer.IsValid())
+        {
+            return SettingsPathHandle{};
+        }
+
+        const auto handleIndex = aznumeric_cast<u32>(m_pathHandlePointers.size());
+        m_pathHandlePointers.push_back(AZStd::move(pointer));
+        m_pathHandleIndices.emplace(path, handleIndex);
+        // Outdates the current snapshot, as it doesn't have a value for the new handle
+        m_pathHandleCount.store(handleIndex + 1, AZStd::memory_order_release);
+        return SettingsPathHandle{ handleIndex };
+    }
+
+    AZStd::shared_ptr<const SettingsRegistrySnapshot> SettingsRegistryImpl::GetSnapshot() const
+    {
+        {
+            AZStd::shared_lock lock(m_snapshotMutex);
+            if (m_snapshot != nullptr && IsSnapshotCurrent(*m_snapshot))
+            {
+                return m_snapshot;
+            }
+        }
+
+        // Only one thread rebuilds the snapshot, the others pick up its result once they get the lock
+        AZStd::scoped_lock publishLock(m_publishSnapshotMutex);
+        {
+            AZStd::shared_lock lock(m_snapshotMutex);
+            if (m_snapshot != nullptr && IsSnapshotCurrent(*m_snapshot))
+            {
+                return m_snapshot;
+            }
+        }
+        return PublishSnapshot();
+    }
+
+    bool SettingsRegistryImpl::IsSnapshotCurrent(const SettingsRegistrySnapshot& snapshot) const
+    {
+        return snapshot.m_generation == m_generation.load(AZStd::memory_order_acquire)
+            && snapshot.m_resolvedValues.size() == m_pathHandleCount.load(AZStd::memory_order_acquire);
+    }
+
+    void SettingsRegistryImpl::IncrementGeneration()
+    {
+        m_generation.fetch_add(1, AZStd::memory_order_release);
+    }
+
+    AZStd::shared_ptr<const SettingsRegistrySnapshot> SettingsRegistryImpl::PublishSnapshot() const
+    {
+        auto snapshot = AZStd::make_shared<SettingsRegistrySnapshot>();
+        {
+            // The generation is only incremented while the settings are locked for writing,
+            // so it matches the copied settings
+            AZStd::scoped_lock lock(LockForReading());
+            snapshot->m_generation = m_generation.load(AZStd::memory_order_relaxed);
+            snapshot->m_settings.CopyFrom(m_settings, snapshot->m_settings.GetAllocator());
+        }
+
+        {
+            AZStd::scoped_lock lock(m_pathHandleMutex);
+            snapshot->m_resolvedValues.reserve(m_pathHandlePointers.size());
+            for (const rapidjson::Pointer& pointer : m_pathHandlePointers)
+            {
+                snapshot->m_resolvedValues.push_back(pointer.Get(snapshot->m_settings));
+            }
+        }
+
+        AZStd::scoped_lock lock(m_snapshotMutex);
+        // Another thread may have published a newer snapshot in the meantime
+        if (m_snapshot == nullptr || m_snapshot->m_generation < snapshot->m_generation
+            || m_snapshot->m_resolvedValues.size() < snapshot->m_resolvedValues.size())
+        {
+            m_snapshot = snapshot;
+        }
+        return snapshot;
+    }
+
+    u64 SettingsRegistrySnapshot::GetGeneration() const
+    {
+        return m_generation;
+    }
+
+    const rapidjson::Value* SettingsRegistrySnapshot::Find(SettingsPathHandle handle) const
+    {
+        return handle.m_index < m_resolvedValues.size() ? m_resolvedValues[handle.m_index] : nullptr;
+    }
+
+    const rapidjson::Value* SettingsRegistrySnapshot::Find(AZStd::string_view path) const
+    {
+        if (path.empty())
+        {
+            // rapidjson::Pointer asserts that the supplied string
+            // is not nullptr even if the supplied size is 0
+            // Setting to empty string to prevent assert
+            path = "";
+        }
+        rapidjson::Pointer pointer(path.data(), path.length());
+        return pointer.IsValid() ? pointer.Get(m_settings) : nullptr;
+    }
+
+    auto SettingsRegistrySnapshot::GetType(SettingsPathHandle handle) const -> SettingsType
+    {
+        const rapidjson::Value* value = Find(handle);
+        return value != nullptr ? SettingsType{ SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(*value) } : SettingsType{};
+    }
+
+    auto SettingsRegistrySnapshot::GetType(AZStd::string_view path) const -> SettingsType
+    {
+        const rapidjson::Value* value = Find(path);
+        return value != nullptr ? SettingsType{ SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(*value) } : SettingsType{};
+    }
+
+    bool SettingsRegistrySnapshot::Get(bool& result, SettingsPathHandle handle) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(handle));
+    }
+
+    bool SettingsRegistrySnapshot::Get(s64& result, SettingsPathHandle handle) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(handle));
+    }
+
+    bool SettingsRegistrySnapshot::Get(u64& result, SettingsPathHandle handle) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(handle));
+    }
+
+    bool SettingsRegistrySnapshot::Get(double& result, SettingsPathHandle handle) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(handle));
+    }
+
+    bool SettingsRegistrySnapshot::Get(AZStd::string& result, SettingsPathHandle handle) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(handle));
+    }
+
+    bool SettingsRegistrySnapshot::Get(FixedValueString& result, SettingsPathHandle handle) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(handle));
+    }
+
+    bool SettingsRegistrySnapshot::Get(AZStd::string_view& result, SettingsPathHandle handle) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(handle));
+    }
+
+    bool SettingsRegistrySnapshot::Get(bool& result, AZStd::string_view path) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(path));
+    }
+
+    bool SettingsRegistrySnapshot::Get(s64& result, AZStd::string_view path) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(path));
+    }
+
+    bool SettingsRegistrySnapshot::Get(u64& result, AZStd::string_view path) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(path));
+    }
+
+    bool SettingsRegistrySnapshot::Get(double& result, AZStd::string_view path) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(path));
+    }
+
+    bool SettingsRegistrySnapshot::Get(AZStd::string& result, AZStd::string_view path) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(path));
+    }
+
+    bool SettingsRegistrySnapshot::Get(FixedValueString& result, AZStd::string_view path) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(path));
+    }
+
+    bool SettingsRegistrySnapshot::Get(AZStd::string_view& result, AZStd::string_view path) const
+    {
+        return SettingsRegistryImplInternal::GetValueFromJson(result, Find(path));
+    }
+
     AZStd::scoped_lock<AZStd::recursive_mutex> SettingsRegistryImpl::LockForWriting() const
     {
         // ensure that we aren't actively iterating over this data that is about to be
@@ -15,14 +15,86 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace AZ
 {
     class StackedString;
     struct JsonImportSettings;
+    class SettingsRegistryImpl;
+
+    //! Path into the Settings Registry which has been resolved once through SettingsRegistryImpl::ResolvePathHandle.
+    //! Handles stay valid for the lifetime of the registry and can be cached by systems that read the same setting repeatedly.
+    struct SettingsPathHandle
+    {
+        static constexpr u32 InvalidIndex = AZStd::numeric_limits<u32>::max();
+
+        bool IsValid() const
+        {
+            return m_index != InvalidIndex;
+        }
+
+        u32 m_index{ InvalidIndex };
+    };
+
+    //! Immutable view of the settings in a SettingsRegistryImpl at the time the snapshot was published.
+    //! Reading from a snapshot takes no lock, so it can be done from any number of threads at once.
+    //! Values of path handles are resolved when the snapshot is published, so looking up a handle is an array index
+    //! instead of a JSON pointer walk.
+    class SettingsRegistrySnapshot
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SettingsRegistrySnapshot, AZ::OSAllocator);
+        using SettingsType = SettingsRegistryInterface::SettingsType;
+        using FixedValueString = SettingsRegistryInterface::FixedValueString;
+
+        SettingsRegistrySnapshot() = default;
+        AZ_DISABLE_COPY_MOVE(SettingsRegistrySnapshot);
+
+        //! Returns the version of the settings this snapshot was taken from
+        u64 GetGeneration() const;
+
+        [[nodiscard]] SettingsType GetType(SettingsPathHandle handle) const;
+        [[nodiscard]] SettingsType GetType(AZStd::string_view path) const;
+
+        //! Handles which were resolved after the snapshot was published aren't part of the snapshot
+        //! and reading them fails. SettingsRegistryImpl::GetSnapshot publishes a snapshot that includes them.
+        bool Get(bool& result, SettingsPathHandle handle) const;
+        bool Get(s64& result, SettingsPathHandle handle) const;
+        bool Get(u64& result, SettingsPathHandle handle) const;
+        bool Get(double& result, SettingsPathHandle handle) const;
+        bool Get(AZStd::string& result, SettingsPathHandle handle) const;
+        bool Get(FixedValueString& result, SettingsPathHandle handle) const;
+        //! The string view refers to the snapshot and is valid for as long as the snapshot is kept alive
+        bool Get(AZStd::string_view& result, SettingsPathHandle handle) const;
+
+        //! Reads a value by JSON pointer path. This doesn't take a lock, but needs to walk the path.
+        bool Get(bool& result, AZStd::string_view path) const;
+        bool Get(s64& result, AZStd::string_view path) const;
+        bool Get(u64& result, AZStd::string_view path) const;
+        bool Get(double& result, AZStd::string_view path) const;
+        bool Get(AZStd::string& result, AZStd::string_view path) const;
+        bool Get(FixedValueString& result, AZStd::string_view path) const;
+        bool Get(AZStd::string_view& result, AZStd::string_view path) const;
+
+    private:
+        friend class SettingsRegistryImpl;
+
+        const rapidjson::Value* Find(SettingsPathHandle handle) const;
+        const rapidjson::Value* Find(AZStd::string_view path) const;
+
+        rapidjson::Document m_settings;
+        //! Value of each path handle in m_settings, indexed by the handle
+        AZStd::vector<const rapidjson::Value*> m_resolvedValues;
+        u64 m_generation{};
+    };
 
     class SettingsRegistryImpl final
         : public SettingsRegistryInterface
@@ -88,6 +160,19 @@ namespace AZ
 
         void SetUseFileIO(bool useFileIo) override;
 
+        //! Resolves a JSON pointer path to a handle for reading the value from snapshots in constant time.
+        //! Resolving the same path again returns the same handle. Returns an invalid handle if the path isn't a valid JSON pointer.
+        SettingsPathHandle ResolvePathHandle(AZStd::string_view path);
+
+        //! Returns a read-only snapshot of the current settings. The snapshot is shared between callers and only rebuilt
+        //! by the first request after the settings have changed or new path handles have been resolved, so any number of
+        //! changes in between cost a single rebuild. Concurrent requests for an outdated snapshot wait for one rebuild.
+        AZStd::shared_ptr<const SettingsRegistrySnapshot> GetSnapshot() const;
+
+        //! Checks without taking a lock if a snapshot still matches the current settings.
+        //! This allows readers to cache a snapshot and only call GetSnapshot when it has been outdated.
+        bool IsSnapshotCurrent(const SettingsRegistrySnapshot& snapshot) const;
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -125,6 +210,11 @@ namespace AZ
 
         void SignalNotifier(AZStd::string_view jsonPath, SettingsType type);
 
+        //! Marks the settings as modified, which outdates the current snapshot. Called with the settings mutex held.
+        void IncrementGeneration();
+        //! Builds a snapshot from the current settings and makes it the current snapshot
+        AZStd::shared_ptr<const SettingsRegistrySnapshot> PublishSnapshot() const;
+
         //! Locks the m_settingMutex but also checks to make sure that someone is not currently
         //! visiting/iterating over the registry, which is invalid if you're about to modify it
         AZStd::scoped_lock<AZStd::recursive_mutex> LockForWriting() const;
@@ -176,6 +266,21 @@ namespace AZ
         //! This is protected by m_settingsMutex
         AZStd::stack<AZ::IO::FixedMaxPath> m_mergeFilePathStack;
 
+        //! Incremented whenever the settings are modified
+        AZStd::atomic<u64> m_generation{ 1 };
+        //! Last published snapshot, swapped under the snapshot mutex
+        mutable AZStd::shared_mutex m_snapshotMutex;
+        mutable AZStd::shared_ptr<const SettingsRegistrySnapshot> m_snapshot;
+        //! Serializes rebuilding snapshots, so concurrent requests after a change share one rebuild
+        mutable AZStd::mutex m_publishSnapshotMutex;
+
+        //! Paths which have been resolved to handles. The index of a path is its handle.
+        //! The transparent comparison allows looking up paths without copying them into a string.
+        mutable AZStd::mutex m_pathHandleMutex;
+        AZStd::unordered_map<AZStd::string, u32, AZStd::hash<AZStd::string>, AZStd::equal_to<>> m_pathHandleIndices;
+        AZStd::vector<rapidjson::Pointer> m_pathHandlePointers;
+        AZStd::atomic<u32> m_pathHandleCount{};
+
         // if this is nonzero, we are in a visit operation.  It can be used to detect illegal modifications
         // of the tree during visit.
         mutable int m_visitDepth = 0; // mutable due to it being a debugging value used in const.
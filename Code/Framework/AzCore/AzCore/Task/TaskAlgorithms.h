@@ -0,0 +1,509 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/numeric.h>
+#include <AzCore/std/sort.h>
+
+// Parallel versions of common AZStd algorithms that run on a TaskExecutor.
+// The range is split into chunks that are processed by tasks while the calling thread processes the first chunk and then
+// waits for the rest. The chunk size adapts to the size of the range and the number of worker threads, ranges that are
+// smaller than the minimum grain size are processed on the calling thread without creating any tasks. Calls made from a task
+// running on the same executor are processed serially as well, since a task can't wait for other tasks.
+// All functions require random access iterators. Functions and predicates are called from multiple threads at the same time
+// and need to be thread safe.
+
+namespace AZ
+{
+    // Controls how the parallel algorithms split up their work
+    struct ParallelAlgorithmDescriptor
+    {
+        // The executor the tasks are submitted to. If not set the default executor is used
+        TaskExecutor* executor = nullptr;
+
+        // The smallest number of elements handled by a single task. Raise this for cheap operations on small elements and
+        // lower it for expensive ones
+        size_t minGrainSize = 2048;
+
+        // The descriptor used for every task created by the algorithm
+        TaskDescriptor taskDescriptor{ "ParallelAlgorithm", "AzCore" };
+    };
+
+    namespace Internal
+    {
+        // The number of chunks created per worker thread, which leaves the executor room to balance chunks that take longer
+        // than others
+        constexpr size_t ParallelChunksPerWorker = 4;
+
+        inline TaskExecutor& GetParallelExecutor(const ParallelAlgorithmDescriptor& descriptor)
+        {
+            return descriptor.executor ? *descriptor.executor : TaskExecutor::Instance();
+        }
+
+        // Returns the number of chunks to split a range of count elements into. Returns 1 if the range should be processed on
+        // the calling thread
+        inline size_t GetParallelChunkCount(
+            size_t count, size_t chunksPerWorker, TaskExecutor& executor, const ParallelAlgorithmDescriptor& descriptor)
+        {
+            const size_t minGrainSize = AZStd::max<size_t>(descriptor.minGrainSize, 1);
+            const size_t threadCount = executor.GetThreadCount();
+            if (count <= minGrainSize || threadCount < 2 || executor.IsTaskWorkerThread())
+            {
+                return 1;
+            }
+            return AZStd::min((count + minGrainSize - 1) / minGrainSize, threadCount * chunksPerWorker);
+        }
+
+        // Returns the first element of a chunk. The last chunk ends at GetParallelChunkBegin(count, chunkCount, chunkCount)
+        inline size_t GetParallelChunkBegin(size_t count, size_t chunkCount, size_t chunkIndex)
+        {
+            return static_cast<size_t>(static_cast<AZ::u64>(count) * chunkIndex / chunkCount);
+        }
+
+        // Calls function(chunkIndex) for every chunk and returns once all chunks are done. The first chunk runs on the calling
+        // thread while the executor runs the others
+        template<class Function>
+        void RunParallelChunks(TaskExecutor& executor, const ParallelAlgorithmDescriptor& descriptor, size_t chunkCount, const Function& function)
+        {
+            if (chunkCount == 0)
+            {
+                return;
+            }
+            if (chunkCount == 1)
+            {
+                function(size_t{ 0 });
+                return;
+            }
+
+            // The graph is only submitted once, detaching it lets the executor free it as soon as the last task finished
+            TaskGraph graph{ "ParallelAlgorithm" };
+            graph.Detach();
+            for (size_t chunkIndex = 1; chunkIndex < chunkCount; ++chunkIndex)
+            {
+                graph.AddTask(
+                    descriptor.taskDescriptor,
+                    [&function, chunkIndex]()
+                    {
+                        function(chunkIndex);
+                    });
+            }
+
+            TaskGraphEvent finished{ "ParallelAlgorithm" };
+            graph.SubmitOnExecutor(executor, &finished);
+            function(size_t{ 0 });
+            finished.Wait();
+        }
+
+        template<class InputIt, class OutputIt, class BinaryOperation>
+        OutputIt InclusiveScan(InputIt first, InputIt last, OutputIt result, BinaryOperation& operation)
+        {
+            if (first == last)
+            {
+                return result;
+            }
+
+            typename AZStd::iterator_traits<InputIt>::value_type sum = *first;
+            *result = sum;
+            for (++first, ++result; first != last; ++first, ++result)
+            {
+                sum = operation(AZStd::move(sum), *first);
+                *result = sum;
+            }
+            return result;
+        }
+
+        // Hoare style partition that calls the predicate exactly once per element
+        template<class RandomIt, class UnaryPredicate>
+        RandomIt Partition(RandomIt first, RandomIt last, UnaryPredicate& predicate)
+        {
+            for (;;)
+            {
+                for (;; ++first)
+                {
+                    if (first == last)
+                    {
+                        return first;
+                    }
+                    if (!predicate(*first))
+                    {
+                        break;
+                    }
+                }
+                for (;;)
+                {
+                    --last;
+                    if (first == last)
+                    {
+                        return first;
+                    }
+                    if (predicate(*last))
+                    {
+                        break;
+                    }
+                }
+                AZStd::iter_swap(first, last);
+                ++first;
+            }
+        }
+
+        // Returns how many of the first k elements of the merge of a and b come from a. Ties are taken from a first, the same
+        // as AZStd::merge does
+        template<class RandomIt, class Compare>
+        size_t MergeSplit(RandomIt a, size_t aSize, RandomIt b, size_t bSize, size_t k, Compare& compare)
+        {
+            size_t low = k > bSize ? k - bSize : 0;
+            size_t high = AZStd::min(k, aSize);
+            while (low < high)
+            {
+                const size_t i = low + (high - low) / 2;
+                if (!compare(b[k - i - 1], a[i]))
+                {
+                    low = i + 1;
+                }
+                else
+                {
+                    high = i;
+                }
+            }
+            return low;
+        }
+
+        // Merges pairs of sorted runs from source into destination and updates the run bounds. Each merge is split into pieces
+        // along the output, so pieces have the same size no matter how the elements of the two runs interleave
+        template<class SourceIt, class DestinationIt, class Compare>
+        void ParallelMergeRuns(
+            SourceIt source, DestinationIt destination, AZStd::vector<size_t>& runBounds, size_t pieceSize, Compare& compare,
+            TaskExecutor& executor, const ParallelAlgorithmDescriptor& descriptor)
+        {
+            struct MergePiece
+            {
+                size_t m_aBegin;
+                size_t m_aEnd;
+                size_t m_bBegin;
+                size_t m_bEnd;
+                size_t m_output;
+            };
+
+            AZStd::vector<MergePiece> pieces;
+            AZStd::vector<size_t> mergedBounds;
+            mergedBounds.push_back(runBounds.front());
+            for (size_t run = 0; run + 1 < runBounds.size(); run += 2)
+            {
+                const size_t aBegin = runBounds[run];
+                const size_t aEnd = runBounds[run + 1];
+                // An unpaired last run is merged with an empty run, which moves it to the destination
+                const size_t bEnd = run + 2 < runBounds.size() ? runBounds[run + 2] : aEnd;
+                const size_t total = bEnd - aBegin;
+                const size_t pieceCount = AZStd::max<size_t>((total + pieceSize - 1) / pieceSize, 1);
+
+                size_t aSplit = aBegin;
+                size_t bSplit = aEnd;
+                for (size_t piece = 1; piece <= pieceCount; ++piece)
+                {
+                    const size_t k = GetParallelChunkBegin(total, pieceCount, piece);
+                    const size_t nextASplit = aBegin + MergeSplit(source + aBegin, aEnd - aBegin, source + aEnd, bEnd - aEnd, k, compare);
+                    const size_t nextBSplit = aEnd + (k - (nextASplit - aBegin));
+                    pieces.push_back({ aSplit, nextASplit, bSplit, nextBSplit, aSplit + (bSplit - aEnd) });
+                    aSplit = nextASplit;
+                    bSplit = nextBSplit;
+                }
+                mergedBounds.push_back(bEnd);
+            }
+
+            RunParallelChunks(
+                executor, descriptor, pieces.size(),
+                [&](size_t pieceIndex)
+                {
+                    const MergePiece& piece = pieces[pieceIndex];
+                    AZStd::merge(
+                        AZStd::make_move_iterator(source + piece.m_aBegin), AZStd::make_move_iterator(source + piece.m_aEnd),
+                        AZStd::make_move_iterator(source + piece.m_bBegin), AZStd::make_move_iterator(source + piece.m_bEnd),
+                        destination + piece.m_output, compare);
+                });
+
+            runBounds = AZStd::move(mergedBounds);
+        }
+    } // namespace Internal
+
+    //! Applies operation to every element of [first, last) and stores the results in the range beginning at result, in
+    //! the same way as AZStd::transform. result may be equal to first.
+    //! @return An iterator to the element past the last element written.
+    template<class RandomIt, class OutputIt, class UnaryOperation>
+    OutputIt parallel_transform(
+        RandomIt first, RandomIt last, OutputIt result, UnaryOperation operation, const ParallelAlgorithmDescriptor& descriptor = {})
+    {
+        const size_t count = AZStd::distance(first, last);
+        TaskExecutor& executor = Internal::GetParallelExecutor(descriptor);
+        const size_t chunkCount = Internal::GetParallelChunkCount(count, Internal::ParallelChunksPerWorker, executor, descriptor);
+        if (chunkCount <= 1)
+        {
+            return AZStd::transform(first, last, result, operation);
+        }
+
+        Internal::RunParallelChunks(
+            executor, descriptor, chunkCount,
+            [&](size_t chunkIndex)
+            {
+                const size_t begin = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex);
+                const size_t end = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex + 1);
+                AZStd::transform(first + begin, first + end, result + begin, operation);
+            });
+        return result + count;
+    }
+
+    //! Combines init and all elements of [first, last) using operation. Unlike AZStd::accumulate the elements aren't
+    //! combined strictly from left to right, so operation needs to be associative. The order of the elements is kept, so
+    //! operation doesn't need to be commutative.
+    template<class RandomIt, class T, class BinaryOperation = AZStd::plus<>>
+    T parallel_reduce(
+        RandomIt first, RandomIt last, T init, BinaryOperation operation = {}, const ParallelAlgorithmDescriptor& descriptor = {})
+    {
+        const size_t count = AZStd::distance(first, last);
+        TaskExecutor& executor = Internal::GetParallelExecutor(descriptor);
+        const size_t chunkCount = Internal::GetParallelChunkCount(count, Internal::ParallelChunksPerWorker, executor, descriptor);
+        if (chunkCount <= 1)
+        {
+            return AZStd::accumulate(first, last, AZStd::move(init), operation);
+        }
+
+        AZStd::vector<T> partialResults(chunkCount, init);
+        Internal::RunParallelChunks(
+            executor, descriptor, chunkCount,
+            [&](size_t chunkIndex)
+            {
+                const size_t begin = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex);
+                const size_t end = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex + 1);
+                partialResults[chunkIndex] = AZStd::accumulate(first + begin + 1, first + end, T(first[begin]), operation);
+            });
+        return AZStd::accumulate(partialResults.begin(), partialResults.end(), AZStd::move(init), operation);
+    }
+
+    //! Stores the inclusive prefix sums of [first, last) under operation in the range beginning at result, so the n-th
+    //! output is the combination of the first n + 1 elements. operation needs to be associative. result may be equal to
+    //! first. Elements are processed in two passes: every chunk is scanned on its own, after which the totals of the
+    //! preceding chunks are combined into the chunks.
+    //! @return An iterator to the element past the last element written.
+    template<class RandomIt, class OutputIt, class BinaryOperation = AZStd::plus<>>
+    OutputIt parallel_inclusive_scan(
+        RandomIt first, RandomIt last, OutputIt result, BinaryOperation operation = {}, const ParallelAlgorithmDescriptor& descriptor = {})
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomIt>::value_type;
+
+        const size_t count = AZStd::distance(first, last);
+        TaskExecutor& executor = Internal::GetParallelExecutor(descriptor);
+        const size_t chunkCount = Internal::GetParallelChunkCount(count, Internal::ParallelChunksPerWorker, executor, descriptor);
+        if (chunkCount <= 1)
+        {
+            return Internal::InclusiveScan(first, last, result, operation);
+        }
+
+        Internal::RunParallelChunks(
+            executor, descriptor, chunkCount,
+            [&](size_t chunkIndex)
+            {
+                const size_t begin = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex);
+                const size_t end = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex + 1);
+                Internal::InclusiveScan(first + begin, first + end, result + begin, operation);
+            });
+
+        // The total of everything before each chunk, starting with the second chunk
+        AZStd::vector<ValueType> chunkOffsets;
+        chunkOffsets.reserve(chunkCount - 1);
+        chunkOffsets.push_back(result[Internal::GetParallelChunkBegin(count, chunkCount, 1) - 1]);
+        for (size_t chunkIndex = 1; chunkIndex + 1 < chunkCount; ++chunkIndex)
+        {
+            const size_t end = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex + 1);
+            chunkOffsets.push_back(operation(chunkOffsets.back(), result[end - 1]));
+        }
+
+        Internal::RunParallelChunks(
+            executor, descriptor, chunkCount - 1,
+            [&](size_t offsetIndex)
+            {
+                const size_t begin = Internal::GetParallelChunkBegin(count, chunkCount, offsetIndex + 1);
+                const size_t end = Internal::GetParallelChunkBegin(count, chunkCount, offsetIndex + 2);
+                const ValueType& offset = chunkOffsets[offsetIndex];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    result[i] = operation(offset, result[i]);
+                }
+            });
+        return result + count;
+    }
+
+    //! Reorders [first, last) so all elements for which predicate returns true come before the elements for which it returns
+    //! false. Like AZStd::partition the relative order of the elements isn't kept. Every chunk is partitioned on its own, after
+    //! which the misplaced elements of all chunks are swapped in parallel. predicate is called once for every element.
+    //! @return An iterator to the first element of the second group.
+    template<class RandomIt, class UnaryPredicate>
+    RandomIt parallel_partition(
+        RandomIt first, RandomIt last, UnaryPredicate predicate, const ParallelAlgorithmDescriptor& descriptor = {})
+    {
+        const size_t count = AZStd::distance(first, last);
+        TaskExecutor& executor = Internal::GetParallelExecutor(descriptor);
+        const size_t chunkCount = Internal::GetParallelChunkCount(count, Internal::ParallelChunksPerWorker, executor, descriptor);
+        if (chunkCount <= 1)
+        {
+            return Internal::Partition(first, last, predicate);
+        }
+
+        AZStd::vector<size_t> chunkSplits(chunkCount);
+        Internal::RunParallelChunks(
+            executor, descriptor, chunkCount,
+            [&](size_t chunkIndex)
+            {
+                const size_t begin = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex);
+                const size_t end = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex + 1);
+                chunkSplits[chunkIndex] = Internal::Partition(first + begin, first + end, predicate) - first;
+            });
+
+        size_t trueCount = 0;
+        for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+        {
+            trueCount += chunkSplits[chunkIndex] - Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex);
+        }
+
+        // Elements that failed the predicate but are in front of the final split point have to be swapped with elements that
+        // passed but are behind it. Both are collected as ranges in order and paired up into runs of swaps
+        struct Range
+        {
+            size_t m_begin;
+            size_t m_end;
+        };
+        AZStd::vector<Range> misplacedFalse;
+        AZStd::vector<Range> misplacedTrue;
+        for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+        {
+            const size_t begin = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex);
+            const size_t end = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex + 1);
+            const size_t split = chunkSplits[chunkIndex];
+            if (split < trueCount && split < end)
+            {
+                misplacedFalse.push_back({ split, AZStd::min(end, trueCount) });
+            }
+            if (split > trueCount && split > begin)
+            {
+                misplacedTrue.push_back({ AZStd::max(begin, trueCount), split });
+            }
+        }
+
+        struct SwapRun
+        {
+            size_t m_falseBegin;
+            size_t m_trueBegin;
+            size_t m_count;
+        };
+        size_t misplacedCount = 0;
+        for (const Range& range : misplacedFalse)
+        {
+            misplacedCount += range.m_end - range.m_begin;
+        }
+        const size_t maxRunCount = AZStd::max<size_t>(
+            descriptor.minGrainSize, misplacedCount / (executor.GetThreadCount() * Internal::ParallelChunksPerWorker) + 1);
+        AZStd::vector<SwapRun> swapRuns;
+        size_t falseIndex = 0;
+        size_t trueIndex = 0;
+        size_t falsePosition = misplacedFalse.empty() ? 0 : misplacedFalse[0].m_begin;
+        size_t truePosition = misplacedTrue.empty() ? 0 : misplacedTrue[0].m_begin;
+        while (falseIndex < misplacedFalse.size() && trueIndex < misplacedTrue.size())
+        {
+            const size_t runCount = AZStd::min(
+                AZStd::min(misplacedFalse[falseIndex].m_end - falsePosition, misplacedTrue[trueIndex].m_end - truePosition), maxRunCount);
+            swapRuns.push_back({ falsePosition, truePosition, runCount });
+            falsePosition += runCount;
+            truePosition += runCount;
+            if (falsePosition == misplacedFalse[falseIndex].m_end && ++falseIndex < misplacedFalse.size())
+            {
+                falsePosition = misplacedFalse[falseIndex].m_begin;
+            }
+            if (truePosition == misplacedTrue[trueIndex].m_end && ++trueIndex < misplacedTrue.size())
+            {
+                truePosition = misplacedTrue[trueIndex].m_begin;
+            }
+        }
+
+        Internal::RunParallelChunks(
+            executor, descriptor, swapRuns.size(),
+            [&](size_t runIndex)
+            {
+                const SwapRun& run = swapRuns[runIndex];
+                AZStd::swap_ranges(first + run.m_falseBegin, first + run.m_falseBegin + run.m_count, first + run.m_trueBegin);
+            });
+        return first + trueCount;
+    }
+
+    //! Sorts [first, last) in the order defined by compare. Like AZStd::sort the order of equal elements isn't kept. Every
+    //! worker sorts a chunk with AZStd::sort, after which the chunks are merged in pairs through a temporary buffer. The
+    //! value type needs to be default constructible and move assignable.
+    template<class RandomIt, class Compare = AZStd::less<>>
+    void parallel_sort(RandomIt first, RandomIt last, Compare compare = {}, const ParallelAlgorithmDescriptor& descriptor = {})
+    {
+        using ValueType = typename AZStd::iterator_traits<RandomIt>::value_type;
+
+        const size_t count = AZStd::distance(first, last);
+        TaskExecutor& executor = Internal::GetParallelExecutor(descriptor);
+        // Merging costs a pass over all elements for every doubling of the number of chunks, so only one chunk is sorted per
+        // worker
+        const size_t chunkCount = Internal::GetParallelChunkCount(count, 1, executor, descriptor);
+        if (chunkCount <= 1)
+        {
+            AZStd::sort(first, last, compare);
+            return;
+        }
+
+        AZStd::vector<size_t> runBounds(chunkCount + 1);
+        for (size_t chunkIndex = 0; chunkIndex <= chunkCount; ++chunkIndex)
+        {
+            runBounds[chunkIndex] = Internal::GetParallelChunkBegin(count, chunkCount, chunkIndex);
+        }
+
+        Internal::RunParallelChunks(
+            executor, descriptor, chunkCount,
+            [&](size_t chunkIndex)
+            {
+                AZStd::sort(first + runBounds[chunkIndex], first + runBounds[chunkIndex + 1], compare);
+            });
+
+        const size_t pieceSize = AZStd::max<size_t>(
+            descriptor.minGrainSize, (count + executor.GetThreadCount() * Internal::ParallelChunksPerWorker - 1) /
+                (executor.GetThreadCount() * Internal::ParallelChunksPerWorker));
+        AZStd::vector<ValueType> buffer(count);
+        bool inBuffer = false;
+        while (runBounds.size() > 2)
+        {
+            if (inBuffer)
+            {
+                Internal::ParallelMergeRuns(buffer.begin(), first, runBounds, pieceSize, compare, executor, descriptor);
+            }
+            else
+            {
+                Internal::ParallelMergeRuns(first, buffer.begin(), runBounds, pieceSize, compare, executor, descriptor);
+            }
+            inBuffer = !inBuffer;
+        }
+
+        if (inBuffer)
+        {
+            parallel_transform(
+                AZStd::make_move_iterator(buffer.begin()), AZStd::make_move_iterator(buffer.end()), first,
+                [](ValueType&& value) -> ValueType&&
+                {
+                    return AZStd::move(value);
+                },
+                descriptor);
+        }
+    }
+} // namespace AZ
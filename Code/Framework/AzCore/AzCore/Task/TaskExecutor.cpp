@@ -185,7 +185,9 @@ namespace AZ
                     }
                     else
                     {
-                        Task* task = m_queues[priority][status.head];
+                        // Read the slot at the head we observed. Other workers may dequeue from this queue concurrently
+                        // when work stealing is enabled, so the head must not be reloaded here.
+                        Task* task = m_queues[priority][head];
                         if (status.head.compare_exchange_weak(head, head + 1))
                         {
                             return task;
@@ -205,6 +207,7 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -254,51 +257,112 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            // Pushes a task onto this worker's queue from the worker thread itself. The worker is already awake, so
+            // no signal is needed.
+            void EnqueueLocal(Task* task)
+            {
+                m_queue.Enqueue(task);
+            }
+
+            Task* TryDequeue()
+            {
+                return m_queue.TryDequeue();
+            }
+
+            // Wakes the worker if it is parked waiting for work. Returns false if the worker was already awake.
+            bool TryWake()
+            {
+                if (m_idle.exchange(false))
+                {
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
+            }
+
             const char* GetThreadName() {return m_threadName.c_str();}
 
         private:
+            Task* AcquireTask(bool workStealing)
+            {
+                Task* task = m_queue.TryDequeue();
+                if (!task && workStealing)
+                {
+                    task = m_executor->TrySteal(m_id);
+                }
+                return task;
+            }
+
             void Run()
             {
+                const bool workStealing = m_executor->GetSchedulingMode() == TaskSchedulingMode::WorkStealing;
+
                 while (m_active)
                 {
+                    if (workStealing)
+                    {
+                        // Advertise that this worker is about to park, then check every queue one last time. A producer
+                        // enqueues before checking the idle flag, so either this scan observes its task or the producer
+                        // observes the flag and wakes this worker.
+                        m_idle.store(true);
+                        if (Task* task = AcquireTask(true))
+                        {
+                            m_idle.store(false);
+                            Execute(task, true);
+                            continue;
+                        }
+                    }
+
                     m_semaphore.acquire();
+                    m_idle.store(false);
 
                     if (!m_active)
                     {
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+                    Task* task = AcquireTask(workStealing);
+                    if (task)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
-                        {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
-                        }
+                        Execute(task, workStealing);
+                    }
+                }
+            }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
+            void Execute(Task* task, bool workStealing)
+            {
+                while (task)
+                {
+                    task->Invoke();
+                    // Decrement counts for all task successors
+                    for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                    {
+                        Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                        if (--successor->m_dependencyCount == 0)
                         {
-                            m_executor->ReleaseGraph();
+                            m_executor->Submit(*successor);
                         }
+                    }
 
-                        task = m_queue.TryDequeue();
+                    bool isRetained = task->m_graph->m_parent != nullptr;
+                    if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
+                    {
+                        m_executor->ReleaseGraph();
                     }
+
+                    task = AcquireTask(workStealing);
                 }
             }
 
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            // Set while the worker is parked (or about to park) on its semaphore in work stealing mode
+            AZStd::atomic<bool> m_idle = false;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
+            uint32_t m_id = 0;
             TaskQueue m_queue;
             AZStd::string m_threadName;
             friend class ::AZ::TaskExecutor;
@@ -370,8 +434,9 @@ namespace AZ
         }
     }
 
-    TaskExecutor::TaskExecutor(uint32_t threadCount)
-        : m_eventTracker(this)
+    TaskExecutor::TaskExecutor(uint32_t threadCount, TaskSchedulingMode schedulingMode)
+        : m_schedulingMode(schedulingMode)
+        , m_eventTracker(this)
     {
         // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
@@ -412,6 +477,11 @@ namespace AZ
         return nullptr;
     }
 
+    bool TaskExecutor::IsTaskWorkerThread()
+    {
+        return GetTaskWorker() != nullptr;
+    }
+
     void TaskExecutor::Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event)
     {
 
@@ -451,6 +521,18 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
+        if (m_schedulingMode == TaskSchedulingMode::WorkStealing)
+        {
+            // Tasks released from a worker thread (successors of a completed task) stay on that worker's queue so they
+            // run on the core that produced their inputs. Any parked worker is woken so that it can steal them.
+            if (Internal::TaskWorker* worker = GetTaskWorker(); worker && worker->Enabled())
+            {
+                worker->EnqueueLocal(&task);
+                WakeIdleWorker(worker->m_id);
+                return;
+            }
+        }
+
         // TODO: Something more sophisticated is likely needed here.
         // First, we are completely ignoring affinity.
         // Second, some heuristics on core availability will help distribute work more effectively
@@ -463,6 +545,38 @@ namespace AZ
         }
 
         m_workers[nextWorker].Enqueue(&task);
+
+        if (m_schedulingMode == TaskSchedulingMode::WorkStealing)
+        {
+            // The target worker may be busy with a long running task, so give an idle worker the chance to take it
+            WakeIdleWorker(nextWorker);
+        }
+    }
+
+    Internal::Task* TaskExecutor::TrySteal(uint32_t thiefId)
+    {
+        // Visit the other workers starting from the thief's neighbor so that thieves spread out over the victims
+        for (uint32_t i = 1; i < m_threadCount; ++i)
+        {
+            const uint32_t victim = (thiefId + i) % m_threadCount;
+            if (Internal::Task* task = m_workers[victim].TryDequeue(); task)
+            {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    void TaskExecutor::WakeIdleWorker(uint32_t skipWorker)
+    {
+        for (uint32_t i = 1; i < m_threadCount; ++i)
+        {
+            const uint32_t candidate = (skipWorker + i) % m_threadCount;
+            if (m_workers[candidate].TryWake())
+            {
+                return;
+            }
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
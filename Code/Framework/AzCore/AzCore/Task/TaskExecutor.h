@@ -116,6 +116,16 @@ namespace AZ
         class TaskWorker;
     } // namespace Internal
 
+    // Controls how the executor distributes ready tasks across its worker threads
+    enum class TaskSchedulingMode : uint8_t
+    {
+        // Every ready task is assigned to the next worker in sequence, and workers only drain their own queue
+        RoundRobin,
+        // Tasks released by a worker are pushed onto that worker's own queue, and idle workers steal queued
+        // tasks from busy workers
+        WorkStealing,
+    };
+
     class TaskExecutor final
     {
     public:
@@ -127,7 +137,7 @@ namespace AZ
         static void SetInstance(TaskExecutor* executor);
 
         // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
-        explicit TaskExecutor(uint32_t threadCount = 0);
+        explicit TaskExecutor(uint32_t threadCount = 0, TaskSchedulingMode schedulingMode = TaskSchedulingMode::RoundRobin);
         ~TaskExecutor();
 
         // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
@@ -138,6 +148,14 @@ namespace AZ
 
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
+        TaskSchedulingMode GetSchedulingMode() const { return m_schedulingMode; }
+
+        uint32_t GetThreadCount() const { return m_threadCount; }
+
+        // Returns true if called from one of the worker threads of this executor. Work submitted from a task
+        // can't be waited on from that same task
+        bool IsTaskWorkerThread();
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
@@ -147,8 +165,13 @@ namespace AZ
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
+        // Work stealing support
+        Internal::Task* TrySteal(uint32_t thiefId);
+        void WakeIdleWorker(uint32_t skipWorker);
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
+        TaskSchedulingMode m_schedulingMode = TaskSchedulingMode::RoundRobin;
         AZStd::atomic<uint32_t> m_lastSubmission;
         AZStd::atomic<uint64_t> m_graphsRemaining;
 
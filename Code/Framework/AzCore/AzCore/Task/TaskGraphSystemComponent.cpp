@@ -27,6 +27,7 @@ AZ_CVAR(float, cl_taskGraphThreadsConcurrencyRatio, 1.0f, nullptr, AZ::ConsoleFu
 AZ_CVAR(uint32_t, cl_taskGraphThreadsNumReserved, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph number of hardware threads that are reserved for O3DE system threads. Value is clamped between 0 and the number of logical cores in the system");
 AZ_CVAR(uint32_t, cl_taskGraphThreadsMinNumber, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph minimum number of worker threads to create after scaling the number of hw threads");
 AZ_CVAR(uint32_t, cl_taskGraphThreadsMaxNumber, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph maximum number of worker threads to create after scaling the number of hw threads (0 indicates uncapped)");
+AZ_CVAR(bool, cl_taskGraphWorkStealing, false, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph workers keep released tasks on their own queue and steal queued tasks from busy workers when idle (read on activation)");
 
 static constexpr uint32_t TaskExecutorServiceCrc = AZ_CRC_CE("TaskExecutorService");
 
@@ -55,7 +56,8 @@ namespace AZ
                 cl_taskGraphThreadsNumReserved);
         #endif // (AZ_TRAIT_THREAD_NUM_TASK_GRAPH_WORKER_THREADS)
             Interface<TaskGraphActiveInterface>::Register(this); // small window that another thread can try to use taskgraph between this line and the set instance.
-            m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads);
+            m_taskExecutor = aznew TaskExecutor(
+                numberOfWorkerThreads, cl_taskGraphWorkStealing ? TaskSchedulingMode::WorkStealing : TaskSchedulingMode::RoundRobin);
             TaskExecutor::SetInstance(m_taskExecutor);
         }
     }
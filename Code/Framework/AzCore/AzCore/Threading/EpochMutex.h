@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    //! @class EpochMutex
+    //! A reader / writer mutex for read heavy data that is accessed from many threads at once, but rarely modified.
+    //! Readers don't touch any shared lock. Each reading thread registers itself in one of a set of epoch counters, which are
+    //! spread across cache lines so that concurrent readers on different threads don't contend with each other. Writers pay for
+    //! this instead: they announce themselves and then wait for every reader in flight to leave its epoch.
+    //! Readers can't nest on the same thread, and a writer can't lock while its thread is reading, as both would wait forever.
+    //! Satisfies the SharedMutex requirements, so it can be used with AZStd::shared_lock and AZStd::unique_lock.
+    class EpochMutex
+    {
+    public:
+        //! Threads are spread across this many reader counters. More threads than this still work, they just share counters.
+        static constexpr uint32_t ReaderSlotCount = 32;
+
+        EpochMutex() = default;
+        ~EpochMutex() = default;
+        AZ_DISABLE_COPY_MOVE(EpochMutex);
+
+        //! Enters the epoch of the calling thread. Only blocks while a writer holds or waits for the lock.
+        void lock_shared()
+        {
+            ReaderSlot& slot = m_readerSlots[GetReaderSlotIndex()];
+
+            // This handshake needs sequential consistency, either the writer sees the count or the reader sees the writer.
+            slot.m_count.fetch_add(1, AZStd::memory_order_seq_cst);
+            if (!m_writer.m_active.load(AZStd::memory_order_seq_cst))
+            {
+                return;
+            }
+
+            // A writer is waiting for the readers to drain, step out of its way until it's done.
+            // Readers stay registered as waiting until they got in, so the next writer can't starve them.
+            slot.m_count.fetch_sub(1, AZStd::memory_order_release);
+            m_writer.m_waitingReaders.fetch_add(1, AZStd::memory_order_seq_cst);
+            for (;;)
+            {
+                while (m_writer.m_active.load(AZStd::memory_order_acquire))
+                {
+                    AZStd::this_thread::yield();
+                }
+
+                slot.m_count.fetch_add(1, AZStd::memory_order_seq_cst);
+                if (!m_writer.m_active.load(AZStd::memory_order_seq_cst))
+                {
+                    m_writer.m_waitingReaders.fetch_sub(1, AZStd::memory_order_release);
+                    return;
+                }
+                slot.m_count.fetch_sub(1, AZStd::memory_order_release);
+            }
+        }
+
+        void unlock_shared()
+        {
+            m_readerSlots[GetReaderSlotIndex()].m_count.fetch_sub(1, AZStd::memory_order_release);
+        }
+
+        //! Blocks new readers and waits until all readers in flight have left their epoch.
+        void lock()
+        {
+            m_writerMutex.lock();
+            // Let the readers that stepped aside for the previous writer in first.
+            while (m_writer.m_waitingReaders.load(AZStd::memory_order_seq_cst) != 0)
+            {
+                AZStd::this_thread::yield();
+            }
+            m_writer.m_active.store(true, AZStd::memory_order_seq_cst);
+            for (ReaderSlot& slot : m_readerSlots)
+            {
+                while (slot.m_count.load(AZStd::memory_order_seq_cst) != 0)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
+        void unlock()
+        {
+            m_writer.m_active.store(false, AZStd::memory_order_release);
+            m_writerMutex.unlock();
+        }
+
+    private:
+        // The counters are padded instead of aligned so the mutex can be placed in storage that isn't cache line aligned,
+        // neighboring counters still never share a cache line.
+        struct ReaderSlot
+        {
+            AZStd::atomic<uint32_t> m_count{ 0 };
+            char m_padding[64 - sizeof(AZStd::atomic<uint32_t>)];
+        };
+
+        struct WriterState
+        {
+            char m_leadingPadding[64];
+            AZStd::atomic_bool m_active{ false };
+            AZStd::atomic<uint32_t> m_waitingReaders{ 0 };
+            char m_trailingPadding[64];
+        };
+
+        static uint32_t GetReaderSlotIndex()
+        {
+            static AZStd::atomic<uint32_t> s_nextSlot{ 0 };
+            thread_local const uint32_t s_slot = s_nextSlot.fetch_add(1, AZStd::memory_order_relaxed) % ReaderSlotCount;
+            return s_slot;
+        }
+
+        ReaderSlot m_readerSlots[ReaderSlotCount];
+        WriterState m_writer;
+        AZStd::mutex m_writerMutex;
+    };
+} // namespace AZ
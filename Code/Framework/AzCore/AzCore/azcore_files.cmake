@@ -42,6 +42,8 @@ set(FILES
     Component/ComponentBus.cpp
     Component/ComponentBus.h
     Component/ComponentExport.h
+    Component/DependencySortCache.cpp
+    Component/DependencySortCache.h
     Component/Entity.cpp
     Component/Entity.h
     Component/EntityBus.h
@@ -62,6 +64,8 @@ set(FILES
     Compression/Compression.h
     Compression/zstd_compression.cpp
     Compression/zstd_compression.h
+    Compression/zstd_dictionary.cpp
+    Compression/zstd_dictionary.h
     Console/Console.cpp
     Console/Console.h
     Console/ConsoleDataWrapper.h
@@ -125,6 +129,7 @@ set(FILES
     EBus/BusImpl.h
     EBus/EBus.h
     EBus/EBusEnvironment.cpp
+    EBus/EBusEpochDispatchTraits.h
     EBus/EBusSharedDispatchTraits.h
     EBus/Environment.h
     EBus/Event.h
@@ -270,6 +275,8 @@ set(FILES
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
+    Math/BatchMath.cpp
+    Math/BatchMath.h
     Math/Capsule.h
     Math/Capsule.inl
     Math/Color.cpp
@@ -304,6 +311,9 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec8_simd.inl
+    Math/Internal/SimdMathCommon_avx.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -369,6 +379,7 @@ set(FILES
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -423,6 +434,8 @@ set(FILES
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
+    Memory/LinearAllocator.cpp
+    Memory/LinearAllocator.h
     Memory/Memory_fwd.h
     Memory/Memory.cpp
     Memory/Memory.h
@@ -435,6 +448,8 @@ set(FILES
     Memory/SimpleSchemaAllocator.h
     Memory/SystemAllocator.cpp
     Memory/SystemAllocator.h
+    Metrics/BinaryTraceEventLogger.h
+    Metrics/BinaryTraceEventLogger.cpp
     Metrics/EventLoggerFactoryImpl.h
     Metrics/EventLoggerFactoryImpl.cpp
     Metrics/EventLoggerReflectUtils.cpp
@@ -565,6 +580,8 @@ set(FILES
     Serialization/SerializationUtils.cpp
     Serialization/ObjectStream.cpp
     Serialization/ObjectStream.h
+    Serialization/ObjectStreamPackedLayout.cpp
+    Serialization/ObjectStreamPackedLayout.h
     Serialization/PointerObject.h
     Serialization/PointerObject.cpp
     Serialization/SerializeContext.cpp
@@ -604,6 +621,8 @@ set(FILES
     Serialization/Json/JsonSerialization.cpp
     Serialization/Json/JsonSerializationMetadata.h
     Serialization/Json/JsonSerializationMetadata.inl
+    Serialization/Json/JsonSerializationPlan.h
+    Serialization/Json/JsonSerializationPlan.cpp
     Serialization/Json/JsonSerializationResult.h
     Serialization/Json/JsonSerializationResult.cpp
     Serialization/Json/JsonSerializationSettings.h
@@ -691,6 +710,7 @@ set(FILES
     Task/Internal/Task.inl
     Task/Internal/Task.h
     Task/Internal/TaskConfig.h
+    Task/TaskAlgorithms.h
     Task/TaskDescriptor.h
     Task/TaskExecutor.cpp
     Task/TaskExecutor.h
@@ -699,6 +719,7 @@ set(FILES
     Task/TaskGraph.inl
     Task/TaskGraphSystemComponent.h
     Task/TaskGraphSystemComponent.cpp
+    Threading/EpochMutex.h
     Threading/ThreadSafeDeque.h
     Threading/ThreadSafeDeque.inl
     Threading/ThreadSafeObject.h
@@ -27,6 +27,7 @@ set(FILES
     createdestroy.h
     docs.h
     exceptions.h
+    flat_hash_table.h
     functional.h
     functional_basic.h
     hash.cpp
@@ -91,12 +92,15 @@ set(FILES
     containers/compressed_pair.h
     containers/compressed_pair.inl
     containers/containers_concepts.h
+    containers/deduction_guide_helpers.h
     containers/deque.h
     containers/fixed_forward_list.h
     containers/fixed_list.h
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/ranges/ranges.h>
+#include <AzCore/std/typetraits/add_const.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace AZStd
+{
+    inline namespace AssociativeInternal
+    {
+        // deduction guide helpers
+        template<class InputIterator>
+        using iter_value_type = typename iter_value_t<InputIterator>::second_type;
+
+        template<class InputIterator>
+        using iter_key_type = remove_const_t<typename iter_value_t<InputIterator>::first_type>;
+
+        template<class InputIterator>
+        using iter_mapped_type = typename iter_value_t<InputIterator>::second_type;
+
+        template<class InputIterator>
+        using iter_to_alloc_type = pair<
+            add_const_t<typename iter_value_t<InputIterator>::first_type>,
+            typename iter_value_t<InputIterator>::second_type
+        >;
+
+        // range deduction guide helpers
+        template<class Range, class = enable_if_t<ranges::input_range<Range>>>
+        using range_key_type = remove_const_t<typename ranges::range_value_t<Range>::first_type>;
+        template<class Range, class = enable_if_t<ranges::input_range<Range>>>
+        using range_mapped_type = typename ranges::range_value_t<Range>::second_type;
+        template<class Range, class = enable_if_t<ranges::input_range<Range>>>
+        using range_to_alloc_type = pair<
+            add_const_t<typename ranges::range_value_t<Range>::first_type>,
+            typename ranges::range_value_t<Range>::second_type
+        >;
+    }
+}
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/deduction_guide_helpers.h>
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/typetraits/type_identity.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using value_type = AZStd::pair<const Key, MappedType>;
+            //! Slots are stored with a mutable key so they can be moved when the table grows.
+            using storage_type = AZStd::pair<Key, MappedType>;
+            using allocator_type = Allocator;
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+        };
+    }
+
+    /**
+     * Flat hash map is an open addressing alternative to \ref unordered_map that stores the pairs inline in a single
+     * allocation. It's considerably faster for lookups and iteration and doesn't allocate per element, but iterators and
+     * references to elements are invalidated when the map grows. Prefer unordered_map when element addresses need to be
+     * stable, or when elements are very large and moving them on rehash is expensive.
+     * See \ref flat_hash_table for details.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>;
+        using base_type = flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>;
+    public:
+        using traits_type = typename base_type::traits_type;
+
+        using key_type = typename base_type::key_type;
+        using key_equal = typename base_type::key_equal;
+        using hasher = typename base_type::hasher;
+        using mapped_type = MappedType;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using value_type = typename base_type::value_type;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_hash_map()
+            : base_type(hasher(), key_equal(), allocator_type()) {}
+        explicit flat_hash_map(size_type numBuckets,
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& alloc = allocator_type())
+            : base_type(hash, keyEqual, alloc)
+        {
+            base_type::rehash(numBuckets);
+        }
+        template<class Iterator>
+        flat_hash_map(Iterator first, Iterator last, size_type numBuckets = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& alloc = allocator_type())
+            : base_type(hash, keyEqual, alloc)
+        {
+            base_type::rehash(numBuckets);
+            base_type::insert(first, last);
+        }
+        template<class R, class = enable_if_t<Internal::container_compatible_range<R, value_type>>>
+        flat_hash_map(from_range_t, R&& rg, size_type numBucketsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& alloc = allocator_type())
+            : base_type(hash, keyEqual, alloc)
+        {
+            base_type::rehash(numBucketsHint);
+            base_type::insert_range(AZStd::forward<R>(rg));
+        }
+        flat_hash_map(const flat_hash_map& rhs)
+            : base_type(rhs) {}
+        flat_hash_map(flat_hash_map&& rhs)
+            : base_type(AZStd::move(rhs)) {}
+        explicit flat_hash_map(const allocator_type& alloc)
+            : base_type(hasher(), key_equal(), alloc) {}
+        flat_hash_map(const flat_hash_map& rhs, const type_identity_t<allocator_type>& alloc)
+            : base_type(rhs, alloc) {}
+        flat_hash_map(flat_hash_map&& rhs, const type_identity_t<allocator_type>& alloc)
+            : base_type(AZStd::move(rhs), alloc) {}
+        flat_hash_map(initializer_list<value_type> list, size_type numBuckets = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& alloc = allocator_type())
+            : base_type(hash, keyEqual, alloc)
+        {
+            base_type::rehash(numBuckets);
+            base_type::insert(list);
+        }
+        flat_hash_map(size_type numBucketsHint, const allocator_type& alloc)
+            : flat_hash_map(numBucketsHint, hasher(), key_equal(), alloc)
+        {
+        }
+        flat_hash_map(size_type numBucketsHint, const hasher& hash, const allocator_type& alloc)
+            : flat_hash_map(numBucketsHint, hash, key_equal(), alloc)
+        {
+        }
+        template<class InputIterator>
+        flat_hash_map(InputIterator f, InputIterator l, size_type n, const allocator_type& a)
+            : flat_hash_map(f, l, n, hasher(), key_equal(), a)
+        {
+        }
+        template<class R, class = enable_if_t<Internal::container_compatible_range<R, value_type>>>
+        flat_hash_map(from_range_t, R&& rg, size_type n, const allocator_type& a)
+            : flat_hash_map(from_range, AZStd::forward<R>(rg), n, hasher(), key_equal(), a)
+        {
+        }
+        flat_hash_map(initializer_list<value_type> il, size_type n, const allocator_type& a)
+            : flat_hash_map(il, n, hasher(), key_equal(), a)
+        {
+        }
+
+        /// This constructor is AZStd extension (so we don't rehash/allocate memory)
+        flat_hash_map(const hasher& hash, const key_equal& keyEqual, const allocator_type& allocator)
+            : base_type(hash, keyEqual, allocator) {}
+
+        this_type& operator=(this_type&& rhs)
+        {
+            base_type::operator=(AZStd::move(rhs));
+            return *this;
+        }
+
+        this_type& operator=(const this_type& rhs)
+        {
+            base_type::operator=(rhs);
+            return *this;
+        }
+
+        /**
+         * Look up operator if element doesn't exists inserts a new one with (key,mapped_type()).
+         */
+        AZ_FORCE_INLINE mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        AZ_FORCE_INLINE mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+        /**
+         * Returns mapped type with based on the key, if the element doesn't exist an assert it triggered!
+         */
+        AZ_FORCE_INLINE mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        AZ_FORCE_INLINE const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        using base_type::insert;
+        using base_type::insert_range;
+
+        //! C++17 insert_or_assign function assigns the element to the mapped_type if the key exist in the container
+        //! Otherwise a new value is inserted into the container
+        template <typename M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            return insert_or_assign_impl(key, AZStd::forward<M>(value));
+        }
+        template <typename M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            return insert_or_assign_impl(AZStd::move(key), AZStd::forward<M>(value));
+        }
+        template <typename M>
+        iterator insert_or_assign(const_iterator, const key_type& key, M&& value)
+        {
+            return insert_or_assign_impl(key, AZStd::forward<M>(value)).first;
+        }
+        template <typename M>
+        iterator insert_or_assign(const_iterator, key_type&& key, M&& value)
+        {
+            return insert_or_assign_impl(AZStd::move(key), AZStd::forward<M>(value)).first;
+        }
+
+        //! C++17 try_emplace function that does nothing to the arguments if the key exist in the container,
+        //! otherwise it constructs the value type as if invoking
+        //! value_type(AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::forward<KeyType>(key)),
+        //!  AZStd::forward_as_tuple(AZStd::forward<Args>(args)...))
+        template <typename... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... arguments)
+        {
+            return try_emplace_impl(key, AZStd::forward<Args>(arguments)...);
+        }
+        template <typename... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... arguments)
+        {
+            return try_emplace_impl(AZStd::move(key), AZStd::forward<Args>(arguments)...);
+        }
+        template <typename... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... arguments)
+        {
+            return try_emplace_impl(key, AZStd::forward<Args>(arguments)...).first;
+        }
+        template <typename... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... arguments)
+        {
+            return try_emplace_impl(AZStd::move(key), AZStd::forward<Args>(arguments)...).first;
+        }
+
+    private:
+        template<class KeyType, class... Args>
+        pair_iter_bool try_emplace_impl(KeyType&& key, Args&&... arguments)
+        {
+            auto [index, inserted] = base_type::find_or_prepare_insert(key);
+            if (inserted)
+            {
+                base_type::construct_at_index(index, AZStd::piecewise_construct,
+                    AZStd::forward_as_tuple(AZStd::forward<KeyType>(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+            }
+            return { base_type::iterator_at(index), inserted };
+        }
+
+        template<class KeyType, class M>
+        pair_iter_bool insert_or_assign_impl(KeyType&& key, M&& value)
+        {
+            auto [index, inserted] = base_type::find_or_prepare_insert(key);
+            if (inserted)
+            {
+                base_type::construct_at_index(index, AZStd::forward<KeyType>(key), AZStd::forward<M>(value));
+            }
+            iterator iter = base_type::iterator_at(index);
+            if (!inserted)
+            {
+                iter->second = AZStd::forward<M>(value);
+            }
+            return { iter, inserted };
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator==(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+
+        // The iteration order depends on the insertion history, so every element is looked up instead.
+        for (const auto& element : a)
+        {
+            auto found = b.find(element.first);
+            if (found == b.end() || !(found->second == element.second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end(); )
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+
+    // deduction guides
+    template<class InputIterator,
+        class Hash = hash<iter_key_type<InputIterator>>,
+        class Pred = equal_to<iter_key_type<InputIterator>>,
+        class Allocator = allocator>
+        flat_hash_map(InputIterator, InputIterator,
+            typename allocator_traits<Allocator>::size_type = {},
+            Hash = Hash(), Pred = Pred(), Allocator = Allocator())
+        ->flat_hash_map<iter_key_type<InputIterator>, iter_mapped_type<InputIterator>, Hash, Pred, Allocator>;
+
+    template<class R,
+        class Hash = hash<range_key_type<R>>,
+        class Pred = equal_to<range_key_type<R>>,
+        class Allocator = allocator,
+        class = enable_if_t<ranges::input_range<R>>>
+    flat_hash_map(from_range_t, R&&,
+        typename allocator_traits<Allocator>::size_type = {},
+        Hash = Hash(), Pred = Pred(), Allocator = Allocator())
+        ->flat_hash_map<range_key_type<R>, range_mapped_type<R>, Hash, Pred, Allocator>;
+
+    template<class Key, class T, class Hash = hash<Key>,
+        class Pred = equal_to<Key>, class Allocator = allocator>
+        flat_hash_map(initializer_list<pair<Key, T>>,
+            typename allocator_traits<Allocator>::size_type = {},
+            Hash = Hash(), Pred = Pred(), Allocator = Allocator())
+        ->flat_hash_map<Key, T, Hash, Pred, Allocator>;
+} // namespace AZStd
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/typetraits/type_identity.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTableTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using value_type = Key;
+            using storage_type = Key;
+            using allocator_type = Allocator;
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+        };
+    }
+
+    /**
+     * Flat hash set is an open addressing alternative to \ref unordered_set that stores the keys inline in a single
+     * allocation. It's considerably faster for lookups and iteration and doesn't allocate per element, but iterators and
+     * references to elements are invalidated when the set grows.
+     * See \ref flat_hash_table for details.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_set<Key, Hasher, EqualKey, Allocator>;
+        using base_type = flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>;
+    public:
+        using traits_type = typename base_type::traits_type;
+
+        using key_type = typename base_type::key_type;
+        using key_equal = typename base_type::key_equal;
+        using hasher = typename base_type::hasher;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using value_type = typename base_type::value_type;
+
+        flat_hash_set()
+            : base_type(hasher(), key_equal(), allocator_type()) {}
+        explicit flat_hash_set(size_type numBuckets,
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& alloc = allocator_type())
+            : base_type(hash, keyEqual, alloc)
+        {
+            base_type::rehash(numBuckets);
+        }
+        template<class Iterator>
+        flat_hash_set(Iterator first, Iterator last, size_type numBuckets = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& alloc = allocator_type())
+            : base_type(hash, keyEqual, alloc)
+        {
+            base_type::rehash(numBuckets);
+            base_type::insert(first, last);
+        }
+        template<class R, class = enable_if_t<Internal::container_compatible_range<R, value_type>>>
+        flat_hash_set(from_range_t, R&& rg, size_type numBucketsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& alloc = allocator_type())
+            : base_type(hash, keyEqual, alloc)
+        {
+            base_type::rehash(numBucketsHint);
+            base_type::insert_range(AZStd::forward<R>(rg));
+        }
+        flat_hash_set(const flat_hash_set& rhs)
+            : base_type(rhs) {}
+        flat_hash_set(flat_hash_set&& rhs)
+            : base_type(AZStd::move(rhs)) {}
+        explicit flat_hash_set(const allocator_type& alloc)
+            : base_type(hasher(), key_equal(), alloc) {}
+        flat_hash_set(const flat_hash_set& rhs, const type_identity_t<allocator_type>& alloc)
+            : base_type(rhs, alloc) {}
+        flat_hash_set(flat_hash_set&& rhs, const type_identity_t<allocator_type>& alloc)
+            : base_type(AZStd::move(rhs), alloc) {}
+        flat_hash_set(initializer_list<value_type> list, size_type numBuckets = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& alloc = allocator_type())
+            : base_type(hash, keyEqual, alloc)
+        {
+            base_type::rehash(numBuckets);
+            base_type::insert(list);
+        }
+        flat_hash_set(size_type numBucketsHint, const allocator_type& alloc)
+            : flat_hash_set(numBucketsHint, hasher(), key_equal(), alloc)
+        {
+        }
+        template<class InputIterator>
+        flat_hash_set(InputIterator f, InputIterator l, size_type n, const allocator_type& a)
+            : flat_hash_set(f, l, n, hasher(), key_equal(), a)
+        {
+        }
+        template<class R, class = enable_if_t<Internal::container_compatible_range<R, value_type>>>
+        flat_hash_set(from_range_t, R&& rg, size_type n, const allocator_type& a)
+            : flat_hash_set(from_range, AZStd::forward<R>(rg), n, hasher(), key_equal(), a)
+        {
+        }
+        flat_hash_set(initializer_list<value_type> il, size_type n, const allocator_type& a)
+            : flat_hash_set(il, n, hasher(), key_equal(), a)
+        {
+        }
+
+        /// This constructor is AZStd extension (so we don't rehash/allocate memory)
+        flat_hash_set(const hasher& hash, const key_equal& keyEqual, const allocator_type& allocator)
+            : base_type(hash, keyEqual, allocator) {}
+
+        this_type& operator=(this_type&& rhs)
+        {
+            base_type::operator=(AZStd::move(rhs));
+            return *this;
+        }
+
+        this_type& operator=(const this_type& rhs)
+        {
+            base_type::operator=(rhs);
+            return *this;
+        }
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator==(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+
+        for (const auto& element : a)
+        {
+            if (!b.contains(element))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+
+    // deduction guides
+    template<class InputIterator,
+        class Hash = hash<iter_value_t<InputIterator>>,
+        class Pred = equal_to<iter_value_t<InputIterator>>,
+        class Allocator = allocator>
+        flat_hash_set(InputIterator, InputIterator,
+            typename allocator_traits<Allocator>::size_type = {},
+            Hash = Hash(), Pred = Pred(), Allocator = Allocator())
+        ->flat_hash_set<iter_value_t<InputIterator>, Hash, Pred, Allocator>;
+
+    template<class R,
+        class Hash = hash<ranges::range_value_t<R>>,
+        class Pred = equal_to<ranges::range_value_t<R>>,
+        class Allocator = allocator,
+        class = enable_if_t<ranges::input_range<R>>>
+    flat_hash_set(from_range_t, R&&,
+        typename allocator_traits<Allocator>::size_type = {},
+        Hash = Hash(), Pred = Pred(), Allocator = Allocator())
+        -> flat_hash_set<ranges::range_value_t<R>, Hash, Pred, Allocator>;
+
+    template<class T, class Hash = hash<T>,
+        class Pred = equal_to<T>, class Allocator = allocator>
+        flat_hash_set(initializer_list<T>,
+            typename allocator_traits<Allocator>::size_type = {},
+            Hash = Hash(), Pred = Pred(), Allocator = Allocator())
+        ->flat_hash_set<T, Hash, Pred, Allocator>;
+} // namespace AZStd
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/allocator_traits.h>
+#include <AzCore/std/containers/deduction_guide_helpers.h>
 #include <AzCore/std/ranges/ranges.h>
 #include <AzCore/std/iterator.h>
 #include <AzCore/std/optional.h>
@@ -197,34 +198,4 @@ namespace AZStd
         template <typename NodeTraits>
         using map_node_handle = node_handle<NodeTraits, map_node_base>;
     }
-
-    inline namespace AssociativeInternal
-    {
-        // deduction guide helpers
-        template<class InputIterator>
-        using iter_value_type = typename iter_value_t<InputIterator>::second_type;
-
-        template<class InputIterator>
-        using iter_key_type = remove_const_t<typename iter_value_t<InputIterator>::first_type>;
-
-        template<class InputIterator>
-        using iter_mapped_type = typename iter_value_t<InputIterator>::second_type;
-
-        template<class InputIterator>
-        using iter_to_alloc_type = pair<
-            add_const_t<typename iter_value_t<InputIterator>::first_type>,
-            typename iter_value_t<InputIterator>::second_type
-        >;
-
-        // range deduction guide helpers
-        template<class Range, class = enable_if_t<ranges::input_range<Range>>>
-        using range_key_type = remove_const_t<typename ranges::range_value_t<Range>::first_type>;
-        template<class Range, class = enable_if_t<ranges::input_range<Range>>>
-        using range_mapped_type = typename ranges::range_value_t<Range>::second_type;
-        template<class Range, class = enable_if_t<ranges::input_range<Range>>>
-        using range_to_alloc_type = pair<
-            add_const_t<typename ranges::range_value_t<Range>::first_type>,
-            typename ranges::range_value_t<Range>::second_type
-        >;
-    }
 }
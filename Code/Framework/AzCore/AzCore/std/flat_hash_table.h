@@ -0,0 +1,1012 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/allocator_traits.h>
+#include <AzCore/std/containers/containers_concepts.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/typetraits/conditional.h>
+#include <AzCore/std/utils.h>
+
+#include <string.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace AZStd
+{
+    template<class Traits>
+    class flat_hash_table;
+
+    namespace Internal
+    {
+        namespace FlatHash
+        {
+            //! Every slot has a control byte. Full slots store the lower 7 bits of the hash of the element (h2), all other
+            //! states have the sign bit set so they can never match a hash.
+            using ctrl_t = signed char;
+            enum : ctrl_t
+            {
+                ctrl_empty = -128,
+                ctrl_deleted = -2,
+                ctrl_sentinel = -1
+            };
+
+            AZ_FORCE_INLINE bool is_full(ctrl_t ctrl) { return ctrl >= 0; }
+            AZ_FORCE_INLINE bool is_empty_or_deleted(ctrl_t ctrl) { return ctrl < ctrl_sentinel; }
+
+            //! Control bytes used by tables without storage, so lookups and iteration don't need to check for an allocation.
+            alignas(16) inline constexpr ctrl_t empty_group[16] = {
+                ctrl_sentinel, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+                ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty
+            };
+
+            //! Set of slots in a group that matched a query, one (group of) bit(s) per slot.
+            template<class T, size_t SignificantBits, size_t Shift>
+            class bit_mask
+            {
+            public:
+                explicit bit_mask(T mask) : m_mask(mask) {}
+
+                explicit operator bool() const { return m_mask != 0; }
+                size_t lowest_bit_set() const { return static_cast<size_t>(az_ctz_u64(m_mask)) >> Shift; }
+                void clear_lowest_bit_set() { m_mask &= (m_mask - 1); }
+
+                size_t trailing_zeros() const
+                {
+                    return m_mask ? lowest_bit_set() : (SignificantBits >> Shift);
+                }
+                size_t leading_zeros() const
+                {
+                    return m_mask ? ((static_cast<size_t>(az_clz_u64(m_mask)) - (64 - SignificantBits)) >> Shift) : (SignificantBits >> Shift);
+                }
+
+            private:
+                T m_mask;
+            };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            //! Group of 16 control bytes that are matched with SSE2 compares.
+            struct group
+            {
+                static constexpr size_t width = 16;
+                using mask_type = bit_mask<uint32_t, 16, 0>;
+
+                explicit group(const ctrl_t* position)
+                    : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(position)))
+                {
+                }
+
+                mask_type match(ctrl_t h2) const
+                {
+                    return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+                }
+                mask_type match_empty() const
+                {
+                    return match(ctrl_empty);
+                }
+                mask_type match_empty_or_deleted() const
+                {
+                    return mask_type(empty_or_deleted_bits());
+                }
+                size_t count_leading_empty_or_deleted() const
+                {
+                    // Adding one turns the trailing set bits into zeros.
+                    return static_cast<size_t>(az_ctz_u32(empty_or_deleted_bits() + 1));
+                }
+
+            private:
+                uint32_t empty_or_deleted_bits() const
+                {
+                    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), m_ctrl)));
+                }
+
+                __m128i m_ctrl;
+            };
+#else
+            //! Group of 8 control bytes that are matched with 64-bit integer operations. The match results have the top bit of each
+            //! byte set. Matching a hash can report false positives, which is fine as the keys are compared afterwards.
+            struct group
+            {
+                static constexpr size_t width = 8;
+                using mask_type = bit_mask<uint64_t, 64, 3>;
+
+                static constexpr uint64_t lsbs = 0x0101010101010101ULL;
+                static constexpr uint64_t msbs = 0x8080808080808080ULL;
+
+                explicit group(const ctrl_t* position)
+                {
+                    memcpy(&m_ctrl, position, sizeof(m_ctrl));
+                }
+
+                mask_type match(ctrl_t h2) const
+                {
+                    const uint64_t x = m_ctrl ^ (lsbs * static_cast<uint8_t>(h2));
+                    return mask_type((x - lsbs) & ~x & msbs);
+                }
+                mask_type match_empty() const
+                {
+                    return mask_type((m_ctrl & (~m_ctrl << 6)) & msbs);
+                }
+                mask_type match_empty_or_deleted() const
+                {
+                    return mask_type((m_ctrl & (~m_ctrl << 7)) & msbs);
+                }
+                size_t count_leading_empty_or_deleted() const
+                {
+                    constexpr uint64_t gaps = 0x00FEFEFEFEFEFEFEULL;
+                    return static_cast<size_t>((az_ctz_u64(((~m_ctrl & (m_ctrl >> 7)) | gaps) + 1) + 7) >> 3);
+                }
+
+            private:
+                uint64_t m_ctrl;
+            };
+#endif
+
+            //! Triangular probing over groups. This visits every group exactly once as the capacity is a power of 2 minus 1.
+            class probe_seq
+            {
+            public:
+                probe_seq(size_t hash, size_t mask)
+                    : m_mask(mask)
+                    , m_offset(hash & mask)
+                {
+                }
+
+                size_t offset() const { return m_offset; }
+                size_t offset(size_t i) const { return (m_offset + i) & m_mask; }
+                void next()
+                {
+                    m_index += group::width;
+                    m_offset = (m_offset + m_index) & m_mask;
+                }
+
+            private:
+                size_t m_mask;
+                size_t m_offset;
+                size_t m_index = 0;
+            };
+
+            //! AZStd::hash is the identity for integral types, so the bits are mixed before they're split into a probe start and
+            //! control byte. Without this, keys that only differ in their upper bits would all collide.
+            AZ_FORCE_INLINE size_t hash_mix(size_t hash)
+            {
+                if constexpr (sizeof(size_t) == 8)
+                {
+                    const uint64_t mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+                    return static_cast<size_t>(mixed ^ (mixed >> 32));
+                }
+                else
+                {
+                    const uint32_t mixed = static_cast<uint32_t>(hash) * 0x9E3779B9U;
+                    return static_cast<size_t>(mixed ^ (mixed >> 16));
+                }
+            }
+            AZ_FORCE_INLINE size_t h1(size_t hash) { return hash >> 7; }
+            AZ_FORCE_INLINE ctrl_t h2(size_t hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+
+            //! Capacities are always a power of 2 minus 1, so they can be used as a mask.
+            AZ_FORCE_INLINE size_t normalize_capacity(size_t capacity)
+            {
+                return capacity ? static_cast<size_t>(~uint64_t{ 0 } >> az_clz_u64(static_cast<uint64_t>(capacity))) : 1;
+            }
+            //! The table is grown when it's 7/8th full.
+            AZ_FORCE_INLINE size_t capacity_to_growth(size_t capacity)
+            {
+                if (group::width == 8 && capacity == 7)
+                {
+                    // With 8-wide groups the table needs an empty slot to terminate probing.
+                    return 6;
+                }
+                return capacity - capacity / 8;
+            }
+            AZ_FORCE_INLINE size_t growth_to_lowerbound_capacity(size_t growth)
+            {
+                if (group::width == 8 && growth == 7)
+                {
+                    return 8;
+                }
+                return growth + static_cast<size_t>((static_cast<ptrdiff_t>(growth) - 1) / 7);
+            }
+        } // namespace FlatHash
+
+        template<class ValueType, bool IsConst>
+        class flat_hash_table_iterator
+        {
+            template<class>
+            friend class AZStd::flat_hash_table;
+            template<class, bool>
+            friend class flat_hash_table_iterator;
+
+        public:
+            using iterator_category = AZStd::forward_iterator_tag;
+            using value_type = ValueType;
+            using difference_type = AZStd::ptrdiff_t;
+            using pointer = AZStd::conditional_t<IsConst, const ValueType*, ValueType*>;
+            using reference = AZStd::conditional_t<IsConst, const ValueType&, ValueType&>;
+
+            flat_hash_table_iterator() = default;
+            template<bool WasConst, class = AZStd::enable_if_t<IsConst && !WasConst>>
+            flat_hash_table_iterator(const flat_hash_table_iterator<ValueType, WasConst>& rhs)
+                : m_ctrl(rhs.m_ctrl)
+                , m_slot(rhs.m_slot)
+            {
+            }
+
+            reference operator*() const { return *m_slot; }
+            pointer operator->() const { return m_slot; }
+
+            flat_hash_table_iterator& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                skip_empty_or_deleted();
+                return *this;
+            }
+            flat_hash_table_iterator operator++(int)
+            {
+                flat_hash_table_iterator result = *this;
+                ++(*this);
+                return result;
+            }
+
+            friend bool operator==(const flat_hash_table_iterator& lhs, const flat_hash_table_iterator& rhs) { return lhs.m_ctrl == rhs.m_ctrl; }
+            friend bool operator!=(const flat_hash_table_iterator& lhs, const flat_hash_table_iterator& rhs) { return lhs.m_ctrl != rhs.m_ctrl; }
+
+        private:
+            flat_hash_table_iterator(FlatHash::ctrl_t* ctrl, ValueType* slot)
+                : m_ctrl(ctrl)
+                , m_slot(slot)
+            {
+            }
+
+            void skip_empty_or_deleted()
+            {
+                // The sentinel at the end of the control bytes stops the iteration.
+                while (FlatHash::is_empty_or_deleted(*m_ctrl))
+                {
+                    const size_t shift = FlatHash::group(m_ctrl).count_leading_empty_or_deleted();
+                    m_ctrl += shift;
+                    m_slot += shift;
+                }
+            }
+
+            FlatHash::ctrl_t* m_ctrl = nullptr;
+            ValueType* m_slot = nullptr;
+        };
+    } // namespace Internal
+
+    /**
+     * Open addressing hash table (Swiss table) that stores the elements in a single flat allocation. Every slot has a
+     * control byte with 7 bits of the hash, which are matched a group at a time with SIMD instructions where available,
+     * so most lookups touch a single cache line of control bytes before comparing any keys.
+     *
+     * Compared to \ref hash_table inserts don't allocate, and lookups don't chase pointers, but:
+     * - Iterators, pointers and references are invalidated by any insert that grows the table.
+     * - Erase doesn't invalidate iterators other than the erased one.
+     * - The iteration order is unspecified and there are no buckets, local iterators or reverse iterators.
+     * - The load factor is fixed to 7/8.
+     *
+     * Traits should have the following members
+     * typedef xxx  key_type;
+     * typedef xxx  key_equal;
+     * typedef xxx  hasher;
+     * typedef xxx  value_type;
+     * typedef xxx  storage_type; // Type the slots are stored as. It has to be value_type or a layout compatible type
+     *                            // with a mutable key, such as pair<Key, T> for pair<const Key, T>, so slots can be moved.
+     * typedef xxx  allocator_type;
+     * static inline const key_type& key_from_value(const value_type& value);
+     */
+    template<class Traits>
+    class flat_hash_table
+    {
+        using this_type = flat_hash_table<Traits>;
+        using ctrl_t = Internal::FlatHash::ctrl_t;
+        using group = Internal::FlatHash::group;
+
+    public:
+        using traits_type = Traits;
+
+        using key_type = typename Traits::key_type;
+        using key_equal = typename Traits::key_equal;
+        using hasher = typename Traits::hasher;
+        using value_type = typename Traits::value_type;
+        using allocator_type = typename Traits::allocator_type;
+
+        using size_type = typename allocator_type::size_type;
+        using difference_type = typename allocator_type::difference_type;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+        using iterator = Internal::flat_hash_table_iterator<value_type, false>;
+        using const_iterator = Internal::flat_hash_table_iterator<value_type, true>;
+
+        using pair_iter_bool = AZStd::pair<iterator, bool>;
+        using pair_iter_iter = AZStd::pair<iterator, iterator>;
+        using pair_citer_citer = AZStd::pair<const_iterator, const_iterator>;
+
+    protected:
+        using storage_type = typename Traits::storage_type;
+        static_assert(sizeof(storage_type) == sizeof(value_type) && alignof(storage_type) == alignof(value_type),
+            "The storage type of a flat_hash_table has to be layout compatible with its value type.");
+
+        //! Keys of other types can only be used for lookups if both the hasher and key_equal are transparent.
+        template<class ComparableToKey>
+        static constexpr bool is_lookup_key_v =
+            (Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value) ||
+            is_convertible_v<ComparableToKey, key_type>;
+
+    public:
+
+        flat_hash_table(const hasher& hash, const key_equal& keyEqual, const allocator_type& alloc = allocator_type())
+            : m_hasher(hash)
+            , m_keyEqual(keyEqual)
+            , m_allocator(alloc)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs)
+            : flat_hash_table(rhs, rhs.m_allocator)
+        {
+        }
+        flat_hash_table(const flat_hash_table& rhs, const type_identity_t<allocator_type>& alloc)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(alloc)
+        {
+            copy_elements(rhs);
+        }
+
+        flat_hash_table(flat_hash_table&& rhs)
+            : m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(rhs.m_allocator)
+        {
+            steal_storage(rhs);
+        }
+        flat_hash_table(flat_hash_table&& rhs, const type_identity_t<allocator_type>& alloc)
+            : m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(alloc)
+        {
+            if (m_allocator == rhs.m_allocator)
+            {
+                steal_storage(rhs);
+            }
+            else
+            {
+                move_elements(rhs);
+            }
+        }
+
+        ~flat_hash_table()
+        {
+            destroy_slots();
+            deallocate_storage();
+        }
+
+        this_type& operator=(const this_type& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                m_hasher = rhs.m_hasher;
+                m_keyEqual = rhs.m_keyEqual;
+                copy_elements(rhs);
+            }
+            return *this;
+        }
+        this_type& operator=(this_type&& rhs)
+        {
+            if (this != &rhs)
+            {
+                destroy_slots();
+                m_hasher = AZStd::move(rhs.m_hasher);
+                m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                if (m_allocator == rhs.m_allocator)
+                {
+                    deallocate_storage();
+                    steal_storage(rhs);
+                }
+                else
+                {
+                    m_size = 0;
+                    if (m_capacity)
+                    {
+                        reset_ctrl();
+                        reset_growth_left();
+                    }
+                    move_elements(rhs);
+                }
+            }
+            return *this;
+        }
+
+        iterator begin()
+        {
+            iterator result(m_ctrl, value_at(0));
+            result.skip_empty_or_deleted();
+            return result;
+        }
+        const_iterator begin() const { return const_cast<this_type*>(this)->begin(); }
+        const_iterator cbegin() const { return begin(); }
+        iterator end() { return iterator(m_ctrl + m_capacity, value_at(m_capacity)); }
+        const_iterator end() const { return const_cast<this_type*>(this)->end(); }
+        const_iterator cend() const { return end(); }
+
+        bool empty() const { return m_size == 0; }
+        size_type size() const { return m_size; }
+        size_type max_size() const { return m_allocator.max_size() / sizeof(storage_type); }
+        //! Number of slots in the table. Up to 7/8th of them can be used before the table grows.
+        size_type capacity() const { return m_capacity; }
+        size_type bucket_count() const { return m_capacity; }
+        float load_factor() const { return m_capacity ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f; }
+        float max_load_factor() const { return 7.0f / 8.0f; }
+
+        key_equal key_eq() const { return m_keyEqual; }
+        hasher get_hasher() const { return m_hasher; }
+        allocator_type& get_allocator() { return m_allocator; }
+        const allocator_type& get_allocator() const { return m_allocator; }
+
+        pair_iter_bool insert(const value_type& value)
+        {
+            auto [index, inserted] = find_or_prepare_insert(Traits::key_from_value(value));
+            if (inserted)
+            {
+                construct_at_index(index, value);
+            }
+            return { iterator_at(index), inserted };
+        }
+        pair_iter_bool insert(value_type&& value)
+        {
+            auto [index, inserted] = find_or_prepare_insert(Traits::key_from_value(value));
+            if (inserted)
+            {
+                construct_at_index(index, AZStd::move(value));
+            }
+            return { iterator_at(index), inserted };
+        }
+        iterator insert(const_iterator, const value_type& value) { return insert(value).first; }
+        iterator insert(const_iterator, value_type&& value) { return insert(AZStd::move(value)).first; }
+
+        template<class Iterator>
+        auto insert(Iterator first, Iterator last)
+            -> enable_if_t<input_iterator<Iterator> && !is_convertible_v<Iterator, size_type>>
+        {
+            if constexpr (forward_iterator<Iterator>)
+            {
+                reserve(m_size + static_cast<size_type>(AZStd::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                emplace(*first);
+            }
+        }
+        void insert(std::initializer_list<value_type> list)
+        {
+            insert(list.begin(), list.end());
+        }
+        template<class R>
+        auto insert_range(R&& rg) -> enable_if_t<Internal::container_compatible_range<R, value_type>>
+        {
+            for (auto&& element : rg)
+            {
+                emplace(AZStd::forward<decltype(element)>(element));
+            }
+        }
+
+        //! The key is only known once the value is constructed, so the value is constructed on the stack and moved into the
+        //! table if the key isn't present. Use try_emplace on maps to avoid this.
+        template<class... Args>
+        pair_iter_bool emplace(Args&&... arguments)
+        {
+            if constexpr (sizeof...(Args) == 1 && (is_same_v<remove_cvref_t<Args>, value_type> && ...))
+            {
+                return insert(AZStd::forward<Args>(arguments)...);
+            }
+            else
+            {
+                // Constructed as the storage type so the key can be moved into the table.
+                alignas(storage_type) unsigned char buffer[sizeof(storage_type)];
+                storage_type* value = AZStd::construct_at(reinterpret_cast<storage_type*>(buffer), AZStd::forward<Args>(arguments)...);
+                auto [index, inserted] = find_or_prepare_insert(Traits::key_from_value(value_from_storage(*value)));
+                if (inserted)
+                {
+                    construct_at_index(index, AZStd::move(*value));
+                }
+                AZStd::destroy_at(value);
+                return { iterator_at(index), inserted };
+            }
+        }
+        template<class... Args>
+        iterator emplace_hint(const_iterator, Args&&... arguments)
+        {
+            return emplace(AZStd::forward<Args>(arguments)...).first;
+        }
+
+        iterator erase(const_iterator erasePos)
+        {
+            AZSTD_CONTAINER_ASSERT(erasePos != end(), "AZStd::flat_hash_table::erase - invalid iterator!");
+            const size_type index = static_cast<size_type>(erasePos.m_ctrl - m_ctrl);
+            erase_at(index);
+            iterator next(m_ctrl + index, value_at(index));
+            next.skip_empty_or_deleted();
+            return next;
+        }
+        iterator erase(iterator erasePos)
+        {
+            return erase(const_iterator(erasePos));
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(last.m_ctrl, last.m_slot);
+        }
+        size_type erase(const key_type& key)
+        {
+            return erase_key(key);
+        }
+        template<class ComparableToKey>
+        auto erase(const ComparableToKey& key) -> enable_if_t<is_lookup_key_v<ComparableToKey> && !is_convertible_v<const ComparableToKey&, const_iterator>, size_type>
+        {
+            return erase_key(key);
+        }
+
+        //! Destroys all elements, but keeps the storage. Use rehash(0) to release the storage as well.
+        void clear()
+        {
+            destroy_slots();
+            m_size = 0;
+            if (m_capacity)
+            {
+                reset_ctrl();
+                reset_growth_left();
+            }
+        }
+
+        void swap(this_type& rhs)
+        {
+            if (this == &rhs)
+            {
+                return;
+            }
+            if (m_allocator == rhs.m_allocator)
+            {
+                AZStd::swap(m_ctrl, rhs.m_ctrl);
+                AZStd::swap(m_slots, rhs.m_slots);
+                AZStd::swap(m_size, rhs.m_size);
+                AZStd::swap(m_capacity, rhs.m_capacity);
+                AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+                AZStd::swap(m_hasher, rhs.m_hasher);
+                AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+            }
+            else
+            {
+                // Each table keeps its own allocator, so the elements are moved between the allocators.
+                this_type temp(AZStd::move(*this));
+                *this = AZStd::move(rhs);
+                rhs = AZStd::move(temp);
+            }
+        }
+
+        //! Makes sure at least count elements can be stored without growing the table.
+        void reserve(size_type count)
+        {
+            if (count > m_size + m_growthLeft)
+            {
+                resize(Internal::FlatHash::normalize_capacity(Internal::FlatHash::growth_to_lowerbound_capacity(count)));
+            }
+        }
+        //! Resizes the table to fit at least count elements. A count of 0 shrinks the table to fit the current elements.
+        void rehash(size_type count)
+        {
+            if (count == 0 && m_size == 0)
+            {
+                deallocate_storage();
+                return;
+            }
+            const size_type capacity = Internal::FlatHash::normalize_capacity(
+                AZStd::max(count, Internal::FlatHash::growth_to_lowerbound_capacity(m_size)));
+            if (count == 0 ? capacity < m_capacity : capacity > m_capacity)
+            {
+                resize(capacity);
+            }
+        }
+
+        iterator find(const key_type& key) { return iterator_or_end(find_index(key)); }
+        const_iterator find(const key_type& key) const { return const_cast<this_type*>(this)->find(key); }
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key) -> enable_if_t<is_lookup_key_v<ComparableToKey>, iterator>
+        {
+            return iterator_or_end(find_index(key));
+        }
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key) const -> enable_if_t<is_lookup_key_v<ComparableToKey>, const_iterator>
+        {
+            return const_cast<this_type*>(this)->find(key);
+        }
+
+        bool contains(const key_type& key) const { return find_index(key) != npos; }
+        template<class ComparableToKey>
+        auto contains(const ComparableToKey& key) const -> enable_if_t<is_lookup_key_v<ComparableToKey>, bool>
+        {
+            return find_index(key) != npos;
+        }
+
+        size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+        template<class ComparableToKey>
+        auto count(const ComparableToKey& key) const -> enable_if_t<is_lookup_key_v<ComparableToKey>, size_type>
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        pair_iter_iter equal_range(const key_type& key) { return equal_range_impl<iterator>(find(key)); }
+        pair_citer_citer equal_range(const key_type& key) const { return equal_range_impl<const_iterator>(find(key)); }
+        template<class ComparableToKey>
+        auto equal_range(const ComparableToKey& key) -> enable_if_t<is_lookup_key_v<ComparableToKey>, pair_iter_iter>
+        {
+            return equal_range_impl<iterator>(find(key));
+        }
+        template<class ComparableToKey>
+        auto equal_range(const ComparableToKey& key) const -> enable_if_t<is_lookup_key_v<ComparableToKey>, pair_citer_citer>
+        {
+            return equal_range_impl<const_iterator>(find(key));
+        }
+
+        //! Returns true if all full slots can be found through a lookup and the element count matches.
+        bool validate() const
+        {
+            size_type fullSlots = 0;
+            for (size_type i = 0; i < m_capacity; ++i)
+            {
+                if (Internal::FlatHash::is_full(m_ctrl[i]))
+                {
+                    ++fullSlots;
+                    if (find_index(Traits::key_from_value(value_from_storage(m_slots[i]))) != i)
+                    {
+                        return false;
+                    }
+                }
+            }
+            if (m_capacity && m_ctrl[m_capacity] != Internal::FlatHash::ctrl_sentinel)
+            {
+                return false;
+            }
+            return fullSlots == m_size && m_size + m_growthLeft <= Internal::FlatHash::capacity_to_growth(m_capacity);
+        }
+
+    protected:
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        //! Returns the index of the element with the key, or claims a slot for it. If the bool is true the caller
+        //! has to construct an element with the key in the slot before using the table again.
+        template<class ComparableToKey>
+        AZStd::pair<size_type, bool> find_or_prepare_insert(const ComparableToKey& key)
+        {
+            const size_t hash = hash_key(key);
+            const size_type index = find_index(key, hash);
+            if (index != npos)
+            {
+                return { index, false };
+            }
+            return { prepare_insert(hash), true };
+        }
+
+        template<class... Args>
+        void construct_at_index(size_type index, Args&&... arguments)
+        {
+            AZStd::construct_at(m_slots + index, AZStd::forward<Args>(arguments)...);
+        }
+
+        iterator iterator_at(size_type index)
+        {
+            return iterator(m_ctrl + index, value_at(index));
+        }
+
+        //! Slots are stored with a mutable key, but only ever exposed as the value type.
+        static const value_type& value_from_storage(const storage_type& slot)
+        {
+            if constexpr (is_same_v<storage_type, value_type>)
+            {
+                return slot;
+            }
+            else
+            {
+                return *reinterpret_cast<const value_type*>(&slot);
+            }
+        }
+        value_type* value_at(size_type index)
+        {
+            return reinterpret_cast<value_type*>(m_slots + index);
+        }
+
+        template<class ComparableToKey>
+        size_type find_index(const ComparableToKey& key) const
+        {
+            return find_index(key, hash_key(key));
+        }
+
+        template<class ComparableToKey>
+        size_type find_index(const ComparableToKey& key, size_t hash) const
+        {
+            using namespace Internal::FlatHash;
+            const ctrl_t hashBits = h2(hash);
+            probe_seq seq(h1(hash), m_capacity);
+            while (true)
+            {
+                const group g(m_ctrl + seq.offset());
+                for (auto match = g.match(hashBits); match; match.clear_lowest_bit_set())
+                {
+                    const size_type index = seq.offset(match.lowest_bit_set());
+                    if (m_keyEqual(key, Traits::key_from_value(value_from_storage(m_slots[index]))))
+                    {
+                        return index;
+                    }
+                }
+                if (g.match_empty())
+                {
+                    return npos;
+                }
+                seq.next();
+            }
+        }
+
+    private:
+        template<class ComparableToKey>
+        size_t hash_key(const ComparableToKey& key) const
+        {
+            return Internal::FlatHash::hash_mix(m_hasher(key));
+        }
+
+        iterator iterator_or_end(size_type index)
+        {
+            return index != npos ? iterator_at(index) : end();
+        }
+
+        template<class Iterator>
+        AZStd::pair<Iterator, Iterator> equal_range_impl(Iterator found) const
+        {
+            if (found == Iterator(end()))
+            {
+                return { found, found };
+            }
+            Iterator next = found;
+            return { found, ++next };
+        }
+
+        template<class ComparableToKey>
+        size_type erase_key(const ComparableToKey& key)
+        {
+            const size_type index = find_index(key);
+            if (index == npos)
+            {
+                return 0;
+            }
+            erase_at(index);
+            return 1;
+        }
+
+        size_type find_first_non_full(size_t hash) const
+        {
+            using namespace Internal::FlatHash;
+            probe_seq seq(h1(hash), m_capacity);
+            while (true)
+            {
+                const auto mask = group(m_ctrl + seq.offset()).match_empty_or_deleted();
+                if (mask)
+                {
+                    return seq.offset(mask.lowest_bit_set());
+                }
+                seq.next();
+            }
+        }
+
+        size_type prepare_insert(size_t hash)
+        {
+            using namespace Internal::FlatHash;
+            size_type target = find_first_non_full(hash);
+            if (m_growthLeft == 0 && m_ctrl[target] != ctrl_deleted)
+            {
+                rehash_and_grow_if_necessary();
+                target = find_first_non_full(hash);
+            }
+            ++m_size;
+            m_growthLeft -= (m_ctrl[target] == ctrl_empty) ? 1 : 0;
+            set_ctrl(target, h2(hash));
+            return target;
+        }
+
+        void rehash_and_grow_if_necessary()
+        {
+            if (m_capacity == 0)
+            {
+                resize(1);
+            }
+            else if (m_capacity > group::width && m_size * 32 <= m_capacity * 25)
+            {
+                // Most of the used slots are tombstones, so rehash at the same size to get rid of them.
+                resize(m_capacity);
+            }
+            else
+            {
+                resize(m_capacity * 2 + 1);
+            }
+        }
+
+        void erase_at(size_type index)
+        {
+            using namespace Internal::FlatHash;
+            AZStd::destroy_at(m_slots + index);
+            --m_size;
+
+            // If there was never a full group around this slot, no probe sequence could have continued past it, so it
+            // can be marked as empty instead of leaving a tombstone.
+            const size_type indexBefore = (index - group::width) & m_capacity;
+            const auto emptyAfter = group(m_ctrl + index).match_empty();
+            const auto emptyBefore = group(m_ctrl + indexBefore).match_empty();
+            const bool wasNeverFull = emptyBefore && emptyAfter && (emptyAfter.trailing_zeros() + emptyBefore.leading_zeros()) < group::width;
+            set_ctrl(index, wasNeverFull ? ctrl_empty : ctrl_deleted);
+            m_growthLeft += wasNeverFull ? 1 : 0;
+        }
+
+        //! Sets the control byte of a slot and its clone. The first group::width - 1 control bytes are cloned after the
+        //! sentinel so groups can be loaded at any slot without wrapping.
+        void set_ctrl(size_type index, ctrl_t ctrl)
+        {
+            constexpr size_type clonedBytes = group::width - 1;
+            m_ctrl[index] = ctrl;
+            m_ctrl[((index - clonedBytes) & m_capacity) + (clonedBytes & m_capacity)] = ctrl;
+        }
+
+        void reset_ctrl()
+        {
+            memset(m_ctrl, Internal::FlatHash::ctrl_empty, m_capacity + group::width);
+            m_ctrl[m_capacity] = Internal::FlatHash::ctrl_sentinel;
+        }
+
+        void reset_growth_left()
+        {
+            m_growthLeft = Internal::FlatHash::capacity_to_growth(m_capacity) - m_size;
+        }
+
+        static constexpr size_type allocation_alignment()
+        {
+            return alignof(storage_type) > alignof(size_type) ? alignof(storage_type) : alignof(size_type);
+        }
+        static size_type slots_offset(size_type capacity)
+        {
+            return (capacity + group::width + alignof(storage_type) - 1) & ~(alignof(storage_type) - 1);
+        }
+        static size_type allocation_size(size_type capacity)
+        {
+            return slots_offset(capacity) + capacity * sizeof(storage_type);
+        }
+
+        void resize(size_type newCapacity)
+        {
+            ctrl_t* oldCtrl = m_ctrl;
+            storage_type* oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            void* memory = m_allocator.allocate(allocation_size(newCapacity), allocation_alignment());
+            AZSTD_CONTAINER_ASSERT(memory, "AZStd::flat_hash_table - failed to allocate %zu slots!", static_cast<size_t>(newCapacity));
+            m_ctrl = static_cast<ctrl_t*>(memory);
+            m_slots = reinterpret_cast<storage_type*>(static_cast<char*>(memory) + slots_offset(newCapacity));
+            m_capacity = newCapacity;
+            reset_ctrl();
+            reset_growth_left();
+
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (Internal::FlatHash::is_full(oldCtrl[i]))
+                {
+                    const size_t hash = hash_key(Traits::key_from_value(value_from_storage(oldSlots[i])));
+                    const size_type target = find_first_non_full(hash);
+                    set_ctrl(target, Internal::FlatHash::h2(hash));
+                    AZStd::construct_at(m_slots + target, AZStd::move(oldSlots[i]));
+                    AZStd::destroy_at(oldSlots + i);
+                }
+            }
+
+            if (oldCapacity)
+            {
+                m_allocator.deallocate(oldCtrl, allocation_size(oldCapacity), allocation_alignment());
+            }
+        }
+
+        void destroy_slots()
+        {
+            if constexpr (!is_trivially_destructible_v<storage_type>)
+            {
+                for (size_type i = 0; i < m_capacity; ++i)
+                {
+                    if (Internal::FlatHash::is_full(m_ctrl[i]))
+                    {
+                        AZStd::destroy_at(m_slots + i);
+                    }
+                }
+            }
+        }
+
+        void deallocate_storage()
+        {
+            if (m_capacity)
+            {
+                m_allocator.deallocate(m_ctrl, allocation_size(m_capacity), allocation_alignment());
+            }
+            m_ctrl = const_cast<ctrl_t*>(Internal::FlatHash::empty_group);
+            m_slots = nullptr;
+            m_capacity = 0;
+            m_growthLeft = 0;
+        }
+
+        void steal_storage(this_type& rhs)
+        {
+            m_ctrl = rhs.m_ctrl;
+            m_slots = rhs.m_slots;
+            m_size = rhs.m_size;
+            m_capacity = rhs.m_capacity;
+            m_growthLeft = rhs.m_growthLeft;
+
+            rhs.m_ctrl = const_cast<ctrl_t*>(Internal::FlatHash::empty_group);
+            rhs.m_slots = nullptr;
+            rhs.m_size = 0;
+            rhs.m_capacity = 0;
+            rhs.m_growthLeft = 0;
+        }
+
+        //! Inserts copies of all elements of rhs, which are known to be unique, into an empty table.
+        void copy_elements(const this_type& rhs)
+        {
+            reserve(rhs.m_size);
+            for (size_type i = 0; i < rhs.m_capacity; ++i)
+            {
+                if (Internal::FlatHash::is_full(rhs.m_ctrl[i]))
+                {
+                    const size_t hash = hash_key(Traits::key_from_value(value_from_storage(rhs.m_slots[i])));
+                    construct_at_index(prepare_insert(hash), rhs.m_slots[i]);
+                }
+            }
+        }
+
+        void move_elements(this_type& rhs)
+        {
+            reserve(rhs.m_size);
+            for (size_type i = 0; i < rhs.m_capacity; ++i)
+            {
+                if (Internal::FlatHash::is_full(rhs.m_ctrl[i]))
+                {
+                    const size_t hash = hash_key(Traits::key_from_value(value_from_storage(rhs.m_slots[i])));
+                    construct_at_index(prepare_insert(hash), AZStd::move(rhs.m_slots[i]));
+                }
+            }
+            rhs.clear();
+        }
+
+        ctrl_t* m_ctrl = const_cast<ctrl_t*>(Internal::FlatHash::empty_group);
+        storage_type* m_slots = nullptr;
+        size_type m_size = 0;
+        size_type m_capacity = 0;
+        size_type m_growthLeft = 0;
+        hasher m_hasher;
+        key_equal m_keyEqual;
+        allocator_type m_allocator;
+    };
+} // namespace AZStd
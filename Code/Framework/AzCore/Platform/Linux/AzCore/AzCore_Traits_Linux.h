@@ -20,10 +20,17 @@
         #define AZ_TRAIT_USE_PLATFORM_SIMD_NEON 0
         #define AZ_TRAIT_USE_PLATFORM_SIMD_SSE 0
     #endif // __ARM_NEON
+    #define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
 #else
     #define AZ_TRAIT_USE_PLATFORM_SIMD_SCALAR 0
     #define AZ_TRAIT_USE_PLATFORM_SIMD_NEON 0
     #define AZ_TRAIT_USE_PLATFORM_SIMD_SSE 1
+    // AVX2 and FMA are only used when the build targets them, see LY_SIMD_AVX2
+    #if defined(__AVX2__) && defined(__FMA__)
+        #define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 1
+    #else
+        #define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+    #endif
 #endif // __ARM_ARCH
 
 // OS traits ...
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+
+namespace AZ::IO
+{
+    namespace IoUringInternal
+    {
+        static int Setup(u32 entries, io_uring_params* params)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        static int Enter(int ringFd, u32 toSubmit, u32 minComplete, u32 flags)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        static int Register(int ringFd, u32 opcode, const void* arg, u32 argCount)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_register, ringFd, opcode, arg, argCount));
+        }
+
+        static void* OffsetPointer(void* base, u32 offset)
+        {
+            return reinterpret_cast<u8*>(base) + offset;
+        }
+    } // namespace IoUringInternal
+
+    IoUring::~IoUring()
+    {
+        Shutdown();
+    }
+
+    bool IoUring::IsAvailable(u32 entries)
+    {
+        IoUring ring;
+        return ring.Initialize(entries) && ring.IsOperationSupported(IORING_OP_READ) && ring.IsOperationSupported(IORING_OP_READ_FIXED) &&
+            ring.IsOperationSupported(IORING_OP_ASYNC_CANCEL);
+    }
+
+    bool IoUring::Initialize(u32 entries)
+    {
+        using namespace IoUringInternal;
+
+        AZ_Assert(!IsInitialized(), "IoUring has already been initialized.");
+
+        io_uring_params params;
+        ::memset(&params, 0, sizeof(params));
+        int ringFd = Setup(entries, &params);
+        if (ringFd < 0)
+        {
+            return false;
+        }
+        m_ringFd = ringFd;
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRingMemory =
+            ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+        if (m_submissionRingMemory == MAP_FAILED)
+        {
+            m_submissionRingMemory = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRingMemory = m_submissionRingMemory;
+        }
+        else
+        {
+            m_completionRingMemory =
+                ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+            if (m_completionRingMemory == MAP_FAILED)
+            {
+                m_completionRingMemory = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries =
+            ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        m_submissionHead = reinterpret_cast<u32*>(OffsetPointer(m_submissionRingMemory, params.sq_off.head));
+        m_submissionTail = reinterpret_cast<u32*>(OffsetPointer(m_submissionRingMemory, params.sq_off.tail));
+        m_submissionArray = reinterpret_cast<u32*>(OffsetPointer(m_submissionRingMemory, params.sq_off.array));
+        m_submissionMask = *reinterpret_cast<u32*>(OffsetPointer(m_submissionRingMemory, params.sq_off.ring_mask));
+        m_submissionEntryCount = params.sq_entries;
+        m_pendingSubmissionTail = *m_submissionTail;
+
+        m_completionHead = reinterpret_cast<u32*>(OffsetPointer(m_completionRingMemory, params.cq_off.head));
+        m_completionTail = reinterpret_cast<u32*>(OffsetPointer(m_completionRingMemory, params.cq_off.tail));
+        m_completionEntries = reinterpret_cast<io_uring_cqe*>(OffsetPointer(m_completionRingMemory, params.cq_off.cqes));
+        m_completionMask = *reinterpret_cast<u32*>(OffsetPointer(m_completionRingMemory, params.cq_off.ring_mask));
+
+        // Probe for the supported operations. Kernels that don't support probing (pre 5.6) also don't support
+        // IORING_OP_READ, so in that case all operations are left as unsupported.
+        constexpr size_t probeSize = sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op);
+        alignas(io_uring_probe) u8 probeBuffer[probeSize]{};
+        auto probe = reinterpret_cast<io_uring_probe*>(probeBuffer);
+        if (Register(m_ringFd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) == 0)
+        {
+            for (u32 i = 0; i < probe->ops_len && i < IORING_OP_LAST; ++i)
+            {
+                if (probe->ops[i].flags & IO_URING_OP_SUPPORTED)
+                {
+                    m_supportedOperations[probe->ops[i].op] = 1;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void IoUring::Shutdown()
+    {
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+            m_submissionEntries = nullptr;
+        }
+        if (m_completionRingMemory && m_completionRingMemory != m_submissionRingMemory)
+        {
+            ::munmap(m_completionRingMemory, m_completionRingSize);
+        }
+        m_completionRingMemory = nullptr;
+        if (m_submissionRingMemory)
+        {
+            ::munmap(m_submissionRingMemory, m_submissionRingSize);
+            m_submissionRingMemory = nullptr;
+        }
+        if (m_ringFd >= 0)
+        {
+            ::close(m_ringFd);
+            m_ringFd = -1;
+        }
+
+        m_submissionHead = nullptr;
+        m_submissionTail = nullptr;
+        m_submissionArray = nullptr;
+        m_completionHead = nullptr;
+        m_completionTail = nullptr;
+        m_completionEntries = nullptr;
+        m_submissionEntryCount = 0;
+        ::memset(m_supportedOperations, 0, sizeof(m_supportedOperations));
+    }
+
+    bool IoUring::IsInitialized() const
+    {
+        return m_ringFd >= 0;
+    }
+
+    bool IoUring::IsOperationSupported(u8 operation) const
+    {
+        return operation < IORING_OP_LAST && m_supportedOperations[operation] != 0;
+    }
+
+    bool IoUring::RegisterBuffers(const iovec* buffers, u32 count)
+    {
+        AZ_Assert(IsInitialized(), "Registering buffers with an IoUring that hasn't been initialized.");
+        return IoUringInternal::Register(m_ringFd, IORING_REGISTER_BUFFERS, buffers, count) == 0;
+    }
+
+    bool IoUring::RegisterEventFd(int eventFd)
+    {
+        AZ_Assert(IsInitialized(), "Registering an eventfd with an IoUring that hasn't been initialized.");
+        return IoUringInternal::Register(m_ringFd, IORING_REGISTER_EVENTFD, &eventFd, 1) == 0;
+    }
+
+    io_uring_sqe* IoUring::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        if (m_pendingSubmissionTail - head >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = m_pendingSubmissionTail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        ++m_pendingSubmissionTail;
+        return entry;
+    }
+
+    int IoUring::Submit()
+    {
+        // Publish the new entries to the kernel before asking it to consume them.
+        __atomic_store_n(m_submissionTail, m_pendingSubmissionTail, __ATOMIC_RELEASE);
+
+        // Include entries that were published before but not consumed because an earlier submit failed part way.
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        const u32 toSubmit = m_pendingSubmissionTail - head;
+        if (toSubmit == 0)
+        {
+            return 0;
+        }
+
+        int result;
+        do
+        {
+            result = IoUringInternal::Enter(m_ringFd, toSubmit, 0, 0);
+        } while (result < 0 && errno == EINTR);
+        return result < 0 ? -errno : result;
+    }
+
+    bool IoUring::DiscardPendingSubmission(u64& userData)
+    {
+        // Without SQPOLL the kernel only reads the submission ring inside io_uring_enter, so entries past the head can
+        // safely be taken back.
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        if (m_pendingSubmissionTail == head)
+        {
+            return false;
+        }
+
+        --m_pendingSubmissionTail;
+        userData = m_submissionEntries[m_submissionArray[m_pendingSubmissionTail & m_submissionMask]].user_data;
+        __atomic_store_n(m_submissionTail, m_pendingSubmissionTail, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    bool IoUring::PopCompletion(io_uring_cqe& completion)
+    {
+        const u32 head = *m_completionHead;
+        const u32 tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+        if (head == tail)
+        {
+            return false;
+        }
+
+        completion = m_completionEntries[head & m_completionMask];
+        __atomic_store_n(m_completionHead, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    bool IoUring::WaitForCompletion(io_uring_cqe& completion)
+    {
+        while (!PopCompletion(completion))
+        {
+            if (IoUringInternal::Enter(m_ringFd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    u32 IoUring::GetSubmissionCapacity() const
+    {
+        return m_submissionEntryCount;
+    }
+} // namespace AZ::IO
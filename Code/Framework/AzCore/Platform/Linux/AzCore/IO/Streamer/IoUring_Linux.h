@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+
+#include <AzCore/base.h>
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around a Linux io_uring instance. The submission and completion rings are set up directly
+    //! through the io_uring system calls so no additional 3rd party library is needed.
+    //! The ring is not thread safe and is expected to be used exclusively from Streamer's scheduling thread.
+    class IoUring
+    {
+    public:
+        IoUring() = default;
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        //! Checks if the running kernel supports io_uring with the features the storage drive needs, and allows a ring with
+        //! the given number of submission entries to be created.
+        static bool IsAvailable(u32 entries);
+
+        //! Creates the rings with at least the requested number of submission entries.
+        bool Initialize(u32 entries);
+        void Shutdown();
+        bool IsInitialized() const;
+
+        //! Checks if the kernel supports the given IORING_OP_* operation.
+        bool IsOperationSupported(u8 operation) const;
+
+        //! Registers a set of buffers with the kernel so they can be used with IORING_OP_READ_FIXED.
+        bool RegisterBuffers(const iovec* buffers, u32 count);
+        //! Registers an eventfd that will be signaled whenever a completion is posted.
+        bool RegisterEventFd(int eventFd);
+
+        //! Returns the next free submission entry or null if the submission ring is full. The returned entry is cleared
+        //! and will be submitted on the next call to Submit.
+        io_uring_sqe* GetSubmissionEntry();
+        //! Submits all submission entries that were retrieved since the last call. Returns the number of submitted
+        //! entries or a negative errno value.
+        int Submit();
+        //! Takes back the most recently retrieved submission entry that the kernel hasn't consumed yet, typically after
+        //! Submit failed. Returns false if there are no such entries.
+        bool DiscardPendingSubmission(u64& userData);
+
+        //! Retrieves the oldest completion if there is one. The completion is consumed immediately.
+        bool PopCompletion(io_uring_cqe& completion);
+        //! Blocks until a completion is available and retrieves it. Returns false if waiting failed.
+        bool WaitForCompletion(io_uring_cqe& completion);
+
+        u32 GetSubmissionCapacity() const;
+
+    private:
+        void* m_submissionRingMemory{ nullptr };
+        void* m_completionRingMemory{ nullptr };
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+        size_t m_submissionEntriesSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32 m_submissionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        io_uring_cqe* m_completionEntries{ nullptr };
+        u32 m_completionMask{ 0 };
+
+        //! Local copy of the submission tail. Entries between the shared tail and this value have been prepared but not
+        //! yet published to the kernel.
+        u32 m_pendingSubmissionTail{ 0 };
+
+        u8 m_supportedOperations[IORING_OP_LAST]{};
+        int m_ringFd{ -1 };
+    };
+} // namespace AZ::IO
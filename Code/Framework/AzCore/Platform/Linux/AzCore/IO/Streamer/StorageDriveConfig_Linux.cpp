@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (!StorageDriveLinux::IsSupported(m_queueDepth))
+        {
+            AZ_Warning("Streamer", false, "io_uring isn't available on this system. Falling back to the generic storage drive.\n");
+            return AZStd::make_shared<StorageDrive>(m_maxFileHandles);
+        }
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableUnbufferedReads = m_enableUnbufferedReads;
+        options.m_minimalReporting = m_minimalReporting;
+
+        // Staging buffers are sized to the largest transfer the hardware supports so a read that was split by the
+        // read splitter always fits in a single registered buffer.
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+            m_maxFileHandles, m_maxMetaDataCache, hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize, m_queueDepth,
+            m_overcommit, m_registeredBufferCount, hardware.m_maxTransfer, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("RegisteredBufferCount", &LinuxStorageDriveConfig::m_registeredBufferCount)
+                ->Field("EnableUnbufferedReads", &LinuxStorageDriveConfig::m_enableUnbufferedReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
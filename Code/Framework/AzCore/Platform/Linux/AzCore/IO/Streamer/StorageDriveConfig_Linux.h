@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    class LinuxStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxStorageDriveConfig, "{E76EE3A1-62B4-4780-9895-034B2C9DFAF8}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxStorageDriveConfig, SystemAllocator);
+
+        ~LinuxStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_maxMetaDataCache{ 32 };
+        AZ::u32 m_queueDepth{ 32 };
+        AZ::s32 m_overcommit{ 8 };
+        AZ::u32 m_registeredBufferCount{ 8 };
+        bool m_enableUnbufferedReads{ true };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
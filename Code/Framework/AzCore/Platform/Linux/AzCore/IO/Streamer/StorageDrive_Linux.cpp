@@ -0,0 +1,1344 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, u32 queueDepth, s32 overCommit, u32 registeredBufferCount, size_t registeredBufferSize,
+        ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_registeredBufferSize(registeredBufferSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_registeredBufferCount(registeredBufferCount)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = DefaultQueueDepth;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Staging buffers are used for direct reads so they need to be a multiple of the sector size.
+        m_registeredBufferSize = AZ_SIZE_ALIGN_UP(m_registeredBufferSize, m_physicalSectorSize);
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        // Tear down the ring first so the kernel no longer references any of the buffers or file handles. Reads that are
+        // still in flight write into those buffers, so they have to be canceled and completed first.
+        CancelAndDrainReads();
+        m_ring.Shutdown();
+
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        for (FileReadInformation& readInfo : m_readSlots_readInfo)
+        {
+            readInfo.Clear();
+        }
+        if (m_registeredBufferMemory)
+        {
+            azfree(m_registeredBufferMemory, AZ::SystemAllocator);
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::IsSupported(u32 queueDepth)
+    {
+        return IoUring::IsAvailable(CalculateRingEntryCount(queueDepth));
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Queue as many reads as there are free slots and submit them to the kernel in a single call.
+        bool hasQueuedReads = false;
+        while (!m_pendingReadRequests.empty())
+        {
+            ReadResult result = ReadRequest(m_pendingReadRequests.front());
+            if (result == ReadResult::Delayed)
+            {
+                break;
+            }
+            hasQueuedReads = hasQueuedReads || (result == ReadResult::Queued);
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+        if (hasQueuedReads)
+        {
+            AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ExecuteRequests io_uring_enter");
+            int submitted = m_ring.Submit();
+            if (submitted < 0)
+            {
+                AZ_Error("StorageDriveLinux", false, "Failed to submit reads to io_uring (Error: %i).\n", -submitted);
+                FailUnsubmittedReads();
+            }
+        }
+
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        return false;
+                    }
+                },
+                request->GetCommand()) || hasWorked;
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                AZStd::chrono::steady_clock::time_point endTime =
+                    read.m_startTime + Statistic::TimeValue(aznumeric_cast<u64>((readCommand->m_size * totalReadTime) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileExistsTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileMetaDataTimeAverage = m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+                startTime += getFileMetaDataTimeAverage;
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    AZStd::chrono::microseconds fileOpenCloseTimeAverage = m_fileOpenCloseTimeAverage.CalculateAverage();
+                    startTime += fileOpenCloseTimeAverage;
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    u32 StorageDriveLinux::CalculateRingEntryCount(u32 queueDepth)
+    {
+        // Reserve additional entries so cancellations can always be queued next to a full set of reads.
+        return (queueDepth != 0 ? queueDepth : DefaultQueueDepth) * 2;
+    }
+
+    bool StorageDriveLinux::InitializeRing()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (!m_ring.Initialize(CalculateRingEntryCount(m_queueDepth)))
+        {
+            AZ_Error("StorageDriveLinux", false, "Failed to create an io_uring instance for %s (Error: %i).\n", m_name.c_str(), errno);
+            return false;
+        }
+        if (!m_ring.IsOperationSupported(IORING_OP_READ) || !m_ring.IsOperationSupported(IORING_OP_ASYNC_CANCEL))
+        {
+            AZ_Error("StorageDriveLinux", false, "The kernel's io_uring implementation doesn't support the operations needed by %s.\n",
+                m_name.c_str());
+            m_ring.Shutdown();
+            return false;
+        }
+
+        // Let the kernel wake up the scheduling thread whenever a read completes.
+        if (m_context && !m_ring.RegisterEventFd(m_context->GetStreamerThreadSynchronizer().GetEventHandle()))
+        {
+            AZ_Warning("StorageDriveLinux", false,
+                "Unable to register the Streamer event with io_uring (Error: %i). Completions will only be picked up when other work "
+                "wakes up the Streamer.\n", errno);
+        }
+
+        if (m_constructionOptions.m_enableUnbufferedReads && m_registeredBufferCount > 0 && m_registeredBufferSize > 0)
+        {
+            m_registeredBufferMemory = azmalloc(m_registeredBufferCount * m_registeredBufferSize, m_physicalSectorSize, AZ::SystemAllocator);
+
+            AZStd::vector<iovec> buffers;
+            buffers.reserve(m_registeredBufferCount);
+            for (u32 i = 0; i < m_registeredBufferCount; ++i)
+            {
+                iovec buffer;
+                buffer.iov_base = reinterpret_cast<u8*>(m_registeredBufferMemory) + i * m_registeredBufferSize;
+                buffer.iov_len = m_registeredBufferSize;
+                buffers.push_back(buffer);
+            }
+
+            if (m_ring.IsOperationSupported(IORING_OP_READ_FIXED) && m_ring.RegisterBuffers(buffers.data(), m_registeredBufferCount))
+            {
+                m_registeredBuffers_available.reserve(m_registeredBufferCount);
+                for (u32 i = m_registeredBufferCount; i > 0; --i)
+                {
+                    m_registeredBuffers_available.push_back(i - 1);
+                }
+            }
+            else
+            {
+                // This typically happens when RLIMIT_MEMLOCK is too low to pin the buffers.
+                AZ_Warning("StorageDriveLinux", false,
+                    "Unable to register %u staging buffers of %zu bytes with io_uring (Error: %i). Unaligned reads will use temporary "
+                    "buffers instead.\n", m_registeredBufferCount, m_registeredBufferSize, errno);
+                azfree(m_registeredBufferMemory, AZ::SystemAllocator);
+                m_registeredBufferMemory = nullptr;
+                m_registeredBufferCount = 0;
+            }
+        }
+        else
+        {
+            m_registeredBufferCount = 0;
+        }
+
+        return true;
+    }
+
+    void StorageDriveLinux::FallBackToStorageDrive()
+    {
+        AZ_Warning("StorageDriveLinux", false, "Falling back to the generic storage drive for %s.\n", m_name.c_str());
+
+        auto fallback = AZStd::make_shared<StorageDrive>(m_maxFileHandles);
+        fallback->SetNext(GetNext());
+        fallback->SetContext(*m_context);
+        SetNext(AZStd::move(fallback));
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileHandle, size_t& cacheSlot, const Requests::ReadData& data) -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            if (m_fileCache_isDirect[cacheIndex] && !m_constructionOptions.m_enableUnbufferedReads)
+            {
+                // Direct reads have been turned off after this file was opened. Wait for any in-flight reads to complete
+                // and reopen the file without O_DIRECT.
+                if (m_fileCache_activeReads[cacheIndex] != 0)
+                {
+                    return OpenFileResult::CacheFull;
+                }
+                CloseFileHandle(cacheIndex);
+                cacheIndex = InvalidFileCacheIndex;
+            }
+            else
+            {
+                file = m_fileCache_handles[cacheIndex];
+                AZ_Assert(file >= 0, "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePathCStr());
+            }
+        }
+
+        if (cacheIndex == InvalidFileCacheIndex)
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            bool isDirect = m_constructionOptions.m_enableUnbufferedReads;
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                constexpr int baseFlags = O_RDONLY | O_CLOEXEC;
+                file = ::open(data.m_path.GetAbsolutePathCStr(), isDirect ? (baseFlags | O_DIRECT) : baseFlags);
+                if (file < 0 && isDirect && errno == EINVAL)
+                {
+                    // The file system doesn't support direct IO, such as tmpfs, so fall back to buffered reads for this file.
+                    isDirect = false;
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), baseFlags);
+                }
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                CloseFileHandle(cacheIndex);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+            m_fileCache_isDirect[cacheIndex] = isDirect;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::now();
+        fileHandle = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    auto StorageDriveLinux::ReadRequest(FileRequest* request) -> ReadResult
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::steady_clock::time_point::min());
+            m_fileCache_paths.resize(m_maxFileHandles);
+            m_fileCache_handles.resize(m_maxFileHandles, -1);
+            m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+            m_fileCache_isDirect.resize(m_maxFileHandles, false);
+
+            m_readSlots_readInfo.resize(m_queueDepth);
+            m_readSlots_active.resize(m_queueDepth);
+
+            m_ringFailed = !InitializeRing();
+            if (m_ringFailed)
+            {
+                FallBackToStorageDrive();
+            }
+            m_cachesInitialized = true;
+        }
+
+        if (m_ringFailed)
+        {
+            StreamStackEntry::QueueRequest(request);
+            return ReadResult::Completed;
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return ReadResult::Delayed;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            StreamStackEntry::QueueRequest(request);
+            return ReadResult::Completed;
+        case OpenFileResult::CacheFull:
+            return ReadResult::Delayed;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        io_uring_sqe* entry = m_ring.GetSubmissionEntry();
+        if (!entry)
+        {
+            // The submission queue is full of cancellations. Try again after the next submit.
+            return ReadResult::Delayed;
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+        readInfo.m_isDirect = m_fileCache_isDirect[fileCacheSlot];
+
+        if (readInfo.m_isDirect)
+        {
+            // Direct reads require the offset and size to be aligned to the logical sector size and the output buffer to be
+            // aligned to the physical sector size. The approach is the same as the unbuffered reads in StorageDriveWin: the
+            // offset is aligned down and the size aligned up. If the output buffer can't hold the additional data or isn't
+            // aligned, the read is staged in a sector aligned buffer and only the requested part is copied back.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedOffs && alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (readSize <= m_registeredBufferSize && !m_registeredBuffers_available.empty())
+                {
+                    readInfo.m_registeredBufferIndex = ClaimRegisteredBuffer();
+                    output = reinterpret_cast<u8*>(m_registeredBufferMemory) + readInfo.m_registeredBufferIndex * m_registeredBufferSize;
+                }
+                else
+                {
+                    readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                    output = readInfo.m_sectorAlignedOutput;
+                }
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        AZ_Assert(readSize <= std::numeric_limits<u32>::max(), "Read of %llu bytes is too large for a single io_uring read.", readSize);
+        readInfo.m_output = reinterpret_cast<u8*>(output);
+        readInfo.m_offset = readOffs;
+        readInfo.m_size = readSize;
+        PrepareReadEntry(*entry, readSlot);
+
+        auto now = AZStd::chrono::steady_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return ReadResult::Queued;
+    }
+
+    void StorageDriveLinux::PrepareReadEntry(io_uring_sqe& entry, size_t readSlot) const
+    {
+        const FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        entry.opcode = readInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        entry.fd = m_fileCache_handles[readInfo.m_fileHandleIndex];
+        entry.addr = reinterpret_cast<u64>(readInfo.m_output + readInfo.m_bytesRead);
+        entry.len = aznumeric_cast<u32>(readInfo.m_size - readInfo.m_bytesRead);
+        entry.off = readInfo.m_offset + readInfo.m_bytesRead;
+        entry.user_data = readSlot;
+        if (readInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex)
+        {
+            entry.buf_index = aznumeric_cast<u16>(readInfo.m_registeredBufferIndex);
+        }
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads and ask the kernel to cancel them.
+        // Reads that are canceled complete with -ECANCELED, reads that already finished complete as normal.
+        bool hasQueuedCancels = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (io_uring_sqe* entry = m_ring.GetSubmissionEntry(); entry)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = CancelUserDataFlag | readSlot;
+                    hasQueuedCancels = true;
+                }
+            }
+        }
+        if (hasQueuedCancels)
+        {
+            int submitted = m_ring.Submit();
+            if (submitted < 0)
+            {
+                AZ_Error("StorageDriveLinux", false, "Failed to submit cancellations to io_uring (Error: %i).\n", -submitted);
+                FailUnsubmittedReads();
+            }
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePathCStr());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        if (::stat(fileExists.m_path.GetAbsolutePathCStr(), &attributes) == 0 && S_ISREG(attributes.st_mode))
+        {
+            cacheIndex = GetNextMetaDataCacheSlot();
+            m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+            m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+            fileExists.m_found = true;
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePathCStr());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] >= 0,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePathCStr());
+            if (::fstat(m_fileCache_handles[cacheIndex], &attributes) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePathCStr(), &attributes) != 0 || !S_ISREG(attributes.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(attributes.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = command.m_fileSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFileHandle(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] >= 0)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Closing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePathCStr(), m_fileCache_activeReads[cacheIndex]);
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = -1;
+        }
+        m_fileCache_activeReads[cacheIndex] = 0;
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+        m_fileCache_paths[cacheIndex].Clear();
+        m_fileCache_isDirect[cacheIndex] = false;
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (!m_ring.IsInitialized())
+        {
+            return false;
+        }
+
+        bool hasWorked = false;
+        bool hasResubmittedReads = false;
+        io_uring_cqe completion;
+        while (m_ring.PopCompletion(completion))
+        {
+            if ((completion.user_data & CancelUserDataFlag) == 0)
+            {
+                const size_t readSlot = aznumeric_cast<size_t>(completion.user_data);
+                AZ_Assert(readSlot < m_readSlots_active.size() && m_readSlots_active[readSlot],
+                    "io_uring returned a completion for read slot %zu which isn't active.", readSlot);
+                hasResubmittedReads = FinalizeSingleRequest(readSlot, completion.res) || hasResubmittedReads;
+                hasWorked = true;
+            }
+        }
+
+        if (hasResubmittedReads)
+        {
+            int submitted = m_ring.Submit();
+            if (submitted < 0)
+            {
+                AZ_Error("StorageDriveLinux", false, "Failed to submit the remainder of short reads to io_uring (Error: %i).\n", -submitted);
+                FailUnsubmittedReads();
+            }
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FailUnsubmittedReads()
+    {
+        u64 userData;
+        while (m_ring.DiscardPendingSubmission(userData))
+        {
+            if ((userData & CancelUserDataFlag) == 0)
+            {
+                const size_t readSlot = aznumeric_cast<size_t>(userData);
+                FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+                ReleaseReadSlot(readSlot, 0);
+                fileReadInfo.m_request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+                fileReadInfo.Clear();
+            }
+        }
+    }
+
+    void StorageDriveLinux::CancelAndDrainReads()
+    {
+        if (!m_ring.IsInitialized() || m_activeReads_Count == 0)
+        {
+            return;
+        }
+
+        // Entries that were never consumed by the kernel don't need to be canceled.
+        u64 userData;
+        while (m_ring.DiscardPendingSubmission(userData))
+        {
+            if ((userData & CancelUserDataFlag) == 0)
+            {
+                ReleaseReadSlot(aznumeric_cast<size_t>(userData), 0);
+            }
+        }
+
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot])
+            {
+                if (io_uring_sqe* entry = m_ring.GetSubmissionEntry(); entry)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = CancelUserDataFlag | readSlot;
+                }
+            }
+        }
+        [[maybe_unused]] int submitted = m_ring.Submit();
+        AZ_Error("StorageDriveLinux", submitted >= 0, "Failed to submit cancellations to io_uring (Error: %i).\n", -submitted);
+
+        // Reads that couldn't be canceled still complete on their own, so wait for every read regardless.
+        io_uring_cqe completion;
+        while (m_activeReads_Count > 0 && m_ring.WaitForCompletion(completion))
+        {
+            if ((completion.user_data & CancelUserDataFlag) == 0)
+            {
+                ReleaseReadSlot(aznumeric_cast<size_t>(completion.user_data), 0);
+            }
+        }
+        AZ_Error("StorageDriveLinux", m_activeReads_Count == 0,
+            "Failed to wait for %u reads to complete in %s (Error: %i).\n", m_activeReads_Count, m_name.c_str(), errno);
+    }
+
+    void StorageDriveLinux::ReleaseReadSlot(size_t readSlot, size_t numBytesTransferred)
+    {
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        m_activeReads_ByteCount += numBytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::steady_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        if (fileReadInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex)
+        {
+            m_registeredBuffers_available.push_back(fileReadInfo.m_registeredBufferIndex);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const u64 requiredBytes = fileReadInfo.m_copyBackOffset + readCommand->m_size;
+        if (result > 0)
+        {
+            fileReadInfo.m_bytesRead += aznumeric_cast<u64>(result);
+            // Reads can return fewer bytes than requested without reaching the end of the file, for instance when interrupted by
+            // a signal or on network file systems. Only a read that returns nothing has reached the end of the file, so keep
+            // reading the remainder into the same slot. If the submission queue is full the request is restarted instead.
+            if (fileReadInfo.m_bytesRead < requiredBytes)
+            {
+                if (io_uring_sqe* entry = m_ring.GetSubmissionEntry(); entry)
+                {
+                    PrepareReadEntry(*entry, readSlot);
+                    return true;
+                }
+                ReleaseReadSlot(readSlot, aznumeric_cast<size_t>(fileReadInfo.m_bytesRead));
+                m_pendingReadRequests.push_front(fileReadInfo.m_request);
+                fileReadInfo.Clear();
+                return false;
+            }
+        }
+
+        const size_t numBytesTransferred = aznumeric_cast<size_t>(fileReadInfo.m_bytesRead);
+        ReleaseReadSlot(readSlot, numBytesTransferred);
+
+        if (result == -EINVAL && fileReadInfo.m_isDirect)
+        {
+            // The file system accepted O_DIRECT on open but rejected the read, usually because it requires a larger alignment
+            // than the configured sector sizes. Switch to buffered reads and retry the request.
+            AZ_Warning("StorageDriveLinux", !m_constructionOptions.m_enableUnbufferedReads,
+                "Direct reads were rejected for '%s'. Switching %s to buffered reads.\n",
+                AZStd::get<Requests::ReadData>(fileReadInfo.m_request->GetCommand()).m_path.GetRelativePathCStr(), m_name.c_str());
+            m_constructionOptions.m_enableUnbufferedReads = false;
+            m_pendingReadRequests.push_front(fileReadInfo.m_request);
+            fileReadInfo.Clear();
+            return false;
+        }
+
+        const bool isCanceled = result == -ECANCELED;
+        const bool isSuccess = result >= 0 && requiredBytes <= numBytesTransferred;
+        AZ_Error("StorageDriveLinux", result >= 0 || isCanceled, "Async file read of '%s' completed with error %i.\n",
+            readCommand->m_path.GetRelativePathCStr(), -result);
+
+        if (isSuccess)
+        {
+            const u8* stagingBuffer = nullptr;
+            if (fileReadInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex)
+            {
+                stagingBuffer = reinterpret_cast<const u8*>(m_registeredBufferMemory) + fileReadInfo.m_registeredBufferIndex * m_registeredBufferSize;
+            }
+            else if (fileReadInfo.m_sectorAlignedOutput)
+            {
+                stagingBuffer = reinterpret_cast<const u8*>(fileReadInfo.m_sectorAlignedOutput);
+            }
+            if (stagingBuffer)
+            {
+                ::memcpy(readCommand->m_output, stagingBuffer + fileReadInfo.m_copyBackOffset, readCommand->m_size);
+            }
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+        fileReadInfo.Clear();
+        return false;
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::steady_clock::time_point oldest = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot() const
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    u32 StorageDriveLinux::ClaimRegisteredBuffer()
+    {
+        AZ_Assert(!m_registeredBuffers_available.empty(), "Claiming a registered buffer while none are available.");
+        u32 index = m_registeredBuffers_available.back();
+        m_registeredBuffers_available.pop_back();
+        return index;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed in megabytes per second this drive achieved. This is the maximum achievable speed for reading from "
+                "disk. If this is lower than expected it may indicate that there's an overhead from the operating system, the drive has "
+                "seen a lot of use or other applications are using the same drive. Disabling unbuffered reads through the Settings "
+                "Registry can increase the read speeds as the operating system can cache files, but this will typically only accelerate "
+                "files that are read multiple times and will be slower for the first read. Artificial tests can therefore be misleading "
+                "if the same files are repeatedly loaded."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes. If this is value is often negative then increasing the over-commit value, but keep in mind that too many "
+                "over-committed reduces the ability of scheduler to order requests."));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage(), m_fileSwitchPercentageStat.GetMinimum(),
+                m_fileSwitchPercentageStat.GetMaximum(),
+                "The percentage of file requests that required switching to a different file. When running from loose file this should be "
+                "close to 100% as that would indicate mostly full file reads. When running from archives this should be as close to 0 as "
+                "possible as that would indicate efficiently running from archives."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, SeeksName, m_seekPercentageStat.GetAverage(), m_seekPercentageStat.GetMinimum(), m_seekPercentageStat.GetMaximum(),
+                "The percentage of file reads that required seeking within a file. For loose files this should be lose to zero to indicate "
+                "no partial file reads. For archives this value is typically high, which is not a problem, but lower values indicate more "
+                "efficient scheduling and archive layout which will result in better hardware cache utilization."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage(), m_directReadsPercentageStat.GetMinimum(),
+                m_directReadsPercentageStat.GetMaximum(),
+                "The percentage of reads that did not require any additional aligning. If this number isn't close to 100 percent "
+                "performance will suffer as reads need to be staged in an intermediate buffer. The best way to avoid this is by adding a "
+                "block cache and/or read splitter in front of this node."));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max file handles", m_maxFileHandles,
+                "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                "that can be in use at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                "The maximum number of meta data like file sizes this drive node will cache."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Physical sector size", m_physicalSectorSize,
+                "The sector size used by the hardware. For optimal performance memory alignment and read sizes need to be multiples of "
+                "this value."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Logical sector size", m_logicalSectorSize,
+                "The sector size used by the operating system. This is typically the same or smaller than the physical sector size. If "
+                "the physical sector size alignment can't be met, this is the next best size to align to."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Queue depth", m_queueDepth, "The maximum number of reads that are kept in flight in the io_uring queue."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Overcommit", m_overCommit,
+                "The number of additional requests this node will accept. Higher numbers means that drives don't have to wait for the "
+                "scheduler to provide new request to process and the next request can immediately start reading. If this value is too "
+                "high though it will negatively impact the scheduler's ability to order and prioritize requests, which can lead to "
+                "poorer hardware and software cache performance and slower cancellations, among others."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Registered buffers", m_registeredBufferCount,
+                "The number of staging buffers that are registered with io_uring. Unaligned direct reads are staged in these buffers."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Registered buffer size", m_registeredBufferSize,
+                "The size of a single registered staging buffer. Unaligned reads that are larger use a temporary allocation."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                "Whether or not the hardware has a penalty for seeking. This refers to drives that need to physically position a read "
+                "head to retrieve data, which can cause additional seek times for non-consecutive reads. This does not refer to seeks "
+                "impacting hardware cache performance."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Unbuffered reads enabled", m_constructionOptions.m_enableUnbufferedReads,
+                "Whether or not this drive will use the operating system's page cache (buffered) or not (unbuffered, O_DIRECT). Buffered "
+                "reads are beneficial when reading the same file frequently, which happens during development. Unbuffered typically is "
+                "faster when reading the initial file as there's much less the operating system has to do, but subsequential reads are "
+                "slower."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Minimal reporting", m_constructionOptions.m_minimalReporting,
+                "Whether or not this node only reports issues or reports all information."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        data.m_output.push_back(
+                            Statistic::CreatePersistentString(m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
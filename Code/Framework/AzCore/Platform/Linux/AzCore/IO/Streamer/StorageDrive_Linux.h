@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    //! Storage drive for Linux that keeps many reads in flight through io_uring. Reads can optionally bypass the
+    //! page cache with O_DIRECT, in which case unaligned reads are staged in buffers that are registered with the kernel
+    //! up front to avoid per-request mapping costs.
+    //! Like the generic StorageDrive this entry is designed as a catch-all and should be the last entry in the stack.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use O_DIRECT reads to bypass the Linux page cache. This results in a faster read the first time a file is read,
+            //! but subsequent reads will possibly be slower as those could have been serviced from the page cache. Direct
+            //! reads have alignment restrictions. Unaligned reads are staged through registered buffers.
+            //! If the file system doesn't support O_DIRECT, buffered reads are used instead.
+            u8 m_enableUnbufferedReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntries The maximum number of files to keep meta data, such as the file size, to cache.
+        //!     This needs to be a power of 2.
+        //! @param physicalSectorSize The sector size used by the device. When unbuffered reads are used the output buffer
+        //!     needs to be aligned to this value.
+        //! @param logicalSectorSize The sector size used by the operating system. When unbuffered reads are used the
+        //!     read size and read offset need to be aligned to this value.
+        //! @param queueDepth The maximum number of reads that are kept in flight in the io_uring submission queue.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. A negative value will under-commit.
+        //! @param registeredBufferCount The number of sector aligned staging buffers that are registered with the kernel.
+        //! @param registeredBufferSize The size of a single registered staging buffer. Unaligned reads that don't fit in a
+        //!     staging buffer will use a temporary allocation instead.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize,
+            u32 queueDepth, s32 overCommit, u32 registeredBufferCount, size_t registeredBufferSize, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        //! Returns true if the running kernel supports the io_uring features this drive needs and allows a ring large
+        //! enough for the given queue depth.
+        static bool IsSupported(u32 queueDepth);
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr u32 InvalidRegisteredBufferIndex = std::numeric_limits<u32>::max();
+        //! Set in the io_uring user data of cancellation entries so their completions can be told apart from reads.
+        inline static constexpr u64 CancelUserDataFlag = u64{ 1 } << 63;
+        inline static constexpr u32 DefaultQueueDepth = 32;
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr }; // Internally allocated buffer that is sector aligned.
+            u8* m_output{ nullptr }; // Buffer the kernel reads into, either the request's output or a staging buffer.
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            u64 m_bytesRead{ 0 }; // Bytes read so far, reads that come up short are resubmitted for the remainder.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u32 m_registeredBufferIndex{ InvalidRegisteredBufferIndex };
+            bool m_isDirect{ false };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        enum class ReadResult
+        {
+            Queued,
+            Completed,
+            Delayed
+        };
+
+        static u32 CalculateRingEntryCount(u32 queueDepth);
+        bool InitializeRing();
+        //! Inserts a generic StorageDrive after this entry and forwards all future reads to it.
+        void FallBackToStorageDrive();
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, const Requests::ReadData& data);
+        ReadResult ReadRequest(FileRequest* request);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot() const;
+        u32 ClaimRegisteredBuffer();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void CloseFileHandle(size_t cacheIndex);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        //! Returns true if the read came up short and the remainder has been queued for submission.
+        bool FinalizeSingleRequest(size_t readSlot, s32 result);
+        //! Fills in a submission entry that reads the part of the read slot that hasn't been read yet.
+        void PrepareReadEntry(io_uring_sqe& entry, size_t readSlot) const;
+        void ReleaseReadSlot(size_t readSlot, size_t numBytesTransferred);
+        //! Takes back the reads that were queued but couldn't be submitted to the kernel and completes them as failed.
+        void FailUnsubmittedReads();
+        //! Cancels all in-flight reads and waits for the kernel to complete them so the ring can be safely torn down.
+        void CancelAndDrainReads();
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isDirect;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        //! Single allocation that backs all registered staging buffers.
+        void* m_registeredBufferMemory{ nullptr };
+        AZStd::vector<u32> m_registeredBuffers_available;
+
+        IoUring m_ring;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_registeredBufferSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        u32 m_registeredBufferCount{ 0 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+        bool m_ringFailed{ false };
+    };
+} // namespace AZ::IO
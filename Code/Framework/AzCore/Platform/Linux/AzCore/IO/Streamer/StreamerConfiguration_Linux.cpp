@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace AZ::IO
+{
+    using SysfsPath = AZStd::fixed_string<256>;
+
+    static size_t ReadSysfsValue(const SysfsPath& path)
+    {
+        size_t value = 0;
+        if (FILE* file = ::fopen(path.c_str(), "r"); file)
+        {
+            if (::fscanf(file, "%zu", &value) != 1)
+            {
+                value = 0;
+            }
+            ::fclose(file);
+        }
+        return value;
+    }
+
+    //! Finds the request queue attributes for a block device. Partitions don't have their own queue, in which case the
+    //! queue of the parent device is used.
+    static bool FindSysfsQueue(dev_t device, SysfsPath& queuePath)
+    {
+        struct stat attributes;
+        queuePath = SysfsPath::format("/sys/dev/block/%u:%u/queue", major(device), minor(device));
+        if (::stat(queuePath.c_str(), &attributes) == 0)
+        {
+            return true;
+        }
+        queuePath = SysfsPath::format("/sys/dev/block/%u:%u/../queue", major(device), minor(device));
+        return ::stat(queuePath.c_str(), &attributes) == 0;
+    }
+
+    static bool CollectDriveInfo(dev_t device, HardwareInformation& hardwareInfo, bool reportHardware)
+    {
+        SysfsPath queuePath;
+        if (!FindSysfsQueue(device, queuePath))
+        {
+            if (reportHardware)
+            {
+                AZ_Trace("Streamer", "Skipping device %u:%u because it isn't backed by a block device.\n", major(device), minor(device));
+            }
+            return false;
+        }
+
+        const size_t physicalSectorSize = ReadSysfsValue(SysfsPath::format("%s/physical_block_size", queuePath.c_str()));
+        const size_t logicalSectorSize = ReadSysfsValue(SysfsPath::format("%s/logical_block_size", queuePath.c_str()));
+        // max_sectors_kb is the limit the kernel currently splits requests at, which can be lower than what the hardware allows.
+        const size_t maxTransfer = ReadSysfsValue(SysfsPath::format("%s/max_sectors_kb", queuePath.c_str())) * 1_kib;
+        if (physicalSectorSize == 0 || logicalSectorSize == 0 || maxTransfer == 0)
+        {
+            return false;
+        }
+
+        if (reportHardware)
+        {
+            AZ_Trace(
+                "Streamer",
+                "Block device %u:%u\n"
+                "    Physical sector size: %zu bytes\n"
+                "    Logical sector size: %zu bytes\n"
+                "    Max transfer: %zu bytes\n\n",
+                major(device), minor(device), physicalSectorSize, logicalSectorSize, maxTransfer);
+        }
+
+        hardwareInfo.m_maxPhysicalSectorSize = AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, physicalSectorSize);
+        hardwareInfo.m_maxLogicalSectorSize = AZStd::max(hardwareInfo.m_maxLogicalSectorSize, logicalSectorSize);
+        hardwareInfo.m_maxTransfer = AZStd::max(hardwareInfo.m_maxTransfer, maxTransfer);
+        return true;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool addAllDrives, bool reportHardware)
+    {
+        AZStd::fixed_vector<dev_t, 64> devices;
+        auto AddDevice = [&devices](dev_t device)
+        {
+            if (!devices.full() && AZStd::find(devices.begin(), devices.end(), device) == devices.end())
+            {
+                devices.push_back(device);
+            }
+        };
+
+        struct stat attributes;
+        if (addAllDrives)
+        {
+            if (DIR* blockDevices = ::opendir("/sys/block"); blockDevices)
+            {
+                while (dirent* entry = ::readdir(blockDevices))
+                {
+                    unsigned int deviceMajor = 0;
+                    unsigned int deviceMinor = 0;
+                    if (FILE* file = ::fopen(SysfsPath::format("/sys/block/%s/dev", entry->d_name).c_str(), "r"); file)
+                    {
+                        if (::fscanf(file, "%u:%u", &deviceMajor, &deviceMinor) == 2)
+                        {
+                            AddDevice(makedev(deviceMajor, deviceMinor));
+                        }
+                        ::fclose(file);
+                    }
+                }
+                ::closedir(blockDevices);
+            }
+        }
+        else if (auto settingsRegistry = SettingsRegistry::Get(); settingsRegistry)
+        {
+            // Only look at the devices that hold paths O3DE is using.
+            auto CollectDevice = [&AddDevice, &attributes](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+            {
+                AZ::IO::FixedMaxPath runtimePath;
+                if (visitArgs.m_registry.Get(runtimePath.Native(), visitArgs.m_jsonKeyPath) &&
+                    ::stat(runtimePath.c_str(), &attributes) == 0)
+                {
+                    AddDevice(attributes.st_dev);
+                }
+                return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+            };
+            AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, CollectDevice, SettingsRegistryMergeUtils::FilePathsRootKey);
+        }
+
+        bool foundDrive = false;
+        for (dev_t device : devices)
+        {
+            foundDrive = CollectDriveInfo(device, hardwareInfo, reportHardware) || foundDrive;
+        }
+        if (foundDrive)
+        {
+            const long pageSize = ::sysconf(_SC_PAGESIZE);
+            hardwareInfo.m_maxPageSize = AZStd::max(hardwareInfo.m_maxPageSize, pageSize > 0 ? aznumeric_cast<size_t>(pageSize) : 4_kib);
+            hardwareInfo.m_profile = "Generic";
+        }
+        return foundDrive;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
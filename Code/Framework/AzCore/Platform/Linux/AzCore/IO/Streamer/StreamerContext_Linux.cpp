@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_event = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        AZ_Assert(m_event >= 0, "Failed to create a required eventfd for IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_event >= 0)
+        {
+            ::close(m_event);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_event >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        pollfd event{};
+        event.fd = m_event;
+        event.events = POLLIN;
+        int result;
+        do
+        {
+            result = ::poll(&event, 1, -1);
+        } while (result < 0 && errno == EINTR);
+        AZ_Assert(result > 0, "Unexpected poll result: %i (Error: %i).", result, errno);
+
+        // Reset the event. It's non-blocking so this won't stall if another thread already drained it.
+        eventfd_t value;
+        [[maybe_unused]] int readResult = ::eventfd_read(m_event, &value);
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_event >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_event, 1);
+    }
+
+    int StreamerContextThreadSync::GetEventHandle() const
+    {
+        return m_event;
+    }
+} // namespace AZ::Platform
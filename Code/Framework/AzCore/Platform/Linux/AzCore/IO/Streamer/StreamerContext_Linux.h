@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Synchronization for the Streamer scheduling thread based on an eventfd. Besides being signaled by wake up calls
+    //! from the rest of the engine, the eventfd can be handed to the kernel by stream stack entries that complete work
+    //! asynchronously, such as the io_uring backed storage drive, so the scheduling thread wakes up as soon as a
+    //! completion is posted.
+    class StreamerContextThreadSync
+    {
+    public:
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Returns the eventfd the scheduling thread waits on. Ownership is retained by this object.
+        int GetEventHandle() const;
+
+    private:
+        int m_event{ -1 };
+    };
+} // namespace AZ::Platform
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UserTypes.h"
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace UnitTest
+{
+    using namespace UnitTestInternal;
+
+    namespace FlatHashedInternal
+    {
+        //! Hashes every key to the same value so every lookup has to probe past all other elements.
+        struct CollidingHash
+        {
+            size_t operator()(int) const { return 42; }
+        };
+
+        struct TransparentStringHash
+        {
+            using is_transparent = void;
+            size_t operator()(AZStd::string_view value) const { return AZStd::hash<AZStd::string_view>{}(value); }
+        };
+
+        struct TransparentStringEqual
+        {
+            using is_transparent = void;
+            bool operator()(AZStd::string_view lhs, AZStd::string_view rhs) const { return lhs == rhs; }
+        };
+    }
+
+    class FlatHashedContainers
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(FlatHashedContainers, FlatHashSet_DefaultConstructed_IsEmptyWithoutAllocating)
+    {
+        AZStd::flat_hash_set<int> set;
+        EXPECT_TRUE(set.empty());
+        EXPECT_EQ(0, set.capacity());
+        EXPECT_EQ(set.begin(), set.end());
+        EXPECT_FALSE(set.contains(1));
+        EXPECT_EQ(set.end(), set.find(1));
+        EXPECT_EQ(0, set.erase(1));
+        EXPECT_TRUE(set.validate());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashSet_InsertFindErase_Works)
+    {
+        AZStd::flat_hash_set<int> set;
+        constexpr int count = 1000;
+        for (int i = 0; i < count; ++i)
+        {
+            auto result = set.insert(i);
+            EXPECT_TRUE(result.second);
+            EXPECT_EQ(i, *result.first);
+        }
+        EXPECT_EQ(count, set.size());
+        EXPECT_TRUE(set.validate());
+        EXPECT_FALSE(set.insert(5).second);
+        EXPECT_EQ(count, set.size());
+
+        for (int i = 0; i < count; ++i)
+        {
+            EXPECT_TRUE(set.contains(i));
+            EXPECT_EQ(1, set.count(i));
+        }
+        EXPECT_FALSE(set.contains(count));
+
+        for (int i = 0; i < count; i += 2)
+        {
+            EXPECT_EQ(1, set.erase(i));
+        }
+        EXPECT_EQ(count / 2, set.size());
+        EXPECT_TRUE(set.validate());
+        for (int i = 0; i < count; ++i)
+        {
+            EXPECT_EQ((i % 2) != 0, set.contains(i));
+        }
+
+        size_t iterated = 0;
+        for (int value : set)
+        {
+            EXPECT_NE(0, value % 2);
+            ++iterated;
+        }
+        EXPECT_EQ(set.size(), iterated);
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashSet_EraseIterator_ReturnsNextElement)
+    {
+        AZStd::flat_hash_set<int> set{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        EXPECT_EQ(10, AZStd::erase_if(set, [](int value) { return value > 5; }) + set.size());
+        EXPECT_EQ(5, set.size());
+
+        auto iter = set.begin();
+        while (iter != set.end())
+        {
+            iter = set.erase(iter);
+        }
+        EXPECT_TRUE(set.empty());
+        EXPECT_TRUE(set.validate());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashSet_ChurnOfInsertAndErase_DoesNotGrowTable)
+    {
+        // Erasing leaves tombstones. Once they fill the table it has to be rehashed in place instead of grown.
+        AZStd::flat_hash_set<int> set;
+        set.reserve(64);
+        const size_t capacity = set.capacity();
+        for (int i = 0; i < 10000; ++i)
+        {
+            set.insert(i);
+            if (i >= 32)
+            {
+                EXPECT_EQ(1, set.erase(i - 32));
+            }
+        }
+        EXPECT_EQ(32, set.size());
+        EXPECT_EQ(capacity, set.capacity());
+        EXPECT_TRUE(set.validate());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashSet_CollidingHashes_AreAllFound)
+    {
+        AZStd::flat_hash_set<int, FlatHashedInternal::CollidingHash> set;
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_TRUE(set.insert(i).second);
+        }
+        for (int i = 0; i < 100; i += 3)
+        {
+            EXPECT_EQ(1, set.erase(i));
+        }
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ((i % 3) != 0, set.contains(i));
+        }
+        EXPECT_TRUE(set.validate());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashSet_ReserveAndRehash_ResizeTable)
+    {
+        AZStd::flat_hash_set<int> set;
+        set.reserve(100);
+        const size_t capacity = set.capacity();
+        EXPECT_GE(capacity * 7 / 8, 100);
+        for (int i = 0; i < 100; ++i)
+        {
+            set.insert(i);
+        }
+        EXPECT_EQ(capacity, set.capacity());
+
+        for (int i = 10; i < 100; ++i)
+        {
+            set.erase(i);
+        }
+        set.rehash(0);
+        EXPECT_LT(set.capacity(), capacity);
+        EXPECT_EQ(10, set.size());
+        EXPECT_TRUE(set.validate());
+
+        set.clear();
+        EXPECT_TRUE(set.empty());
+        EXPECT_NE(0, set.capacity());
+        set.rehash(0);
+        EXPECT_EQ(0, set.capacity());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashSet_CopyAndMove_KeepElements)
+    {
+        AZStd::flat_hash_set<AZStd::string> set{ "one", "two", "three" };
+
+        AZStd::flat_hash_set<AZStd::string> copy(set);
+        EXPECT_EQ(set, copy);
+
+        AZStd::flat_hash_set<AZStd::string> moved(AZStd::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(set, moved);
+
+        copy = moved;
+        EXPECT_EQ(set, copy);
+        moved.insert("four");
+        EXPECT_NE(set, moved);
+
+        set = AZStd::move(moved);
+        EXPECT_EQ(4, set.size());
+        EXPECT_TRUE(set.contains("four"));
+
+        AZStd::swap(set, copy);
+        EXPECT_EQ(3, set.size());
+        EXPECT_EQ(4, copy.size());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_BracketAndAt_Works)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map[i] = i * 2;
+        }
+        EXPECT_EQ(100, map.size());
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(i * 2, map.at(i));
+        }
+        map[5] += 1;
+        EXPECT_EQ(11, map.at(5));
+        EXPECT_EQ(0, map[1000]);
+        EXPECT_EQ(101, map.size());
+        EXPECT_TRUE(map.validate());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_KeysAreConst_ElementsSurviveRehash)
+    {
+        using map_type = AZStd::flat_hash_map<AZStd::string, int>;
+        static_assert(AZStd::is_same_v<map_type::value_type, AZStd::pair<const AZStd::string, int>>);
+        static_assert(AZStd::is_same_v<decltype(*AZStd::declval<map_type::iterator>()), AZStd::pair<const AZStd::string, int>&>);
+
+        map_type map;
+        for (int i = 0; i < 200; ++i)
+        {
+            map.emplace(AZStd::string::format("key%i", i), i);
+        }
+        for (const auto& [key, value] : map)
+        {
+            EXPECT_EQ(AZStd::string::format("key%i", value), key);
+        }
+        EXPECT_TRUE(map.validate());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_TryEmplaceAndInsertOrAssign_Works)
+    {
+        AZStd::flat_hash_map<int, AZStd::unique_ptr<int>> map;
+        auto result = map.try_emplace(1, AZStd::make_unique<int>(10));
+        EXPECT_TRUE(result.second);
+        EXPECT_EQ(10, *result.first->second);
+
+        // The arguments aren't consumed if the key is already present.
+        auto value = AZStd::make_unique<int>(20);
+        result = map.try_emplace(1, AZStd::move(value));
+        EXPECT_FALSE(result.second);
+        EXPECT_NE(nullptr, value);
+        EXPECT_EQ(10, *map[1]);
+
+        result = map.insert_or_assign(1, AZStd::move(value));
+        EXPECT_FALSE(result.second);
+        EXPECT_EQ(20, *map[1]);
+        result = map.insert_or_assign(2, AZStd::make_unique<int>(30));
+        EXPECT_TRUE(result.second);
+        EXPECT_EQ(30, *map[2]);
+
+        // Move only values have to survive growing the table.
+        for (int i = 3; i < 200; ++i)
+        {
+            map.try_emplace(i, AZStd::make_unique<int>(i));
+        }
+        for (int i = 3; i < 200; ++i)
+        {
+            EXPECT_EQ(i, *map.at(i));
+        }
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_NonTrivialValues_AreDestroyed)
+    {
+        AZStd::flat_hash_map<int, MyClass> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, MyClass(i));
+        }
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(i, map.at(i).m_data);
+        }
+        map.erase(map.begin(), map.end());
+        EXPECT_TRUE(map.empty());
+
+        AZStd::flat_hash_map<AZStd::string, AZStd::vector<int>> vectors;
+        vectors["a"].push_back(1);
+        vectors["b"].push_back(2);
+        vectors["a"].push_back(3);
+        EXPECT_EQ(2, vectors["a"].size());
+        EXPECT_EQ(1, vectors["b"].size());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_TransparentLookup_DoesNotConstructKey)
+    {
+        AZStd::flat_hash_map<AZStd::string, int, FlatHashedInternal::TransparentStringHash, FlatHashedInternal::TransparentStringEqual> map;
+        map.emplace("hello", 1);
+        map.emplace("world", 2);
+
+        constexpr AZStd::string_view key = "world";
+        auto found = map.find(key);
+        ASSERT_NE(map.end(), found);
+        EXPECT_EQ(2, found->second);
+        EXPECT_TRUE(map.contains(AZStd::string_view("hello")));
+        EXPECT_EQ(1, map.erase(AZStd::string_view("hello")));
+        EXPECT_FALSE(map.contains(AZStd::string_view("hello")));
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_MatchesUnorderedSet_UnderRandomOperations)
+    {
+        AZStd::flat_hash_map<uint32_t, uint32_t> map;
+        AZStd::unordered_set<uint32_t> reference;
+        uint32_t seed = 1234;
+        for (int i = 0; i < 20000; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const uint32_t key = (seed >> 8) % 2048;
+            if ((seed & 3) == 0)
+            {
+                EXPECT_EQ(reference.erase(key), map.erase(key));
+            }
+            else
+            {
+                EXPECT_EQ(reference.insert(key).second, map.emplace(key, key).second);
+            }
+        }
+        EXPECT_EQ(reference.size(), map.size());
+        for (const auto& element : map)
+        {
+            EXPECT_EQ(1, reference.count(element.first));
+            EXPECT_EQ(element.first, element.second);
+        }
+        EXPECT_TRUE(map.validate());
+    }
+} // namespace UnitTest
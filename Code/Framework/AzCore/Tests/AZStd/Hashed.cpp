@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/ranges/transform_view.h>
 #include <AzCore/std/string/string.h>
@@ -2333,6 +2334,30 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
 #endif
 } // namespace UnitTest
 
@@ -2436,5 +2461,113 @@ namespace Benchmark
     }
     BENCHMARK(BM_UnorderedMap_InsertDuplicatesViaBracket);
 
+    using FlatHashMap = AZStd::flat_hash_map<int, A>;
+
+    // BM_FlatHashMap_InsertXXX: the same as the BM_UnorderedMap benchmarks, to compare the open addressing map against the node based one
+    static void BM_FlatHashMap_InsertUniqueViaInsert(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map.insert(make_pair(mapKey, A{})).first->second;
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertUniqueViaInsert);
+
+    static void BM_FlatHashMap_InsertUniqueViaBracket(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map[mapKey];
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertUniqueViaBracket);
+
+    static void BM_FlatHashMap_InsertDuplicatesViaBracket(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map[mapKey % kModuloForDuplicates];
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertDuplicatesViaBracket);
+
+    // BM_XXX_FindHit/FindMiss/Iterate: lookups and iteration in maps of growing size, so the effect of the maps falling out of cache shows
+    template<class Map>
+    static void FillForLookup(Map& map, int64_t count)
+    {
+        map.reserve(static_cast<size_t>(count));
+        for (int mapKey = 0; mapKey < count; ++mapKey)
+        {
+            // Spread the keys, so the hashes aren't sequential.
+            map[mapKey * 7919].m_int = mapKey;
+        }
+    }
+
+    template<class Map>
+    static void BM_Map_FindHit(::benchmark::State& state)
+    {
+        Map map;
+        const int count = static_cast<int>(state.range(0));
+        FillForLookup(map, count);
+        int mapKey = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ::benchmark::DoNotOptimize(map.find(mapKey * 7919));
+            mapKey = (mapKey + 1) % count;
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_Map_FindHit, UnorderedMap)->RangeMultiplier(8)->Range(64, 256 * 1024);
+    BENCHMARK_TEMPLATE(BM_Map_FindHit, FlatHashMap)->RangeMultiplier(8)->Range(64, 256 * 1024);
+
+    template<class Map>
+    static void BM_Map_FindMiss(::benchmark::State& state)
+    {
+        Map map;
+        const int count = static_cast<int>(state.range(0));
+        FillForLookup(map, count);
+        int mapKey = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ::benchmark::DoNotOptimize(map.find(mapKey * 7919 + 1));
+            mapKey = (mapKey + 1) % count;
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_Map_FindMiss, UnorderedMap)->RangeMultiplier(8)->Range(64, 256 * 1024);
+    BENCHMARK_TEMPLATE(BM_Map_FindMiss, FlatHashMap)->RangeMultiplier(8)->Range(64, 256 * 1024);
+
+    template<class Map>
+    static void BM_Map_Iterate(::benchmark::State& state)
+    {
+        Map map;
+        FillForLookup(map, state.range(0));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            int sum = 0;
+            for (const auto& element : map)
+            {
+                sum += element.second.m_int;
+            }
+            ::benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_TEMPLATE(BM_Map_Iterate, UnorderedMap)->RangeMultiplier(8)->Range(64, 256 * 1024);
+    BENCHMARK_TEMPLATE(BM_Map_Iterate, FlatHashMap)->RangeMultiplier(8)->Range(64, 256 * 1024);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
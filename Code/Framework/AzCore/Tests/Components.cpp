@@ -12,6 +12,7 @@
 #include <AzCore/Math/Sfmt.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/DependencySortCache.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/EntityUtils.h>
 
@@ -1052,6 +1053,98 @@ namespace UnitTest
         EXPECT_EQ(Entity::DependencySortResult::HasIncompatibleServices, m_entity->EvaluateDependencies());
     }
 
+    TEST_F(ComponentDependency, DependencySortCache_EntitiesWithSameComponents_ShareOrder)
+    {
+        DependencySortCache cache;
+        Entity secondEntity;
+        for (Entity* entity : { m_entity, &secondEntity })
+        {
+            entity->CreateComponent<ComponentA>();
+            entity->CreateComponent<ComponentB>();
+            entity->CreateComponent<ComponentC>();
+            entity->CreateComponent<ComponentD>();
+            entity->CreateComponent<ComponentE>();
+            EXPECT_TRUE(entity->EvaluateDependenciesGetDetails(cache).IsSuccess());
+
+            const Entity::ComponentArrayType& components = entity->GetComponents();
+            ASSERT_EQ(5, components.size());
+            EXPECT_TRUE(components[0]->RTTI_IsTypeOf(AzTypeInfo<ComponentA>::Uuid()));
+            EXPECT_TRUE(components[1]->RTTI_IsTypeOf(AzTypeInfo<ComponentD>::Uuid()));
+            EXPECT_TRUE(components[2]->RTTI_IsTypeOf(AzTypeInfo<ComponentE>::Uuid()));
+            EXPECT_TRUE(components[3]->RTTI_IsTypeOf(AzTypeInfo<ComponentB>::Uuid()));
+            EXPECT_TRUE(components[4]->RTTI_IsTypeOf(AzTypeInfo<ComponentC>::Uuid()));
+        }
+        EXPECT_EQ(1, cache.GetSize());
+    }
+
+    TEST_F(ComponentDependency, DependencySortCache_ServicesChanged_SortsAgain)
+    {
+        DependencySortCache cache;
+        CreateComponents_ABCDE();
+        EXPECT_TRUE(m_entity->EvaluateDependenciesGetDetails(cache).IsSuccess());
+
+        // The services are part of the key, so the stored order isn't reused even though the types are the same
+        m_descriptorComponentA->m_isDependent = true; // now A should depend on D
+        m_entity->InvalidateDependencies();
+        EXPECT_TRUE(m_entity->EvaluateDependenciesGetDetails(cache).IsSuccess());
+        EXPECT_EQ(2, cache.GetSize());
+
+        const Entity::ComponentArrayType& components = m_entity->GetComponents();
+        EXPECT_TRUE(components[0]->RTTI_IsTypeOf(AzTypeInfo<ComponentD>::Uuid()));
+        EXPECT_TRUE(components[1]->RTTI_IsTypeOf(AzTypeInfo<ComponentA>::Uuid()));
+        EXPECT_TRUE(components[2]->RTTI_IsTypeOf(AzTypeInfo<ComponentE>::Uuid()));
+        EXPECT_TRUE(components[3]->RTTI_IsTypeOf(AzTypeInfo<ComponentB>::Uuid()));
+        EXPECT_TRUE(components[4]->RTTI_IsTypeOf(AzTypeInfo<ComponentC>::Uuid()));
+    }
+
+    TEST_F(ComponentDependency, DependencySortCache_ClearAll_EmptiedOnNextSort)
+    {
+        DependencySortCache cache;
+        CreateComponents_ABCDE();
+        EXPECT_TRUE(m_entity->EvaluateDependenciesGetDetails(cache).IsSuccess());
+        EXPECT_EQ(1, cache.GetSize());
+
+        // Called whenever a component descriptor is registered or unregistered
+        DependencySortCache::ClearAll();
+        EXPECT_EQ(1, cache.GetSize());
+
+        Entity secondEntity;
+        secondEntity.CreateComponent<ComponentA>();
+        EXPECT_TRUE(secondEntity.EvaluateDependenciesGetDetails(cache).IsSuccess());
+        EXPECT_EQ(1, cache.GetSize());
+    }
+
+    TEST_F(ComponentDependency, DependencySortCache_ComponentsOfSameTypeInDifferentIdOrder_SortedById)
+    {
+        DependencySortCache cache;
+        ComponentP* first = m_entity->CreateComponent<ComponentP>();
+        ComponentP* second = m_entity->CreateComponent<ComponentP>();
+        first->SetId(1);
+        second->SetId(2);
+        EXPECT_TRUE(m_entity->EvaluateDependenciesGetDetails(cache).IsSuccess());
+        EXPECT_EQ(first, m_entity->GetComponents()[0]);
+
+        Entity secondEntity;
+        first = secondEntity.CreateComponent<ComponentP>();
+        second = secondEntity.CreateComponent<ComponentP>();
+        first->SetId(2);
+        second->SetId(1);
+        EXPECT_TRUE(secondEntity.EvaluateDependenciesGetDetails(cache).IsSuccess());
+        EXPECT_EQ(second, secondEntity.GetComponents()[0]);
+    }
+
+    TEST_F(ComponentDependency, DependencySortCache_FailedSort_IsNotStored)
+    {
+        DependencySortCache cache;
+        m_entity->CreateComponent<ComponentO>();
+        m_entity->CreateComponent<ComponentO>();
+
+        Entity::DependencySortOutcome outcome = m_entity->EvaluateDependenciesGetDetails(cache);
+        ASSERT_FALSE(outcome.IsSuccess());
+        EXPECT_EQ(Entity::DependencySortResult::HasIncompatibleServices, outcome.GetError().m_code);
+        EXPECT_EQ(0, cache.GetSize());
+    }
+
     /**
      * UserSettingsComponent test
      */
@@ -2053,5 +2146,75 @@ namespace Benchmark
 
     BENCHMARK(BM_ComponentDependencySort)->Arg(6)->Arg(60);
 
+    // Activates many entities that hold the same components, like the clones of a prefab entity that are spawned together.
+    static void BM_ComponentDependencySort_PrototypeInstances(::benchmark::State& state, bool useCache)
+    {
+        // descriptors are cleaned up when ComponentApplication shuts down
+        aznew UnitTest::ComponentADescriptor;
+        aznew UnitTest::ComponentB::DescriptorType;
+        aznew UnitTest::ComponentC::DescriptorType;
+        aznew UnitTest::ComponentD::DescriptorType;
+        aznew UnitTest::ComponentE::DescriptorType;
+        aznew UnitTest::ComponentE2::DescriptorType;
+
+        ComponentApplication componentApp;
+
+        ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+        AZ::ComponentApplication::StartupParameters startupParameters;
+        startupParameters.m_loadSettingsRegistry = false;
+        Entity* systemEntity = componentApp.Create(desc, startupParameters);
+        systemEntity->Init();
+
+        const int64_t instanceCount = state.range(0);
+        AZStd::vector<AZStd::unique_ptr<Entity>> instances;
+        instances.reserve(instanceCount);
+        for (int64_t i = 0; i < instanceCount; ++i)
+        {
+            Entity* instance = aznew Entity();
+            instance->CreateComponent<UnitTest::ComponentE>();
+            instance->CreateComponent<UnitTest::ComponentC>();
+            instance->CreateComponent<UnitTest::ComponentA>();
+            instance->CreateComponent<UnitTest::ComponentE2>();
+            instance->CreateComponent<UnitTest::ComponentB>();
+            instance->CreateComponent<UnitTest::ComponentD>();
+            instances.emplace_back(instance);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            DependencySortCache cache;
+            for (AZStd::unique_ptr<Entity>& instance : instances)
+            {
+                instance->InvalidateDependencies();
+            }
+            state.ResumeTiming();
+
+            for (AZStd::unique_ptr<Entity>& instance : instances)
+            {
+                Entity::DependencySortOutcome outcome = useCache
+                    ? instance->EvaluateDependenciesGetDetails(cache)
+                    : instance->EvaluateDependenciesGetDetails();
+                benchmark::DoNotOptimize(outcome);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * instanceCount);
+
+        instances.clear();
+    }
+
+    static void BM_ComponentDependencySort_PrototypeInstancesWithoutCache(::benchmark::State& state)
+    {
+        BM_ComponentDependencySort_PrototypeInstances(state, false);
+    }
+    BENCHMARK(BM_ComponentDependencySort_PrototypeInstancesWithoutCache)->Arg(1000)->Arg(10000);
+
+    static void BM_ComponentDependencySort_PrototypeInstancesWithCache(::benchmark::State& state)
+    {
+        BM_ComponentDependencySort_PrototypeInstances(state, true);
+    }
+    BENCHMARK(BM_ComponentDependencySort_PrototypeInstancesWithCache)->Arg(1000)->Arg(10000);
+
 } // Benchmark
 #endif // HAVE_BENCHMARK
@@ -0,0 +1,464 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Compression/zstd_dictionary.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/string.h>
+
+namespace UnitTest
+{
+    //! Generates small JSON assets that share their structure but differ in their values, like the material and
+    //! prefab files that make up most of the file count of a typical archive.
+    class ZStdDictionaryCorpus
+    {
+    public:
+        explicit ZStdDictionaryCorpus(AZ::u64 seed = 1234)
+            : m_random(seed)
+        {
+        }
+
+        AZStd::string GenerateMaterial(size_t index)
+        {
+            static constexpr const char* textureNames[] = { "brick", "concrete", "wood_planks", "metal_panel", "fabric", "rock" };
+            const char* textureName = textureNames[m_random.GetRandom() % AZ_ARRAY_SIZE(textureNames)];
+
+            AZStd::string material = AZStd::string::format(
+                "{\n"
+                "    \"description\": \"\",\n"
+                "    \"materialType\": \"Materials/Types/StandardPBR.materialtype\",\n"
+                "    \"materialTypeVersion\": 4,\n"
+                "    \"propertyValues\": {\n"
+                "        \"baseColor.color\": [%.6f, %.6f, %.6f, 1.0],\n"
+                "        \"baseColor.textureMap\": \"Textures/%s_%zu_basecolor.png\",\n"
+                "        \"metallic.factor\": %.3f,\n"
+                "        \"roughness.factor\": %.3f,\n"
+                "        \"normal.textureMap\": \"Textures/%s_%zu_normal.png\",\n"
+                "        \"normal.factor\": %.3f",
+                m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat(), textureName, index,
+                m_random.GetRandomFloat(), m_random.GetRandomFloat(), textureName, index, m_random.GetRandomFloat());
+            if (m_random.GetRandom() % 2)
+            {
+                material += AZStd::string::format(
+                    ",\n"
+                    "        \"occlusion.diffuseTextureMap\": \"Textures/%s_%zu_ao.png\",\n"
+                    "        \"occlusion.diffuseFactor\": %.3f",
+                    textureName, index, m_random.GetRandomFloat());
+            }
+            if (m_random.GetRandom() % 3 == 0)
+            {
+                material += AZStd::string::format(
+                    ",\n"
+                    "        \"opacity.mode\": \"Cutout\",\n"
+                    "        \"opacity.factor\": %.3f,\n"
+                    "        \"opacity.alphaSource\": \"Split\"",
+                    m_random.GetRandomFloat());
+            }
+            if (m_random.GetRandom() % 4 == 0)
+            {
+                material += AZStd::string::format(
+                    ",\n"
+                    "        \"emissive.enable\": true,\n"
+                    "        \"emissive.color\": [%.6f, %.6f, %.6f, 1.0],\n"
+                    "        \"emissive.intensity\": %.2f",
+                    m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat(),
+                    m_random.GetRandomFloat() * 8.0f);
+            }
+            material += "\n    }\n}\n";
+            return material;
+        }
+
+        AZStd::string GeneratePrefab(size_t index)
+        {
+            AZStd::string prefab = AZStd::string::format(
+                "{\n"
+                "    \"ContainerEntity\": {\n"
+                "        \"Id\": \"ContainerEntity\",\n"
+                "        \"Name\": \"Prop_%zu\",\n"
+                "        \"Components\": {\n",
+                index);
+            const AZ::u32 entityCount = 1 + m_random.GetRandom() % 4;
+            for (AZ::u32 i = 0; i < entityCount; ++i)
+            {
+                prefab += AZStd::string::format(
+                    "            \"Component_[%u]\": {\n"
+                    "                \"$type\": \"{27F1E1A1-8D9D-4C3B-BD3A-AFB9762449C0} TransformComponent\",\n"
+                    "                \"Id\": %u,\n"
+                    "                \"Transform Data\": {\n"
+                    "                    \"Translate\": [%.4f, %.4f, %.4f],\n"
+                    "                    \"Rotate\": [0.0, 0.0, %.4f]\n"
+                    "                }\n"
+                    "            }%s\n",
+                    m_random.GetRandom(), m_random.GetRandom(), m_random.GetRandomFloat() * 512.0f, m_random.GetRandomFloat() * 512.0f,
+                    m_random.GetRandomFloat() * 64.0f, m_random.GetRandomFloat() * 360.0f, i + 1 < entityCount ? "," : "");
+            }
+            prefab += "        }\n    }\n}\n";
+            return prefab;
+        }
+
+        static AZStd::vector<AZStd::span<const AZ::u8>> GetSamples(const AZStd::vector<AZStd::string>& files)
+        {
+            AZStd::vector<AZStd::span<const AZ::u8>> samples;
+            samples.reserve(files.size());
+            for (const AZStd::string& file : files)
+            {
+                samples.emplace_back(reinterpret_cast<const AZ::u8*>(file.data()), file.size());
+            }
+            return samples;
+        }
+
+    private:
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    class ZStdDictionaryTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            ZStdDictionaryCorpus corpus;
+            for (size_t i = 0; i < SampleCount; ++i)
+            {
+                m_materials.push_back(corpus.GenerateMaterial(i));
+                m_prefabs.push_back(corpus.GeneratePrefab(i));
+            }
+        }
+
+        void TearDown() override
+        {
+            m_materials = {};
+            m_prefabs = {};
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::shared_ptr<AZ::ZStdDictionary> TrainMaterialDictionary()
+        {
+            auto trained = AZ::ZStdDictionary::TrainDictionary(ZStdDictionaryCorpus::GetSamples(m_materials), 16 * 1024);
+            EXPECT_TRUE(trained.IsSuccess());
+            return AZStd::make_shared<AZ::ZStdDictionary>(trained.GetValue());
+        }
+
+        static AZStd::vector<AZ::u8> Compress(const AZ::ZStdDictionary& dictionary, const AZStd::string& file)
+        {
+            AZStd::vector<AZ::u8> compressed(AZ::ZStdDictionary::GetMinCompressedBufferSize(file.size()));
+            size_t compressedSize = dictionary.Compress(file.data(), file.size(), compressed.data(), compressed.size());
+            EXPECT_NE(0, compressedSize);
+            compressed.resize(compressedSize);
+            return compressed;
+        }
+
+    protected:
+        static constexpr size_t SampleCount = 500;
+
+        AZStd::vector<AZStd::string> m_materials;
+        AZStd::vector<AZStd::string> m_prefabs;
+    };
+
+    TEST_F(ZStdDictionaryTest, TrainDictionary_NoSamples_Fails)
+    {
+        auto trained = AZ::ZStdDictionary::TrainDictionary({});
+        EXPECT_FALSE(trained.IsSuccess());
+    }
+
+    TEST_F(ZStdDictionaryTest, TrainDictionary_Samples_ReturnsDictionaryWithinCapacity)
+    {
+        constexpr size_t capacity = 16 * 1024;
+        auto trained = AZ::ZStdDictionary::TrainDictionary(ZStdDictionaryCorpus::GetSamples(m_materials), capacity);
+        ASSERT_TRUE(trained.IsSuccess());
+        EXPECT_FALSE(trained.GetValue().empty());
+        EXPECT_LE(trained.GetValue().size(), capacity);
+
+        AZ::ZStdDictionary dictionary(trained.GetValue());
+        EXPECT_TRUE(dictionary.IsValid());
+        EXPECT_NE(0, dictionary.GetDictionaryId());
+    }
+
+    TEST_F(ZStdDictionaryTest, CompressDecompress_SmallFile_RoundTrips)
+    {
+        AZStd::shared_ptr<AZ::ZStdDictionary> dictionary = TrainMaterialDictionary();
+        ASSERT_TRUE(dictionary->IsValid());
+
+        ZStdDictionaryCorpus corpus(42);
+        AZStd::string file = corpus.GenerateMaterial(SampleCount);
+        AZStd::vector<AZ::u8> compressed = Compress(*dictionary, file);
+
+        AZStd::string decompressed;
+        decompressed.resize(file.size());
+        EXPECT_TRUE(dictionary->Decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+        EXPECT_EQ(file, decompressed);
+    }
+
+    TEST_F(ZStdDictionaryTest, Compress_SmallFilesWithDictionary_SmallerThanWithoutDictionary)
+    {
+        AZStd::shared_ptr<AZ::ZStdDictionary> dictionary = TrainMaterialDictionary();
+        ASSERT_TRUE(dictionary->IsValid());
+
+        // Use files the dictionary wasn't trained on.
+        ZStdDictionaryCorpus corpus(42);
+        size_t withDictionary = 0;
+        size_t withoutDictionary = 0;
+        AZStd::vector<AZ::u8> compressed;
+        for (size_t i = 0; i < 32; ++i)
+        {
+            AZStd::string file = corpus.GenerateMaterial(SampleCount + i);
+            withDictionary += Compress(*dictionary, file).size();
+
+            compressed.resize(ZSTD_compressBound(file.size()));
+            size_t result = ZSTD_compress(compressed.data(), compressed.size(), file.data(), file.size(), dictionary->GetCompressionLevel());
+            ASSERT_FALSE(ZSTD_isError(result));
+            withoutDictionary += result;
+        }
+        EXPECT_LT(withDictionary * 2, withoutDictionary);
+    }
+
+    TEST_F(ZStdDictionaryTest, Decompress_WithDifferentDictionary_Fails)
+    {
+        AZStd::shared_ptr<AZ::ZStdDictionary> materialDictionary = TrainMaterialDictionary();
+        auto trained = AZ::ZStdDictionary::TrainDictionary(ZStdDictionaryCorpus::GetSamples(m_prefabs), 16 * 1024);
+        ASSERT_TRUE(trained.IsSuccess());
+        AZ::ZStdDictionary prefabDictionary(trained.GetValue());
+
+        AZStd::vector<AZ::u8> compressed = Compress(*materialDictionary, m_materials[0]);
+        AZStd::string decompressed;
+        decompressed.resize(m_materials[0].size());
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(prefabDictionary.Decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(ZStdDictionaryTest, DictionarySet_SaveAndLoad_RestoresDictionaries)
+    {
+        AZ::ZStdDictionarySet dictionaries;
+        EXPECT_TRUE(dictionaries.TrainDictionary(".azmaterial", ZStdDictionaryCorpus::GetSamples(m_materials), 16 * 1024).IsSuccess());
+        EXPECT_TRUE(dictionaries.TrainDictionary(".prefab", ZStdDictionaryCorpus::GetSamples(m_prefabs), 16 * 1024).IsSuccess());
+        ASSERT_EQ(2, dictionaries.GetDictionaryCount());
+
+        AZStd::vector<AZ::u8> compressed = Compress(*dictionaries.FindDictionary(".prefab"), m_prefabs[7]);
+
+        AZStd::vector<AZ::u8> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&buffer);
+        ASSERT_TRUE(dictionaries.Save(stream));
+
+        stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        AZ::ZStdDictionarySet loaded;
+        auto result = loaded.Load(stream);
+        ASSERT_TRUE(result.IsSuccess()) << result.GetError().c_str();
+        ASSERT_EQ(2, loaded.GetDictionaryCount());
+
+        AZStd::shared_ptr<const AZ::ZStdDictionary> prefabDictionary = loaded.FindDictionaryForFile("Prefabs/Prop_7.PREFAB");
+        ASSERT_NE(nullptr, prefabDictionary);
+        EXPECT_EQ(dictionaries.FindDictionary(".prefab")->GetDictionaryId(), prefabDictionary->GetDictionaryId());
+
+        AZStd::string decompressed;
+        decompressed.resize(m_prefabs[7].size());
+        EXPECT_TRUE(prefabDictionary->Decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()));
+        EXPECT_EQ(m_prefabs[7], decompressed);
+    }
+
+    TEST_F(ZStdDictionaryTest, DictionarySet_LoadTruncatedStream_FailsAndStaysEmpty)
+    {
+        AZ::ZStdDictionarySet dictionaries;
+        EXPECT_TRUE(dictionaries.TrainDictionary(".azmaterial", ZStdDictionaryCorpus::GetSamples(m_materials), 16 * 1024).IsSuccess());
+
+        AZStd::vector<AZ::u8> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&buffer);
+        ASSERT_TRUE(dictionaries.Save(stream));
+        buffer.resize(buffer.size() / 2);
+
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> truncatedStream(&buffer);
+        EXPECT_FALSE(dictionaries.Load(truncatedStream).IsSuccess());
+        EXPECT_EQ(0, dictionaries.GetDictionaryCount());
+    }
+
+    TEST_F(ZStdDictionaryTest, DictionarySet_LoadOversizedHeaders_FailsWithoutAllocating)
+    {
+        auto WriteHeader = [](AZ::IO::GenericStream& stream, AZ::u32 count, AZ::u32 assetTypeLength, AZ::u32 dataSize)
+        {
+            const AZ::u32 version = AZ::ZStdDictionarySet::FileVersion;
+            const AZ::s32 compressionLevel = 3;
+            stream.Write(AZ::ZStdDictionarySet::FileMagic.size(), AZ::ZStdDictionarySet::FileMagic.data());
+            stream.Write(sizeof(version), &version);
+            stream.Write(sizeof(count), &count);
+            stream.Write(sizeof(assetTypeLength), &assetTypeLength);
+            stream.Write(4, ".bin");
+            stream.Write(sizeof(compressionLevel), &compressionLevel);
+            stream.Write(sizeof(dataSize), &dataSize);
+        };
+
+        // Every size below would make Load allocate gigabytes if it was trusted.
+        const AZ::u32 sizes[][3] = { { 0xffffffff, 4, 16 }, { 1, 0xffffffff, 16 }, { 1, 4, 0xffffffff },
+            { 1, 4, AZ::ZStdDictionarySet::MaxDictionarySize + 1 } };
+        for (const auto& [count, assetTypeLength, dataSize] : sizes)
+        {
+            AZStd::vector<AZ::u8> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&buffer);
+            WriteHeader(stream, count, assetTypeLength, dataSize);
+            buffer.resize(buffer.size() + 16);
+            stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+
+            AZ::ZStdDictionarySet dictionaries;
+            EXPECT_FALSE(dictionaries.Load(stream).IsSuccess());
+            EXPECT_EQ(0, dictionaries.GetDictionaryCount());
+        }
+    }
+
+    TEST_F(ZStdDictionaryTest, DictionarySet_GetDictionaryPath_AppendsExtensionToArchivePath)
+    {
+        EXPECT_EQ(AZ::IO::Path("Cache/pc/level.pak.zdict"), AZ::ZStdDictionarySet::GetDictionaryPath("Cache/pc/level.pak"));
+    }
+
+    TEST_F(ZStdDictionaryTest, DictionarySet_FindDictionaryForFrame_ReturnsDictionaryTheFrameWasCompressedWith)
+    {
+        AZ::ZStdDictionarySet dictionaries;
+        EXPECT_TRUE(dictionaries.TrainDictionary(".azmaterial", ZStdDictionaryCorpus::GetSamples(m_materials), 16 * 1024).IsSuccess());
+        EXPECT_TRUE(dictionaries.TrainDictionary(".prefab", ZStdDictionaryCorpus::GetSamples(m_prefabs), 16 * 1024).IsSuccess());
+
+        AZStd::shared_ptr<const AZ::ZStdDictionary> prefabDictionary = dictionaries.FindDictionary(".prefab");
+        AZStd::vector<AZ::u8> compressed = Compress(*prefabDictionary, m_prefabs[3]);
+        EXPECT_EQ(prefabDictionary.get(), dictionaries.FindDictionaryForFrame(compressed.data(), compressed.size()));
+
+        // Frames compressed without a dictionary, or with one the set doesn't have, aren't matched to any dictionary.
+        compressed.resize(ZSTD_compressBound(m_prefabs[3].size()));
+        size_t result = ZSTD_compress(compressed.data(), compressed.size(), m_prefabs[3].data(), m_prefabs[3].size(), 3);
+        ASSERT_FALSE(ZSTD_isError(result));
+        EXPECT_EQ(nullptr, dictionaries.FindDictionaryForFrame(compressed.data(), result));
+
+        AZStd::shared_ptr<AZ::ZStdDictionary> otherDictionary = TrainMaterialDictionary();
+        dictionaries.Clear();
+        dictionaries.AddDictionary(".prefab", prefabDictionary);
+        compressed = Compress(*otherDictionary, m_materials[3]);
+        EXPECT_EQ(nullptr, dictionaries.FindDictionaryForFrame(compressed.data(), compressed.size()));
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Compresses a corpus of small material files, trained on a different set of files of the same type, and reports the
+    //! compression ratio as a counter and the decompression throughput as bytes processed.
+    class ZStdDictionaryBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            ::UnitTest::ZStdDictionaryCorpus corpus;
+            AZStd::vector<AZStd::string> trainingFiles;
+            for (size_t i = 0; i < TrainingFileCount; ++i)
+            {
+                trainingFiles.push_back(corpus.GenerateMaterial(i));
+            }
+            for (size_t i = 0; i < FileCount; ++i)
+            {
+                m_files.push_back(corpus.GenerateMaterial(TrainingFileCount + i));
+                m_uncompressedSize += m_files.back().size();
+            }
+
+            auto trained = AZ::ZStdDictionary::TrainDictionary(::UnitTest::ZStdDictionaryCorpus::GetSamples(trainingFiles), 16 * 1024);
+            if (trained.IsSuccess())
+            {
+                m_dictionary = AZStd::make_unique<AZ::ZStdDictionary>(trained.GetValue());
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_compressedFiles = {};
+            m_files = {};
+            m_dictionary.reset();
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr size_t TrainingFileCount = 1000;
+        static constexpr size_t FileCount = 1000;
+
+        template<class CompressFunc, class DecompressFunc>
+        void Run(::benchmark::State& state, CompressFunc&& compressFunc, DecompressFunc&& decompressFunc)
+        {
+            size_t compressedSize = 0;
+            for (const AZStd::string& file : m_files)
+            {
+                AZStd::vector<AZ::u8> compressed(ZSTD_compressBound(file.size()));
+                compressed.resize(compressFunc(file, compressed));
+                compressedSize += compressed.size();
+                m_compressedFiles.push_back(AZStd::move(compressed));
+            }
+
+            AZStd::vector<char> output;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t i = 0; i < m_files.size(); ++i)
+                {
+                    output.resize_no_construct(m_files[i].size());
+                    bool result = decompressFunc(m_compressedFiles[i], output);
+                    benchmark::DoNotOptimize(result);
+                }
+            }
+
+            state.SetBytesProcessed(state.iterations() * m_uncompressedSize);
+            state.counters["Ratio"] = static_cast<double>(m_uncompressedSize) / static_cast<double>(compressedSize);
+        }
+
+        AZStd::vector<AZStd::string> m_files;
+        AZStd::vector<AZStd::vector<AZ::u8>> m_compressedFiles;
+        AZStd::unique_ptr<AZ::ZStdDictionary> m_dictionary;
+        size_t m_uncompressedSize{};
+    };
+
+    BENCHMARK_DEFINE_F(ZStdDictionaryBenchmarkFixture, BM_SmallFiles_WithoutDictionary)(::benchmark::State& state)
+    {
+        ZSTD_CCtx* compressionContext = ZSTD_createCCtx();
+        ZSTD_DCtx* decompressionContext = ZSTD_createDCtx();
+        Run(
+            state,
+            [compressionContext](const AZStd::string& file, AZStd::vector<AZ::u8>& compressed)
+            {
+                return ZSTD_compressCCtx(compressionContext, compressed.data(), compressed.size(), file.data(), file.size(),
+                    AZ::ZStdDictionary::DefaultCompressionLevel);
+            },
+            [decompressionContext](const AZStd::vector<AZ::u8>& compressed, AZStd::vector<char>& output)
+            {
+                return ZSTD_decompressDCtx(decompressionContext, output.data(), output.size(), compressed.data(), compressed.size()) ==
+                    output.size();
+            });
+        ZSTD_freeDCtx(decompressionContext);
+        ZSTD_freeCCtx(compressionContext);
+    }
+    BENCHMARK_REGISTER_F(ZStdDictionaryBenchmarkFixture, BM_SmallFiles_WithoutDictionary);
+
+    BENCHMARK_DEFINE_F(ZStdDictionaryBenchmarkFixture, BM_SmallFiles_WithDictionary)(::benchmark::State& state)
+    {
+        if (!m_dictionary || !m_dictionary->IsValid())
+        {
+            state.SkipWithError("Failed to train dictionary.");
+            return;
+        }
+
+        Run(
+            state,
+            [this](const AZStd::string& file, AZStd::vector<AZ::u8>& compressed)
+            {
+                return m_dictionary->Compress(file.data(), file.size(), compressed.data(), compressed.size());
+            },
+            [this](const AZStd::vector<AZ::u8>& compressed, AZStd::vector<char>& output)
+            {
+                return m_dictionary->Decompress(compressed.data(), compressed.size(), output.data(), output.size());
+            });
+    }
+    BENCHMARK_REGISTER_F(ZStdDictionaryBenchmarkFixture, BM_SmallFiles_WithDictionary);
+} // namespace Benchmark
+#endif
@@ -72,6 +72,69 @@ namespace AZ::Dom::Benchmark
             RunBenchmarkInternal(state, apply);
         }
 
+        //! Generates a prefab-like document with entityCount entities, each with a few components.
+        static Value GenerateLargeTree(int64_t entityCount)
+        {
+            Value root(Type::Object);
+            Value& entities = root["Entities"].SetObject();
+            for (int64_t i = 0; i < entityCount; ++i)
+            {
+                Value entity(Type::Object);
+                entity["Id"] = Value(AZStd::string::format("Entity_[%" PRId64 "]", i), true);
+                entity["Name"] = Value(AZStd::string::format("Entity %" PRId64, i), true);
+                Value& components = entity["Components"].SetObject();
+                for (int component = 0; component < 4; ++component)
+                {
+                    Value componentValue(Type::Object);
+                    componentValue["$type"] = Value("GenericComponentWrapper", false);
+                    componentValue["Id"] = Value(aznumeric_cast<AZ::u64>(i * 4 + component));
+                    Value& translation = componentValue["Translate"].SetArray();
+                    translation.ArrayPushBack(Value(aznumeric_cast<double>(i)));
+                    translation.ArrayPushBack(Value(aznumeric_cast<double>(component)));
+                    translation.ArrayPushBack(Value(0.0));
+                    componentValue["Enabled"] = Value(true);
+                    components.AddMember(AZStd::string::format("Component_[%d]", component), AZStd::move(componentValue));
+                }
+                entities.AddMember(AZStd::string::format("Entity_[%" PRId64 "]", i), AZStd::move(entity));
+            }
+            return root;
+        }
+
+        //! Diffs a large document against a copy with a single edit. If rebuild is set the copy is a deep copy, as if the document
+        //! was serialized again after the edit, so the diff can't rely on shared storage to skip unchanged subtrees.
+        //! If dirtyPath is set, the path of the edit is passed to the diff so only that path is compared.
+        void LargeTreeSmallEdit(benchmark::State& state, bool rebuild, bool dirtyPath)
+        {
+            m_before = GenerateLargeTree(state.range(0));
+            const Path editPath(AZStd::string::format("/Entities/Entity_[%" PRId64 "]/Components/Component_[1]/Translate/2", state.range(0) / 2));
+
+            DeltaPatchGenerationParameters params;
+            if (dirtyPath)
+            {
+                params.m_dirtyPaths.push_back(editPath);
+            }
+
+            double editValue = 0.0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                m_after = rebuild ? Utils::DeepCopy(m_before) : m_before;
+                m_after[editPath] = Value(editValue += 1.0);
+                state.ResumeTiming();
+
+                auto patchInfo = GenerateHierarchicalDeltaPatch(m_before, m_after, params);
+                benchmark::DoNotOptimize(patchInfo);
+
+                // Like an editor, the next edit is made on top of this one.
+                state.PauseTiming();
+                m_before = AZStd::move(m_after);
+                m_after = {};
+                state.ResumeTiming();
+            }
+
+            state.SetItemsProcessed(state.iterations());
+        }
+
     private:
         void RunBenchmarkInternal(benchmark::State& state, bool apply)
         {
@@ -177,4 +240,27 @@ namespace AZ::Dom::Benchmark
         ArrayPrepend(state, true, true);
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomPatchBenchmark, AzDomPatch_Apply_ArrayPrepend)
+
+#define DOM_REGISTER_LARGE_TREE_BENCHMARK(BaseClass, Method)                                                                               \
+    BENCHMARK_REGISTER_F(BaseClass, Method)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(DomPatchBenchmark, AzDomPatch_Generate_LargeTreeSmallEdit_ShallowCopy)(benchmark::State& state)
+    {
+        LargeTreeSmallEdit(state, false, false);
+    }
+    DOM_REGISTER_LARGE_TREE_BENCHMARK(DomPatchBenchmark, AzDomPatch_Generate_LargeTreeSmallEdit_ShallowCopy)
+
+    BENCHMARK_DEFINE_F(DomPatchBenchmark, AzDomPatch_Generate_LargeTreeSmallEdit_Rebuilt)(benchmark::State& state)
+    {
+        LargeTreeSmallEdit(state, true, false);
+    }
+    DOM_REGISTER_LARGE_TREE_BENCHMARK(DomPatchBenchmark, AzDomPatch_Generate_LargeTreeSmallEdit_Rebuilt)
+
+    BENCHMARK_DEFINE_F(DomPatchBenchmark, AzDomPatch_Generate_LargeTreeSmallEdit_RebuiltDirtyPath)(benchmark::State& state)
+    {
+        LargeTreeSmallEdit(state, true, true);
+    }
+    DOM_REGISTER_LARGE_TREE_BENCHMARK(DomPatchBenchmark, AzDomPatch_Generate_LargeTreeSmallEdit_RebuiltDirtyPath)
+
+#undef DOM_REGISTER_LARGE_TREE_BENCHMARK
 } // namespace AZ::Dom::Benchmark
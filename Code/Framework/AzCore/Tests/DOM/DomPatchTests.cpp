@@ -580,4 +580,63 @@ namespace AZ::Dom::Tests
 
         EXPECT_FALSE(info.m_forwardPatches.ContainsNormalizedEntries());
     }
+
+    TEST_F(DomPatchTests, TestPatch_DeepCopyWithSingleChange_OnlyPatchesChange)
+    {
+        m_deltaDataset = Utils::DeepCopy(m_dataset);
+        m_deltaDataset["node"]["int"] = 6;
+
+        PatchUndoRedoInfo info = GenerateAndVerifyDelta();
+        EXPECT_EQ(1, info.m_forwardPatches.Size());
+    }
+
+    TEST_F(DomPatchTests, TestPatch_ChildMutatedThroughKeptReference_PatchesChange)
+    {
+        m_deltaDataset = Utils::DeepCopy(m_dataset);
+        Value& foo = m_deltaDataset["obj"]["foo"];
+        foo = false;
+
+        PatchUndoRedoInfo info = GenerateAndVerifyDelta();
+        EXPECT_EQ(1, info.m_forwardPatches.Size());
+    }
+
+    TEST_F(DomPatchTests, TestPatch_DirtyPaths_OnlyComparesDirtyPaths)
+    {
+        m_deltaDataset["obj"]["foo"] = false;
+        m_deltaDataset["arr"][1] = 42;
+
+        DeltaPatchGenerationParameters params;
+        params.m_dirtyPaths.push_back(Path("/obj/foo"));
+        PatchUndoRedoInfo info = GenerateHierarchicalDeltaPatch(m_dataset, m_deltaDataset, params);
+        ASSERT_EQ(1, info.m_forwardPatches.Size());
+        EXPECT_EQ(Path("/obj/foo"), info.m_forwardPatches.begin()->GetDestinationPath());
+
+        params.m_dirtyPaths.push_back(Path("/arr/1"));
+        info = GenerateHierarchicalDeltaPatch(m_dataset, m_deltaDataset, params);
+        EXPECT_EQ(2, info.m_forwardPatches.Size());
+        auto result = info.m_forwardPatches.Apply(m_dataset);
+        ASSERT_TRUE(result.IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(result.GetValue(), m_deltaDataset));
+    }
+
+    TEST_F(DomPatchTests, TestPatch_DirtyPathsAddedRemovedOrRetyped_ComparesClosestCommonParent)
+    {
+        m_deltaDataset["obj"].RemoveMember("foo");
+        m_deltaDataset["obj"]["baz"] = Value(Type::Array);
+        m_deltaDataset["node"] = Value(Type::Array);
+
+        DeltaPatchGenerationParameters params;
+        params.m_dirtyPaths = { Path("/obj/foo"), Path("/obj/baz/0"), Path("/node/int"), Path("/obj") };
+        PatchUndoRedoInfo info = GenerateHierarchicalDeltaPatch(m_dataset, m_deltaDataset, params);
+
+        auto result = info.m_forwardPatches.Apply(m_dataset);
+        ASSERT_TRUE(result.IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(result.GetValue(), m_deltaDataset));
+        result = info.m_inversePatches.Apply(result.GetValue());
+        ASSERT_TRUE(result.IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(result.GetValue(), m_dataset));
+
+        // The remove of foo, the add of baz and the replacement of node, without duplicates from overlapping dirty paths.
+        EXPECT_EQ(3, info.m_forwardPatches.Size());
+    }
 } // namespace AZ::Dom::Tests
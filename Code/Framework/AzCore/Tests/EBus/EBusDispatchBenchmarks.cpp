@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/EBus/EBusEpochDispatchTraits.h>
+#include <AzCore/EBus/EBusSharedDispatchTraits.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Compares the throughput of concurrent dispatches on buses that only differ in how they lock their handler lists.
+    // The handlers do a trivial amount of work, so the results are dominated by the cost of the dispatch lock itself.
+
+    namespace ConcurrentDispatch
+    {
+        constexpr int HandlerCount = 8;
+
+        class MutexBusEvents : public AZ::EBusTraits
+        {
+        public:
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+            static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+            using MutexType = AZStd::mutex;
+
+            virtual void OnEvent() = 0;
+        };
+
+        class SharedDispatchBusEvents : public AZ::EBusSharedDispatchTraits<SharedDispatchBusEvents>
+        {
+        public:
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+            static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+
+            virtual void OnEvent() = 0;
+        };
+
+        class EpochDispatchBusEvents : public AZ::EBusEpochDispatchTraits<EpochDispatchBusEvents>
+        {
+        public:
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+            static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+
+            virtual void OnEvent() = 0;
+        };
+
+        using MutexBus = AZ::EBus<MutexBusEvents>;
+        using SharedDispatchBus = AZ::EBus<SharedDispatchBusEvents>;
+        using EpochDispatchBus = AZ::EBus<EpochDispatchBusEvents>;
+
+        template<typename Bus>
+        class Handler : public Bus::Handler
+        {
+        public:
+            void OnEvent() override
+            {
+                benchmark::DoNotOptimize(this);
+            }
+        };
+    } // namespace ConcurrentDispatch
+
+    template<typename Bus>
+    static void BM_EBus_ConcurrentBroadcast(::benchmark::State& state)
+    {
+        using HandlerType = ConcurrentDispatch::Handler<Bus>;
+
+        AZStd::unique_ptr<HandlerType[]> handlers;
+        if (state.thread_index() == 0)
+        {
+            Bus::GetOrCreateContext();
+            handlers = AZStd::make_unique<HandlerType[]>(ConcurrentDispatch::HandlerCount);
+            for (int i = 0; i < ConcurrentDispatch::HandlerCount; ++i)
+            {
+                handlers[i].BusConnect();
+            }
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Bus::Broadcast(&Bus::Events::OnEvent);
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+        {
+            for (int i = 0; i < ConcurrentDispatch::HandlerCount; ++i)
+            {
+                handlers[i].BusDisconnect();
+            }
+        }
+    }
+
+    BENCHMARK_TEMPLATE(BM_EBus_ConcurrentBroadcast, ConcurrentDispatch::MutexBus)->ThreadRange(1, 32)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBus_ConcurrentBroadcast, ConcurrentDispatch::SharedDispatchBus)->ThreadRange(1, 32)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBus_ConcurrentBroadcast, ConcurrentDispatch::EpochDispatchBus)->ThreadRange(1, 32)->UseRealTime();
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
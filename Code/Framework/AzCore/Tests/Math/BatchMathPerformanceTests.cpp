@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <random>
+
+namespace Benchmark
+{
+    //! Each batch benchmark has a matching scalar benchmark over the same data in array of structures layout,
+    //! the items per second counters show the per element throughput of both.
+    class BM_MathBatch
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            m_points.resize(ElementCount);
+            m_aabbs.resize(ElementCount);
+            m_spheres.resize(ElementCount);
+            for (AZStd::vector<float>* components : { &m_x, &m_y, &m_z, &m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ, &m_radius,
+                                                      &m_outX, &m_outY, &m_outZ, &m_outMinX, &m_outMinY, &m_outMinZ, &m_outMaxX, &m_outMaxY, &m_outMaxZ })
+            {
+                components->resize(ElementCount);
+            }
+            m_mask.resize(AZ::BatchMath::GetMaskWordCount(ElementCount));
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> size(0.1f, 5.0f);
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                m_points[i] = AZ::Vector3(position(rng), position(rng), position(rng));
+                m_aabbs[i] = AZ::Aabb::CreateCenterHalfExtents(m_points[i], AZ::Vector3(size(rng), size(rng), size(rng)));
+                m_spheres[i] = AZ::Sphere(m_points[i], size(rng));
+
+                m_x[i] = m_points[i].GetX();
+                m_y[i] = m_points[i].GetY();
+                m_z[i] = m_points[i].GetZ();
+                m_minX[i] = m_aabbs[i].GetMin().GetX();
+                m_minY[i] = m_aabbs[i].GetMin().GetY();
+                m_minZ[i] = m_aabbs[i].GetMin().GetZ();
+                m_maxX[i] = m_aabbs[i].GetMax().GetX();
+                m_maxY[i] = m_aabbs[i].GetMax().GetY();
+                m_maxZ[i] = m_aabbs[i].GetMax().GetZ();
+                m_radius[i] = m_spheres[i].GetRadius();
+            }
+
+            m_transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateFromEulerAnglesDegrees(AZ::Vector3(30.0f, -45.0f, 70.0f)), AZ::Vector3(1.0f, -2.0f, 3.0f));
+            m_frustum = AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.5f, AZ::DegToRad(60.0f), 0.1f, 100.0f));
+        }
+    public:
+        static constexpr size_t ElementCount = 4096;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        AZ::BatchMath::ConstVector3Span GetPoints() const
+        {
+            return { m_x, m_y, m_z };
+        }
+
+        AZ::BatchMath::ConstAabbSpan GetAabbs() const
+        {
+            return { { m_minX, m_minY, m_minZ }, { m_maxX, m_maxY, m_maxZ } };
+        }
+
+        AZStd::vector<AZ::Vector3> m_points;
+        AZStd::vector<AZ::Aabb> m_aabbs;
+        AZStd::vector<AZ::Sphere> m_spheres;
+
+        AZStd::vector<float> m_x, m_y, m_z;
+        AZStd::vector<float> m_minX, m_minY, m_minZ, m_maxX, m_maxY, m_maxZ;
+        AZStd::vector<float> m_radius;
+        AZStd::vector<float> m_outX, m_outY, m_outZ;
+        AZStd::vector<float> m_outMinX, m_outMinY, m_outMinZ, m_outMaxX, m_outMaxY, m_outMaxZ;
+        AZStd::vector<uint32_t> m_mask;
+
+        AZ::Transform m_transform;
+        AZ::Frustum m_frustum;
+
+    private:
+        void internalTearDown()
+        {
+            m_points = {};
+            m_aabbs = {};
+            m_spheres = {};
+            for (AZStd::vector<float>* components : { &m_x, &m_y, &m_z, &m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ, &m_radius,
+                                                      &m_outX, &m_outY, &m_outZ, &m_outMinX, &m_outMinY, &m_outMinZ, &m_outMaxX, &m_outMaxY, &m_outMaxZ })
+            {
+                *components = {};
+            }
+            m_mask = {};
+        }
+    };
+
+    BENCHMARK_F(BM_MathBatch, TransformPoint_Scalar)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Vector3> result(ElementCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                result[i] = m_transform.TransformPoint(m_points[i]);
+            }
+            benchmark::DoNotOptimize(result.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(m_transform, GetPoints(), { m_outX, m_outY, m_outZ });
+            benchmark::DoNotOptimize(m_outX.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, GetTransformedAabb_Scalar)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Aabb> result(ElementCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                result[i] = m_aabbs[i].GetTransformedAabb(m_transform);
+            }
+            benchmark::DoNotOptimize(result.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformAabbs_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::BatchMath::TransformAabbs(
+                m_transform, GetAabbs(), { { m_outMinX, m_outMinY, m_outMinZ }, { m_outMaxX, m_outMaxY, m_outMaxZ } });
+            benchmark::DoNotOptimize(m_outMinX.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsFrustumAabb_Scalar)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t count = 0;
+            for (const AZ::Aabb& aabb : m_aabbs)
+            {
+                count += AZ::ShapeIntersection::Overlaps(m_frustum, aabb) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(count);
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsFrustumAabb_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::BatchMath::OverlapsFrustum(m_frustum, GetAabbs(), m_mask));
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsFrustumSphere_Scalar)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t count = 0;
+            for (const AZ::Sphere& sphere : m_spheres)
+            {
+                count += AZ::ShapeIntersection::Overlaps(m_frustum, sphere) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(count);
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsFrustumSphere_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::BatchMath::OverlapsFrustum(m_frustum, AZ::BatchMath::ConstSphereSpan{ GetPoints(), m_radius }, m_mask));
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsAabbAabb_Scalar)(benchmark::State& state)
+    {
+        const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-50.0f), AZ::Vector3(25.0f));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t count = 0;
+            for (const AZ::Aabb& aabb : m_aabbs)
+            {
+                count += AZ::ShapeIntersection::Overlaps(query, aabb) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(count);
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsAabbAabb_Batch)(benchmark::State& state)
+    {
+        const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-50.0f), AZ::Vector3(25.0f));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::BatchMath::OverlapsAabb(query, GetAabbs(), m_mask));
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+} // namespace Benchmark
+
+#endif
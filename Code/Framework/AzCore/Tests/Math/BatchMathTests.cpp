@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <random>
+
+namespace UnitTest
+{
+    class MATH_BatchMath
+        : public ::testing::Test
+    {
+    protected:
+        // Not a multiple of the simd width and spanning more than one mask word, so both the vector and the scalar paths are covered
+        static constexpr size_t ElementCount = 45;
+
+        void SetUp() override
+        {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+            std::uniform_real_distribution<float> size(0.0f, 4.0f);
+
+            for (AZStd::vector<float>* components : { &m_x, &m_y, &m_z, &m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ, &m_radius })
+            {
+                components->resize(ElementCount);
+            }
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                m_x[i] = position(rng);
+                m_y[i] = position(rng);
+                m_z[i] = position(rng);
+                m_radius[i] = size(rng);
+                m_minX[i] = m_x[i] - size(rng);
+                m_minY[i] = m_y[i] - size(rng);
+                m_minZ[i] = m_z[i] - size(rng);
+                m_maxX[i] = m_x[i] + size(rng);
+                m_maxY[i] = m_y[i] + size(rng);
+                m_maxZ[i] = m_z[i] + size(rng);
+            }
+
+            m_transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateFromEulerAnglesDegrees(AZ::Vector3(30.0f, -45.0f, 70.0f)), AZ::Vector3(1.0f, -2.0f, 3.0f));
+            m_transform.MultiplyByUniformScale(1.5f);
+        }
+
+        AZ::BatchMath::Vector3Span GetPoints()
+        {
+            return { m_x, m_y, m_z };
+        }
+
+        AZ::BatchMath::AabbSpan GetAabbs()
+        {
+            return { { m_minX, m_minY, m_minZ }, { m_maxX, m_maxY, m_maxZ } };
+        }
+
+        AZ::Vector3 GetPoint(size_t index) const
+        {
+            return AZ::Vector3(m_x[index], m_y[index], m_z[index]);
+        }
+
+        AZ::Aabb GetAabb(size_t index) const
+        {
+            return AZ::Aabb::CreateFromMinMaxValues(m_minX[index], m_minY[index], m_minZ[index], m_maxX[index], m_maxY[index], m_maxZ[index]);
+        }
+
+        AZStd::vector<float> m_x, m_y, m_z;
+        AZStd::vector<float> m_minX, m_minY, m_minZ, m_maxX, m_maxY, m_maxZ;
+        AZStd::vector<float> m_radius;
+        AZ::Transform m_transform;
+    };
+
+    TEST_F(MATH_BatchMath, TransformPoints_MatchesTransformPoint)
+    {
+        AZStd::vector<float> x(ElementCount), y(ElementCount), z(ElementCount);
+        AZ::BatchMath::TransformPoints(m_transform, GetPoints(), { x, y, z });
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_THAT(AZ::Vector3(x[i], y[i], z[i]), IsCloseTolerance(m_transform.TransformPoint(GetPoint(i)), 1e-4f));
+        }
+
+        const AZ::Matrix3x4 matrix = AZ::Matrix3x4::CreateFromTransform(m_transform);
+        AZ::BatchMath::TransformPoints(matrix, GetPoints(), { x, y, z });
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_THAT(AZ::Vector3(x[i], y[i], z[i]), IsCloseTolerance(matrix.TransformPoint(GetPoint(i)), 1e-4f));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, TransformVectors_MatchesTransformVector)
+    {
+        AZStd::vector<float> x(ElementCount), y(ElementCount), z(ElementCount);
+        AZ::BatchMath::TransformVectors(m_transform, GetPoints(), { x, y, z });
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_THAT(AZ::Vector3(x[i], y[i], z[i]), IsCloseTolerance(m_transform.TransformVector(GetPoint(i)), 1e-4f));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, TransformPoints_InPlace_MatchesTransformPoint)
+    {
+        AZStd::vector<AZ::Vector3> expected;
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            expected.push_back(m_transform.TransformPoint(GetPoint(i)));
+        }
+
+        AZ::BatchMath::TransformPoints(m_transform, GetPoints(), GetPoints());
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_THAT(GetPoint(i), IsCloseTolerance(expected[i], 1e-4f));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, TransformAabbs_MatchesGetTransformedAabb)
+    {
+        AZStd::vector<AZ::Aabb> expected;
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            expected.push_back(GetAabb(i).GetTransformedAabb(m_transform));
+        }
+
+        // Transformed in place, so this also checks that aliased input and output work
+        AZ::BatchMath::TransformAabbs(m_transform, GetAabbs(), GetAabbs());
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_THAT(GetAabb(i).GetMin(), IsCloseTolerance(expected[i].GetMin(), 1e-4f));
+            EXPECT_THAT(GetAabb(i).GetMax(), IsCloseTolerance(expected[i].GetMax(), 1e-4f));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, OverlapsFrustum_MatchesShapeIntersection)
+    {
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(0.3f), AZ::Vector3(0.0f, -15.0f, 0.0f)),
+            1.5f, AZ::DegToRad(60.0f), 0.1f, 25.0f));
+
+        AZStd::vector<uint32_t> aabbMask(AZ::BatchMath::GetMaskWordCount(ElementCount), 0xFFFFFFFF);
+        AZStd::vector<uint32_t> sphereMask(AZ::BatchMath::GetMaskWordCount(ElementCount), 0xFFFFFFFF);
+        const size_t aabbCount = AZ::BatchMath::OverlapsFrustum(frustum, GetAabbs(), aabbMask);
+        const size_t sphereCount = AZ::BatchMath::OverlapsFrustum(frustum, AZ::BatchMath::SphereSpan{ GetPoints(), m_radius }, sphereMask);
+
+        size_t expectedAabbCount = 0;
+        size_t expectedSphereCount = 0;
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const bool aabbOverlaps = AZ::ShapeIntersection::Overlaps(frustum, GetAabb(i));
+            const bool sphereOverlaps = AZ::ShapeIntersection::Overlaps(frustum, AZ::Sphere(GetPoint(i), m_radius[i]));
+            expectedAabbCount += aabbOverlaps ? 1 : 0;
+            expectedSphereCount += sphereOverlaps ? 1 : 0;
+            EXPECT_EQ(aabbOverlaps, ((aabbMask[i / 32] >> (i % 32)) & 1) != 0) << "Aabb " << i;
+            EXPECT_EQ(sphereOverlaps, ((sphereMask[i / 32] >> (i % 32)) & 1) != 0) << "Sphere " << i;
+        }
+        EXPECT_EQ(expectedAabbCount, aabbCount);
+        EXPECT_EQ(expectedSphereCount, sphereCount);
+        // The test data should have elements on both sides of the frustum
+        EXPECT_GT(aabbCount, 0);
+        EXPECT_LT(aabbCount, ElementCount);
+
+        // Unused bits of the last word are cleared
+        EXPECT_EQ(0, aabbMask.back() >> (ElementCount % 32));
+        EXPECT_EQ(0, sphereMask.back() >> (ElementCount % 32));
+    }
+
+    TEST_F(MATH_BatchMath, OverlapsAabb_MatchesShapeIntersection)
+    {
+        const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-12.0f, -8.0f, -14.0f), AZ::Vector3(9.0f, 12.0f, 6.0f));
+
+        AZStd::vector<uint32_t> mask(AZ::BatchMath::GetMaskWordCount(ElementCount), 0xFFFFFFFF);
+        const size_t count = AZ::BatchMath::OverlapsAabb(aabb, GetAabbs(), mask);
+
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const bool overlaps = AZ::ShapeIntersection::Overlaps(aabb, GetAabb(i));
+            expectedCount += overlaps ? 1 : 0;
+            EXPECT_EQ(overlaps, ((mask[i / 32] >> (i % 32)) & 1) != 0) << "Aabb " << i;
+        }
+        EXPECT_EQ(expectedCount, count);
+        // The test data should have elements inside and outside of the aabb
+        EXPECT_GT(count, 0);
+        EXPECT_LT(count, ElementCount);
+        EXPECT_EQ(0, mask.back() >> (ElementCount % 32));
+
+        // Touching boxes overlap
+        const float touchingMin[3] = { 9.0f, 12.0f, 6.0f };
+        const float touchingMax[3] = { 10.0f, 13.0f, 7.0f };
+        const AZ::BatchMath::ConstAabbSpan touching{ { { &touchingMin[0], 1 }, { &touchingMin[1], 1 }, { &touchingMin[2], 1 } },
+                                                    { { &touchingMax[0], 1 }, { &touchingMax[1], 1 }, { &touchingMax[2], 1 } } };
+        uint32_t touchingMask = 0;
+        EXPECT_EQ(1, AZ::BatchMath::OverlapsAabb(aabb, touching, { &touchingMask, 1 }));
+    }
+
+    TEST_F(MATH_BatchMath, EmptySpans_DoNothing)
+    {
+        AZ::Frustum frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, AZ::DegToRad(60.0f), 0.1f, 10.0f));
+        EXPECT_EQ(0, AZ::BatchMath::OverlapsFrustum(frustum, AZ::BatchMath::ConstAabbSpan{}, {}));
+        AZ::BatchMath::TransformPoints(m_transform, AZ::BatchMath::ConstVector3Span{}, AZ::BatchMath::Vector3Span{});
+    }
+} // namespace UnitTest
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <algorithm>
+#include <random>
+
+namespace Benchmark
+{
+    //! Compares the 4 and 8 wide vector types on the same structure of arrays data, so the gain from the AVX2 backend
+    //! is visible. Matrix and transform multiplies are covered by the per type performance tests.
+    class BM_MathSimd
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif(0.1f, 10.0f);
+
+            for (float* values : { m_x, m_y, m_z })
+            {
+                std::generate(values, values + ElementCount, [&unif, &rng]() { return unif(rng); });
+            }
+        }
+    public:
+        static constexpr size_t ElementCount = 4096;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        // Evaluates the length of each (x, y, z) vector, which is the kind of kernel batch culling and skinning code uses.
+        template<typename VecType>
+        void Length()
+        {
+            for (size_t i = 0; i < ElementCount; i += VecType::ElementCount)
+            {
+                const typename VecType::FloatType x = VecType::LoadAligned(m_x + i);
+                const typename VecType::FloatType y = VecType::LoadAligned(m_y + i);
+                const typename VecType::FloatType z = VecType::LoadAligned(m_z + i);
+                const typename VecType::FloatType lengthSq = VecType::Madd(z, z, VecType::Madd(y, y, VecType::Mul(x, x)));
+                VecType::StoreAligned(m_result + i, VecType::Sqrt(lengthSq));
+            }
+        }
+
+        template<typename VecType>
+        void Polynomial()
+        {
+            const typename VecType::FloatType c0 = VecType::Splat(0.5f);
+            const typename VecType::FloatType c1 = VecType::Splat(-0.25f);
+            const typename VecType::FloatType c2 = VecType::Splat(0.125f);
+            for (size_t i = 0; i < ElementCount; i += VecType::ElementCount)
+            {
+                const typename VecType::FloatType x = VecType::LoadAligned(m_x + i);
+                VecType::StoreAligned(m_result + i, VecType::Madd(VecType::Madd(c2, x, c1), x, c0));
+            }
+        }
+
+        // Vec8 loads require 32 byte alignment
+        alignas(32) float m_x[ElementCount];
+        alignas(32) float m_y[ElementCount];
+        alignas(32) float m_z[ElementCount];
+        alignas(32) float m_result[ElementCount];
+    };
+
+    BENCHMARK_F(BM_MathSimd, Vec4Length)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Length<AZ::Simd::Vec4>();
+            benchmark::DoNotOptimize(m_result);
+        }
+    }
+
+    BENCHMARK_F(BM_MathSimd, Vec8Length)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Length<AZ::Simd::Vec8>();
+            benchmark::DoNotOptimize(m_result);
+        }
+    }
+
+    BENCHMARK_F(BM_MathSimd, Vec4Polynomial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Polynomial<AZ::Simd::Vec4>();
+            benchmark::DoNotOptimize(m_result);
+        }
+    }
+
+    BENCHMARK_F(BM_MathSimd, Vec8Polynomial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Polynomial<AZ::Simd::Vec8>();
+            benchmark::DoNotOptimize(m_result);
+        }
+    }
+}
+
+#endif
@@ -3153,4 +3153,315 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    TEST(MATH_SimdMath, TestVec4MaddMatchesMulAdd)
+    {
+        // With FMA the product isn't rounded before the add, so only require the results to be close
+        alignas(16) const float mul1[4] = { 1.1f, -2.5f, 3.3f, 1.0e-3f };
+        alignas(16) const float mul2[4] = { 4.7f, 0.5f, -6.1f, 1.0e3f };
+        alignas(16) const float add[4] = { 0.25f, 10.0f, 20.0f, -1.0f };
+        alignas(16) float result[4];
+        Simd::Vec4::StoreAligned(result, Simd::Vec4::Madd(Simd::Vec4::LoadAligned(mul1), Simd::Vec4::LoadAligned(mul2), Simd::Vec4::LoadAligned(add)));
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            EXPECT_NEAR(mul1[i] * mul2[i] + add[i], result[i], AZ::Constants::Tolerance);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestMat4x4MultiplyMatchesReference)
+    {
+        alignas(16) float valuesA[16];
+        alignas(16) float valuesB[16];
+        alignas(16) float valuesAdd[16];
+        for (int32_t i = 0; i < 16; ++i)
+        {
+            valuesA[i] = static_cast<float>(i) * 0.5f - 3.0f;
+            valuesB[i] = static_cast<float>(15 - i) * 0.25f + 1.0f;
+            valuesAdd[i] = static_cast<float>(i % 5);
+        }
+
+        Simd::Vec4::FloatType rowsA[4];
+        Simd::Vec4::FloatType rowsB[4];
+        Simd::Vec4::FloatType rowsAdd[4];
+        for (int32_t row = 0; row < 4; ++row)
+        {
+            rowsA[row] = Simd::Vec4::LoadAligned(valuesA + row * 4);
+            rowsB[row] = Simd::Vec4::LoadAligned(valuesB + row * 4);
+            rowsAdd[row] = Simd::Vec4::LoadAligned(valuesAdd + row * 4);
+        }
+
+        Simd::Vec4::FloatType product[4];
+        Simd::Vec4::FloatType productAdd[4];
+        Simd::Vec4::FloatType product3x4[3];
+        Simd::Vec4::Mat4x4Multiply(rowsA, rowsB, product);
+        Simd::Vec4::Mat4x4MultiplyAdd(rowsA, rowsB, rowsAdd, productAdd);
+        Simd::Vec4::Mat3x4Multiply(rowsA, rowsB, product3x4);
+
+        for (int32_t row = 0; row < 4; ++row)
+        {
+            alignas(16) float stored[4];
+            alignas(16) float storedAdd[4];
+            alignas(16) float stored3x4[4];
+            Simd::Vec4::StoreAligned(stored, product[row]);
+            Simd::Vec4::StoreAligned(storedAdd, productAdd[row]);
+            if (row < 3)
+            {
+                Simd::Vec4::StoreAligned(stored3x4, product3x4[row]);
+            }
+            for (int32_t column = 0; column < 4; ++column)
+            {
+                float expected = 0.0f;
+                float expected3x4 = 0.0f;
+                for (int32_t k = 0; k < 4; ++k)
+                {
+                    expected += valuesA[row * 4 + k] * valuesB[k * 4 + column];
+                    // The fourth row of a 3x4 matrix is implicitly (0, 0, 0, 1)
+                    expected3x4 += valuesA[row * 4 + k] * ((k < 3) ? valuesB[k * 4 + column] : (column == 3 ? 1.0f : 0.0f));
+                }
+                EXPECT_NEAR(expected, stored[column], AZ::Constants::Tolerance);
+                EXPECT_NEAR(expected + valuesAdd[row * 4 + column], storedAdd[column], AZ::Constants::Tolerance);
+                if (row < 3)
+                {
+                    EXPECT_NEAR(expected3x4, stored3x4[column], AZ::Constants::Tolerance);
+                }
+            }
+        }
+    }
+
+    class MATH_SimdMathVec8
+        : public ::testing::Test
+    {
+    protected:
+        static constexpr int32_t ElementCount = Simd::Vec8::ElementCount;
+
+        static void Store(Simd::Vec8::FloatArgType value, float* out)
+        {
+            Simd::Vec8::StoreUnaligned(out, value);
+        }
+
+        static void Store(Simd::Vec8::Int32ArgType value, int32_t* out)
+        {
+            Simd::Vec8::StoreUnaligned(out, value);
+        }
+
+        alignas(32) const float m_values1[8] = { 1.5f, -2.25f, 3.0f, -4.75f, 0.0f, 6.5f, -7.5f, 8.25f };
+        alignas(32) const float m_values2[8] = { 2.0f, 0.5f, -3.0f, -4.75f, 1.0f, -6.5f, 2.5f, 9.0f };
+        alignas(32) const float m_values3[8] = { 0.25f, 1.0f, -2.0f, 3.0f, 4.0f, -5.0f, 6.0f, 0.5f };
+    };
+
+    TEST_F(MATH_SimdMathVec8, LoadStore_RoundTrip)
+    {
+        alignas(32) float aligned[8];
+        float unaligned[9];
+        Simd::Vec8::StoreAligned(aligned, Simd::Vec8::LoadAligned(m_values1));
+        Simd::Vec8::StoreUnaligned(unaligned + 1, Simd::Vec8::LoadUnaligned(m_values1));
+
+        alignas(32) const int32_t intValues[8] = { 1, -2, 3, -4, 5, -6, 7, -8 };
+        alignas(32) int32_t intStored[8];
+        Simd::Vec8::StoreAligned(intStored, Simd::Vec8::LoadAligned(intValues));
+
+        for (int32_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_EQ(m_values1[i], aligned[i]);
+            EXPECT_EQ(m_values1[i], unaligned[i + 1]);
+            EXPECT_EQ(intValues[i], intStored[i]);
+        }
+    }
+
+    TEST_F(MATH_SimdMathVec8, ToAndFromVec4_SplitsIntoHalves)
+    {
+        const Simd::Vec8::FloatType value = Simd::Vec8::LoadAligned(m_values1);
+        alignas(16) float low[4];
+        alignas(16) float high[4];
+        Simd::Vec4::StoreAligned(low, Simd::Vec8::ToVec4Low(value));
+        Simd::Vec4::StoreAligned(high, Simd::Vec8::ToVec4High(value));
+
+        float combined[8];
+        Store(Simd::Vec8::FromVec4(Simd::Vec4::LoadAligned(high), Simd::Vec4::LoadAligned(low)), combined);
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(m_values1[i], low[i]);
+            EXPECT_EQ(m_values1[i + 4], high[i]);
+            EXPECT_EQ(m_values1[i + 4], combined[i]);
+            EXPECT_EQ(m_values1[i], combined[i + 4]);
+        }
+    }
+
+    TEST_F(MATH_SimdMathVec8, Arithmetic_MatchesScalar)
+    {
+        const Simd::Vec8::FloatType a = Simd::Vec8::LoadAligned(m_values1);
+        const Simd::Vec8::FloatType b = Simd::Vec8::LoadAligned(m_values2);
+        const Simd::Vec8::FloatType c = Simd::Vec8::LoadAligned(m_values3);
+
+        float add[8], sub[8], mul[8], madd[8], div[8], abs[8], min[8], max[8], clamp[8];
+        Store(Simd::Vec8::Add(a, b), add);
+        Store(Simd::Vec8::Sub(a, b), sub);
+        Store(Simd::Vec8::Mul(a, b), mul);
+        Store(Simd::Vec8::Madd(a, b, c), madd);
+        Store(Simd::Vec8::Div(a, b), div);
+        Store(Simd::Vec8::Abs(a), abs);
+        Store(Simd::Vec8::Min(a, b), min);
+        Store(Simd::Vec8::Max(a, b), max);
+        Store(Simd::Vec8::Clamp(a, Simd::Vec8::Splat(-2.0f), Simd::Vec8::Splat(2.0f)), clamp);
+
+        for (int32_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(m_values1[i] + m_values2[i], add[i]);
+            EXPECT_FLOAT_EQ(m_values1[i] - m_values2[i], sub[i]);
+            EXPECT_FLOAT_EQ(m_values1[i] * m_values2[i], mul[i]);
+            EXPECT_NEAR(m_values1[i] * m_values2[i] + m_values3[i], madd[i], AZ::Constants::Tolerance);
+            EXPECT_FLOAT_EQ(m_values1[i] / m_values2[i], div[i]);
+            EXPECT_FLOAT_EQ(fabsf(m_values1[i]), abs[i]);
+            EXPECT_FLOAT_EQ(AZStd::min(m_values1[i], m_values2[i]), min[i]);
+            EXPECT_FLOAT_EQ(AZStd::max(m_values1[i], m_values2[i]), max[i]);
+            EXPECT_FLOAT_EQ(AZStd::clamp(m_values1[i], -2.0f, 2.0f), clamp[i]);
+        }
+    }
+
+    TEST_F(MATH_SimdMathVec8, Rounding_MatchesScalar)
+    {
+        alignas(32) const float values[8] = { 1.5f, 2.5f, -1.5f, -2.5f, 0.7f, -0.7f, 3.2f, -3.8f };
+        const Simd::Vec8::FloatType value = Simd::Vec8::LoadAligned(values);
+
+        float floor[8], ceil[8], round[8], truncate[8];
+        int32_t convert[8], convertNearest[8];
+        Store(Simd::Vec8::Floor(value), floor);
+        Store(Simd::Vec8::Ceil(value), ceil);
+        Store(Simd::Vec8::Round(value), round);
+        Store(Simd::Vec8::Truncate(value), truncate);
+        Store(Simd::Vec8::ConvertToInt(value), convert);
+        Store(Simd::Vec8::ConvertToIntNearest(value), convertNearest);
+
+        for (int32_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(floorf(values[i]), floor[i]);
+            EXPECT_FLOAT_EQ(ceilf(values[i]), ceil[i]);
+            EXPECT_FLOAT_EQ(nearbyintf(values[i]), round[i]);
+            EXPECT_FLOAT_EQ(truncf(values[i]), truncate[i]);
+            EXPECT_EQ(static_cast<int32_t>(values[i]), convert[i]);
+            EXPECT_EQ(static_cast<int32_t>(nearbyintf(values[i])), convertNearest[i]);
+        }
+    }
+
+    TEST_F(MATH_SimdMathVec8, SqrtAndReciprocal_MatchScalar)
+    {
+        alignas(32) const float values[8] = { 1.0f, 4.0f, 9.0f, 2.0f, 0.25f, 100.0f, 3.0f, 7.5f };
+        const Simd::Vec8::FloatType value = Simd::Vec8::LoadAligned(values);
+
+        float sqrt[8], sqrtEstimate[8], sqrtInv[8], sqrtInvEstimate[8], reciprocal[8], reciprocalEstimate[8];
+        Store(Simd::Vec8::Sqrt(value), sqrt);
+        Store(Simd::Vec8::SqrtEstimate(value), sqrtEstimate);
+        Store(Simd::Vec8::SqrtInv(value), sqrtInv);
+        Store(Simd::Vec8::SqrtInvEstimate(value), sqrtInvEstimate);
+        Store(Simd::Vec8::Reciprocal(value), reciprocal);
+        Store(Simd::Vec8::ReciprocalEstimate(value), reciprocalEstimate);
+
+        for (int32_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(sqrtf(values[i]), sqrt[i]);
+            EXPECT_NEAR(sqrtf(values[i]), sqrtEstimate[i], sqrtf(values[i]) * 0.01f);
+            EXPECT_FLOAT_EQ(1.0f / sqrtf(values[i]), sqrtInv[i]);
+            EXPECT_NEAR(1.0f / sqrtf(values[i]), sqrtInvEstimate[i], 0.01f / sqrtf(values[i]));
+            EXPECT_FLOAT_EQ(1.0f / values[i], reciprocal[i]);
+            EXPECT_NEAR(1.0f / values[i], reciprocalEstimate[i], 0.01f / values[i]);
+        }
+    }
+
+    TEST_F(MATH_SimdMathVec8, CompareAndSelect_MatchScalar)
+    {
+        const Simd::Vec8::FloatType a = Simd::Vec8::LoadAligned(m_values1);
+        const Simd::Vec8::FloatType b = Simd::Vec8::LoadAligned(m_values2);
+
+        const Simd::Vec8::FloatType compares[6] = { Simd::Vec8::CmpEq(a, b), Simd::Vec8::CmpNeq(a, b), Simd::Vec8::CmpGt(a, b),
+            Simd::Vec8::CmpGtEq(a, b), Simd::Vec8::CmpLt(a, b), Simd::Vec8::CmpLtEq(a, b) };
+        for (int32_t compare = 0; compare < 6; ++compare)
+        {
+            float selected[8];
+            Store(Simd::Vec8::Select(a, b, compares[compare]), selected);
+            for (int32_t i = 0; i < ElementCount; ++i)
+            {
+                const float lhs = m_values1[i];
+                const float rhs = m_values2[i];
+                const bool expected[6] = { lhs == rhs, lhs != rhs, lhs > rhs, lhs >= rhs, lhs < rhs, lhs <= rhs };
+                EXPECT_EQ(expected[compare] ? lhs : rhs, selected[i]) << "Compare " << compare << " element " << i;
+            }
+        }
+
+        EXPECT_TRUE(Simd::Vec8::CmpAllEq(a, a));
+        EXPECT_FALSE(Simd::Vec8::CmpAllEq(a, b));
+        EXPECT_TRUE(Simd::Vec8::CmpAllLt(a, Simd::Vec8::Add(a, Simd::Vec8::Splat(1.0f))));
+        EXPECT_TRUE(Simd::Vec8::CmpAllLtEq(a, a));
+        EXPECT_TRUE(Simd::Vec8::CmpAllGt(Simd::Vec8::Add(a, Simd::Vec8::Splat(1.0f)), a));
+        EXPECT_TRUE(Simd::Vec8::CmpAllGtEq(a, a));
+        // Only the last element differs, so this also checks that the upper half is compared
+        alignas(32) float almostEqual[8];
+        Simd::Vec8::StoreAligned(almostEqual, a);
+        almostEqual[7] += 1.0f;
+        EXPECT_FALSE(Simd::Vec8::CmpAllEq(a, Simd::Vec8::LoadAligned(almostEqual)));
+    }
+
+    TEST_F(MATH_SimdMathVec8, IntegerOps_MatchScalar)
+    {
+        alignas(32) const int32_t values1[8] = { 1, -2, 3, -4, 5, -6, 7, 100000 };
+        alignas(32) const int32_t values2[8] = { 8, 7, -6, -4, 4, 3, -2, 3 };
+        const Simd::Vec8::Int32Type a = Simd::Vec8::LoadAligned(values1);
+        const Simd::Vec8::Int32Type b = Simd::Vec8::LoadAligned(values2);
+
+        int32_t add[8], sub[8], mul[8], abs[8], min[8], max[8], gt[8], lt[8], eq[8], bitAnd[8], bitAndNot[8], bitOr[8], bitXor[8], bitNot[8];
+        Store(Simd::Vec8::Add(a, b), add);
+        Store(Simd::Vec8::Sub(a, b), sub);
+        Store(Simd::Vec8::Mul(a, b), mul);
+        Store(Simd::Vec8::Abs(a), abs);
+        Store(Simd::Vec8::Min(a, b), min);
+        Store(Simd::Vec8::Max(a, b), max);
+        Store(Simd::Vec8::CmpGt(a, b), gt);
+        Store(Simd::Vec8::CmpLt(a, b), lt);
+        Store(Simd::Vec8::CmpEq(a, b), eq);
+        Store(Simd::Vec8::And(a, b), bitAnd);
+        Store(Simd::Vec8::AndNot(a, b), bitAndNot);
+        Store(Simd::Vec8::Or(a, b), bitOr);
+        Store(Simd::Vec8::Xor(a, b), bitXor);
+        Store(Simd::Vec8::Not(a), bitNot);
+
+        float converted[8];
+        Store(Simd::Vec8::ConvertToFloat(a), converted);
+
+        for (int32_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_EQ(values1[i] + values2[i], add[i]);
+            EXPECT_EQ(values1[i] - values2[i], sub[i]);
+            EXPECT_EQ(values1[i] * values2[i], mul[i]);
+            EXPECT_EQ(values1[i] < 0 ? -values1[i] : values1[i], abs[i]);
+            EXPECT_EQ(AZStd::min(values1[i], values2[i]), min[i]);
+            EXPECT_EQ(AZStd::max(values1[i], values2[i]), max[i]);
+            EXPECT_EQ(values1[i] > values2[i] ? -1 : 0, gt[i]);
+            EXPECT_EQ(values1[i] < values2[i] ? -1 : 0, lt[i]);
+            EXPECT_EQ(values1[i] == values2[i] ? -1 : 0, eq[i]);
+            EXPECT_EQ(values1[i] & values2[i], bitAnd[i]);
+            EXPECT_EQ(~values1[i] & values2[i], bitAndNot[i]);
+            EXPECT_EQ(values1[i] | values2[i], bitOr[i]);
+            EXPECT_EQ(values1[i] ^ values2[i], bitXor[i]);
+            EXPECT_EQ(~values1[i], bitNot[i]);
+            EXPECT_FLOAT_EQ(static_cast<float>(values1[i]), converted[i]);
+        }
+
+        EXPECT_TRUE(Simd::Vec8::CmpAllEq(a, a));
+        EXPECT_FALSE(Simd::Vec8::CmpAllEq(a, b));
+    }
+
+    TEST_F(MATH_SimdMathVec8, ZeroAndCast_RoundTrip)
+    {
+        float zeroFloat[8];
+        int32_t zeroInt[8];
+        float cast[8];
+        Store(Simd::Vec8::ZeroFloat(), zeroFloat);
+        Store(Simd::Vec8::ZeroInt(), zeroInt);
+        Store(Simd::Vec8::CastToFloat(Simd::Vec8::CastToInt(Simd::Vec8::LoadAligned(m_values1))), cast);
+        for (int32_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_EQ(0.0f, zeroFloat[i]);
+            EXPECT_EQ(0, zeroInt[i]);
+            EXPECT_EQ(m_values1[i], cast[i]);
+        }
+    }
 }
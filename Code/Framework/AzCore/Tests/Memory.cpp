@@ -9,6 +9,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/HphaAllocator.h>
+#include <AzCore/Memory/LinearAllocator.h>
 
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/StackTracer.h>
@@ -439,6 +440,224 @@ namespace UnitTest
         EXPECT_EQ(result, nullptr);
     }
 
+    /**
+     * Tests LinearAllocator
+     */
+    class LinearAllocatorTest
+        : public MemoryTrackingFixture
+    {
+    public:
+        void TearDown() override
+        {
+            GetFrameAllocator().ResetFrame();
+            MemoryTrackingFixture::TearDown();
+        }
+
+        static LinearAllocatorBase& GetFrameAllocator()
+        {
+            return static_cast<LinearAllocatorBase&>(AllocatorInstance<FrameAllocator>::Get());
+        }
+    };
+
+    TEST_F(LinearAllocatorTest, Allocate_RespectsAlignment_ReturnsDistinctAddresses)
+    {
+        IAllocator& allocator = AllocatorInstance<FrameAllocator>::Get();
+        void* previous = nullptr;
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            void* address = allocator.allocate(3, alignment);
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(address) % alignment);
+            EXPECT_NE(previous, address);
+            previous = address;
+        }
+        EXPECT_GT(allocator.NumAllocatedBytes(), 0);
+    }
+
+    TEST_F(LinearAllocatorTest, Deallocate_MostRecentAllocation_ReusesMemory)
+    {
+        IAllocator& allocator = AllocatorInstance<FrameAllocator>::Get();
+        void* first = allocator.allocate(64, 16);
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+        void* second = allocator.allocate(64, 16);
+
+        EXPECT_EQ(64, allocator.deallocate(second, 64, 16));
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+        EXPECT_EQ(second, allocator.allocate(64, 16));
+
+        // Older allocations are only released in bulk.
+        EXPECT_EQ(0, allocator.deallocate(first, 64, 16));
+    }
+
+    TEST_F(LinearAllocatorTest, Reallocate_OlderAllocation_CopiesToNewAllocation)
+    {
+        IAllocator& allocator = AllocatorInstance<FrameAllocator>::Get();
+        char* first = static_cast<char*>(allocator.allocate(16, 8));
+        memset(first, 0x5A, 16);
+        void* second = allocator.allocate(16, 8);
+
+        char* grown = static_cast<char*>(allocator.reallocate(first, 64, 8));
+        ASSERT_NE(nullptr, grown);
+        EXPECT_NE(first, grown);
+        EXPECT_NE(second, grown);
+        for (int i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(0x5A, grown[i]);
+        }
+        // The old block is left in place until the frame is reset.
+        EXPECT_EQ(0x5A, first[0]);
+
+        EXPECT_EQ(64, allocator.get_allocated_size(grown));
+    }
+
+    TEST_F(LinearAllocatorTest, GetAllocatedSize_ReturnsSizeOfEachAllocation)
+    {
+        IAllocator& allocator = AllocatorInstance<FrameAllocator>::Get();
+        void* first = allocator.allocate(24, 8);
+        void* second = allocator.allocate(100, 32);
+        void* third = allocator.allocate(LinearAllocatorBase::DefaultPageSize / 2, 16);
+        void* fourth = allocator.allocate(LinearAllocatorBase::DefaultPageSize / 2, 16);
+
+        EXPECT_EQ(24, allocator.get_allocated_size(first));
+        EXPECT_EQ(100, allocator.get_allocated_size(second));
+        EXPECT_EQ(LinearAllocatorBase::DefaultPageSize / 2, allocator.get_allocated_size(third));
+        EXPECT_EQ(LinearAllocatorBase::DefaultPageSize / 2, allocator.get_allocated_size(fourth));
+
+        // Released memory and memory the allocator doesn't own have no size.
+        allocator.deallocate(fourth);
+        EXPECT_EQ(0, allocator.get_allocated_size(fourth));
+        int local = 0;
+        EXPECT_EQ(0, allocator.get_allocated_size(&local));
+    }
+
+    TEST_F(LinearAllocatorTest, GetAllocatedSize_AllocationOfOtherThread_ReturnsZero)
+    {
+        IAllocator& allocator = AllocatorInstance<FrameAllocator>::Get();
+        void* address = nullptr;
+        AZStd::thread worker([&allocator, &address]()
+            {
+                address = allocator.allocate(48, 8);
+                EXPECT_EQ(48, allocator.get_allocated_size(address));
+            });
+        worker.join();
+        EXPECT_EQ(0, allocator.get_allocated_size(address));
+    }
+
+    TEST_F(LinearAllocatorTest, Scope_ReleasesAllocationsMadeInScope)
+    {
+        IAllocator& allocator = AllocatorInstance<FrameAllocator>::Get();
+        allocator.allocate(32, 8);
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+        void* firstInScope = nullptr;
+        {
+            LinearAllocatorScope scope(allocator);
+            firstInScope = allocator.allocate(128, 8);
+            for (int i = 0; i < 16; ++i)
+            {
+                // Large enough to require additional pages.
+                allocator.allocate(LinearAllocatorBase::DefaultPageSize / 4, 8);
+            }
+        }
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+        EXPECT_EQ(firstInScope, allocator.allocate(128, 8));
+    }
+
+    TEST_F(LinearAllocatorTest, Allocate_LargerThanPage_Succeeds)
+    {
+        LinearAllocatorBase& allocator = GetFrameAllocator();
+        const size_t byteSize = allocator.GetPageSize() * 3;
+        char* address = static_cast<char*>(allocator.allocate(byteSize, 64));
+        ASSERT_NE(nullptr, address);
+        address[0] = 1;
+        address[byteSize - 1] = 1;
+        EXPECT_GE(allocator.GetReservedBytes(), byteSize);
+
+        allocator.ResetFrame();
+        EXPECT_LT(allocator.GetReservedBytes(), byteSize);
+    }
+
+    TEST_F(LinearAllocatorTest, ResetFrame_AllocationsOnMultipleThreads_ReleasesAll)
+    {
+        LinearAllocatorBase& allocator = GetFrameAllocator();
+        constexpr int threadCount = 4;
+        AZStd::thread threads[threadCount];
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread([&allocator]()
+                {
+                    for (int i = 0; i < 1000; ++i)
+                    {
+                        int* value = static_cast<int*>(allocator.allocate(sizeof(int) * 16, alignof(int)));
+                        value[0] = i;
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_GE(allocator.NumAllocatedBytes(), threadCount * 1000 * sizeof(int) * 16);
+        const u64 frame = allocator.GetFrame();
+        allocator.ResetFrame();
+        EXPECT_EQ(frame + 1, allocator.GetFrame());
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+
+        // The threads are gone, so their pages are released on the next reset.
+        allocator.ResetFrame();
+        EXPECT_EQ(0, allocator.GetReservedBytes());
+    }
+
+    class FrameAllocatedClass
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameAllocatedClass, FrameAllocator);
+
+        int m_values[8];
+    };
+
+    TEST_F(LinearAllocatorTest, Containers_UseFrameAllocator)
+    {
+        IAllocator& allocator = AllocatorInstance<FrameAllocator>::Get();
+        {
+            LinearAllocatorScope scope(allocator);
+
+            AZStd::vector<int, FrameAllocator_for_std_t> values;
+            AZStd::unordered_map<int, int, AZStd::hash<int>, AZStd::equal_to<int>, FrameAllocator_for_std_t> map;
+            for (int i = 0; i < 1000; ++i)
+            {
+                values.push_back(i);
+                map.emplace(i, i * 2);
+            }
+            EXPECT_EQ(999, values.back());
+            EXPECT_EQ(1998, map[999]);
+
+            FrameAllocatedClass* instance = aznew FrameAllocatedClass;
+            instance->m_values[0] = 1;
+            EXPECT_GT(allocator.NumAllocatedBytes(), 1000 * sizeof(int));
+            delete instance;
+        }
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(LinearAllocatorTest, AllocatorManager_ReportsFrameAllocator)
+    {
+        IAllocator& allocator = AllocatorInstance<FrameAllocator>::Get();
+        allocator.allocate(256, 16);
+
+        size_t usedBytes = 0;
+        size_t reservedBytes = 0;
+        AZStd::vector<AllocatorManager::AllocatorStats> stats;
+        AllocatorManager::Instance().GetAllocatorStats(usedBytes, reservedBytes, &stats);
+        auto it = AZStd::find_if(stats.begin(), stats.end(),
+            [](const AllocatorManager::AllocatorStats& entry)
+            {
+                return entry.m_name == AzTypeInfo<FrameAllocator>::Name();
+            });
+        ASSERT_NE(stats.end(), it);
+        EXPECT_GE(it->m_allocatedBytes, 256);
+    }
+
     /**
      * Tests ThreadPoolAllocator
      */
@@ -12,6 +12,7 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Memory/HphaAllocator.h>
+#include <AzCore/Memory/LinearAllocator.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -58,6 +59,13 @@ namespace Benchmark
         }
     };
 
+    // Own type so the benchmark doesn't share the thread slot with the global FrameAllocator
+    class TestFrameAllocator : public AZ::LinearAllocatorHelper<TestFrameAllocator>
+    {
+    public:
+        AZ_RTTI(TestFrameAllocator, "{8E4C2A71-5B3F-4D69-A0E8-1C7F9B2D6E43}", AZ::LinearAllocatorBase);
+    };
+
     // Allocated bytes reported by the allocator
     static const char* s_counterAllocatorMemory = "Allocator_Memory";
 
@@ -237,6 +245,48 @@ namespace Benchmark
         }
     };
 
+    // Simulates the short lived allocations made while processing a frame: everything is allocated, then all of it is released
+    // at the end of the frame. Linear allocators release everything at once, other allocators release allocations one by one.
+    template <typename TAllocator, AllocationSize TAllocationSize>
+    class FrameAllocationBenchmarkFixture
+        : public AllocatorBenchmarkFixture<TAllocator>
+    {
+        using base = AllocatorBenchmarkFixture<TAllocator>;
+        using TestAllocatorType = typename base::TestAllocatorType;
+
+    public:
+        void Benchmark(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<void*>& perThreadAllocations = base::GetPerThreadAllocations(state.thread_index());
+                const AllocationSizeArray& allocationArray = s_allocationSizes[TAllocationSize];
+                const size_t numberOfAllocations = perThreadAllocations.size();
+
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    perThreadAllocations[allocationIndex] = this->GetAllocator().allocate(allocationSize, 0);
+                }
+
+                if constexpr (AZStd::is_base_of_v<AZ::LinearAllocatorBase, TestAllocatorType>)
+                {
+                    this->GetAllocator().ResetFrame();
+                }
+                else
+                {
+                    for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                    {
+                        const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                        this->GetAllocator().deallocate(perThreadAllocations[allocationIndex], allocationSize);
+                    }
+                }
+
+                state.SetItemsProcessed(numberOfAllocations);
+            }
+        }
+    };
+
     template<typename TAllocator>
     class RecordedAllocationBenchmarkFixture : public ::benchmark::Fixture
     {
@@ -438,6 +488,14 @@ namespace Benchmark
         BM_REGISTER_TEMPLATE(RecordedAllocationBenchmarkFixture, TESTNAME, ALLOCATORTYPE)->Apply(RecordedRunRanges); \
     }
 
+    // Frame allocations are only run single-threaded since releasing a frame requires all threads to be synchronized
+#define BM_REGISTER_FRAME_ALLOCATOR(TESTNAME, ALLOCATORTYPE) \
+    namespace BM_##TESTNAME \
+    { \
+        BM_REGISTER_TEMPLATE(FrameAllocationBenchmarkFixture, TESTNAME##_FRAME_SMALL, ALLOCATORTYPE, SMALL)->Apply(RunRanges); \
+        BM_REGISTER_TEMPLATE(FrameAllocationBenchmarkFixture, TESTNAME##_FRAME_MIXED, ALLOCATORTYPE, MIXED)->Apply(RunRanges); \
+    }
+
     /// Warm up benchmark used to prepare the OS for allocations. Most OS keep allocations for a process somehow
     /// reserved. So the first allocations run always get a bigger impact in a process. This warm up allocator runs
     /// all the benchmarks and is just used for the the next allocators to report more consistent results.
@@ -447,9 +505,14 @@ namespace Benchmark
     BM_REGISTER_ALLOCATOR(HphaSchemaAllocator, HphaSchemaAllocator);
     BM_REGISTER_ALLOCATOR(SystemAllocator, TestSystemAllocator);
 
+    BM_REGISTER_FRAME_ALLOCATOR(RawMallocAllocator, RawMallocAllocator);
+    BM_REGISTER_FRAME_ALLOCATOR(SystemAllocator, TestSystemAllocator);
+    BM_REGISTER_FRAME_ALLOCATOR(FrameAllocator, TestFrameAllocator);
+
     //BM_REGISTER_SCHEMA(PoolSchema); // Requires special alignment requests while allocating
     // BM_REGISTER_ALLOCATOR(OSAllocator, OSAllocator); // Requires special treatment to initialize since it will be already initialized, maybe creating a different instance?
 
+#undef BM_REGISTER_FRAME_ALLOCATOR
 #undef BM_REGISTER_ALLOCATOR
 #undef BM_REGISTER_SIZE_FIXTURES
 #undef BM_REGISTER_TEMPLATE
@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Metrics/BinaryTraceEventLogger.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class BinaryTraceEventLoggerTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_settingsRegistry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            // Make the loggers active independent of the build configuration
+            m_settingsRegistry->Set(AZ::Metrics::SettingsKey(EventLoggerName) + "/Active", true);
+        }
+
+        void TearDown() override
+        {
+            m_settingsRegistry.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZ::Metrics::BinaryTraceEventLoggerConfig GetConfig(AZStd::chrono::milliseconds flushInterval = {}) const
+        {
+            AZ::Metrics::BinaryTraceEventLoggerConfig config;
+            config.m_loggerName = EventLoggerName;
+            config.m_settingsRegistry = m_settingsRegistry.get();
+            config.m_flushInterval = flushInterval;
+            return config;
+        }
+
+        //! Converts the binary trace to JSON and parses the result
+        static void ConvertToJson(const AZStd::vector<AZ::u8>& binaryTrace, rapidjson::Document& jsonDocument)
+        {
+            AZStd::vector<AZ::u8> binaryTraceCopy = binaryTrace;
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> binaryStream(&binaryTraceCopy);
+            AZStd::string jsonOutput;
+            auto jsonStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&jsonOutput);
+            auto convertOutcome = AZ::Metrics::ConvertBinaryTraceToJson(binaryStream, AZStd::move(jsonStream));
+            ASSERT_TRUE(convertOutcome) << convertOutcome.GetError().c_str();
+
+            jsonDocument.Parse(jsonOutput.c_str());
+            ASSERT_FALSE(jsonDocument.HasParseError()) << R"(JSON parse error ")"
+                << rapidjson::GetParseError_En(jsonDocument.GetParseError()) << R"(" at offset )" << jsonDocument.GetErrorOffset();
+            ASSERT_TRUE(jsonDocument.IsArray());
+        }
+
+        static constexpr AZStd::string_view EventLoggerName = "BinaryTraceEventTest";
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_settingsRegistry;
+    };
+
+    TEST_F(BinaryTraceEventLoggerTest, RecordAllEvents_ConvertedToJson_MatchesRecordedFields)
+    {
+        constexpr AZStd::string_view eventString = "Hello world";
+        constexpr AZ::s64 eventInt64 = -2;
+        constexpr AZ::u64 eventUint64 = 0xFFFF'0000'FFFF'FFFF;
+        constexpr double eventDouble = 64.0;
+
+        AZ::Metrics::EventArrayStorage eventArray{ eventString, eventInt64, eventUint64 };
+        AZ::Metrics::EventObjectStorage eventObject{ { "Field1", true }, { "Field2", eventDouble } };
+
+        AZ::Metrics::EventObjectStorage argsContainer;
+        argsContainer.emplace_back("string", eventString);
+        argsContainer.emplace_back("int64_t", eventInt64);
+        argsContainer.emplace_back("uint64_t", eventUint64);
+        argsContainer.emplace_back("bool", true);
+        argsContainer.emplace_back("double", eventDouble);
+        argsContainer.emplace_back("array", AZ::Metrics::EventArray(eventArray));
+        argsContainer.emplace_back("object", AZ::Metrics::EventObject(eventObject));
+
+        AZStd::vector<AZ::u8> binaryTrace;
+        {
+            auto binaryStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&binaryTrace);
+            AZ::Metrics::BinaryTraceEventLogger binaryTraceLogger(AZStd::move(binaryStream), GetConfig());
+
+            AZ::Metrics::CompleteArgs completeArgs;
+            completeArgs.m_name = "Complete Event";
+            completeArgs.m_cat = "Test";
+            completeArgs.m_dur = AZStd::chrono::microseconds(42);
+            completeArgs.m_tdur = AZStd::chrono::microseconds(24);
+            completeArgs.m_args = argsContainer;
+            completeArgs.m_id = "7";
+            EXPECT_TRUE(binaryTraceLogger.RecordCompleteEvent(completeArgs));
+
+            AZ::Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = "Instant Event";
+            instantArgs.m_cat = "Test";
+            instantArgs.m_scope = AZ::Metrics::InstantEventScope::Process;
+            EXPECT_TRUE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+
+            AZ::Metrics::AsyncArgs asyncArgs;
+            asyncArgs.m_name = "Async Event";
+            asyncArgs.m_cat = "Test";
+            asyncArgs.m_id = "8";
+            asyncArgs.m_scope = "Distinguishing Scope";
+            EXPECT_TRUE(binaryTraceLogger.RecordAsyncEventStart(asyncArgs));
+            // The logger writes the remaining events to the stream when destroyed
+        }
+
+        rapidjson::Document jsonDocument;
+        ConvertToJson(binaryTrace, jsonDocument);
+        ASSERT_EQ(3, jsonDocument.Size());
+
+        const rapidjson::Value& completeEvent = jsonDocument[0];
+        EXPECT_STREQ("Complete Event", completeEvent["name"].GetString());
+        EXPECT_STREQ("Test", completeEvent["cat"].GetString());
+        EXPECT_STREQ("X", completeEvent["ph"].GetString());
+        EXPECT_STREQ("7", completeEvent["id"].GetString());
+        EXPECT_EQ(42, completeEvent["dur"].GetInt64());
+        EXPECT_EQ(24, completeEvent["tdur"].GetInt64());
+        EXPECT_EQ(AZ::Platform::GetCurrentProcessId(), completeEvent["pid"].GetUint64());
+
+        const rapidjson::Value& args = completeEvent["args"];
+        EXPECT_STREQ("Hello world", args["string"].GetString());
+        EXPECT_EQ(eventInt64, args["int64_t"].GetInt64());
+        EXPECT_EQ(eventUint64, args["uint64_t"].GetUint64());
+        EXPECT_TRUE(args["bool"].GetBool());
+        EXPECT_DOUBLE_EQ(eventDouble, args["double"].GetDouble());
+        ASSERT_TRUE(args["array"].IsArray());
+        ASSERT_EQ(3, args["array"].Size());
+        EXPECT_STREQ("Hello world", args["array"][0].GetString());
+        EXPECT_EQ(eventUint64, args["array"][2].GetUint64());
+        ASSERT_TRUE(args["object"].IsObject());
+        EXPECT_TRUE(args["object"]["Field1"].GetBool());
+        EXPECT_DOUBLE_EQ(eventDouble, args["object"]["Field2"].GetDouble());
+
+        const rapidjson::Value& instantEvent = jsonDocument[1];
+        EXPECT_STREQ("Instant Event", instantEvent["name"].GetString());
+        EXPECT_STREQ("i", instantEvent["ph"].GetString());
+        EXPECT_STREQ("p", instantEvent["s"].GetString());
+        EXPECT_FALSE(instantEvent.HasMember("id"));
+
+        const rapidjson::Value& asyncEvent = jsonDocument[2];
+        EXPECT_STREQ("b", asyncEvent["ph"].GetString());
+        EXPECT_STREQ("8", asyncEvent["id"].GetString());
+        EXPECT_STREQ("Distinguishing Scope", asyncEvent["scope"].GetString());
+        EXPECT_EQ(completeEvent["tid"].GetUint64(), asyncEvent["tid"].GetUint64());
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, RecordEvents_LargerThanOneRecord_RoundTripsAcrossBufferWrap)
+    {
+        // A small buffer which is flushed after each event makes the events wrap around the end of the buffer
+        AZ::Metrics::BinaryTraceEventLoggerConfig config = GetConfig();
+        config.m_recordsPerThread = 8;
+
+        AZStd::vector<AZ::u8> binaryTrace;
+        constexpr size_t eventCount = 10;
+        {
+            auto binaryStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&binaryTrace);
+            AZ::Metrics::BinaryTraceEventLogger binaryTraceLogger(AZStd::move(binaryStream), config);
+
+            const AZStd::string longString(150, 'x');
+            for (size_t eventIndex = 0; eventIndex < eventCount; ++eventIndex)
+            {
+                AZ::Metrics::EventObjectStorage argsContainer{ { "long", longString },
+                    { "index", AZ::Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, eventIndex } } };
+                AZ::Metrics::CounterArgs counterArgs;
+                counterArgs.m_name = "Counter Event";
+                counterArgs.m_cat = "Test";
+                counterArgs.m_args = argsContainer;
+                EXPECT_TRUE(binaryTraceLogger.RecordCounterEvent(counterArgs));
+                binaryTraceLogger.Flush();
+            }
+            EXPECT_EQ(0, binaryTraceLogger.GetDroppedEventCount());
+        }
+
+        rapidjson::Document jsonDocument;
+        ConvertToJson(binaryTrace, jsonDocument);
+        ASSERT_EQ(eventCount, jsonDocument.Size());
+        for (rapidjson::SizeType eventIndex = 0; eventIndex < eventCount; ++eventIndex)
+        {
+            const rapidjson::Value& args = jsonDocument[eventIndex]["args"];
+            EXPECT_EQ(150, args["long"].GetStringLength());
+            EXPECT_EQ(eventIndex, args["index"].GetUint64());
+        }
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, RecordEvents_FromMultipleThreads_AllEventsConverted)
+    {
+        AZStd::vector<AZ::u8> binaryTrace;
+        constexpr size_t totalThreads = 4;
+        constexpr size_t eventsPerThread = 1000;
+        {
+            // Use a background flush with a buffer smaller than the number of events each thread records,
+            // so the threads record while their buffers are being drained
+            AZ::Metrics::BinaryTraceEventLoggerConfig config = GetConfig(AZStd::chrono::milliseconds(1));
+            config.m_recordsPerThread = 64;
+
+            auto binaryStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&binaryTrace);
+            AZ::Metrics::BinaryTraceEventLogger binaryTraceLogger(AZStd::move(binaryStream), config);
+
+            AZStd::atomic_bool startLogging{};
+            auto LogEvents = [&startLogging, &binaryTraceLogger](int threadIndex)
+            {
+                while (!startLogging)
+                {
+                    AZStd::this_thread::yield();
+                }
+
+                AZStd::fixed_string<32> idString;
+                AZStd::to_string(idString, threadIndex);
+                for (size_t eventIndex = 0; eventIndex < eventsPerThread; ++eventIndex)
+                {
+                    AZ::Metrics::EventObjectStorage argsContainer{
+                        { "index", AZ::Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, eventIndex } } };
+                    AZ::Metrics::InstantArgs instantArgs;
+                    instantArgs.m_name = "Instant Event";
+                    instantArgs.m_cat = "Test";
+                    instantArgs.m_id = idString;
+                    instantArgs.m_args = argsContainer;
+                    // Retry dropped events, as the flush thread may not have drained the buffer yet
+                    while (!binaryTraceLogger.RecordInstantEvent(instantArgs))
+                    {
+                        AZStd::this_thread::yield();
+                    }
+                }
+            };
+
+            int32_t currentThreadIndex{};
+            AZStd::array<AZStd::thread, totalThreads> threads;
+            for (AZStd::thread& threadRef : threads)
+            {
+                threadRef = AZStd::thread(LogEvents, currentThreadIndex++);
+            }
+
+            startLogging = true;
+            for (AZStd::thread& threadRef : threads)
+            {
+                threadRef.join();
+            }
+        }
+
+        rapidjson::Document jsonDocument;
+        ConvertToJson(binaryTrace, jsonDocument);
+        ASSERT_EQ(totalThreads * eventsPerThread, jsonDocument.Size());
+
+        // The events of each thread must be in the order they were recorded
+        AZStd::array<AZ::u64, totalThreads> nextEventIndex{};
+        for (const rapidjson::Value& event : jsonDocument.GetArray())
+        {
+            const int threadIndex = atoi(event["id"].GetString());
+            ASSERT_LT(threadIndex, static_cast<int>(totalThreads));
+            EXPECT_EQ(nextEventIndex[threadIndex]++, event["args"]["index"].GetUint64());
+        }
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, ThreadExits_BufferFreedAfterFlush)
+    {
+        AZStd::vector<AZ::u8> binaryTrace;
+        auto binaryStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&binaryTrace);
+        auto binaryTraceLogger = AZStd::make_unique<AZ::Metrics::BinaryTraceEventLogger>(AZStd::move(binaryStream), GetConfig());
+
+        AZ::Metrics::InstantArgs instantArgs;
+        instantArgs.m_name = "Instant Event";
+        instantArgs.m_cat = "Test";
+        AZStd::thread exitedThread([&binaryTraceLogger, &instantArgs]()
+        {
+            EXPECT_TRUE(binaryTraceLogger->RecordInstantEvent(instantArgs));
+        });
+        exitedThread.join();
+        EXPECT_EQ(1, binaryTraceLogger->GetThreadBufferCount());
+
+        // The buffer is only freed once its events have been written
+        binaryTraceLogger->Flush();
+        EXPECT_EQ(0, binaryTraceLogger->GetThreadBufferCount());
+
+        // A thread that outlives the logger must leave the freed buffer alone when it exits
+        AZStd::atomic_bool loggerDestroyed{};
+        AZStd::atomic_bool eventRecorded{};
+        AZStd::thread outlivingThread([&]()
+        {
+            EXPECT_TRUE(binaryTraceLogger->RecordInstantEvent(instantArgs));
+            eventRecorded = true;
+            while (!loggerDestroyed)
+            {
+                AZStd::this_thread::yield();
+            }
+        });
+        while (!eventRecorded)
+        {
+            AZStd::this_thread::yield();
+        }
+        binaryTraceLogger.reset();
+        loggerDestroyed = true;
+        outlivingThread.join();
+
+        rapidjson::Document jsonDocument;
+        ConvertToJson(binaryTrace, jsonDocument);
+        EXPECT_EQ(2, jsonDocument.Size());
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, RecordEvent_ThreadBufferFull_DropsEvent)
+    {
+        AZ::Metrics::BinaryTraceEventLoggerConfig config = GetConfig();
+        config.m_recordsPerThread = 4;
+
+        AZStd::vector<AZ::u8> binaryTrace;
+        auto binaryStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&binaryTrace);
+        AZ::Metrics::BinaryTraceEventLogger binaryTraceLogger(AZStd::move(binaryStream), config);
+
+        AZ::Metrics::InstantArgs instantArgs;
+        instantArgs.m_name = "Instant Event";
+        instantArgs.m_cat = "Test";
+        for (size_t eventIndex = 0; eventIndex < 4; ++eventIndex)
+        {
+            EXPECT_TRUE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+        }
+
+        // The buffer holds 4 single record events, so the next one is dropped
+        EXPECT_FALSE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+        EXPECT_EQ(1, binaryTraceLogger.GetDroppedEventCount());
+
+        // An event that needs more records than the buffer holds can never be recorded
+        const AZStd::string longString(512, 'x');
+        AZ::Metrics::EventObjectStorage argsContainer{ { "long", longString } };
+        instantArgs.m_args = argsContainer;
+        binaryTraceLogger.Flush();
+        EXPECT_FALSE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+        EXPECT_EQ(2, binaryTraceLogger.GetDroppedEventCount());
+
+        // Flushing makes room for new events
+        instantArgs.m_args = {};
+        EXPECT_TRUE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+        binaryTraceLogger.ResetStream(nullptr);
+
+        rapidjson::Document jsonDocument;
+        ConvertToJson(binaryTrace, jsonDocument);
+        EXPECT_EQ(5, jsonDocument.Size());
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, TogglingActiveSetting_CanTurnOrOffEventRecording_Succeeds)
+    {
+        AZStd::vector<AZ::u8> binaryTrace;
+        {
+            auto binaryStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&binaryTrace);
+            AZ::Metrics::BinaryTraceEventLogger binaryTraceLogger(AZStd::move(binaryStream), GetConfig());
+
+            AZ::Metrics::InstantArgs instantArgs;
+            instantArgs.m_cat = "Test";
+            instantArgs.m_name = "Recorded";
+            EXPECT_TRUE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+
+            m_settingsRegistry->Set(AZ::Metrics::SettingsKey(EventLoggerName) + "/Active", false);
+            instantArgs.m_name = "Unrecorded";
+            EXPECT_TRUE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+
+            m_settingsRegistry->Set(AZ::Metrics::SettingsKey(EventLoggerName) + "/Active", true);
+            instantArgs.m_name = "Re-recorded";
+            EXPECT_TRUE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+        }
+
+        rapidjson::Document jsonDocument;
+        ConvertToJson(binaryTrace, jsonDocument);
+        ASSERT_EQ(2, jsonDocument.Size());
+        EXPECT_STREQ("Recorded", jsonDocument[0]["name"].GetString());
+        EXPECT_STREQ("Re-recorded", jsonDocument[1]["name"].GetString());
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, ConvertBinaryTraceToJson_InvalidInput_Fails)
+    {
+        AZStd::vector<AZ::u8> binaryTrace;
+        {
+            auto binaryStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&binaryTrace);
+            AZ::Metrics::BinaryTraceEventLogger binaryTraceLogger(AZStd::move(binaryStream), GetConfig());
+            AZ::Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = "Instant Event";
+            instantArgs.m_cat = "Test";
+            EXPECT_TRUE(binaryTraceLogger.RecordInstantEvent(instantArgs));
+        }
+
+        auto Convert = [](AZStd::vector<AZ::u8> binaryTrace)
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> binaryStream(&binaryTrace);
+            AZStd::string jsonOutput;
+            auto jsonStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&jsonOutput);
+            return AZ::Metrics::ConvertBinaryTraceToJson(binaryStream, AZStd::move(jsonStream));
+        };
+
+        EXPECT_TRUE(Convert(binaryTrace));
+
+        // Not a binary trace
+        AZStd::vector<AZ::u8> invalidMagic = binaryTrace;
+        invalidMagic[0] = '[';
+        EXPECT_FALSE(Convert(invalidMagic));
+
+        // Truncated in the middle of an event
+        AZStd::vector<AZ::u8> truncated = binaryTrace;
+        truncated.resize(truncated.size() - 1);
+        EXPECT_FALSE(Convert(truncated));
+
+        // Empty stream
+        EXPECT_FALSE(Convert({}));
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Compares the cost of recording a single event on the calling thread for the JSON and the binary trace loggers
+    class BinaryTraceEventLoggerBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        template<class RecordFunc>
+        static void RecordCompleteEvents(benchmark::State& state, RecordFunc&& recordFunc)
+        {
+            constexpr AZStd::string_view eventString = "Hello world";
+            AZ::Metrics::EventObjectStorage argsContainer;
+            argsContainer.emplace_back("string", eventString);
+            argsContainer.emplace_back("int64_t", AZ::s64{ -2 });
+            argsContainer.emplace_back("double", 64.0);
+
+            AZ::Metrics::CompleteArgs completeArgs;
+            completeArgs.m_name = "Complete Event";
+            completeArgs.m_cat = "Test";
+            completeArgs.m_dur = AZStd::chrono::microseconds(16);
+            completeArgs.m_args = argsContainer;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                recordFunc(completeArgs);
+            }
+            state.SetItemsProcessed(state.iterations());
+        }
+    };
+
+    BENCHMARK_F(BinaryTraceEventLoggerBenchmarkFixture, BM_JsonTraceEventLogger_RecordCompleteEvent)(benchmark::State& state)
+    {
+        AZStd::string metricsOutput;
+        auto metricsStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&metricsOutput);
+        AZ::Metrics::JsonTraceEventLogger jsonTraceLogger(AZStd::move(metricsStream));
+        RecordCompleteEvents(state, [&jsonTraceLogger, &metricsOutput, &state](const AZ::Metrics::CompleteArgs& completeArgs)
+        {
+            jsonTraceLogger.RecordCompleteEvent(completeArgs);
+            // Keep the in-memory output from growing for the whole run
+            if (metricsOutput.size() > 1024 * 1024)
+            {
+                state.PauseTiming();
+                jsonTraceLogger.ResetStream(nullptr);
+                metricsOutput.clear();
+                jsonTraceLogger.ResetStream(AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&metricsOutput));
+                state.ResumeTiming();
+            }
+        });
+    }
+
+    BENCHMARK_F(BinaryTraceEventLoggerBenchmarkFixture, BM_BinaryTraceEventLogger_RecordCompleteEvent)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::u8> metricsOutput;
+        auto metricsStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&metricsOutput);
+        // Flushing is done by the benchmark instead of a background thread, to only measure the recording thread
+        AZ::Metrics::BinaryTraceEventLoggerConfig config;
+        config.m_flushInterval = {};
+        AZ::Metrics::BinaryTraceEventLogger binaryTraceLogger(AZStd::move(metricsStream), config);
+        RecordCompleteEvents(state, [&binaryTraceLogger, &metricsOutput, &state](const AZ::Metrics::CompleteArgs& completeArgs)
+        {
+            if (!binaryTraceLogger.RecordCompleteEvent(completeArgs))
+            {
+                // The buffer of the thread is full, so write it out and start over with an empty stream
+                state.PauseTiming();
+                binaryTraceLogger.ResetStream(nullptr);
+                metricsOutput.clear();
+                binaryTraceLogger.ResetStream(AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>>(&metricsOutput));
+                state.ResumeTiming();
+                binaryTraceLogger.RecordCompleteEvent(completeArgs);
+            }
+        });
+    }
+} // Benchmark
+#endif
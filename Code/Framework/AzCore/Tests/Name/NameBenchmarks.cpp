@@ -177,4 +177,110 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    // Fixture for benchmarks that run on multiple threads. Google benchmark calls SetUp and TearDown on every thread, so the
+    // NameDictionary is created and destroyed by the first thread from within the benchmark instead.
+    class NameMultiThreadedBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PoolSize = 100;
+
+        // Creates the dictionary and a pool of names that stay alive for the duration of the benchmark.
+        // The other threads wait for this to complete before they start their iterations.
+        void CreateDictionaryAndNames(const ::benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                AZ::NameDictionary::Create();
+                for (size_t i = 0; i < PoolSize; ++i)
+                {
+                    m_existingNames.emplace_back(AZStd::string::format("name%zu", i));
+                }
+            }
+        }
+
+        // Releases the pool of names and destroys the dictionary. All threads have completed their iterations at this point.
+        void DestroyDictionaryAndNames(const ::benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                m_existingNames = {};
+                AZ::NameDictionary::Destroy();
+            }
+        }
+
+        AZStd::vector<AZ::Name> m_existingNames;
+    };
+
+    BENCHMARK_DEFINE_F(NameMultiThreadedBenchmarkFixture, MakeName_SharedNames)(::benchmark::State& state)
+    {
+        CreateDictionaryAndNames(state);
+
+        AZStd::vector<AZStd::string> namesToCreate;
+        for (size_t i = 0; i < PoolSize; ++i)
+        {
+            namesToCreate.emplace_back(AZStd::string::format("name%zu", i));
+        }
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(namesToCreate[i]));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+        DestroyDictionaryAndNames(state);
+    }
+    BENCHMARK_REGISTER_F(NameMultiThreadedBenchmarkFixture, MakeName_SharedNames)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameMultiThreadedBenchmarkFixture, MakeName_UniqueNamesPerThread)(::benchmark::State& state)
+    {
+        CreateDictionaryAndNames(state);
+
+        // None of these names are kept alive, so every iteration adds them to the dictionary and removes them again.
+        AZStd::vector<AZStd::string> namesToCreate;
+        for (size_t i = 0; i < PoolSize; ++i)
+        {
+            namesToCreate.emplace_back(AZStd::string::format("thread%d_name%zu", state.thread_index(), i));
+        }
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(namesToCreate[i]));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+        DestroyDictionaryAndNames(state);
+    }
+    BENCHMARK_REGISTER_F(NameMultiThreadedBenchmarkFixture, MakeName_UniqueNamesPerThread)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameMultiThreadedBenchmarkFixture, FindName_SharedNames)(::benchmark::State& state)
+    {
+        CreateDictionaryAndNames(state);
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            // The pool is only accessed inside the loop as it may not have been created yet before the first iteration.
+            AZ::NameDictionary& nameDictionary = AZ::NameDictionary::Instance();
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(nameDictionary.FindName(m_existingNames[i].GetHash()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+        DestroyDictionaryAndNames(state);
+    }
+    BENCHMARK_REGISTER_F(NameMultiThreadedBenchmarkFixture, FindName_SharedNames)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
 } // namespace AZ::NameBenchmarks
@@ -50,9 +50,19 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const auto& GetDictionary()
+        static bool ContainsName(AZStd::string_view nameString)
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            for (const AZ::NameDictionary::Shard& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                for (const auto& entry : shard.m_entries)
+                {
+                    if (entry.second.m_nameData->GetName() == nameString)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
         }
         
         static size_t GetEntryCount()
@@ -76,7 +86,7 @@ namespace UnitTest
                     break;
                 }
             }
-            return GetDictionary().size() - staticNameCount;
+            return AZ::NameDictionary::Instance().GetEntryCount() - staticNameCount;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -297,13 +307,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            // Workaround VS2022 17.3 issue with incorrect detection of unused lambda captures assigning the nameString reference to a same type
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString = nameString](const AZStd::pair<AZ::Name::Hash, AZ::NameDictionary::ScopedNameDataWrapper>& entry)
-            {
-                return entry.second.m_nameData->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsName(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -673,6 +677,86 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(1, 2);
     }
 
+    TEST_F(NameTest, RepeatedNameCreation_ReleasingAllReferences_RemovesNameFromDictionary)
+    {
+        AZ::Name::Hash hash = 0;
+        {
+            // The second and third Name are resolved through the thread's cache of recently created names.
+            AZ::Name first("cachedName");
+            AZ::Name second("cachedName");
+            AZ::Name third("cachedName");
+            EXPECT_EQ(first, second);
+            EXPECT_EQ(first, third);
+            EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+            hash = first.GetHash();
+        }
+
+        // The cache doesn't keep names alive.
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+        EXPECT_TRUE(AZ::NameDictionary::Instance().FindName(hash).IsEmpty());
+
+        AZ::Name recreated("cachedName");
+        EXPECT_EQ(recreated.GetStringView(), "cachedName");
+        EXPECT_EQ(recreated.GetHash(), hash);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, ConcurrencyDataTest_ThreadsShareNamesWithCollisions_AllNamesResolveConsistently)
+    {
+        AZ::NameDictionary::Destroy();
+
+        // A single hash slot forces every name through the collision resolution, which moves across shards.
+        ASSERT_EQ(nullptr, AZ::Interface<AZ::NameDictionary>::Get());
+        constexpr AZ::u64 maxHashSlots = 1;
+        AZStd::unique_ptr<AZ::NameDictionary> nameDictionary = AZStd::make_unique<AZ::NameDictionary>(maxHashSlots);
+        AZ::Interface<AZ::NameDictionary>::Register(nameDictionary.get());
+
+        constexpr size_t nameCount = 64;
+        constexpr size_t threadCount = 8;
+        AZStd::vector<AZStd::string> nameStrings;
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            nameStrings.push_back(AZStd::string::format("shared_name_%zu", i));
+        }
+
+        AZStd::vector<AZStd::vector<AZ::Name>> threadNames(threadCount);
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&nameStrings, &names = threadNames[threadIndex]]()
+            {
+                for (int repeat = 0; repeat < 4; ++repeat)
+                {
+                    names.clear();
+                    for (const AZStd::string& nameString : nameStrings)
+                    {
+                        names.emplace_back(nameString);
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(nameDictionary->GetEntryCount(), nameCount);
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                EXPECT_EQ(threadNames[threadIndex][i].GetStringView(), nameStrings[i]);
+                EXPECT_EQ(threadNames[threadIndex][i], threadNames[0][i]);
+            }
+            EXPECT_EQ(nameDictionary->FindName(threadNames[0][i].GetHash()).GetStringView(), nameStrings[i]);
+        }
+
+        // Names that were involved in a collision are kept in the dictionary after they're released.
+        threadNames.clear();
+        EXPECT_EQ(nameDictionary->GetEntryCount(), nameCount);
+        AZ::Interface<AZ::NameDictionary>::Unregister(nameDictionary.get());
+    }
+
     TEST_F(NameTest, NameRef)
     {
         AZ::NameRef fromRValue = AZ::Name("test");
@@ -0,0 +1,743 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr AZ::u32 TestRegisteredBufferCount = 2;
+    constexpr size_t TestRegisteredBufferSize = 64_kib;
+    constexpr bool TestEnableUnbufferReads = true;
+    constexpr bool HasSeekPenalty = false;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = HasSeekPenalty;
+            options.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize,
+                TestQueueDepth, TestOverCommit, TestRegisteredBufferCount, TestRegisteredBufferSize, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::LeakDetectionFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        // Data...
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StreamStackEntry> m_storageDriveLinux{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+        AZStd::vector<AZStd::unique_ptr<char[]>> m_dummyBuffers;
+        StorageDriveLinux::ConstructionOptions m_configurationOptions;
+
+        // Methods...
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetupStorageDrive(s32 overCommit, u32 registeredBufferCount = TestRegisteredBufferCount)
+        {
+            if (m_context == nullptr)
+            {
+                m_context = new AZ::IO::StreamerContext();
+            }
+
+            ASSERT_FALSE(m_dummyFilepath.empty());
+
+            m_configurationOptions.m_hasSeekPenalty = HasSeekPenalty;
+            m_configurationOptions.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            m_configurationOptions.m_minimalReporting = true;
+
+            m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+                TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, overCommit, registeredBufferCount,
+                TestRegisteredBufferSize, m_configurationOptions);
+            m_storageDriveLinux->SetContext(*m_context);
+        }
+
+        void SetUp() override
+        {
+            if (!StorageDriveLinux::IsSupported(TestQueueDepth))
+            {
+                GTEST_SKIP() << "io_uring is not available on this system.";
+            }
+
+            m_dummyRequestPath = RequestPath(AZ::IO::PathView(m_dummyFilepath));
+
+            SetupStorageDrive(TestOverCommit);
+        }
+
+        void TearDown() override
+        {
+            m_storageDriveLinux.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            RemoveDummyFiles();
+            m_dummyBuffers.clear();
+            m_dummyBuffers.shrink_to_fit();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(AZStd::string path, size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            using namespace AZ::IO;
+
+            SystemFile file;
+            bool fileCreated = file.Open(path.c_str(),
+                SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+
+            ASSERT_TRUE(fileCreated);
+
+            m_dummyFiles.push_back(AZStd::move(path));
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            CreateDummyFile(m_dummyFilepath, fileSize, chunkOffset, beginEndMarkers);
+        }
+
+        void RemoveDummyFiles()
+        {
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+            m_dummyFiles.shrink_to_fit();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::steady_clock::now();
+            do
+            {
+                m_storageDriveLinux->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDriveLinux->UpdateStatus(status);
+
+                if (AZStd::chrono::steady_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        void DoSingleRead()
+        {
+            constexpr size_t fileSize = 16_kib;
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+
+            CreateDummyFile(fileSize);
+
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+            m_storageDriveLinux->QueueRequest(request);
+
+            m_dummyBuffers.push_back(AZStd::move(buffer));
+        }
+
+        void DoMetaDataRetrieval()
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+            m_storageDriveLinux->QueueRequest(request);
+        }
+
+        void DoUnalignedOffsetRead()
+        {
+            constexpr AZ::u64 unalignedOffset = 40;
+            constexpr AZ::u64 numChunksToRead = 7;
+            constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+            constexpr size_t fileSize = 16_kib;
+
+            constexpr char unexpectedChar = 'Z';
+            char* buffer = reinterpret_cast<char*>(azmalloc(unalignedSize + 4, TestPhysicalSectorSize));
+            // Explicitly set the byte after the read size to be a predetermined value to detect over-reading.
+            buffer[unalignedSize] = unexpectedChar;
+
+            CreateDummyFile(fileSize, unalignedOffset);
+
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer, unalignedSize + 4, m_dummyRequestPath, unalignedOffset, unalignedSize);
+            request->SetCompletionCallback([](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                });
+            m_storageDriveLinux->QueueRequest(request);
+
+            WaitTillCompleted();
+
+            EXPECT_EQ(buffer[0], s_chunkCharacter);
+            for (size_t offset = 1; offset < numChunksToRead; ++offset)
+            {
+                EXPECT_EQ(buffer[(offset * unalignedOffset) - 1], s_fileCharacter);
+                EXPECT_EQ(buffer[offset * unalignedOffset], s_chunkCharacter);
+            }
+            EXPECT_EQ(buffer[unalignedSize - 1], s_fileCharacter);
+            EXPECT_EQ(buffer[unalignedSize], unexpectedChar);
+
+            azfree(buffer);
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+
+            // Create the "TestFiles" dir in the bin directory if it doesn't exist...
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0,
+            TestQueueDepth, TestOverCommit, TestRegisteredBufferCount, TestRegisteredBufferSize, m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+            TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, -(aznumeric_cast<s32>(TestQueueDepth) + 2),
+            TestRegisteredBufferCount, TestRegisteredBufferSize, m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileDoesntExist_ReturnsFalse)
+    {
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_FALSE(fileMetaData.m_found);
+                EXPECT_EQ(0, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_TRUE(fileExistsCheck.m_found);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(fileExistsCheck.m_found);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_QueueAndExecuteRequest_StorageDriveHandledRequest)
+    {
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+
+        CreateDummyFile(fileSize, 0, true);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        request->SetCompletionCallback([this](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                auto& readRequest = AZStd::get<AZ::IO::Requests::ReadData>(request.GetCommand());
+                EXPECT_EQ(readRequest.m_size, 16_kib);
+                EXPECT_EQ(readRequest.m_path.GetAbsolutePath(), AZStd::string_view(m_dummyFilepath));
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        EXPECT_EQ(buffer[1], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 2], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetReadWithRegisteredBuffers_ReturnsCorrectData)
+    {
+        DoUnalignedOffsetRead();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetReadWithoutRegisteredBuffers_ReturnsCorrectData)
+    {
+        SetupStorageDrive(TestOverCommit, 0);
+        DoUnalignedOffsetRead();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedSizeRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        constexpr AZ::u64 unalignedSize = 103630;
+        // Don't give it too much extra size otherwise the extra space will be used over-read to the next alignment.
+        constexpr size_t bufferSize = unalignedSize + 8;
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(bufferSize, TestPhysicalSectorSize));
+        ::memset(buffer, 'Z', bufferSize);
+
+        CreateDummyFile(unalignedSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, bufferSize, m_dummyRequestPath, 0, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        for (size_t i = 0; i < unalignedSize; ++i)
+        {
+            ASSERT_EQ(s_fileCharacter, buffer[i]);
+        }
+        for (size_t i = unalignedSize; i < bufferSize; ++i)
+        {
+            ASSERT_EQ('Z', buffer[i]);
+        }
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedMemoryAllocation_ReturnsCorrectData)
+    {
+        constexpr AZ::u64 readSize = TestPhysicalSectorSize * 16;
+
+        char* memory = reinterpret_cast<char*>(azmalloc(readSize + 16, TestPhysicalSectorSize));
+        char* buffer = memory + 7;
+
+        CreateDummyFile(readSize, 0, true);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, readSize + 16 - 7, m_dummyRequestPath, 0, readSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        EXPECT_EQ(buffer[readSize - 1], s_endCharacter);
+
+        azfree(memory);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_RequestIsForwarded)
+    {
+        constexpr AZ::u64 readSize = TestPhysicalSectorSize;
+
+        char buffer[readSize];
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDriveLinux->SetNext(mock);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        AZ::IO::RequestPath path{ AZ::IO::PathView{ m_dummyFilepath + "/Broken/Path.txt" } };
+
+        request->CreateRead(nullptr, buffer, readSize, path, 0, readSize);
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](AZ::IO::FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_MoreReadsThanQueueDepth_AllReadsCompleteWithCorrectData)
+    {
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = TestQueueDepth * 3;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        size_t counter = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&counter, i](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    auto& readRequest = AZStd::get<AZ::IO::Requests::ReadData>(request.GetCommand());
+                    EXPECT_EQ(readRequest.m_offset, i * chunkSize);
+                    counter++;
+                });
+            m_storageDriveLinux->QueueRequest(request);
+        }
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(numChunks, counter);
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_NoMoreFileHandlesSlots_RequestIsDelayedAndThenCompleted)
+    {
+        size_t counter = 0;
+        auto callback = [&counter](const FileRequest& request)
+        {
+            EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            counter++;
+        };
+
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer0(new char[fileSize]);
+        AZStd::unique_ptr<char[]> buffer1(new char[fileSize]);
+
+        AZStd::string filePath0 = m_dummyFilepath + "0";
+        AZStd::string filePath1 = m_dummyFilepath + "1";
+        CreateDummyFile(filePath0, fileSize);
+        CreateDummyFile(filePath1, fileSize);
+
+        AZ::IO::RequestPath path0{ AZ::IO::PathView{ filePath0 } };
+        AZ::IO::FileRequest* request0 = m_context->GetNewInternalRequest();
+        request0->CreateRead(nullptr, buffer0.get(), fileSize, path0, 0, fileSize);
+        request0->SetCompletionCallback(callback);
+
+        AZ::IO::RequestPath path1{ AZ::IO::PathView{ filePath1 } };
+        AZ::IO::FileRequest* request1 = m_context->GetNewInternalRequest();
+        request1->CreateRead(nullptr, buffer1.get(), fileSize, path1, 0, fileSize);
+        request1->SetCompletionCallback(callback);
+
+        m_storageDriveLinux->QueueRequest(request0);
+        m_storageDriveLinux->QueueRequest(request1);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(2, counter);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FlushEntireCacheRequest_FlushPreviouslyReadFileAndMetaData_NoErrorsReported)
+    {
+        DoSingleRead();
+        DoMetaDataRetrieval();
+        // Wait here because normally the scheduler will only queue a flush when the stack is idle.
+        WaitTillCompleted();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZ::IO::FileRequest* flushRequest = m_context->GetNewInternalRequest();
+        flushRequest->CreateFlushAll();
+        m_storageDriveLinux->QueueRequest(flushRequest);
+
+        WaitTillCompleted();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(0);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        AZStd::vector<Statistic> statistics;
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_TRUE(statistics.empty());
+
+        DoSingleRead();
+        WaitTillCompleted();
+
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+
+    class Streamer_StorageDriveLinuxTestFixture_WithScheduler
+        : public Streamer_StorageDriveLinuxTestFixture
+    {
+    public:
+        void SetupStorageDrive(s32 overCommit)
+        {
+            Streamer_StorageDriveLinuxTestFixture::SetupStorageDrive(overCommit);
+
+            if (m_streamer)
+            {
+                Interface<IStreamer>::Unregister(m_streamer);
+                delete m_streamer;
+            }
+            AZStd::unique_ptr<Scheduler> stack = AZStd::make_unique<Scheduler>(m_storageDriveLinux);
+            m_streamer = aznew AZ::IO::Streamer(AZStd::thread_desc{}, AZStd::move(stack));
+            ASSERT_NE(m_streamer, nullptr);
+            Interface<IStreamer>::Register(m_streamer);
+        }
+
+        void SetUp() override
+        {
+            if (!StorageDriveLinux::IsSupported(TestQueueDepth))
+            {
+                GTEST_SKIP() << "io_uring is not available on this system.";
+            }
+            SetupStorageDrive(TestOverCommit);
+        }
+
+        void TearDown() override
+        {
+            if (m_streamer)
+            {
+                Interface<IStreamer>::Unregister(m_streamer);
+                delete m_streamer;
+                m_streamer = nullptr;
+            }
+
+            Streamer_StorageDriveLinuxTestFixture::TearDown();
+        }
+
+    protected:
+        Streamer* m_streamer{ nullptr };
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture_WithScheduler, ReadDataRequest_ParallelReadsUsingIStreamer_DataIsCorrect)
+    {
+        // Completions are only picked up when the io_uring eventfd wakes up the Streamer thread, so this test will time out
+        // if the wake up isn't hooked up correctly.
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = 16;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<u8*, numChunks> buffers;
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        AZStd::atomic_int counter{ numChunks };
+        AZStd::binary_semaphore wait;
+        auto callback = [&counter, &wait](FileRequestHandle request)
+        {
+            auto streamer = Interface<IStreamer>::Get();
+            EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, streamer->GetRequestStatus(request));
+            if (--counter == 0)
+            {
+                wait.release();
+            }
+        };
+
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i] = reinterpret_cast<u8*>(azmalloc(chunkSize, TestPhysicalSectorSize));
+            FileRequestPtr request = m_streamer->Read(m_dummyFilepath, buffers[i], chunkSize, chunkSize,
+                IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, i * chunkSize);
+            m_streamer->SetRequestCompleteCallback(request, callback);
+            m_streamer->QueueRequest(request);
+        }
+
+        bool acquired = wait.try_acquire_for(AZStd::chrono::seconds(5));
+        ASSERT_TRUE(acquired);
+
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            if (i != 0)
+            {
+                EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+            }
+            azfree(buffers[i]);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture_WithScheduler, CancelRequest_CancelPendingRequest_PendingRequestCompletedWithCanceled)
+    {
+        constexpr size_t size = 16_kib;
+        // This needs to be a large enough number so there are requests in the queue. Due to the aggressive completion and queue, faster
+        // drives can prove to be able to read faster than requests can be queued.
+        constexpr size_t numRequests = 1024;
+
+        SetupStorageDrive(numRequests + 1); // Over commit so all request are queued in one go
+
+        CreateDummyFile(size);
+
+        AZStd::vector<char*> buffers(numRequests);
+        AZStd::vector<AZ::IO::FileRequestPtr> requests;
+        requests.reserve(numRequests);
+        m_streamer->CreateRequestBatch(requests, numRequests);
+
+        AZStd::atomic_int counter{ aznumeric_cast<int>(numRequests) };
+        AZStd::binary_semaphore wait;
+        auto callback = [&counter, &wait](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                wait.release();
+            }
+        };
+
+        for (size_t i = 0; i < numRequests; ++i)
+        {
+            buffers[i] = reinterpret_cast<char*>(azmalloc(size, TestPhysicalSectorSize));
+            m_streamer->Read(requests[i], m_dummyFilepath, buffers[i], size, size);
+            m_streamer->SetRequestCompleteCallback(requests[i], callback);
+        }
+
+        AZ::IO::FileRequest* cancelRequest = m_context->GetNewInternalRequest();
+        cancelRequest->CreateCancel(requests[numRequests - 1]);
+        AZ::IO::FileRequestPtr sentinalRequest = m_streamer->Custom({});
+        m_streamer->SetRequestCompleteCallback(sentinalRequest, [this, cancelRequest] (FileRequestHandle)
+            {
+                m_storageDriveLinux->QueueRequest(cancelRequest);
+            });
+
+        // Suspend processing so all request are processed fully before reading begins.
+        m_streamer->SuspendProcessing();
+        m_streamer->QueueRequestBatch(requests);
+        m_streamer->QueueRequest(sentinalRequest);
+        m_streamer->ResumeProcessing();
+
+        bool acquired = wait.try_acquire_for(AZStd::chrono::seconds(5));
+        ASSERT_TRUE(acquired);
+
+        ASSERT_EQ(0, counter);
+        for (size_t i = 0; i < numRequests - 1; ++i)
+        {
+            EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(requests[i]));
+            azfree(buffers[i]);
+        }
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Canceled, m_streamer->GetRequestStatus(requests[numRequests - 1]));
+        azfree(buffers[numRequests - 1]);
+    }
+} // namespace AZ::IO
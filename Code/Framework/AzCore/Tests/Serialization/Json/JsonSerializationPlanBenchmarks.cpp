@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace Benchmark
+{
+    // A reduced version of the layout of a prefab: a list of entities, each holding a number of polymorphic components
+    // that in turn have a couple of base classes. This exercises the same member lookups as loading an actual prefab,
+    // without requiring the full component framework.
+    namespace JsonSerializationPlanBenchmarkTypes
+    {
+        struct ComponentBase
+        {
+            AZ_CLASS_ALLOCATOR(ComponentBase, AZ::SystemAllocator);
+            AZ_RTTI(ComponentBase, "{1E36C1A6-93A1-4C6F-9B8A-7F1C64D1C2E0}");
+            virtual ~ComponentBase() = default;
+
+            AZ::u64 m_id{ 0 };
+        };
+
+        struct EditorComponentBase
+            : public ComponentBase
+        {
+            AZ_CLASS_ALLOCATOR(EditorComponentBase, AZ::SystemAllocator);
+            AZ_RTTI(EditorComponentBase, "{4B5E28A9-2E1D-4D89-8E1F-3B1C39F0B0D4}", ComponentBase);
+
+            bool m_visibleInEditor{ true };
+            bool m_locked{ false };
+        };
+
+        struct TransformComponent
+            : public EditorComponentBase
+        {
+            AZ_CLASS_ALLOCATOR(TransformComponent, AZ::SystemAllocator);
+            AZ_RTTI(TransformComponent, "{8A4E2C3D-6F17-4B0C-9F21-5D7E0A1B9C36}", EditorComponentBase);
+
+            float m_translateX{ 0.0f };
+            float m_translateY{ 0.0f };
+            float m_translateZ{ 0.0f };
+            float m_rotateX{ 0.0f };
+            float m_rotateY{ 0.0f };
+            float m_rotateZ{ 0.0f };
+            float m_scale{ 1.0f };
+            AZ::u64 m_parentId{ 0 };
+            bool m_isStatic{ false };
+        };
+
+        struct MeshComponent
+            : public EditorComponentBase
+        {
+            AZ_CLASS_ALLOCATOR(MeshComponent, AZ::SystemAllocator);
+            AZ_RTTI(MeshComponent, "{C02D1B58-1E2A-4C8E-AF7F-0E6B4A1F3D91}", EditorComponentBase);
+
+            AZStd::string m_assetPath;
+            AZ::s32 m_lodOverride{ -1 };
+            float m_minimumScreenCoverage{ 0.0f };
+            float m_qualityDecayRate{ 0.5f };
+            bool m_excludeFromReflectionCubeMaps{ false };
+            bool m_useForwardPassIblSpecular{ false };
+        };
+
+        struct Entity
+        {
+            AZ_CLASS_ALLOCATOR(Entity, AZ::SystemAllocator);
+            AZ_RTTI(Entity, "{E5A62D4F-3C1B-4F5A-8D2E-91B7C6A0F4E8}");
+
+            Entity() = default;
+            Entity(const Entity&) = delete;
+            Entity& operator=(const Entity&) = delete;
+            virtual ~Entity()
+            {
+                for (ComponentBase* component : m_components)
+                {
+                    delete component;
+                }
+            }
+
+            AZ::u64 m_id{ 0 };
+            AZStd::string m_name;
+            AZStd::vector<ComponentBase*> m_components;
+        };
+
+        struct Prefab
+        {
+            AZ_CLASS_ALLOCATOR(Prefab, AZ::SystemAllocator);
+            AZ_RTTI(Prefab, "{7F0C9E14-5B2D-4A63-B8E9-2D4C1A7E6F03}");
+
+            Prefab() = default;
+            Prefab(const Prefab&) = delete;
+            Prefab& operator=(const Prefab&) = delete;
+            virtual ~Prefab()
+            {
+                for (Entity* entity : m_entities)
+                {
+                    delete entity;
+                }
+            }
+
+            AZStd::string m_name;
+            AZStd::vector<Entity*> m_entities;
+        };
+
+        void Reflect(AZ::SerializeContext* context)
+        {
+            context->Class<ComponentBase>()
+                ->Field("Id", &ComponentBase::m_id);
+            context->Class<EditorComponentBase, ComponentBase>()
+                ->Field("VisibleInEditor", &EditorComponentBase::m_visibleInEditor)
+                ->Field("Locked", &EditorComponentBase::m_locked);
+            context->Class<TransformComponent, EditorComponentBase>()
+                ->Field("TranslateX", &TransformComponent::m_translateX)
+                ->Field("TranslateY", &TransformComponent::m_translateY)
+                ->Field("TranslateZ", &TransformComponent::m_translateZ)
+                ->Field("RotateX", &TransformComponent::m_rotateX)
+                ->Field("RotateY", &TransformComponent::m_rotateY)
+                ->Field("RotateZ", &TransformComponent::m_rotateZ)
+                ->Field("Scale", &TransformComponent::m_scale)
+                ->Field("ParentId", &TransformComponent::m_parentId)
+                ->Field("IsStatic", &TransformComponent::m_isStatic);
+            context->Class<MeshComponent, EditorComponentBase>()
+                ->Field("AssetPath", &MeshComponent::m_assetPath)
+                ->Field("LodOverride", &MeshComponent::m_lodOverride)
+                ->Field("MinimumScreenCoverage", &MeshComponent::m_minimumScreenCoverage)
+                ->Field("QualityDecayRate", &MeshComponent::m_qualityDecayRate)
+                ->Field("ExcludeFromReflectionCubeMaps", &MeshComponent::m_excludeFromReflectionCubeMaps)
+                ->Field("UseForwardPassIblSpecular", &MeshComponent::m_useForwardPassIblSpecular);
+            context->Class<Entity>()
+                ->Field("Id", &Entity::m_id)
+                ->Field("Name", &Entity::m_name)
+                ->Field("Components", &Entity::m_components);
+            context->Class<Prefab>()
+                ->Field("Name", &Prefab::m_name)
+                ->Field("Entities", &Prefab::m_entities);
+        }
+    } // namespace JsonSerializationPlanBenchmarkTypes
+
+    class BM_JsonSerializationPlan
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            using namespace JsonSerializationPlanBenchmarkTypes;
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_registrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            AZ::JsonSystemComponent::Reflect(m_serializeContext.get());
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            Reflect(m_serializeContext.get());
+
+            m_prefab = AZStd::make_unique<Prefab>();
+            m_prefab->m_name = "BenchmarkPrefab";
+            for (AZ::u64 i = 0; i < EntityCount; ++i)
+            {
+                Entity* entity = aznew Entity();
+                entity->m_id = i + 1;
+                entity->m_name = AZStd::string::format("Entity%llu", static_cast<unsigned long long>(i));
+
+                TransformComponent* transform = aznew TransformComponent();
+                transform->m_id = i * 2 + 1;
+                transform->m_translateX = static_cast<float>(i);
+                transform->m_rotateZ = static_cast<float>(i % 360);
+                transform->m_parentId = i / 8;
+                entity->m_components.push_back(transform);
+
+                MeshComponent* mesh = aznew MeshComponent();
+                mesh->m_id = i * 2 + 2;
+                mesh->m_assetPath = AZStd::string::format("objects/mesh_%llu.azmodel", static_cast<unsigned long long>(i % 16));
+                mesh->m_lodOverride = static_cast<AZ::s32>(i % 3);
+                entity->m_components.push_back(mesh);
+
+                m_prefab->m_entities.push_back(entity);
+            }
+
+            m_storeSettings.m_serializeContext = m_serializeContext.get();
+            m_storeSettings.m_registrationContext = m_registrationContext.get();
+            m_storeSettings.m_keepDefaults = true;
+            m_loadSettings.m_serializeContext = m_serializeContext.get();
+            m_loadSettings.m_registrationContext = m_registrationContext.get();
+
+            m_document = AZStd::make_unique<rapidjson::Document>();
+            AZ::JsonSerialization::Store(*m_document, m_document->GetAllocator(), *m_prefab, m_storeSettings);
+        }
+
+        void internalTearDown()
+        {
+            m_document.reset();
+            m_prefab.reset();
+            m_planCache.Clear();
+
+            m_serializeContext->EnableRemoveReflection();
+            m_registrationContext->EnableRemoveReflection();
+            JsonSerializationPlanBenchmarkTypes::Reflect(m_serializeContext.get());
+            AZ::JsonSystemComponent::Reflect(m_serializeContext.get());
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            m_serializeContext->DisableRemoveReflection();
+            m_registrationContext->DisableRemoveReflection();
+
+            m_registrationContext.reset();
+            m_serializeContext.reset();
+        }
+
+    public:
+        static constexpr AZ::u64 EntityCount = 2000;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void LoadPrefab(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                auto prefab = AZStd::make_unique<JsonSerializationPlanBenchmarkTypes::Prefab>();
+                state.ResumeTiming();
+
+                benchmark::DoNotOptimize(AZ::JsonSerialization::Load(*prefab, *m_document, m_loadSettings));
+
+                state.PauseTiming();
+                prefab.reset();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * EntityCount);
+        }
+
+        void StorePrefab(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                rapidjson::Document document;
+                benchmark::DoNotOptimize(AZ::JsonSerialization::Store(document, document.GetAllocator(), *m_prefab, m_storeSettings));
+            }
+            state.SetItemsProcessed(state.iterations() * EntityCount);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_registrationContext;
+        AZStd::unique_ptr<JsonSerializationPlanBenchmarkTypes::Prefab> m_prefab;
+        AZStd::unique_ptr<rapidjson::Document> m_document;
+        AZ::JsonSerializationPlanCache m_planCache;
+        AZ::JsonSerializerSettings m_storeSettings;
+        AZ::JsonDeserializerSettings m_loadSettings;
+    };
+
+    BENCHMARK_F(BM_JsonSerializationPlan, LoadPrefab_WithoutPlans)(benchmark::State& state)
+    {
+        LoadPrefab(state);
+    }
+
+    BENCHMARK_F(BM_JsonSerializationPlan, LoadPrefab_WithPlans)(benchmark::State& state)
+    {
+        m_loadSettings.m_planCache = &m_planCache;
+        LoadPrefab(state);
+    }
+
+    BENCHMARK_F(BM_JsonSerializationPlan, StorePrefab_WithoutPlans)(benchmark::State& state)
+    {
+        StorePrefab(state);
+    }
+
+    BENCHMARK_F(BM_JsonSerializationPlan, StorePrefab_WithPlans)(benchmark::State& state)
+    {
+        m_storeSettings.m_planCache = &m_planCache;
+        StorePrefab(state);
+    }
+} // namespace Benchmark
+
+#endif
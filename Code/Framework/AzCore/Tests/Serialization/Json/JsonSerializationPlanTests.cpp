@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
+#include <AzCore/std/string/string.h>
+#include <Tests/Serialization/Json/JsonSerializationTests.h>
+#include <Tests/Serialization/Json/TestCases.h>
+
+namespace JsonSerializationTests
+{
+    // The json serialization should behave exactly the same whether or not a plan cache is used, so these run a subset of
+    // the regular serialization tests with a plan cache.
+    template<typename T>
+    class TypedJsonSerializationPlanTests
+        : public JsonSerializationTests
+    {
+    public:
+        using SerializableStruct = T;
+
+        ~TypedJsonSerializationPlanTests() override = default;
+
+        void SetUp() override
+        {
+            JsonSerializationTests::SetUp();
+            m_planCache = AZStd::make_unique<AZ::JsonSerializationPlanCache>();
+            m_serializationSettings->m_planCache = m_planCache.get();
+            m_deserializationSettings->m_planCache = m_planCache.get();
+        }
+
+        void TearDown() override
+        {
+            m_planCache.reset();
+            JsonSerializationTests::TearDown();
+        }
+
+        void Reflect(bool fullReflection)
+        {
+            SerializableStruct::Reflect(m_serializeContext, fullReflection);
+            m_fullyReflected = fullReflection;
+        }
+
+        AZStd::unique_ptr<AZ::JsonSerializationPlanCache> m_planCache;
+        bool m_fullyReflected = true;
+    };
+
+    TYPED_TEST_CASE(TypedJsonSerializationPlanTests, JsonSerializationTestCases);
+
+    TYPED_TEST(TypedJsonSerializationPlanTests, Store_SerializeWithSomeDefaults_StoredSuccessfullyAndJsonMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        this->m_serializationSettings->m_keepDefaults = false;
+
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        ResultCode result = AZ::JsonSerialization::Store(*this->m_jsonDocument, this->m_jsonDocument->GetAllocator(),
+            *description.m_instance, *this->m_serializationSettings);
+
+        bool partialDefaultsSupported = TypeParam::SupportsPartialDefaults;
+        EXPECT_EQ(partialDefaultsSupported ? Outcomes::PartialDefaults : Outcomes::DefaultsUsed, result.GetOutcome());
+        this->Expect_DocStrEq(description.m_jsonWithStrippedDefaults);
+    }
+
+    TYPED_TEST(TypedJsonSerializationPlanTests, Load_JsonWithSomeDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+        bool validResult =
+            loadResult.GetOutcome() == Outcomes::Success ||
+            loadResult.GetOutcome() == Outcomes::DefaultsUsed ||
+            loadResult.GetOutcome() == Outcomes::PartialDefaults;
+        EXPECT_TRUE(validResult);
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationPlanTests, Load_JsonWithSomeDefaultsKept_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithKeptDefaults);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationPlanTests, Store_SerializeWithUnknownType_UnknownTypeReturned)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(false);
+        this->m_serializationSettings->m_keepDefaults = true;
+
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        ResultCode result = AZ::JsonSerialization::Store(*this->m_jsonDocument, this->m_jsonDocument->GetAllocator(),
+            *description.m_instance, *this->m_serializationSettings);
+        EXPECT_EQ(Outcomes::Unknown, result.GetOutcome());
+    }
+
+    TYPED_TEST(TypedJsonSerializationPlanTests, LoadAndStore_RoundTripTwice_StoredObjectCanBeLoadedAgain)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        this->m_serializationSettings->m_keepDefaults = true;
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+
+        // The second round trip runs on the plans created during the first.
+        for (int i = 0; i < 2; ++i)
+        {
+            ResultCode storeResult = AZ::JsonSerialization::Store(*this->m_jsonDocument, this->m_jsonDocument->GetAllocator(),
+                *description.m_instance, *this->m_serializationSettings);
+            ASSERT_NE(Processing::Halted, storeResult.GetProcessing());
+
+            TypeParam loadInstance;
+            ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+            ASSERT_NE(Processing::Halted, loadResult.GetProcessing());
+            EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+        }
+    }
+
+    TYPED_TEST(TypedJsonSerializationPlanTests, Load_JsonAdditionalFields_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+        this->InjectAdditionalFields(*this->m_jsonDocument, rapidjson::kStringType, this->m_jsonDocument->GetAllocator());
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+        ASSERT_NE(Processing::Halted, loadResult.GetProcessing());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    struct PlanBaseClass
+    {
+        AZ_RTTI(PlanBaseClass, "{6B6C3E4A-0F2B-4F77-9F7C-4D8AC5E0F0A1}");
+        virtual ~PlanBaseClass() = default;
+
+        int m_shared{ 1 };
+        int m_baseOnly{ 2 };
+    };
+
+    struct PlanDerivedClass
+        : public PlanBaseClass
+    {
+        AZ_RTTI(PlanDerivedClass, "{0A9C2C5B-6E54-4C1F-A0D9-8D3E5D0C3B72}", PlanBaseClass);
+        ~PlanDerivedClass() override = default;
+
+        int m_shared{ 3 };
+        AZStd::string m_name{ "default" };
+    };
+
+    class JsonSerializationPlanTests
+        : public JsonSerializationTests
+    {
+    public:
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& context) override
+        {
+            context->Class<PlanBaseClass>()
+                ->Field("shared", &PlanBaseClass::m_shared)
+                ->Field("baseOnly", &PlanBaseClass::m_baseOnly);
+            context->Class<PlanDerivedClass, PlanBaseClass>()
+                ->Field("shared", &PlanDerivedClass::m_shared)
+                ->Field("name", &PlanDerivedClass::m_name);
+        }
+
+        AZ::JsonSerializationPlanCache m_planCache;
+    };
+
+    TEST_F(JsonSerializationPlanTests, Load_NameConflictWithBaseClass_DerivedMemberTakesPrecedence)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        m_deserializationSettings->m_planCache = &m_planCache;
+        m_jsonDocument->Parse(R"({ "shared": 42, "baseOnly": 88, "name": "hello" })");
+
+        PlanDerivedClass instance;
+        ResultCode result = AZ::JsonSerialization::Load(instance, *m_jsonDocument, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::PartialDefaults, result.GetOutcome());
+        EXPECT_EQ(42, instance.m_shared);
+        EXPECT_EQ(1, instance.PlanBaseClass::m_shared);
+        EXPECT_EQ(88, instance.m_baseOnly);
+        EXPECT_EQ("hello", instance.m_name);
+    }
+
+    TEST_F(JsonSerializationPlanTests, Load_MatchesLoadWithoutPlan)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        m_jsonDocument->Parse(R"({ "baseOnly": 88, "unknown": 5, "name": "hello" })");
+
+        PlanDerivedClass withoutPlan;
+        ResultCode resultWithoutPlan = AZ::JsonSerialization::Load(withoutPlan, *m_jsonDocument, *m_deserializationSettings);
+
+        m_deserializationSettings->m_planCache = &m_planCache;
+        PlanDerivedClass withPlan;
+        ResultCode resultWithPlan = AZ::JsonSerialization::Load(withPlan, *m_jsonDocument, *m_deserializationSettings);
+
+        EXPECT_EQ(resultWithoutPlan.GetOutcome(), resultWithPlan.GetOutcome());
+        EXPECT_EQ(resultWithoutPlan.GetProcessing(), resultWithPlan.GetProcessing());
+        EXPECT_EQ(withoutPlan.m_shared, withPlan.m_shared);
+        EXPECT_EQ(withoutPlan.PlanBaseClass::m_shared, withPlan.PlanBaseClass::m_shared);
+        EXPECT_EQ(withoutPlan.m_baseOnly, withPlan.m_baseOnly);
+        EXPECT_EQ(withoutPlan.m_name, withPlan.m_name);
+    }
+
+    TEST_F(JsonSerializationPlanTests, Store_MatchesStoreWithoutPlan)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        PlanDerivedClass instance;
+        instance.m_shared = 42;
+        instance.m_baseOnly = 88;
+        instance.m_name = "hello";
+
+        rapidjson::Document withoutPlan;
+        ResultCode resultWithoutPlan =
+            AZ::JsonSerialization::Store(withoutPlan, withoutPlan.GetAllocator(), instance, *m_serializationSettings);
+
+        m_serializationSettings->m_planCache = &m_planCache;
+        rapidjson::Document withPlan;
+        ResultCode resultWithPlan = AZ::JsonSerialization::Store(withPlan, withPlan.GetAllocator(), instance, *m_serializationSettings);
+
+        EXPECT_EQ(resultWithoutPlan.GetOutcome(), resultWithPlan.GetOutcome());
+        Expect_DocStrEq(withoutPlan, withPlan);
+    }
+
+    TEST_F(JsonSerializationPlanTests, GetPlan_CalledRepeatedly_PlanIsOnlyCreatedOnce)
+    {
+        m_deserializationSettings->m_planCache = &m_planCache;
+        m_jsonDocument->Parse(R"({ "name": "hello" })");
+
+        for (int i = 0; i < 4; ++i)
+        {
+            PlanDerivedClass instance;
+            AZ::JsonSerialization::Load(instance, *m_jsonDocument, *m_deserializationSettings);
+        }
+        EXPECT_EQ(1, m_planCache.GetPlanCount());
+
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<PlanDerivedClass>());
+        ASSERT_NE(nullptr, classData);
+        const AZ::JsonClassPlan& plan = m_planCache.GetPlan(*classData, *m_serializeContext, *m_jsonRegistrationContext);
+        EXPECT_EQ(&plan, &m_planCache.GetPlan(*classData, *m_serializeContext, *m_jsonRegistrationContext));
+        EXPECT_EQ(4, plan.GetElementCount());
+        EXPECT_EQ(nullptr, plan.FindLoadField(AZ::Crc32("missing")));
+
+        m_planCache.Clear();
+        EXPECT_EQ(0, m_planCache.GetPlanCount());
+    }
+
+    TEST_F(JsonSerializationPlanTests, GetPlan_DifferentSerializeContext_CacheIsReset)
+    {
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<PlanDerivedClass>());
+        ASSERT_NE(nullptr, classData);
+        m_planCache.GetPlan(*classData, *m_serializeContext, *m_jsonRegistrationContext);
+        EXPECT_EQ(1, m_planCache.GetPlanCount());
+
+        AZ::SerializeContext otherContext;
+        otherContext.Class<PlanBaseClass>()->Field("shared", &PlanBaseClass::m_shared);
+        const AZ::SerializeContext::ClassData* otherClassData = otherContext.FindClassData(azrtti_typeid<PlanBaseClass>());
+        ASSERT_NE(nullptr, otherClassData);
+        const AZ::JsonClassPlan& plan = m_planCache.GetPlan(*otherClassData, otherContext, *m_jsonRegistrationContext);
+        EXPECT_EQ(1, m_planCache.GetPlanCount());
+        EXPECT_EQ(otherClassData, &plan.GetClassData());
+
+        m_planCache.Clear();
+    }
+} // namespace JsonSerializationTests
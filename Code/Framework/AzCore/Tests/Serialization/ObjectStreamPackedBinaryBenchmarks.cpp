@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace Benchmark
+{
+    // A reduced version of the data found in navigation and terrain assets: large arrays of small structs that only hold
+    // numbers, which is the case the packed binary format is intended for.
+    namespace ObjectStreamPackedBinaryBenchmarkTypes
+    {
+        struct Vertex
+        {
+            AZ_TYPE_INFO(Vertex, "{3F6A9D2C-8B1E-4C7F-A0D5-2E9B4C1F7A63}");
+
+            float m_x{ 0.0f };
+            float m_y{ 0.0f };
+            float m_z{ 0.0f };
+            AZ::u32 m_flags{ 0 };
+        };
+
+        struct Polygon
+        {
+            AZ_TYPE_INFO(Polygon, "{A8C2E5F1-4D7B-4E9A-B3C6-0F1D8E2A5B94}");
+
+            AZ::u16 m_vertex0{ 0 };
+            AZ::u16 m_vertex1{ 0 };
+            AZ::u16 m_vertex2{ 0 };
+            AZ::u16 m_neighbor0{ 0 };
+            AZ::u16 m_neighbor1{ 0 };
+            AZ::u16 m_neighbor2{ 0 };
+            AZ::u8 m_area{ 0 };
+            AZ::u8 m_type{ 0 };
+        };
+
+        struct Mesh
+        {
+            AZ_TYPE_INFO(Mesh, "{D4E7B1A3-6C2F-4A8D-9E5B-7C0A3F1D2E86}");
+
+            AZStd::vector<Vertex> m_vertices;
+            AZStd::vector<Polygon> m_polygons;
+            AZ::u32 m_revision{ 0 };
+        };
+
+        void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<Vertex>()
+                ->Field("X", &Vertex::m_x)
+                ->Field("Y", &Vertex::m_y)
+                ->Field("Z", &Vertex::m_z)
+                ->Field("Flags", &Vertex::m_flags);
+            context.Class<Polygon>()
+                ->Field("Vertex0", &Polygon::m_vertex0)
+                ->Field("Vertex1", &Polygon::m_vertex1)
+                ->Field("Vertex2", &Polygon::m_vertex2)
+                ->Field("Neighbor0", &Polygon::m_neighbor0)
+                ->Field("Neighbor1", &Polygon::m_neighbor1)
+                ->Field("Neighbor2", &Polygon::m_neighbor2)
+                ->Field("Area", &Polygon::m_area)
+                ->Field("Type", &Polygon::m_type);
+            context.Class<Mesh>()
+                ->Field("Vertices", &Mesh::m_vertices)
+                ->Field("Polygons", &Mesh::m_polygons)
+                ->Field("Revision", &Mesh::m_revision);
+        }
+    } // namespace ObjectStreamPackedBinaryBenchmarkTypes
+
+    class BM_ObjectStreamPackedBinary
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            using namespace ObjectStreamPackedBinaryBenchmarkTypes;
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            Reflect(*m_serializeContext);
+
+            m_mesh = AZStd::make_unique<Mesh>();
+            m_mesh->m_vertices.reserve(VertexCount);
+            for (AZ::u32 i = 0; i < VertexCount; ++i)
+            {
+                m_mesh->m_vertices.push_back(Vertex{ static_cast<float>(i % 256), static_cast<float>(i / 256), 0.5f, i & 0xF });
+            }
+            m_mesh->m_polygons.resize(VertexCount / 2);
+            for (AZ::u32 i = 0; i < VertexCount / 2; ++i)
+            {
+                Polygon& polygon = m_mesh->m_polygons[i];
+                polygon.m_vertex0 = static_cast<AZ::u16>(i);
+                polygon.m_vertex1 = static_cast<AZ::u16>(i + 1);
+                polygon.m_vertex2 = static_cast<AZ::u16>(i + 256);
+                polygon.m_area = static_cast<AZ::u8>(i % 4);
+            }
+            m_mesh->m_revision = 1;
+
+            Save(m_binaryBuffer, AZ::DataStream::ST_BINARY);
+            Save(m_packedBuffer, AZ::DataStream::ST_BINARY_PACKED);
+        }
+
+        void internalTearDown()
+        {
+            m_packedBuffer = {};
+            m_binaryBuffer = {};
+            m_mesh.reset();
+            m_serializeContext.reset();
+        }
+
+        void Save(AZStd::vector<char>& buffer, AZ::DataStream::StreamType streamType)
+        {
+            buffer.clear();
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            AZ::Utils::SaveObjectToStream(stream, streamType, m_mesh.get(), m_serializeContext.get());
+        }
+
+    public:
+        static constexpr AZ::u32 VertexCount = 64 * 1024;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void LoadMesh(benchmark::State& state, const AZStd::vector<char>& buffer)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                auto mesh = AZStd::make_unique<ObjectStreamPackedBinaryBenchmarkTypes::Mesh>();
+                state.ResumeTiming();
+
+                benchmark::DoNotOptimize(AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), *mesh, m_serializeContext.get()));
+
+                state.PauseTiming();
+                mesh.reset();
+                state.ResumeTiming();
+            }
+            state.SetBytesProcessed(state.iterations() * buffer.size());
+            state.SetItemsProcessed(state.iterations() * VertexCount);
+        }
+
+        void SaveMesh(benchmark::State& state, AZ::DataStream::StreamType streamType)
+        {
+            AZStd::vector<char> buffer;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                Save(buffer, streamType);
+                benchmark::DoNotOptimize(buffer.data());
+            }
+            state.SetItemsProcessed(state.iterations() * VertexCount);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<ObjectStreamPackedBinaryBenchmarkTypes::Mesh> m_mesh;
+        AZStd::vector<char> m_binaryBuffer;
+        AZStd::vector<char> m_packedBuffer;
+    };
+
+    BENCHMARK_F(BM_ObjectStreamPackedBinary, LoadMesh_Binary)(benchmark::State& state)
+    {
+        LoadMesh(state, m_binaryBuffer);
+    }
+
+    BENCHMARK_F(BM_ObjectStreamPackedBinary, LoadMesh_BinaryPacked)(benchmark::State& state)
+    {
+        LoadMesh(state, m_packedBuffer);
+    }
+
+    BENCHMARK_F(BM_ObjectStreamPackedBinary, SaveMesh_Binary)(benchmark::State& state)
+    {
+        SaveMesh(state, AZ::DataStream::ST_BINARY);
+    }
+
+    BENCHMARK_F(BM_ObjectStreamPackedBinary, SaveMesh_BinaryPacked)(benchmark::State& state)
+    {
+        SaveMesh(state, AZ::DataStream::ST_BINARY_PACKED);
+    }
+} // namespace Benchmark
+
+#endif
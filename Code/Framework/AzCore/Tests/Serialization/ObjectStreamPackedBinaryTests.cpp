@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    namespace ObjectStreamPackedBinaryTestTypes
+    {
+        struct Point
+        {
+            AZ_TYPE_INFO(Point, "{6A1B0C5E-2D8F-4E7A-9B3C-1F0E5D2A4C87}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<Point>()
+                    ->Field("X", &Point::m_x)
+                    ->Field("Y", &Point::m_y)
+                    ->Field("Z", &Point::m_z);
+            }
+
+            float m_x{ 0.0f };
+            float m_y{ 0.0f };
+            float m_z{ 0.0f };
+        };
+
+        // Uses the same type id as Point, but replaces Z with W, to simulate the class changing after data was saved.
+        struct PointChanged
+        {
+            AZ_TYPE_INFO(PointChanged, "{6A1B0C5E-2D8F-4E7A-9B3C-1F0E5D2A4C87}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<PointChanged>()
+                    ->Field("X", &PointChanged::m_x)
+                    ->Field("Y", &PointChanged::m_y)
+                    ->Field("W", &PointChanged::m_w);
+            }
+
+            float m_x{ 0.0f };
+            float m_y{ 0.0f };
+            float m_w{ 7.0f };
+        };
+
+        struct Particle
+        {
+            AZ_TYPE_INFO(Particle, "{0E4C8B2A-7D1F-4A6E-8C3B-5F9A2D1E7B40}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<Particle>()
+                    ->Field("Position", &Particle::m_position)
+                    ->Field("Velocity", &Particle::m_velocity)
+                    ->Field("Flags", &Particle::m_flags)
+                    ->Field("Alive", &Particle::m_alive)
+                    ->Field("Age", &Particle::m_age)
+                    ->Field("Id", &Particle::m_id)
+                    ->Field("Group", &Particle::m_group);
+            }
+
+            Point m_position;
+            Point m_velocity;
+            AZ::u8 m_flags{ 0 };
+            bool m_alive{ false };
+            double m_age{ 0.0 };
+            AZ::s64 m_id{ 0 };
+            AZ::u16 m_group{ 0 };
+        };
+
+        struct Shape
+        {
+            AZ_RTTI(Shape, "{B53F2E9D-1C4A-4F8B-A7E6-3D0C9B2F5A18}");
+            virtual ~Shape() = default;
+
+            AZ::u32 m_color{ 0 };
+        };
+
+        struct Box
+            : public Shape
+        {
+            AZ_RTTI(Box, "{2C7E9A1F-6B3D-4E5C-9F8A-0D4B1E6C3A72}", Shape);
+
+            Point m_extents;
+            float m_roundness{ 0.0f };
+        };
+
+        // Mixes data that can be packed with data that can't.
+        struct Scene
+        {
+            AZ_TYPE_INFO(Scene, "{F1D6A3C8-5E2B-4B9F-8A7D-6C0E3B1F9D25}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                Point::Reflect(context);
+                Particle::Reflect(context);
+                context.Class<Shape>()
+                    ->Field("Color", &Shape::m_color);
+                context.Class<Box, Shape>()
+                    ->Field("Extents", &Box::m_extents)
+                    ->Field("Roundness", &Box::m_roundness);
+                context.Class<Scene>()
+                    ->Field("Name", &Scene::m_name)
+                    ->Field("Box", &Scene::m_box)
+                    ->Field("Weights", &Scene::m_weights)
+                    ->Field("Particles", &Scene::m_particles)
+                    ->Field("Tint", &Scene::m_tint)
+                    ->Field("Path", &Scene::m_path)
+                    ->Field("Frame", &Scene::m_frame);
+            }
+
+            AZStd::string m_name;
+            Box m_box;
+            AZStd::vector<float> m_weights;
+            AZStd::vector<Particle> m_particles;
+            AZStd::array<float, 4> m_tint{};
+            AZStd::list<Point> m_path;
+            AZ::u32 m_frame{ 0 };
+        };
+
+        struct PointHolder
+        {
+            AZ_TYPE_INFO(PointHolder, "{8D2A5F1C-3E7B-4C9A-B6D0-7E1F4A2C8B93}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                Point::Reflect(context);
+                context.Class<PointHolder>()
+                    ->Field("Point", &PointHolder::m_point)
+                    ->Field("Points", &PointHolder::m_points)
+                    ->Field("After", &PointHolder::m_after);
+            }
+
+            Point m_point;
+            AZStd::vector<Point> m_points;
+            AZ::s32 m_after{ 0 };
+        };
+
+        struct PointHolderChanged
+        {
+            AZ_TYPE_INFO(PointHolderChanged, "{8D2A5F1C-3E7B-4C9A-B6D0-7E1F4A2C8B93}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                PointChanged::Reflect(context);
+                context.Class<PointHolderChanged>()
+                    ->Field("Point", &PointHolderChanged::m_point)
+                    ->Field("Points", &PointHolderChanged::m_points)
+                    ->Field("After", &PointHolderChanged::m_after);
+            }
+
+            PointChanged m_point;
+            AZStd::vector<PointChanged> m_points;
+            AZ::s32 m_after{ 0 };
+        };
+
+        struct Sample
+        {
+            AZ_TYPE_INFO(Sample, "{4B9E1D7A-2F6C-4A3E-8D5B-9C0F2E7A1B64}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<Sample>()
+                    ->Version(1)
+                    ->Field("Value", &Sample::m_value)
+                    ->Field("Count", &Sample::m_count);
+            }
+
+            float m_value{ 0.0f };
+            AZ::u32 m_count{ 0 };
+        };
+
+        // Version 2 of Sample, which stores the value as a double and doubles it on conversion.
+        struct SampleV2
+        {
+            AZ_TYPE_INFO(SampleV2, "{4B9E1D7A-2F6C-4A3E-8D5B-9C0F2E7A1B64}");
+
+            static bool Convert(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
+            {
+                float value = 0.0f;
+                if (!classElement.GetChildData(AZ_CRC_CE("Value"), value))
+                {
+                    return false;
+                }
+                classElement.RemoveElementByName(AZ_CRC_CE("Value"));
+                classElement.AddElementWithData(context, "Value", static_cast<double>(value) * 2.0);
+                return true;
+            }
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<SampleV2>()
+                    ->Version(2, &SampleV2::Convert)
+                    ->Field("Value", &SampleV2::m_value)
+                    ->Field("Count", &SampleV2::m_count);
+            }
+
+            double m_value{ 0.0 };
+            AZ::u32 m_count{ 0 };
+        };
+
+        // Can't be packed because of the string, but holds a packed point.
+        struct Label
+        {
+            AZ_TYPE_INFO(Label, "{C7A0E3B5-9D1F-4E2C-A8B6-1F5D3C9E7A20}");
+
+            AZStd::string m_text;
+            Point m_anchor;
+        };
+
+        struct LabeledPoint
+        {
+            AZ_TYPE_INFO(LabeledPoint, "{5E8B2D6F-0A4C-4B1E-9F7D-3A6C8E2B0D51}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                Point::Reflect(context);
+                context.Class<Label>()
+                    ->Field("Text", &Label::m_text)
+                    ->Field("Anchor", &Label::m_anchor);
+                context.Class<LabeledPoint>()
+                    ->Field("Label", &LabeledPoint::m_label)
+                    ->Field("Point", &LabeledPoint::m_point)
+                    ->Field("After", &LabeledPoint::m_after);
+            }
+
+            Label m_label;
+            Point m_point;
+            AZ::u32 m_after{ 0 };
+        };
+
+        // LabeledPoint without the label, which also isn't reflected.
+        struct UnlabeledPoint
+        {
+            AZ_TYPE_INFO(UnlabeledPoint, "{5E8B2D6F-0A4C-4B1E-9F7D-3A6C8E2B0D51}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                Point::Reflect(context);
+                context.Class<UnlabeledPoint>()
+                    ->Field("Point", &UnlabeledPoint::m_point)
+                    ->Field("After", &UnlabeledPoint::m_after);
+            }
+
+            Point m_point;
+            AZ::u32 m_after{ 0 };
+        };
+
+        // Hides the memory of the stream, so packed data has to be read through the stream.
+        class NonContiguousMemoryStream
+            : public AZ::IO::MemoryStream
+        {
+        public:
+            using AZ::IO::MemoryStream::MemoryStream;
+
+            const void* GetContiguousData() const override
+            {
+                return nullptr;
+            }
+        };
+    } // namespace ObjectStreamPackedBinaryTestTypes
+
+    class ObjectStreamPackedBinaryTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_saveContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_loadContext = AZStd::make_unique<AZ::SerializeContext>();
+        }
+
+        void TearDown() override
+        {
+            m_loadContext.reset();
+            m_saveContext.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        template<typename T>
+        AZStd::vector<char> Save(const T& object, AZ::DataStream::StreamType streamType)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            EXPECT_TRUE(AZ::Utils::SaveObjectToStream(stream, streamType, &object, m_saveContext.get()));
+            return buffer;
+        }
+
+        template<typename T>
+        bool Load(const AZStd::vector<char>& buffer, T& object, AZ::u32 filterFlags = 0)
+        {
+            return AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), object, m_loadContext.get(),
+                AZ::ObjectStream::FilterDescriptor(nullptr, filterFlags));
+        }
+
+        static ObjectStreamPackedBinaryTestTypes::Scene CreateScene()
+        {
+            using namespace ObjectStreamPackedBinaryTestTypes;
+
+            Scene scene;
+            scene.m_name = "Scene";
+            scene.m_box.m_color = 0xFF8000FF;
+            scene.m_box.m_extents = { 1.0f, 2.0f, 3.0f };
+            scene.m_box.m_roundness = 0.25f;
+            scene.m_weights = { 0.5f, 1.5f, 2.5f, 3.5f, 4.5f };
+            for (int i = 0; i < 16; ++i)
+            {
+                Particle& particle = scene.m_particles.emplace_back();
+                particle.m_position = { static_cast<float>(i), 1.0f, -static_cast<float>(i) };
+                particle.m_velocity = { 0.0f, static_cast<float>(i) * 0.5f, 2.0f };
+                particle.m_flags = static_cast<AZ::u8>(i * 3);
+                particle.m_alive = (i % 2) == 0;
+                particle.m_age = i * 0.125;
+                particle.m_id = -1000 - i;
+                particle.m_group = static_cast<AZ::u16>(i * 100);
+            }
+            scene.m_tint = { 0.1f, 0.2f, 0.3f, 1.0f };
+            scene.m_path = { Point{ 1.0f, 0.0f, 0.0f }, Point{ 2.0f, 1.0f, 0.0f }, Point{ 3.0f, 1.0f, 1.0f } };
+            scene.m_frame = 42;
+            return scene;
+        }
+
+        static void ExpectPointEq(const ObjectStreamPackedBinaryTestTypes::Point& expected, const ObjectStreamPackedBinaryTestTypes::Point& actual)
+        {
+            EXPECT_EQ(expected.m_x, actual.m_x);
+            EXPECT_EQ(expected.m_y, actual.m_y);
+            EXPECT_EQ(expected.m_z, actual.m_z);
+        }
+
+        static void ExpectSceneEq(const ObjectStreamPackedBinaryTestTypes::Scene& expected, const ObjectStreamPackedBinaryTestTypes::Scene& actual)
+        {
+            EXPECT_STREQ(expected.m_name.c_str(), actual.m_name.c_str());
+            EXPECT_EQ(expected.m_box.m_color, actual.m_box.m_color);
+            ExpectPointEq(expected.m_box.m_extents, actual.m_box.m_extents);
+            EXPECT_EQ(expected.m_box.m_roundness, actual.m_box.m_roundness);
+            EXPECT_EQ(expected.m_weights, actual.m_weights);
+            ASSERT_EQ(expected.m_particles.size(), actual.m_particles.size());
+            for (size_t i = 0; i < expected.m_particles.size(); ++i)
+            {
+                ExpectPointEq(expected.m_particles[i].m_position, actual.m_particles[i].m_position);
+                ExpectPointEq(expected.m_particles[i].m_velocity, actual.m_particles[i].m_velocity);
+                EXPECT_EQ(expected.m_particles[i].m_flags, actual.m_particles[i].m_flags);
+                EXPECT_EQ(expected.m_particles[i].m_alive, actual.m_particles[i].m_alive);
+                EXPECT_EQ(expected.m_particles[i].m_age, actual.m_particles[i].m_age);
+                EXPECT_EQ(expected.m_particles[i].m_id, actual.m_particles[i].m_id);
+                EXPECT_EQ(expected.m_particles[i].m_group, actual.m_particles[i].m_group);
+            }
+            EXPECT_EQ(expected.m_tint, actual.m_tint);
+            ASSERT_EQ(expected.m_path.size(), actual.m_path.size());
+            for (auto expectedIt = expected.m_path.begin(), actualIt = actual.m_path.begin(); expectedIt != expected.m_path.end(); ++expectedIt, ++actualIt)
+            {
+                ExpectPointEq(*expectedIt, *actualIt);
+            }
+            EXPECT_EQ(expected.m_frame, actual.m_frame);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_saveContext;
+        AZStd::unique_ptr<AZ::SerializeContext> m_loadContext;
+    };
+
+    TEST_F(ObjectStreamPackedBinaryTests, Load_PackedStream_ObjectMatches)
+    {
+        using namespace ObjectStreamPackedBinaryTestTypes;
+        Scene::Reflect(*m_saveContext);
+        Scene::Reflect(*m_loadContext);
+
+        Scene scene = CreateScene();
+        AZStd::vector<char> buffer = Save(scene, AZ::DataStream::ST_BINARY_PACKED);
+
+        Scene loaded;
+        ASSERT_TRUE(Load(buffer, loaded));
+        ExpectSceneEq(scene, loaded);
+    }
+
+    TEST_F(ObjectStreamPackedBinaryTests, Load_PackedStreamWithoutContiguousData_ObjectMatches)
+    {
+        using namespace ObjectStreamPackedBinaryTestTypes;
+        Scene::Reflect(*m_saveContext);
+        Scene::Reflect(*m_loadContext);
+
+        Scene scene = CreateScene();
+        AZStd::vector<char> buffer = Save(scene, AZ::DataStream::ST_BINARY_PACKED);
+
+        Scene loaded;
+        NonContiguousMemoryStream stream(buffer.data(), buffer.size());
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_loadContext.get()));
+        ExpectSceneEq(scene, loaded);
+    }
+
+    TEST_F(ObjectStreamPackedBinaryTests, Load_PackedStreamIntoFilledContainers_ContainersAreReplaced)
+    {
+        using namespace ObjectStreamPackedBinaryTestTypes;
+        Scene::Reflect(*m_saveContext);
+        Scene::Reflect(*m_loadContext);
+
+        Scene scene = CreateScene();
+        AZStd::vector<char> buffer = Save(scene, AZ::DataStream::ST_BINARY_PACKED);
+
+        Scene loaded;
+        loaded.m_weights.resize(100, 9.0f);
+        loaded.m_particles.resize(50);
+        loaded.m_path.resize(10);
+        ASSERT_TRUE(Load(buffer, loaded));
+        ExpectSceneEq(scene, loaded);
+    }
+
+    TEST_F(ObjectStreamPackedBinaryTests, Save_PackedStream_SmallerThanBinaryStream)
+    {
+        using namespace ObjectStreamPackedBinaryTestTypes;
+        PointHolder::Reflect(*m_saveContext);
+
+        PointHolder holder;
+        for (int i = 0; i < 1000; ++i)
+        {
+            holder.m_points.push_back(Point{ static_cast<float>(i), 0.0f, 1.0f });
+        }
+
+        AZStd::vector<char> binary = Save(holder, AZ::DataStream::ST_BINARY);
+        AZStd::vector<char> packed = Save(holder, AZ::DataStream::ST_BINARY_PACKED);
+        EXPECT_LT(packed.size() * 4, binary.size());
+    }
+
+    TEST_F(ObjectStreamPackedBinaryTests, Load_BinaryStream_StillLoads)
+    {
+        using namespace ObjectStreamPackedBinaryTestTypes;
+        Scene::Reflect(*m_saveContext);
+        Scene::Reflect(*m_loadContext);
+
+        Scene scene = CreateScene();
+        AZStd::vector<char> buffer = Save(scene, AZ::DataStream::ST_BINARY);
+
+        Scene loaded;
+        ASSERT_TRUE(Load(buffer, loaded));
+        ExpectSceneEq(scene, loaded);
+    }
+
+    TEST_F(ObjectStreamPackedBinaryTests, Load_ClassChangedSinceSaving_MatchingMembersAreLoaded)
+    {
+        using namespace ObjectStreamPackedBinaryTestTypes;
+        PointHolder::Reflect(*m_saveContext);
+        PointHolderChanged::Reflect(*m_loadContext);
+
+        PointHolder holder;
+        holder.m_point = { 1.0f, 2.0f, 3.0f };
+        holder.m_points = { Point{ 4.0f, 5.0f, 6.0f }, Point{ 7.0f, 8.0f, 9.0f } };
+        holder.m_after = 11;
+        AZStd::vector<char> buffer = Save(holder, AZ::DataStream::ST_BINARY_PACKED);
+
+        // The removed Z member is reported as discarded data for every point.
+        PointHolderChanged loaded;
+        ASSERT_TRUE(Load(buffer, loaded));
+        EXPECT_EQ(1.0f, loaded.m_point.m_x);
+        EXPECT_EQ(2.0f, loaded.m_point.m_y);
+        EXPECT_EQ(7.0f, loaded.m_point.m_w);
+        ASSERT_EQ(2, loaded.m_points.size());
+        EXPECT_EQ(4.0f, loaded.m_points[0].m_x);
+        EXPECT_EQ(5.0f, loaded.m_points[0].m_y);
+        EXPECT_EQ(7.0f, loaded.m_points[1].m_x);
+        EXPECT_EQ(8.0f, loaded.m_points[1].m_y);
+        EXPECT_EQ(11, loaded.m_after);
+    }
+
+    TEST_F(ObjectStreamPackedBinaryTests, Load_OlderClassVersion_ConverterIsCalled)
+    {
+        using namespace ObjectStreamPackedBinaryTestTypes;
+        Sample::Reflect(*m_saveContext);
+        SampleV2::Reflect(*m_loadContext);
+
+        Sample sample;
+        sample.m_value = 1.5f;
+        sample.m_count = 3;
+        AZStd::vector<char> buffer = Save(sample, AZ::DataStream::ST_BINARY_PACKED);
+
+        SampleV2 loaded;
+        ASSERT_TRUE(Load(buffer, loaded));
+        EXPECT_EQ(3.0, loaded.m_value);
+        EXPECT_EQ(3, loaded.m_count);
+    }
+
+    TEST_F(ObjectStreamPackedBinaryTests, Load_UnknownClassHoldingPackedData_IsSkipped)
+    {
+        using namespace ObjectStreamPackedBinaryTestTypes;
+        LabeledPoint::Reflect(*m_saveContext);
+        UnlabeledPoint::Reflect(*m_loadContext);
+
+        LabeledPoint labeledPoint;
+        labeledPoint.m_label.m_text = "Label";
+        labeledPoint.m_label.m_anchor = { -1.0f, -2.0f, -3.0f };
+        labeledPoint.m_point = { 1.0f, 2.0f, 3.0f };
+        labeledPoint.m_after = 5;
+        AZStd::vector<char> buffer = Save(labeledPoint, AZ::DataStream::ST_BINARY_PACKED);
+
+        // The layout of the point is stored with the skipped label, so it has to be picked up while skipping.
+        UnlabeledPoint loaded;
+        ASSERT_TRUE(Load(buffer, loaded, AZ::ObjectStream::FILTERFLAG_IGNORE_UNKNOWN_CLASSES));
+        ExpectPointEq(labeledPoint.m_point, loaded.m_point);
+        EXPECT_EQ(5, loaded.m_after);
+    }
+} // namespace UnitTest
@@ -14,6 +14,8 @@
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -1787,4 +1789,253 @@ namespace SettingsRegistryTests
         // The message structure should contain the error message
         EXPECT_FALSE(result.GetMessages().empty());
     }
+
+    //
+    // Snapshot
+    //
+
+    TEST_F(SettingsRegistryTest, Snapshot_GetByHandle_ReturnsStoredValues)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Bool": true, "Int": -42, "Uint": 18446744073709551615,)"
+            R"( "Double": 4.5, "String": "Hello" } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        const AZ::SettingsPathHandle boolHandle = m_registry->ResolvePathHandle("/Object/Bool");
+        const AZ::SettingsPathHandle intHandle = m_registry->ResolvePathHandle("/Object/Int");
+        const AZ::SettingsPathHandle uintHandle = m_registry->ResolvePathHandle("/Object/Uint");
+        const AZ::SettingsPathHandle doubleHandle = m_registry->ResolvePathHandle("/Object/Double");
+        const AZ::SettingsPathHandle stringHandle = m_registry->ResolvePathHandle("/Object/String");
+        const AZ::SettingsPathHandle missingHandle = m_registry->ResolvePathHandle("/Object/Missing");
+        ASSERT_TRUE(boolHandle.IsValid());
+        ASSERT_TRUE(missingHandle.IsValid());
+
+        auto snapshot = m_registry->GetSnapshot();
+        ASSERT_NE(nullptr, snapshot);
+
+        bool boolValue{};
+        EXPECT_TRUE(snapshot->Get(boolValue, boolHandle));
+        EXPECT_TRUE(boolValue);
+        AZ::s64 intValue{};
+        EXPECT_TRUE(snapshot->Get(intValue, intHandle));
+        EXPECT_EQ(-42, intValue);
+        AZ::u64 uintValue{};
+        EXPECT_TRUE(snapshot->Get(uintValue, uintHandle));
+        EXPECT_EQ(AZStd::numeric_limits<AZ::u64>::max(), uintValue);
+        double doubleValue{};
+        EXPECT_TRUE(snapshot->Get(doubleValue, doubleHandle));
+        EXPECT_DOUBLE_EQ(4.5, doubleValue);
+        AZStd::string_view stringValue;
+        EXPECT_TRUE(snapshot->Get(stringValue, stringHandle));
+        EXPECT_EQ("Hello", stringValue);
+        AZ::SettingsRegistryInterface::FixedValueString fixedStringValue;
+        EXPECT_TRUE(snapshot->Get(fixedStringValue, "/Object/String"));
+        EXPECT_EQ("Hello", fixedStringValue);
+
+        // Mismatched types and missing values fail like they do for the registry
+        EXPECT_FALSE(snapshot->Get(intValue, boolHandle));
+        EXPECT_FALSE(snapshot->Get(boolValue, missingHandle));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshot->GetType(missingHandle).m_type);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, snapshot->GetType("/Object").m_type);
+    }
+
+    TEST_F(SettingsRegistryTest, Snapshot_ResolvePathHandle_SamePathReturnsSameHandle)
+    {
+        const AZ::SettingsPathHandle handle = m_registry->ResolvePathHandle("/Object/Value");
+        EXPECT_TRUE(handle.IsValid());
+        EXPECT_EQ(handle.m_index, m_registry->ResolvePathHandle("/Object/Value").m_index);
+        EXPECT_NE(handle.m_index, m_registry->ResolvePathHandle("/Object/Other").m_index);
+        EXPECT_FALSE(m_registry->ResolvePathHandle("#$%^&").IsValid());
+    }
+
+    TEST_F(SettingsRegistryTest, Snapshot_SettingsModified_PreviousSnapshotUnchangedAndOutdated)
+    {
+        const AZ::SettingsPathHandle handle = m_registry->ResolvePathHandle("/Object/Value");
+        ASSERT_TRUE(m_registry->Set("/Object/Value", AZ::s64{ 1 }));
+
+        auto firstSnapshot = m_registry->GetSnapshot();
+        EXPECT_TRUE(m_registry->IsSnapshotCurrent(*firstSnapshot));
+        // Without changes the same snapshot is shared
+        EXPECT_EQ(firstSnapshot, m_registry->GetSnapshot());
+
+        ASSERT_TRUE(m_registry->Set("/Object/Value", AZ::s64{ 2 }));
+        EXPECT_FALSE(m_registry->IsSnapshotCurrent(*firstSnapshot));
+
+        auto secondSnapshot = m_registry->GetSnapshot();
+        EXPECT_NE(firstSnapshot, secondSnapshot);
+        EXPECT_GT(secondSnapshot->GetGeneration(), firstSnapshot->GetGeneration());
+
+        AZ::s64 value{};
+        EXPECT_TRUE(firstSnapshot->Get(value, handle));
+        EXPECT_EQ(1, value);
+        EXPECT_TRUE(secondSnapshot->Get(value, handle));
+        EXPECT_EQ(2, value);
+
+        ASSERT_TRUE(m_registry->Remove("/Object/Value"));
+        EXPECT_FALSE(m_registry->GetSnapshot()->Get(value, handle));
+        EXPECT_TRUE(secondSnapshot->Get(value, handle));
+    }
+
+    TEST_F(SettingsRegistryTest, Snapshot_HandleResolvedAfterSnapshot_OnlyAvailableInNewSnapshot)
+    {
+        ASSERT_TRUE(m_registry->Set("/Object/Value", true));
+        auto snapshot = m_registry->GetSnapshot();
+
+        const AZ::SettingsPathHandle handle = m_registry->ResolvePathHandle("/Object/Value");
+        EXPECT_FALSE(m_registry->IsSnapshotCurrent(*snapshot));
+
+        bool value{};
+        EXPECT_FALSE(snapshot->Get(value, handle));
+        // Reading by path still works with the older snapshot
+        EXPECT_TRUE(snapshot->Get(value, "/Object/Value"));
+
+        value = false;
+        EXPECT_TRUE(m_registry->GetSnapshot()->Get(value, handle));
+        EXPECT_TRUE(value);
+    }
+
+    TEST_F(SettingsRegistryTest, Snapshot_NotifierDuringMerge_SnapshotHasMergedValues)
+    {
+        const AZ::SettingsPathHandle handle = m_registry->ResolvePathHandle("/Object/Value");
+        // The snapshot is outdated by the merge and rebuilt by the first request from the notifier
+        auto initialSnapshot = m_registry->GetSnapshot();
+
+        size_t notifyCount{};
+        auto notifier = m_registry->RegisterNotifier(
+            [this, &handle, &notifyCount](const AZ::SettingsRegistryInterface::NotifyEventArgs&)
+            {
+                auto snapshot = m_registry->GetSnapshot();
+                EXPECT_TRUE(m_registry->IsSnapshotCurrent(*snapshot));
+                AZ::s64 value{};
+                EXPECT_TRUE(snapshot->Get(value, handle));
+                EXPECT_EQ(42, value);
+                ++notifyCount;
+            });
+
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 42 } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        EXPECT_GT(notifyCount, 0);
+        EXPECT_FALSE(m_registry->IsSnapshotCurrent(*initialSnapshot));
+    }
+
+    TEST_F(SettingsRegistryTest, Snapshot_ReadWhileWriting_ReadsConsistentValues)
+    {
+        const AZ::SettingsPathHandle firstHandle = m_registry->ResolvePathHandle("/Object/First");
+        const AZ::SettingsPathHandle secondHandle = m_registry->ResolvePathHandle("/Object/Second");
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "First": 0, "Second": 0 } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        constexpr AZ::s64 WriteCount = 200;
+        AZStd::atomic_bool writing{ true };
+        AZStd::thread reader([this, &writing, firstHandle, secondHandle]()
+        {
+            auto snapshot = m_registry->GetSnapshot();
+            while (writing)
+            {
+                if (!m_registry->IsSnapshotCurrent(*snapshot))
+                {
+                    snapshot = m_registry->GetSnapshot();
+                }
+                // Both values are merged at once, so a snapshot always sees them with the same value
+                AZ::s64 first{};
+                AZ::s64 second{};
+                EXPECT_TRUE(snapshot->Get(first, firstHandle));
+                EXPECT_TRUE(snapshot->Get(second, secondHandle));
+                EXPECT_EQ(first, second);
+            }
+        });
+
+        for (AZ::s64 writeIndex = 1; writeIndex <= WriteCount; ++writeIndex)
+        {
+            const auto mergePatch = AZStd::string::format(R"({ "Object": { "First": %lld, "Second": %lld } })",
+                static_cast<long long>(writeIndex), static_cast<long long>(writeIndex));
+            EXPECT_TRUE(m_registry->MergeSettings(mergePatch, AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        }
+        writing = false;
+        reader.join();
+
+        AZ::s64 value{};
+        EXPECT_TRUE(m_registry->GetSnapshot()->Get(value, firstHandle));
+        EXPECT_EQ(WriteCount, value);
+    }
 } // namespace SettingsRegistryTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Measures reading a setting from several threads at once, through the locked registry and through snapshots
+    class SettingsRegistryReadBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        void CreateRegistry(const benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                m_registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+                m_registry->MergeSettings(R"({ "O3DE": { "Streamer": { "Config": { "MaxRequests": 64, "Enabled": true } } } })",
+                    AZ::SettingsRegistryInterface::Format::JsonMergePatch);
+                m_handle = m_registry->ResolvePathHandle(SettingPath);
+            }
+        }
+
+        void DestroyRegistry(const benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                m_registry.reset();
+            }
+        }
+
+        static constexpr AZStd::string_view SettingPath = "/O3DE/Streamer/Config/MaxRequests";
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_registry;
+        AZ::SettingsPathHandle m_handle;
+    };
+
+    BENCHMARK_DEFINE_F(SettingsRegistryReadBenchmarkFixture, BM_SettingsRegistry_GetByPath)(benchmark::State& state)
+    {
+        CreateRegistry(state);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::s64 value{};
+            m_registry->Get(value, SettingPath);
+            benchmark::DoNotOptimize(value);
+        }
+        DestroyRegistry(state);
+    }
+
+    BENCHMARK_DEFINE_F(SettingsRegistryReadBenchmarkFixture, BM_SettingsRegistry_GetSnapshotByHandle)(benchmark::State& state)
+    {
+        CreateRegistry(state);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::s64 value{};
+            m_registry->GetSnapshot()->Get(value, m_handle);
+            benchmark::DoNotOptimize(value);
+        }
+        DestroyRegistry(state);
+    }
+
+    BENCHMARK_DEFINE_F(SettingsRegistryReadBenchmarkFixture, BM_SettingsRegistry_CachedSnapshotByHandle)(benchmark::State& state)
+    {
+        CreateRegistry(state);
+        AZStd::shared_ptr<const AZ::SettingsRegistrySnapshot> snapshot;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (snapshot == nullptr || !m_registry->IsSnapshotCurrent(*snapshot))
+            {
+                snapshot = m_registry->GetSnapshot();
+            }
+            AZ::s64 value{};
+            snapshot->Get(value, m_handle);
+            benchmark::DoNotOptimize(value);
+        }
+        snapshot.reset();
+        DestroyRegistry(state);
+    }
+
+    BENCHMARK_REGISTER_F(SettingsRegistryReadBenchmarkFixture, BM_SettingsRegistry_GetByPath)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency());
+    BENCHMARK_REGISTER_F(SettingsRegistryReadBenchmarkFixture, BM_SettingsRegistry_GetSnapshotByHandle)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency());
+    BENCHMARK_REGISTER_F(SettingsRegistryReadBenchmarkFixture, BM_SettingsRegistry_CachedSnapshotByHandle)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency());
+} // namespace Benchmark
+#endif
@@ -61,11 +61,13 @@ namespace AZ::IO
             AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
         }
 
-        void CreateTestEnvironmentImplementation(bool onlyEpilogWrites)
+        void CreateTestEnvironmentImplementation(
+            bool onlyEpilogWrites, BlockCache::EvictionPolicy evictionPolicy = BlockCache::EvictionPolicy::LeastRecentlyUsed)
         {
             using ::testing::_;
 
-            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites);
+            m_cache = AZStd::make_shared<BlockCache>(
+                m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites, evictionPolicy);
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_cache->SetNext(m_mock);
             EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
@@ -1167,4 +1169,103 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+    /////////////////////////////////////////////////////////////
+    // Eviction policies
+    /////////////////////////////////////////////////////////////
+    class Streamer_BlockCacheEvictionTest
+        : public BlockCacheTest
+    {
+    public:
+        static constexpr u64 s_numCacheBlocks = 8;
+        static constexpr u64 s_numFileBlocks = 64;
+
+        void CreateTestEnvironment(BlockCache::EvictionPolicy evictionPolicy)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+
+            m_cacheSize = s_numCacheBlocks * m_blockSize;
+            m_fakeFileLength = s_numFileBlocks * m_blockSize;
+            CreateTestEnvironmentImplementation(false, evictionPolicy);
+            RedirectReadCalls();
+            EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(AnyNumber());
+        }
+
+        // Reads a small section from the middle of a block so the entire block is cached.
+        void ReadFromBlock(u64 block)
+        {
+            ProcessRead(m_buffer, m_path, block * m_blockSize + 256, m_blockSize - 512, IStreamerTypes::RequestStatus::Completed);
+        }
+
+        // Reads block 0 twice with enough other blocks in between for it to be recycled, then sweeps through the rest of the file.
+        void ReuseFirstBlockAndSweepFile()
+        {
+            ReadFromBlock(0);
+            for (u64 block = 1; block <= s_numCacheBlocks; ++block)
+            {
+                ReadFromBlock(block);
+            }
+            ReadFromBlock(0);
+            for (u64 block = s_numCacheBlocks + 1; block < s_numFileBlocks; ++block)
+            {
+                ReadFromBlock(block);
+            }
+            ::testing::Mock::VerifyAndClearExpectations(this);
+        }
+    };
+
+    TEST_F(Streamer_BlockCacheEvictionTest, LeastRecentlyUsed_SweepAfterReuse_ReusedBlockIsRecycled)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment(BlockCache::EvictionPolicy::LeastRecentlyUsed);
+        ReuseFirstBlockAndSweepFile();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize)).Times(1);
+        ReadFromBlock(0);
+        VerifyReadBuffer(256, m_blockSize - 512);
+    }
+
+    TEST_F(Streamer_BlockCacheEvictionTest, TwoQueue_SweepAfterReuse_ReusedBlockIsKept)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment(BlockCache::EvictionPolicy::TwoQueue);
+        ReuseFirstBlockAndSweepFile();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(0);
+        ReadFromBlock(0);
+        VerifyReadBuffer(256, m_blockSize - 512);
+    }
+
+    TEST_F(Streamer_BlockCacheEvictionTest, TwoQueue_RepeatedSweeps_AllDataIsCorrect)
+    {
+        CreateTestEnvironment(BlockCache::EvictionPolicy::TwoQueue);
+        for (int sweep = 0; sweep < 3; ++sweep)
+        {
+            for (u64 block = 0; block < s_numFileBlocks; block += 3)
+            {
+                ReadFromBlock(block);
+                VerifyReadBuffer(block * m_blockSize + 256, m_blockSize - 512);
+            }
+        }
+    }
+
+    TEST_F(Streamer_BlockCacheEvictionTest, FindInCache_ManyCachedBlocks_LookupsDoNotScanTheCache)
+    {
+        CreateTestEnvironment(BlockCache::EvictionPolicy::LeastRecentlyUsed);
+        for (u64 block = 0; block < s_numCacheBlocks; ++block)
+        {
+            ReadFromBlock(block);
+        }
+        for (u64 block = 0; block < s_numCacheBlocks; ++block)
+        {
+            ReadFromBlock(block);
+        }
+
+        // Every lookup is either a miss without candidates or a hit on the first candidate.
+        EXPECT_LE(m_cache->CalculateAverageLookupCost(), 1.0);
+        EXPECT_GT(m_cache->CalculateHitRatePercentage(), 0.0);
+    }
 } // namespace AZ::IO
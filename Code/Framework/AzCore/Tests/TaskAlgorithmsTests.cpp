@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Task/TaskAlgorithms.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/string.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <algorithm>
+#include <random>
+
+namespace UnitTest
+{
+    class TaskAlgorithmsTestFixture : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // Use a fixed worker count and a small grain so the tests split the ranges regardless of the host's core count
+            m_executor = aznew AZ::TaskExecutor(4);
+            m_descriptor.executor = m_executor;
+            m_descriptor.minGrainSize = 64;
+        }
+
+        void TearDown() override
+        {
+            azdestroy(m_executor);
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        AZStd::vector<int> MakeRandomValues(size_t count, int maxValue)
+        {
+            std::mt19937 generator(static_cast<unsigned int>(count));
+            std::uniform_int_distribution<int> distribution(0, maxValue);
+            AZStd::vector<int> values(count);
+            for (int& value : values)
+            {
+                value = distribution(generator);
+            }
+            return values;
+        }
+
+        AZ::TaskExecutor* m_executor = nullptr;
+        AZ::ParallelAlgorithmDescriptor m_descriptor;
+    };
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelSort_RandomValues_MatchesSerialSort)
+    {
+        for (size_t count : { 0, 1, 63, 64, 65, 1000, 4099, 100000 })
+        {
+            AZStd::vector<int> values = MakeRandomValues(count, 1000);
+            AZStd::vector<int> expected = values;
+            AZStd::sort(expected.begin(), expected.end());
+
+            AZ::parallel_sort(values.begin(), values.end(), AZStd::less<>(), m_descriptor);
+            EXPECT_EQ(expected, values) << "Failed to sort " << count << " values";
+        }
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelSort_OrderedAndReversedValues_MatchesSerialSort)
+    {
+        AZStd::vector<int> values(10000);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<int>(i / 3);
+        }
+        AZStd::vector<int> expected = values;
+
+        AZ::parallel_sort(values.begin(), values.end(), AZStd::less<>(), m_descriptor);
+        EXPECT_EQ(expected, values);
+
+        AZStd::reverse(values.begin(), values.end());
+        AZ::parallel_sort(values.begin(), values.end(), AZStd::less<>(), m_descriptor);
+        EXPECT_EQ(expected, values);
+
+        AZ::parallel_sort(values.begin(), values.end(), AZStd::greater<>(), m_descriptor);
+        AZStd::reverse(expected.begin(), expected.end());
+        EXPECT_EQ(expected, values);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelSort_Strings_MatchesSerialSort)
+    {
+        AZStd::vector<int> keys = MakeRandomValues(5000, 100000);
+        AZStd::vector<AZStd::string> values;
+        for (int key : keys)
+        {
+            values.push_back(AZStd::string::format("value %d", key));
+        }
+        AZStd::vector<AZStd::string> expected = values;
+        AZStd::sort(expected.begin(), expected.end());
+
+        AZ::parallel_sort(values.begin(), values.end(), AZStd::less<>(), m_descriptor);
+        EXPECT_EQ(expected, values);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelSort_CalledFromTask_SortsSerially)
+    {
+        AZStd::vector<int> values = MakeRandomValues(10000, 1000);
+        AZStd::vector<int> expected = values;
+        AZStd::sort(expected.begin(), expected.end());
+
+        AZ::TaskGraph graph{ "ParallelSortInTask" };
+        graph.Detach();
+        graph.AddTask(
+            AZ::TaskDescriptor{ "ParallelSortInTask", "TaskAlgorithmsTests" },
+            [this, &values]()
+            {
+                AZ::parallel_sort(values.begin(), values.end(), AZStd::less<>(), m_descriptor);
+            });
+        AZ::TaskGraphEvent finished{ "ParallelSortInTask" };
+        graph.SubmitOnExecutor(*m_executor, &finished);
+        finished.Wait();
+
+        EXPECT_EQ(expected, values);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelReduce_Sum_MatchesAccumulate)
+    {
+        for (size_t count : { 0, 1, 64, 65, 1000, 100000 })
+        {
+            AZStd::vector<int> values = MakeRandomValues(count, 1000);
+            const AZ::s64 expected = AZStd::accumulate(values.begin(), values.end(), AZ::s64{ 7 });
+            EXPECT_EQ(expected, AZ::parallel_reduce(values.begin(), values.end(), AZ::s64{ 7 }, AZStd::plus<>(), m_descriptor));
+        }
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelReduce_NonCommutativeOperation_KeepsElementOrder)
+    {
+        AZStd::vector<AZStd::string> values;
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(AZStd::string(1, static_cast<char>('a' + i % 26)));
+        }
+        const AZStd::string expected = AZStd::accumulate(values.begin(), values.end(), AZStd::string("start:"));
+        EXPECT_EQ(expected, AZ::parallel_reduce(values.begin(), values.end(), AZStd::string("start:"), AZStd::plus<>(), m_descriptor));
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelTransform_MatchesSerialTransform)
+    {
+        AZStd::vector<int> values = MakeRandomValues(10000, 1000);
+        auto operation = [](int value)
+        {
+            return value * 0.5f + 1.0f;
+        };
+
+        AZStd::vector<float> expected(values.size());
+        AZStd::transform(values.begin(), values.end(), expected.begin(), operation);
+
+        AZStd::vector<float> results(values.size());
+        auto resultEnd = AZ::parallel_transform(values.begin(), values.end(), results.begin(), operation, m_descriptor);
+        EXPECT_EQ(results.end(), resultEnd);
+        EXPECT_EQ(expected, results);
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelInclusiveScan_MatchesSerialScan)
+    {
+        for (size_t count : { 0, 1, 64, 65, 1000, 100000 })
+        {
+            AZStd::vector<int> values = MakeRandomValues(count, 1000);
+            AZStd::vector<int> expected(values.size());
+            int sum = 0;
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                sum += values[i];
+                expected[i] = sum;
+            }
+
+            AZStd::vector<int> results(values.size());
+            auto resultEnd = AZ::parallel_inclusive_scan(values.begin(), values.end(), results.begin(), AZStd::plus<>(), m_descriptor);
+            EXPECT_EQ(results.end(), resultEnd);
+            EXPECT_EQ(expected, results) << "Failed to scan " << count << " values";
+
+            // Scanning in place gives the same results
+            AZ::parallel_inclusive_scan(values.begin(), values.end(), values.begin(), AZStd::plus<>(), m_descriptor);
+            EXPECT_EQ(expected, values);
+        }
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelInclusiveScan_NonCommutativeOperation_KeepsElementOrder)
+    {
+        AZStd::vector<AZStd::string> values;
+        for (int i = 0; i < 300; ++i)
+        {
+            values.push_back(AZStd::string(1, static_cast<char>('a' + i % 26)));
+        }
+
+        AZStd::vector<AZStd::string> results(values.size());
+        AZ::parallel_inclusive_scan(values.begin(), values.end(), results.begin(), AZStd::plus<>(), m_descriptor);
+
+        AZStd::string expected;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            expected += values[i];
+            EXPECT_EQ(expected, results[i]);
+        }
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelPartition_SplitsAllElements)
+    {
+        for (size_t count : { 0, 1, 64, 65, 1000, 100000 })
+        {
+            for (int threshold : { -1, 100, 500, 1001 })
+            {
+                AZStd::vector<int> values = MakeRandomValues(count, 1000);
+                AZStd::vector<int> original = values;
+                auto predicate = [threshold](int value)
+                {
+                    return value < threshold;
+                };
+                const size_t expectedTrueCount = AZStd::count_if(values.begin(), values.end(), predicate);
+
+                auto split = AZ::parallel_partition(values.begin(), values.end(), predicate, m_descriptor);
+                EXPECT_EQ(expectedTrueCount, static_cast<size_t>(split - values.begin()));
+                EXPECT_TRUE(AZStd::all_of(values.begin(), split, predicate));
+                EXPECT_TRUE(AZStd::none_of(split, values.end(), predicate));
+
+                // No elements were lost or duplicated
+                AZStd::sort(values.begin(), values.end());
+                AZStd::sort(original.begin(), original.end());
+                EXPECT_EQ(original, values);
+            }
+        }
+    }
+
+    TEST_F(TaskAlgorithmsTestFixture, ParallelPartition_PredicateCalledOncePerElement)
+    {
+        AZStd::vector<int> values = MakeRandomValues(10000, 1000);
+        AZStd::atomic<size_t> callCount{ 0 };
+        AZ::parallel_partition(
+            values.begin(), values.end(),
+            [&callCount](int value)
+            {
+                ++callCount;
+                return value % 3 == 0;
+            },
+            m_descriptor);
+        EXPECT_EQ(values.size(), callCount.load());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class TaskAlgorithmsBenchmarkFixture : public ::benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_executor = new AZ::TaskExecutor;
+            m_descriptor.executor = m_executor;
+
+            std::mt19937 generator(1);
+            std::uniform_int_distribution<int> distribution(0, 1 << 20);
+            m_values.resize(state.range(0));
+            for (int& value : m_values)
+            {
+                value = distribution(generator);
+            }
+            m_results.resize(m_values.size());
+        }
+
+        void internalTearDown()
+        {
+            m_values = {};
+            m_results = {};
+            delete m_executor;
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        AZ::TaskExecutor* m_executor = nullptr;
+        AZ::ParallelAlgorithmDescriptor m_descriptor;
+        AZStd::vector<int> m_values;
+        AZStd::vector<int> m_results;
+    };
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, Sort_Serial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_results = m_values;
+            AZStd::sort(m_results.begin(), m_results.end());
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, Sort_Serial)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, Sort_Parallel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_results = m_values;
+            AZ::parallel_sort(m_results.begin(), m_results.end(), AZStd::less<>(), m_descriptor);
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, Sort_Parallel)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, Reduce_Serial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZStd::accumulate(m_values.begin(), m_values.end(), AZ::s64{ 0 }));
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, Reduce_Serial)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, Reduce_Parallel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                AZ::parallel_reduce(m_values.begin(), m_values.end(), AZ::s64{ 0 }, AZStd::plus<>(), m_descriptor));
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, Reduce_Parallel)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, Transform_Serial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::transform(
+                m_values.begin(), m_values.end(), m_results.begin(),
+                [](int value)
+                {
+                    return value * 3 + 1;
+                });
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, Transform_Serial)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, Transform_Parallel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::parallel_transform(
+                m_values.begin(), m_values.end(), m_results.begin(),
+                [](int value)
+                {
+                    return value * 3 + 1;
+                },
+                m_descriptor);
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, Transform_Parallel)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, InclusiveScan_Serial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            int sum = 0;
+            for (size_t i = 0; i < m_values.size(); ++i)
+            {
+                sum += m_values[i];
+                m_results[i] = sum;
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, InclusiveScan_Serial)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, InclusiveScan_Parallel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::parallel_inclusive_scan(m_values.begin(), m_values.end(), m_results.begin(), AZStd::plus<>(), m_descriptor);
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, InclusiveScan_Parallel)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, Partition_Serial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_results = m_values;
+            benchmark::DoNotOptimize(std::partition(
+                m_results.begin(), m_results.end(),
+                [](int value)
+                {
+                    return (value & 1) == 0;
+                }));
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, Partition_Serial)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskAlgorithmsBenchmarkFixture, Partition_Parallel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_results = m_values;
+            benchmark::DoNotOptimize(AZ::parallel_partition(
+                m_results.begin(), m_results.end(),
+                [](int value)
+                {
+                    return (value & 1) == 0;
+                },
+                m_descriptor));
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskAlgorithmsBenchmarkFixture, Partition_Parallel)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif
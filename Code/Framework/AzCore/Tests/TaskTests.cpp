@@ -50,6 +50,27 @@ namespace UnitTest
         TaskExecutor* m_executor;
     };
 
+    class TaskGraphWorkStealingTestFixture : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // Use a fixed worker count so the tests exercise stealing regardless of the host's core count
+            m_executor = aznew TaskExecutor(2, AZ::TaskSchedulingMode::WorkStealing);
+        }
+
+        void TearDown() override
+        {
+            azdestroy(m_executor);
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        TaskExecutor* m_executor;
+    };
+
     TEST(TaskGraphTests, TrivialTaskLambda)
     {
         int x = 0;
@@ -624,6 +645,123 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphWorkStealingTestFixture, ForkJoin)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "WorkStealingForkJoin" };
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0b111;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 1;
+            });
+        auto c = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 2;
+            });
+        auto d = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x -= 1;
+            });
+        a.Precedes(b, c);
+        d.Follows(b, c);
+
+        for (int i = 0; i != 16; ++i)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(3, x);
+        }
+    }
+
+    // One task blocks its worker until every other task in the graph has run. Tasks queued behind it must be
+    // stolen by the other worker for the blocking task to complete.
+    TEST_F(TaskGraphWorkStealingTestFixture, BlockedWorker_QueuedTasksAreStolen)
+    {
+        constexpr int ShortTaskCount = 32;
+        AZStd::atomic<int> completed = 0;
+        bool allShortTasksRan = false;
+
+        TaskGraph graph{ "BlockedWorker" };
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                const auto deadline = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(10);
+                while (completed.load() != ShortTaskCount && AZStd::chrono::steady_clock::now() < deadline)
+                {
+                    AZStd::this_thread::yield();
+                }
+                allShortTasksRan = completed.load() == ShortTaskCount;
+            });
+        for (int i = 0; i != ShortTaskCount; ++i)
+        {
+            graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    ++completed;
+                });
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_TRUE(allShortTasksRan);
+        EXPECT_EQ(ShortTaskCount, completed);
+    }
+
+    // Successors released on a worker are queued locally and must still be picked up by idle workers
+    TEST_F(TaskGraphWorkStealingTestFixture, WideFanOut_AllSuccessorsRun)
+    {
+        constexpr int FanOut = 256;
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "WideFanOut" };
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        auto join = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x += 1000;
+            });
+        for (int i = 0; i != FanOut; ++i)
+        {
+            auto task = graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    ++x;
+                });
+            root.Precedes(task);
+            task.Precedes(join);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(FanOut + 1000, x);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -739,5 +877,99 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    // Compares the schedulers on a graph with a skewed cost distribution: every few root tasks is a long one, and each
+    // long task releases a batch of short successors. The round robin scheduler leaves the short tasks queued behind
+    // the long ones on the same worker, while the work stealing scheduler lets idle workers pick them up.
+    class TaskGraphSchedulingBenchmarkFixture : public ::benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            const auto mode = static_cast<AZ::TaskSchedulingMode>(state.range(0));
+            executor = new TaskExecutor(0, mode);
+            graph = new TaskGraph{ "SchedulingBenchmark" };
+
+            constexpr uint32_t RootCount = 64;
+            constexpr uint32_t SuccessorCount = 8;
+            constexpr uint32_t LongTaskStride = 4;
+            for (uint32_t i = 0; i != RootCount; ++i)
+            {
+                const bool isLong = (i % LongTaskStride) == 0;
+                auto root = graph->AddTask(
+                    descriptor,
+                    [isLong]
+                    {
+                        Spin(isLong ? 200 : 2);
+                    });
+                if (isLong)
+                {
+                    for (uint32_t j = 0; j != SuccessorCount; ++j)
+                    {
+                        auto successor = graph->AddTask(
+                            descriptor,
+                            []
+                            {
+                                Spin(10);
+                            });
+                        root.Precedes(successor);
+                    }
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            delete graph;
+            delete executor;
+        }
+
+        static void Spin(uint32_t microseconds)
+        {
+            const auto end = AZStd::chrono::steady_clock::now() + AZStd::chrono::microseconds(microseconds);
+            while (AZStd::chrono::steady_clock::now() < end)
+            {
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        TaskDescriptor descriptor{ "skewed", "benchmark", TaskPriority::MEDIUM };
+
+        TaskGraph* graph;
+        TaskExecutor* executor;
+    };
+
+    BENCHMARK_DEFINE_F(TaskGraphSchedulingBenchmarkFixture, SkewedGraph)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskGraphSchedulingBenchmarkFixture, SkewedGraph)
+        ->ArgName("WorkStealing")
+        ->Arg(static_cast<int64_t>(AZ::TaskSchedulingMode::RoundRobin))
+        ->Arg(static_cast<int64_t>(AZ::TaskSchedulingMode::WorkStealing))
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
 } // namespace Benchmark
 #endif
@@ -33,6 +33,7 @@ set(FILES
     AZStd/ExpectedTests.cpp
     AZStd/FunctionalBasic.cpp
     AZStd/FunctorsBind.cpp
+    AZStd/FlatHashed.cpp
     AZStd/Hashed.cpp
     AZStd/Invoke.cpp
     AZStd/Iterators.cpp
@@ -72,6 +73,7 @@ set(FILES
     BehaviorContext.cpp
     BehaviorContextFixture.h
     Components.cpp
+    Compression/ZStdDictionaryTests.cpp
     Console/LoggerSystemComponentTests.cpp
     Console/ConsoleTests.cpp
     Date/DateFormatTests.cpp
@@ -91,6 +93,8 @@ set(FILES
     DOM/DomValueBenchmarks.cpp
     DOM/DomPrefixTreeTests.cpp
     DOM/DomPrefixTreeBenchmarks.cpp
+    EBus/EBusDispatchBenchmarks.cpp
+    EBus/EBusEpochDispatchMutexTests.cpp
     EBus/EBusSharedDispatchMutexTests.cpp
     EBus/ScheduledEventTests.cpp
     EBus.cpp
@@ -111,6 +115,8 @@ set(FILES
     GenericStreamMock.h
     GenericStreamTests.cpp
     Math/AabbTests.cpp
+    Math/BatchMathPerformanceTests.cpp
+    Math/BatchMathTests.cpp
     Math/CapsuleTests.cpp
     Math/ColorTests.cpp
     Math/CrcTests.cpp
@@ -148,6 +154,7 @@ set(FILES
     Math/ShapeIntersectionPerformanceTests.cpp
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
+    Math/SimdMathPerformanceTests.cpp
     Math/SimdMathTests.cpp
     Math/SphereTests.cpp
     Math/RayTests.cpp
@@ -169,6 +176,7 @@ set(FILES
     Memory/HphaAllocatorErrorDetection.cpp
     Memory/LeakDetection.cpp
     Memory.cpp
+    Metrics/BinaryTraceEventLoggerTests.cpp
     Metrics/EventLoggerFactoryTests.cpp
     Metrics/EventLoggerReflectUtilsTests.cpp
     Metrics/EventLoggerUtilsTests.cpp
@@ -200,6 +208,8 @@ set(FILES
     Serialization/Json/IntSerializerTests.cpp
     Serialization/Json/JsonRegistrationContextTests.cpp
     Serialization/Json/JsonSerializationMetadataTests.cpp
+    Serialization/Json/JsonSerializationPlanTests.cpp
+    Serialization/Json/JsonSerializationPlanBenchmarks.cpp
     Serialization/Json/JsonSerializationResultTests.cpp
     Serialization/Json/JsonSerializationTests.h
     Serialization/Json/JsonSerializationTests.cpp
@@ -230,6 +240,8 @@ set(FILES
     Serialization/Json/UnorderedSetSerializerTests.cpp
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
+    Serialization/ObjectStreamPackedBinaryBenchmarks.cpp
+    Serialization/ObjectStreamPackedBinaryTests.cpp
     Serialization.cpp
     SerializeContextFixture.h
     Settings/CommandLineTests.cpp
@@ -262,6 +274,7 @@ set(FILES
     StringFunc.cpp
     SystemFileTest.cpp
     SystemFileStreamTest.cpp
+    TaskAlgorithmsTests.cpp
     TaskTests.cpp
     TickBusTest.cpp
     Time/TimeTests.cpp
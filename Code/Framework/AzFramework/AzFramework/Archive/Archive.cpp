@@ -1952,10 +1952,12 @@ namespace AZ::IO
                     break;
                 }
 
-                info.m_decompressor = []([[maybe_unused]] const AZ::IO::CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)->bool
+                // The decompressor keeps the dictionaries of the archive alive, as the archive can be closed while reads are in flight.
+                info.m_decompressor = [dictionaries = archive->GetZStdDictionaries()]([[maybe_unused]] const AZ::IO::CompressionInfo& info,
+                    const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)->bool
                 {
                     size_t nSizeUncompressed = uncompressedBufferSize;
-                    return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize) == 0;
+                    return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize, dictionaries.get()) == 0;
                 };
             }
         }
@@ -102,6 +102,8 @@ namespace AZ::IO
         //   METHOD_DEFLATE == METHOD_COMPRESS == 8 (deflate) , compression
         //   level is LEVEL_FASTEST == 0 till LEVEL_BEST == 9 or LEVEL_DEFAULT == -1
         //   for default (like in zlib)
+        //   If a zstd dictionary file is stored next to the archive, deflated files of the asset
+        //   types it covers are compressed with their dictionary instead of the given codec.
         virtual int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = 0,
             int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) = 0;
 
@@ -7,9 +7,12 @@
  */
 
 
+#include <AzCore/Compression/zstd_dictionary.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -206,6 +209,58 @@ namespace AZ::IO::ZipDir
         return true;
     }
 
+    void Cache::LoadZStdDictionaries(AZ::IO::PathView zipFilePath)
+    {
+        m_zstdDictionaries.reset();
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetDirectInstance();
+        const AZ::IO::Path dictionaryPath = AZ::ZStdDictionarySet::GetDictionaryPath(zipFilePath);
+        if (!fileIO->Exists(dictionaryPath.c_str()))
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::u8> fileData;
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        bool readSucceeded = fileIO->Open(dictionaryPath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, fileHandle);
+        if (readSucceeded)
+        {
+            AZ::u64 fileSize = 0;
+            readSucceeded = fileIO->Size(fileHandle, fileSize);
+            if (readSucceeded)
+            {
+                fileData.resize_no_construct(fileSize);
+                readSucceeded = fileIO->Read(fileHandle, fileData.data(), fileSize, true);
+            }
+            fileIO->Close(fileHandle);
+        }
+        if (!readSucceeded)
+        {
+            AZ_Error("Archive", false, R"(Failed to read the zstd dictionaries "%s" of the pack file.)", dictionaryPath.c_str());
+            return;
+        }
+
+        // Entries compressed with a dictionary that failed to load will fail to decompress, all other entries can still be read.
+        AZ::IO::MemoryStream stream(fileData.data(), fileData.size());
+        auto dictionaries = AZStd::make_shared<AZ::ZStdDictionarySet>();
+        if (auto loadOutcome = dictionaries->Load(stream); !loadOutcome.IsSuccess())
+        {
+            AZ_Error("Archive", false, R"(Failed to load the zstd dictionaries "%s" of the pack file: %s)", dictionaryPath.c_str(),
+                loadOutcome.GetError().c_str());
+            return;
+        }
+        m_zstdDictionaries = AZStd::move(dictionaries);
+    }
+
+    const AZ::ZStdDictionary* Cache::FindZStdDictionary(AZ::IO::PathView relativePath, uint64_t nSize) const
+    {
+        if (!m_zstdDictionaries || nSize > AZ::ZStdDictionarySet::MaxFileSize)
+        {
+            return nullptr;
+        }
+        return m_zstdDictionaries->FindDictionaryForFile(relativePath).get();
+    }
+
     size_t Cache::GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec)
     {
         switch (codec)
@@ -234,6 +289,7 @@ namespace AZ::IO::ZipDir
         const void* dataBuffer{};
         size_t nSizeCompressed;
         int nError = Z_ERRNO;
+        const AZ::ZStdDictionary* dictionary = nullptr;
 
         if (nSize == 0)
         {
@@ -242,6 +298,11 @@ namespace AZ::IO::ZipDir
         switch (nCompressionMethod)
         {
         case ZipFile::METHOD_DEFLATE:
+            dictionary = FindZStdDictionary(szRelativePathSrc, nSize);
+            if (dictionary)
+            {
+                codec = CompressionCodec::Codec::ZSTD;
+            }
             nSizeCompressed = GetCompressedSizeEstimate(nSize, codec);
             memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed);
             pCompressed = memoryBlock->m_address.get();
@@ -250,7 +311,7 @@ namespace AZ::IO::ZipDir
             switch (codec)
             {
             case CompressionCodec::Codec::ZSTD:
-                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel, dictionary);
                 break;
 
             case CompressionCodec::Codec::ZLIB:
@@ -708,7 +769,7 @@ namespace AZ::IO::ZipDir
             else
             {
                 size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
-                if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+                if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed, m_zstdDictionaries.get()))
                 {
                     return ZD_ERROR_CORRUPTED_DATA;
                 }
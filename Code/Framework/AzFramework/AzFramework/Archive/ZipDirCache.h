@@ -20,10 +20,17 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 
+namespace AZ
+{
+    class ZStdDictionary;
+    class ZStdDictionarySet;
+}
+
 namespace AZ::IO::ZipDir
 {
     struct FileDataRecord;
@@ -53,6 +60,8 @@ namespace AZ::IO::ZipDir
 
         // Adds a new file to the zip or update an existing one
         // adds a directory (creates several nested directories if needed)
+        // if the archive has a zstd dictionary for the type of the file, compressed files up to
+        // ZStdDictionarySet::MaxFileSize are compressed with the dictionary instead of the given codec
         ErrorEnum UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB);
 
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
@@ -108,6 +117,12 @@ namespace AZ::IO::ZipDir
             return &m_treeDir;
         }
 
+        // returns the zstd dictionaries stored next to the zip file, or nullptr if it doesn't have any
+        const AZStd::shared_ptr<const AZ::ZStdDictionarySet>& GetZStdDictionaries() const
+        {
+            return m_zstdDictionaries;
+        }
+
         // writes the CDR to the disk
         bool WriteCDR() { return WriteCDR(m_fileHandle); }
         bool WriteCDR(AZ::IO::HandleType fTarget);
@@ -128,6 +143,10 @@ namespace AZ::IO::ZipDir
         size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
     protected:
+        // loads the zstd dictionaries stored next to the zip file, if there are any
+        void LoadZStdDictionaries(AZ::IO::PathView zipFilePath);
+        const AZ::ZStdDictionary* FindZStdDictionary(AZ::IO::PathView relativePath, uint64_t nSize) const;
+
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
         FileEntryTree m_treeDir;
@@ -165,6 +184,9 @@ namespace AZ::IO::ZipDir
         ZipFile::CryCustomEncryptionHeader m_headerEncryption;
         ZipFile::CrySignedCDRHeader m_headerSignature;
         ZipFile::CryCustomExtendedHeader m_headerExtended;
+
+        // dictionaries of the zip file, loaded when it's opened and not modified afterwards
+        AZStd::shared_ptr<const AZ::ZStdDictionarySet> m_zstdDictionaries;
     };
 
     using CachePtr = AZStd::intrusive_ptr<Cache>;
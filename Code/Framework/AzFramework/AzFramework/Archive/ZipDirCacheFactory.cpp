@@ -147,6 +147,8 @@ namespace AZ::IO::ZipDir
         // the factory doesn't own it after that
         m_fileExt.m_fileHandle = AZ::IO::InvalidHandle;
 
+        pCache->LoadZStdDictionaries(szFileName);
+
         return pCache;
     }
 
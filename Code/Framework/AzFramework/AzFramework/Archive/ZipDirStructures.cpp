@@ -9,6 +9,7 @@
 
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Compression/zstd_dictionary.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -493,13 +494,20 @@ namespace AZ::IO::ZipDir
     // with 2 differences: there are no 16-bit checks, and
     // it initializes the inflation to start without waiting for compression method byte, as this is the
     // way it's stored into zip file
-    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize)
+    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize,
+        const AZ::ZStdDictionarySet* dictionaries)
     {
         int nReturnCode = Z_OK;
 
         //check first 4 bytes to see what compression codec was used
         if (CompressionCodec::TestForZSTDMagic(pCompressed))
         {
+            if (const AZ::ZStdDictionary* dictionary = dictionaries ? dictionaries->FindDictionaryForFrame(pCompressed, nSrcSize) : nullptr)
+            {
+                // The entry sizes are recorded in the archive, so the frame has to fill the buffer exactly.
+                return dictionary->Decompress(pCompressed, nSrcSize, pUncompressed, *pDestSize) ? Z_OK : Z_BUF_ERROR;
+            }
+
             size_t result = ZSTD_decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
 
             if (ZSTD_isError(result))
@@ -590,8 +598,20 @@ namespace AZ::IO::ZipDir
         return err;
     }
 
-    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
+    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel,
+        const AZ::ZStdDictionary* dictionary)
     {
+        if (dictionary)
+        {
+            const size_t compressedSize = dictionary->Compress(pUncompressed, nSrcSize, pCompressed, *pDestSize);
+            if (compressedSize == 0)
+            {
+                return Z_BUF_ERROR;
+            }
+            *pDestSize = compressedSize;
+            return Z_OK;
+        }
+
         size_t result = ZSTD_compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
 
         int err = Z_OK;
@@ -25,6 +25,12 @@
 
 struct z_stream_s;
 
+namespace AZ
+{
+    class ZStdDictionary;
+    class ZStdDictionarySet;
+}
+
 namespace AZ::IO
 {
     class FileIOBase;
@@ -144,13 +150,17 @@ namespace AZ::IO::ZipDir
     };
 
     // Uncompresses raw (without wrapping) data that is compressed with method 8 (deflated) in the Zip file
+    // zstd frames that were compressed with a dictionary are decompressed with the matching dictionary of the archive
     // returns one of the Z_* errors (Z_OK upon success)
-    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize);
+    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize,
+        const AZ::ZStdDictionarySet* dictionaries = nullptr);
 
     // compresses the raw data into raw data. The buffer for compressed data itself with the heap passed. Uses method 8 (deflate)
     // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
     int ZipRawCompress(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
-    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
+    // if a dictionary is given, the data is compressed with it at the compression level of the dictionary
+    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel,
+        const AZ::ZStdDictionary* dictionary = nullptr);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
     // fseek wrapper with memory in file support.
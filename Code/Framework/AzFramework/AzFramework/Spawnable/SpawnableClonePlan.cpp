@@ -0,0 +1,709 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    namespace ClonePlanInternal
+    {
+        using IdRemapper = AZ::IdUtils::Remapper<AZ::EntityId, false>;
+
+        // Returns the size of the types that the Serialize Context clones by saving and loading them, but that can be copied
+        // byte by byte instead, or 0 for all other types.
+        static size_t GetValueSize(const AZ::TypeId& typeId)
+        {
+            static const AZStd::pair<AZ::TypeId, size_t> s_valueTypes[] = {
+                { azrtti_typeid<bool>(), sizeof(bool) },
+                { azrtti_typeid<char>(), sizeof(char) },
+                { azrtti_typeid<AZ::s8>(), sizeof(AZ::s8) },
+                { azrtti_typeid<AZ::u8>(), sizeof(AZ::u8) },
+                { azrtti_typeid<AZ::s16>(), sizeof(AZ::s16) },
+                { azrtti_typeid<AZ::u16>(), sizeof(AZ::u16) },
+                { azrtti_typeid<AZ::s32>(), sizeof(AZ::s32) },
+                { azrtti_typeid<AZ::u32>(), sizeof(AZ::u32) },
+                { azrtti_typeid<AZ::s64>(), sizeof(AZ::s64) },
+                { azrtti_typeid<AZ::u64>(), sizeof(AZ::u64) },
+                { azrtti_typeid<float>(), sizeof(float) },
+                { azrtti_typeid<double>(), sizeof(double) },
+                { azrtti_typeid<AZ::Uuid>(), sizeof(AZ::Uuid) },
+                { azrtti_typeid<AZ::Vector2>(), sizeof(AZ::Vector2) },
+                { azrtti_typeid<AZ::Vector3>(), sizeof(AZ::Vector3) },
+                { azrtti_typeid<AZ::Vector4>(), sizeof(AZ::Vector4) },
+                { azrtti_typeid<AZ::Quaternion>(), sizeof(AZ::Quaternion) },
+                { azrtti_typeid<AZ::Color>(), sizeof(AZ::Color) },
+                { azrtti_typeid<AZ::Matrix3x3>(), sizeof(AZ::Matrix3x3) },
+                { azrtti_typeid<AZ::Matrix3x4>(), sizeof(AZ::Matrix3x4) },
+                { azrtti_typeid<AZ::Matrix4x4>(), sizeof(AZ::Matrix4x4) },
+            };
+
+            for (const auto& [valueTypeId, size] : s_valueTypes)
+            {
+                if (valueTypeId == typeId)
+                {
+                    return size;
+                }
+            }
+            return 0;
+        }
+
+        // Classes without any code that runs while cloning them can have their members added to the plan of the class
+        // that holds them.
+        static bool CanFlatten(const AZ::SerializeContext::ClassData& classData)
+        {
+            return !classData.m_serializer && !classData.m_container && !classData.m_eventHandler && !classData.IsDeprecated() &&
+                classData.m_typeId != azrtti_typeid<AZ::DynamicSerializableField>();
+        }
+
+        static const AZ::SerializeContext::ClassData* FindElementClassData(const AZ::SerializeContext::ClassElement& element,
+            const AZ::SerializeContext::ClassData* parent, const AZ::SerializeContext& serializeContext)
+        {
+            return element.m_genericClassInfo
+                ? element.m_genericClassInfo->GetClassData()
+                : serializeContext.FindClassData(element.m_typeId, parent, element.m_nameCrc);
+        }
+
+        // Returns the element describing the entries of a container if the container holds only pointers to reflected objects.
+        static const AZ::SerializeContext::ClassElement* GetPointerContainerElement(const AZ::SerializeContext::ClassData& classData)
+        {
+            AZ::SerializeContext::IDataContainer* container = classData.m_container;
+            if (!container || classData.m_serializer || !container->IsSequenceContainer() || container->IsSmartPointer())
+            {
+                return nullptr;
+            }
+
+            const AZ::SerializeContext::ClassElement* element = nullptr;
+            size_t elementTypeCount = 0;
+            container->EnumTypes(
+                [&element, &elementTypeCount](const AZ::Uuid&, const AZ::SerializeContext::ClassElement* genericElement)
+                {
+                    element = genericElement;
+                    ++elementTypeCount;
+                    return true;
+                });
+
+            return elementTypeCount == 1 && element && (element->m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER) != 0
+                ? element
+                : nullptr;
+        }
+
+        // Sorts the ranges by offset and joins ranges that are next to each other.
+        static void MergeCopyRanges(AZStd::vector<ClonePlan::CopyRange>& copyRanges)
+        {
+            AZStd::sort(copyRanges.begin(), copyRanges.end(),
+                [](const ClonePlan::CopyRange& lhs, const ClonePlan::CopyRange& rhs)
+                {
+                    return lhs.m_offset < rhs.m_offset;
+                });
+
+            size_t count = 0;
+            for (const ClonePlan::CopyRange& range : copyRanges)
+            {
+                if (count > 0 && copyRanges[count - 1].m_offset + copyRanges[count - 1].m_size == range.m_offset)
+                {
+                    copyRanges[count - 1].m_size += range.m_size;
+                }
+                else
+                {
+                    copyRanges[count++] = range;
+                }
+            }
+            copyRanges.resize(count);
+        }
+    } // namespace ClonePlanInternal
+
+    //
+    // ClonePlan
+    //
+
+    ClonePlan::ClonePlan(const AZ::SerializeContext::ClassData& classData)
+        : m_classData(&classData)
+    {
+    }
+
+    const AZ::SerializeContext::ClassData& ClonePlan::GetClassData() const
+    {
+        return *m_classData;
+    }
+
+    bool ClonePlan::IsCompiled() const
+    {
+        return m_isCompiled;
+    }
+
+    bool ClonePlan::MayHoldEntityIds() const
+    {
+        return m_mayHoldEntityIds;
+    }
+
+    AZStd::span<const ClonePlan::CopyRange> ClonePlan::GetCopyRanges() const
+    {
+        return m_copyRanges;
+    }
+
+    AZStd::span<const ClonePlan::EntityIdField> ClonePlan::GetEntityIdFields() const
+    {
+        return m_entityIdFields;
+    }
+
+    AZStd::span<const ClonePlan::DeepCopyMember> ClonePlan::GetDeepCopyMembers() const
+    {
+        return m_deepCopyMembers;
+    }
+
+    //
+    // ClonePlanCache
+    //
+
+    //! The state of a single clone. Ids of objects are remapped while cloning, but references can only be remapped once the
+    //! whole object has been cloned, since they can refer to objects later on in the same clone.
+    struct ClonePlanCache::CloneState
+    {
+        CloneState(const EntityIdMap& idMap, EntityIdMap* writableIdMap, AZ::SerializeContext& serializeContext)
+            : m_idMap(idMap)
+            , m_writableIdMap(writableIdMap)
+            , m_serializeContext(serializeContext)
+        {
+        }
+
+        template<typename Generator>
+        AZ::EntityId MapObjectId(const AZ::EntityId& id, const Generator& generate)
+        {
+            if (auto it = m_idMap.find(id); it != m_idMap.end())
+            {
+                return it->second;
+            }
+            if (m_writableIdMap)
+            {
+                return m_writableIdMap->emplace(id, generate()).first->second;
+            }
+            for (const auto& [originalId, generatedId] : m_generatedIds)
+            {
+                if (originalId == id)
+                {
+                    return generatedId;
+                }
+            }
+            return m_generatedIds.emplace_back(id, generate()).second;
+        }
+
+        AZ::EntityId MapReference(const AZ::EntityId& id) const
+        {
+            if (auto it = m_idMap.find(id); it != m_idMap.end())
+            {
+                return it->second;
+            }
+            for (const auto& [originalId, generatedId] : m_generatedIds)
+            {
+                if (originalId == id)
+                {
+                    return generatedId;
+                }
+            }
+            return id;
+        }
+
+        const EntityIdMap& m_idMap;
+        //! The map to add generated ids to. If not set, generated ids are kept in m_generatedIds instead.
+        EntityIdMap* m_writableIdMap;
+        AZStd::vector<AZStd::pair<AZ::EntityId, AZ::EntityId>> m_generatedIds;
+        //! Ids in planned objects that refer to other objects.
+        AZStd::vector<AZ::EntityId*> m_references;
+        //! Objects cloned through the Serialize Context that may hold references.
+        AZStd::vector<AZStd::pair<void*, AZ::TypeId>> m_reflectedObjects;
+        AZ::SerializeContext& m_serializeContext;
+    };
+
+    AZ::Entity* ClonePlanCache::CloneEntity(const AZ::Entity& prototype, EntityIdMap& idMap, AZ::SerializeContext& serializeContext)
+    {
+        CloneState state(idMap, &idMap, serializeContext);
+        return CloneEntityInternal(prototype, state);
+    }
+
+    AZ::Component* ClonePlanCache::CloneComponent(const AZ::Component& prototype, EntityIdMap& idMap, AZ::SerializeContext& serializeContext)
+    {
+        CloneState state(idMap, &idMap, serializeContext);
+
+        const void* source = AZ::SerializeTypeInfo<AZ::Component>::RttiCast(&prototype, azrtti_typeid(&prototype));
+        const AZ::TypeId& typeId = AZ::SerializeTypeInfo<AZ::Component>::GetUuid(&prototype);
+        const AZ::SerializeContext::ClassData* classData = serializeContext.FindClassData(typeId);
+        if (!classData)
+        {
+            AZ_Error("Spawnables", false, "Unable to clone component of type %s because it isn't reflected to the Serialize Context.",
+                typeId.ToString<AZStd::string>().c_str());
+            return nullptr;
+        }
+
+        void* clone = CloneObject(source, *classData, state);
+        ResolveReferences(state);
+        return clone ? serializeContext.Cast<AZ::Component*>(clone, typeId) : nullptr;
+    }
+
+    void ClonePlanCache::CloneEntities(AZStd::span<const AZ::Entity* const> prototypes, AZStd::span<AZ::Entity*> clones,
+        EntityIdMap& idMap, AZ::SerializeContext& serializeContext)
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+        AZ_Assert(prototypes.size() == clones.size(), "The number of clones (%zu) doesn't match the number of prototypes (%zu).",
+            clones.size(), prototypes.size());
+
+        AZ::JobContext* jobContext = nullptr;
+        if (prototypes.size() >= ParallelCloneThreshold)
+        {
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        }
+
+        if (!jobContext)
+        {
+            for (size_t i = 0; i < prototypes.size(); ++i)
+            {
+                clones[i] = CloneEntity(*prototypes[i], idMap, serializeContext);
+            }
+            return;
+        }
+
+        AZStd::vector<AZStd::vector<AZStd::pair<AZ::EntityId, AZ::EntityId>>> generatedIds(prototypes.size());
+        AZ::parallel_for(
+            0, aznumeric_cast<int>(prototypes.size()),
+            [this, &prototypes, &clones, &generatedIds, &idMap, &serializeContext](int index)
+            {
+                CloneState state(idMap, nullptr, serializeContext);
+                clones[index] = CloneEntityInternal(*prototypes[index], state);
+                generatedIds[index] = AZStd::move(state.m_generatedIds);
+            },
+            jobContext);
+
+        for (const auto& entityGeneratedIds : generatedIds)
+        {
+            for (const auto& [originalId, generatedId] : entityGeneratedIds)
+            {
+                idMap.emplace(originalId, generatedId);
+            }
+        }
+    }
+
+    const ClonePlan& ClonePlanCache::GetPlan(const AZ::SerializeContext::ClassData& classData, const AZ::SerializeContext& serializeContext)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            if (m_serializeContext == &serializeContext)
+            {
+                if (auto it = m_plans.find(&classData); it != m_plans.end())
+                {
+                    return *it->second;
+                }
+            }
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (m_serializeContext != &serializeContext)
+        {
+            m_plans.clear();
+            m_holdsEntityIds.clear();
+            m_serializeContext = &serializeContext;
+        }
+
+        AZStd::unique_ptr<ClonePlan>& plan = m_plans[&classData];
+        if (!plan)
+        {
+            plan = AZStd::make_unique<ClonePlan>(classData);
+            BuildPlan(*plan, serializeContext);
+        }
+        return *plan;
+    }
+
+    void ClonePlanCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_plans.clear();
+        m_holdsEntityIds.clear();
+        m_serializeContext = nullptr;
+    }
+
+    size_t ClonePlanCache::GetPlanCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_plans.size();
+    }
+
+    void ClonePlanCache::BuildPlan(ClonePlan& plan, const AZ::SerializeContext& serializeContext)
+    {
+        using namespace ClonePlanInternal;
+
+        const AZ::SerializeContext::ClassData& classData = *plan.m_classData;
+        plan.m_mayHoldEntityIds = MayHoldEntityIds(classData, serializeContext);
+        if (!classData.m_factory || !CanFlatten(classData) || !AddMembers(plan, classData, 0, serializeContext))
+        {
+            plan.m_copyRanges.clear();
+            plan.m_entityIdFields.clear();
+            plan.m_deepCopyMembers.clear();
+            return;
+        }
+
+        MergeCopyRanges(plan.m_copyRanges);
+        plan.m_isCompiled = true;
+    }
+
+    bool ClonePlanCache::AddMembers(ClonePlan& plan, const AZ::SerializeContext::ClassData& classData, size_t baseOffset,
+        const AZ::SerializeContext& serializeContext)
+    {
+        using namespace ClonePlanInternal;
+        using ClassElement = AZ::SerializeContext::ClassElement;
+        using DeepCopyType = ClonePlan::DeepCopyMember::Type;
+
+        for (const ClassElement& element : classData.m_elements)
+        {
+            if (element.m_flags & (ClassElement::FLG_DYNAMIC_FIELD | ClassElement::FLG_UI_ELEMENT))
+            {
+                return false;
+            }
+
+            const AZ::SerializeContext::ClassData* elementClassData = FindElementClassData(element, &classData, serializeContext);
+            if (!elementClassData || elementClassData->IsDeprecated())
+            {
+                // Cloning through the Serialize Context skips these as well.
+                continue;
+            }
+
+            const AZ::u32 offset = aznumeric_cast<AZ::u32>(baseOffset + element.m_offset);
+            const bool isEntityId = elementClassData->m_typeId == azrtti_typeid<AZ::EntityId>();
+            if (element.m_flags & ClassElement::FLG_POINTER)
+            {
+                if (isEntityId)
+                {
+                    // Pointers to ids are rare enough to leave to the Remapper.
+                    return false;
+                }
+
+                ClonePlan::DeepCopyMember& member = plan.m_deepCopyMembers.emplace_back();
+                member.m_element = &element;
+                member.m_classData = elementClassData;
+                member.m_offset = offset;
+                member.m_type = DeepCopyType::Pointer;
+                continue;
+            }
+
+            if (isEntityId)
+            {
+                ClonePlan::EntityIdField& field = plan.m_entityIdFields.emplace_back();
+                field.m_offset = offset;
+                if (AZ::Attribute* attribute = AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, element.m_attributes))
+                {
+                    field.m_idGenerator = azrtti_cast<AZ::AttributeFunction<AZ::EntityId()>*>(attribute);
+                }
+                continue;
+            }
+
+            const size_t valueSize = GetValueSize(serializeContext.GetUnderlyingTypeId(elementClassData->m_typeId));
+            if (valueSize != 0 && valueSize == element.m_dataSize)
+            {
+                plan.m_copyRanges.push_back({ offset, aznumeric_cast<AZ::u32>(valueSize) });
+                continue;
+            }
+
+            if (CanFlatten(*elementClassData))
+            {
+                // Base classes and members that are plain classes themselves are added in place. If that's not possible
+                // the member is cloned as a whole instead.
+                const size_t copyRangeCount = plan.m_copyRanges.size();
+                const size_t entityIdFieldCount = plan.m_entityIdFields.size();
+                const size_t deepCopyMemberCount = plan.m_deepCopyMembers.size();
+                if (AddMembers(plan, *elementClassData, offset, serializeContext))
+                {
+                    continue;
+                }
+                plan.m_copyRanges.resize(copyRangeCount);
+                plan.m_entityIdFields.resize(entityIdFieldCount);
+                plan.m_deepCopyMembers.resize(deepCopyMemberCount);
+            }
+
+            ClonePlan::DeepCopyMember& member = plan.m_deepCopyMembers.emplace_back();
+            member.m_element = &element;
+            member.m_classData = elementClassData;
+            member.m_offset = offset;
+            if (elementClassData->m_typeId == azrtti_typeid<AZStd::string>())
+            {
+                member.m_type = DeepCopyType::String;
+                member.m_mayHoldEntityIds = false;
+            }
+            else if (const ClassElement* containerElement = GetPointerContainerElement(*elementClassData))
+            {
+                member.m_type = DeepCopyType::PointerContainer;
+                member.m_containerElement = containerElement;
+            }
+            else
+            {
+                member.m_type = DeepCopyType::Reflected;
+                member.m_mayHoldEntityIds = MayHoldEntityIds(*elementClassData, serializeContext);
+            }
+        }
+        return true;
+    }
+
+    bool ClonePlanCache::MayHoldEntityIds(const AZ::SerializeContext::ClassData& classData, const AZ::SerializeContext& serializeContext)
+    {
+        using namespace ClonePlanInternal;
+
+        if (auto it = m_holdsEntityIds.find(&classData); it != m_holdsEntityIds.end())
+        {
+            return it->second;
+        }
+
+        // Reflection that refers back to the class is assumed to hold ids until the answer is known.
+        m_holdsEntityIds.emplace(&classData, true);
+
+        bool result = false;
+        if (classData.m_typeId == azrtti_typeid<AZ::EntityId>() || classData.m_typeId == azrtti_typeid<AZ::DynamicSerializableField>())
+        {
+            result = true;
+        }
+        else if (classData.m_container)
+        {
+            classData.m_container->EnumTypes(
+                [this, &classData, &serializeContext, &result](const AZ::Uuid& typeId, const AZ::SerializeContext::ClassElement* element)
+                {
+                    const AZ::SerializeContext::ClassData* elementClassData = element
+                        ? FindElementClassData(*element, &classData, serializeContext)
+                        : serializeContext.FindClassData(typeId);
+                    // Pointers can point to derived classes, which can hold ids even if the base class doesn't.
+                    result = !elementClassData || (element && element->m_azRtti && (element->m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER)) ||
+                        MayHoldEntityIds(*elementClassData, serializeContext);
+                    return !result;
+                });
+        }
+        else if (!classData.m_serializer)
+        {
+            for (const AZ::SerializeContext::ClassElement& element : classData.m_elements)
+            {
+                const AZ::SerializeContext::ClassData* elementClassData = FindElementClassData(element, &classData, serializeContext);
+                if (!elementClassData)
+                {
+                    continue;
+                }
+                if ((element.m_azRtti && (element.m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER)) ||
+                    (element.m_flags & AZ::SerializeContext::ClassElement::FLG_DYNAMIC_FIELD) ||
+                    MayHoldEntityIds(*elementClassData, serializeContext))
+                {
+                    result = true;
+                    break;
+                }
+            }
+        }
+
+        m_holdsEntityIds[&classData] = result;
+        return result;
+    }
+
+    void* ClonePlanCache::CloneObject(const void* source, const AZ::SerializeContext::ClassData& classData, CloneState& state)
+    {
+        const ClonePlan& plan = GetPlan(classData, state.m_serializeContext);
+        if (plan.IsCompiled())
+        {
+            void* target = classData.m_factory->Create(classData.m_name);
+            ExecutePlan(plan, target, source, state);
+            return target;
+        }
+
+        void* target = state.m_serializeContext.CloneObject(source, classData.m_typeId);
+        if (target && plan.MayHoldEntityIds())
+        {
+            ClonePlanInternal::IdRemapper::RemapIds(
+                target, classData.m_typeId,
+                [&state](const AZ::EntityId& originalId, bool, const ClonePlanInternal::IdRemapper::IdGenerator& idGenerator)
+                {
+                    return state.MapObjectId(originalId, idGenerator);
+                },
+                &state.m_serializeContext, true);
+            state.m_reflectedObjects.emplace_back(target, classData.m_typeId);
+        }
+        return target;
+    }
+
+    void ClonePlanCache::ExecutePlan(const ClonePlan& plan, void* target, const void* source, CloneState& state)
+    {
+        using DeepCopyType = ClonePlan::DeepCopyMember::Type;
+
+        char* targetBytes = reinterpret_cast<char*>(target);
+        const char* sourceBytes = reinterpret_cast<const char*>(source);
+
+        for (const ClonePlan::CopyRange& range : plan.m_copyRanges)
+        {
+            memcpy(targetBytes + range.m_offset, sourceBytes + range.m_offset, range.m_size);
+        }
+
+        for (const ClonePlan::EntityIdField& field : plan.m_entityIdFields)
+        {
+            AZ::EntityId& targetId = *reinterpret_cast<AZ::EntityId*>(targetBytes + field.m_offset);
+            const AZ::EntityId& sourceId = *reinterpret_cast<const AZ::EntityId*>(sourceBytes + field.m_offset);
+            if (field.m_idGenerator)
+            {
+                targetId = state.MapObjectId(sourceId,
+                    [generator = field.m_idGenerator]()
+                    {
+                        return generator->Invoke(nullptr);
+                    });
+            }
+            else
+            {
+                targetId = sourceId;
+                state.m_references.push_back(&targetId);
+            }
+        }
+
+        for (const ClonePlan::DeepCopyMember& member : plan.m_deepCopyMembers)
+        {
+            void* targetMember = targetBytes + member.m_offset;
+            const void* sourceMember = sourceBytes + member.m_offset;
+            switch (member.m_type)
+            {
+            case DeepCopyType::String:
+                *reinterpret_cast<AZStd::string*>(targetMember) = *reinterpret_cast<const AZStd::string*>(sourceMember);
+                break;
+            case DeepCopyType::Pointer:
+                *reinterpret_cast<void**>(targetMember) =
+                    ClonePointer(*reinterpret_cast<const void* const*>(sourceMember), *member.m_element, state);
+                break;
+            case DeepCopyType::PointerContainer:
+            {
+                AZ::SerializeContext::IDataContainer* container = member.m_classData->m_container;
+                container->ClearElements(targetMember, &state.m_serializeContext);
+                container->EnumElements(const_cast<void*>(sourceMember),
+                    [this, container, targetMember, &member, &state](void* sourceElement, const AZ::Uuid&,
+                        const AZ::SerializeContext::ClassData*, const AZ::SerializeContext::ClassElement*)
+                    {
+                        void* clone = ClonePointer(*reinterpret_cast<void**>(sourceElement), *member.m_containerElement, state);
+                        if (!clone)
+                        {
+                            return true;
+                        }
+
+                        void* targetElement = container->ReserveElement(targetMember, member.m_containerElement);
+                        AZ_Assert(targetElement, "Failed to reserve element in container. The container may be full.");
+                        if (targetElement)
+                        {
+                            *reinterpret_cast<void**>(targetElement) = clone;
+                            container->StoreElement(targetMember, targetElement);
+                        }
+                        return true;
+                    });
+                break;
+            }
+            case DeepCopyType::Reflected:
+                state.m_serializeContext.CloneObjectInplace(targetMember, sourceMember, member.m_element->m_typeId);
+                if (member.m_mayHoldEntityIds)
+                {
+                    ClonePlanInternal::IdRemapper::RemapIds(
+                        targetMember, member.m_element->m_typeId,
+                        [&state](const AZ::EntityId& originalId, bool, const ClonePlanInternal::IdRemapper::IdGenerator& idGenerator)
+                        {
+                            return state.MapObjectId(originalId, idGenerator);
+                        },
+                        &state.m_serializeContext, true);
+                    state.m_reflectedObjects.emplace_back(targetMember, member.m_element->m_typeId);
+                }
+                break;
+            }
+        }
+    }
+
+    void* ClonePlanCache::ClonePointer(const void* source, const AZ::SerializeContext::ClassElement& element, CloneState& state)
+    {
+        if (!source)
+        {
+            return nullptr;
+        }
+
+        // Pointers can point to derived classes, in which case the plan of the derived class is used.
+        const AZ::SerializeContext::ClassData* classData = nullptr;
+        const void* object = source;
+        const AZ::TypeId actualTypeId = element.m_azRtti ? element.m_azRtti->GetActualUuid(source) : element.m_typeId;
+        if (actualTypeId != element.m_typeId)
+        {
+            classData = state.m_serializeContext.FindClassData(actualTypeId);
+            if (classData && classData->m_azRtti)
+            {
+                object = element.m_azRtti->Cast(const_cast<void*>(source), classData->m_azRtti->GetTypeId());
+            }
+        }
+        else
+        {
+            classData = ClonePlanInternal::FindElementClassData(element, nullptr, state.m_serializeContext);
+        }
+
+        if (!classData || classData->IsDeprecated() || !object)
+        {
+            return nullptr;
+        }
+
+        AZ_Assert(classData->m_factory != nullptr, "We are attempting to create '%s', but no factory is provided! Either provide a factory "
+            "or change data member '%s' to value not pointer!", classData->m_name, element.m_name);
+        void* clone = CloneObject(object, *classData, state);
+        return clone
+            ? state.m_serializeContext.DownCast(clone, classData->m_typeId, element.m_typeId, classData->m_azRtti, element.m_azRtti)
+            : nullptr;
+    }
+
+    AZ::Entity* ClonePlanCache::CloneEntityInternal(const AZ::Entity& prototype, CloneState& state)
+    {
+        const void* source = AZ::SerializeTypeInfo<AZ::Entity>::RttiCast(&prototype, azrtti_typeid(&prototype));
+        const AZ::TypeId& typeId = AZ::SerializeTypeInfo<AZ::Entity>::GetUuid(&prototype);
+        const AZ::SerializeContext::ClassData* classData = state.m_serializeContext.FindClassData(typeId);
+        if (!classData)
+        {
+            AZ_Error("Spawnables", false, "Unable to clone entity '%s' because it isn't reflected to the Serialize Context.",
+                prototype.GetName().c_str());
+            return nullptr;
+        }
+
+        void* clone = CloneObject(source, *classData, state);
+        ResolveReferences(state);
+        return clone ? state.m_serializeContext.Cast<AZ::Entity*>(clone, typeId) : nullptr;
+    }
+
+    void ClonePlanCache::ResolveReferences(CloneState& state)
+    {
+        for (AZ::EntityId* reference : state.m_references)
+        {
+            *reference = state.MapReference(*reference);
+        }
+
+        for (const auto& [object, typeId] : state.m_reflectedObjects)
+        {
+            ClonePlanInternal::IdRemapper::RemapIds(
+                object, typeId,
+                [&state](const AZ::EntityId& originalId, bool, const ClonePlanInternal::IdRemapper::IdGenerator&)
+                {
+                    return state.MapReference(originalId);
+                },
+                &state.m_serializeContext, false);
+        }
+
+        state.m_references.clear();
+        state.m_reflectedObjects.clear();
+    }
+} // namespace AzFramework
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class Component;
+    class Entity;
+}
+
+namespace AzFramework
+{
+    //! Precompiled description of how to clone an instance of a reflected class while remapping the entity ids in it.
+    //! Cloning through the Serialize Context enumerates every element of the object, saves and loads every value through a
+    //! serializer and then enumerates the clone twice more to remap entity ids. A plan does the enumeration once per type:
+    //! members of plain classes, including base classes, are flattened into byte ranges that can be copied as is, the
+    //! offsets of entity ids and members that need a deep copy, such as strings and components, are recorded separately.
+    class ClonePlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ClonePlan, AZ::SystemAllocator);
+
+        //! A range of bytes that can be copied from the source to the clone with memcpy.
+        struct CopyRange
+        {
+            AZ::u32 m_offset{ 0 };
+            AZ::u32 m_size{ 0 };
+        };
+
+        //! An entity id that has to be remapped after it's copied.
+        struct EntityIdField
+        {
+            AZ::u32 m_offset{ 0 };
+            //! Set if the element has the IdGeneratorFunction attribute, in which case this is the id of the object itself
+            //! and a new id is generated if the original id isn't mapped yet. All other ids are references to other objects.
+            AZ::AttributeFunction<AZ::EntityId()>* m_idGenerator{ nullptr };
+        };
+
+        //! A member that can't be copied byte by byte.
+        struct DeepCopyMember
+        {
+            enum class Type : AZ::u8
+            {
+                //! An AZStd::string, which is assigned.
+                String,
+                //! A pointer to a reflected object, which is cloned using the plan of the type it points to.
+                Pointer,
+                //! A sequence container of pointers, such as the components of an entity. Each element is cloned using the
+                //! plan of the type it points to.
+                PointerContainer,
+                //! Any other member. These are cloned through the Serialize Context.
+                Reflected
+            };
+
+            const AZ::SerializeContext::ClassElement* m_element{ nullptr };
+            //! The class data of the member, or for containers of the container.
+            const AZ::SerializeContext::ClassData* m_classData{ nullptr };
+            //! For pointer containers, the element describing the pointers in the container.
+            const AZ::SerializeContext::ClassElement* m_containerElement{ nullptr };
+            AZ::u32 m_offset{ 0 };
+            Type m_type{ Type::Reflected };
+            //! False if the member can't hold entity ids, so remapping can be skipped for reflected members.
+            bool m_mayHoldEntityIds{ true };
+        };
+
+        explicit ClonePlan(const AZ::SerializeContext::ClassData& classData);
+
+        const AZ::SerializeContext::ClassData& GetClassData() const;
+        //! Returns false if the class can't be cloned with a plan, for instance because it has a custom serializer or an
+        //! event handler. These classes are cloned through the Serialize Context as a whole.
+        bool IsCompiled() const;
+        //! Returns false if instances of the class can't hold entity ids, so remapping can be skipped for classes that
+        //! aren't compiled.
+        bool MayHoldEntityIds() const;
+
+        AZStd::span<const CopyRange> GetCopyRanges() const;
+        AZStd::span<const EntityIdField> GetEntityIdFields() const;
+        AZStd::span<const DeepCopyMember> GetDeepCopyMembers() const;
+
+    private:
+        friend class ClonePlanCache;
+
+        const AZ::SerializeContext::ClassData* m_classData{ nullptr };
+        AZStd::vector<CopyRange> m_copyRanges;
+        AZStd::vector<EntityIdField> m_entityIdFields;
+        AZStd::vector<DeepCopyMember> m_deepCopyMembers;
+        bool m_isCompiled{ false };
+        bool m_mayHoldEntityIds{ true };
+    };
+
+    //! Clones entities and components using ClonePlans, which are created the first time a type is cloned. The results
+    //! are the same as cloning with AZ::IdUtils::Remapper<AZ::EntityId>::CloneObjectAndGenerateNewIdsAndFixRefs without
+    //! duplicate ids.
+    //! Plans are tied to the Serialize Context they were created with. The cache resets itself when it's used with a
+    //! different context, but needs to be cleared manually if types are reflected or unreflected while it's alive.
+    //! Cloning can happen from multiple threads, but clearing can't happen while a clone is in progress.
+    class ClonePlanCache final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ClonePlanCache, AZ::SystemAllocator);
+
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! The minimum number of entities in a batch before CloneEntities spreads the work over the job system.
+        static constexpr size_t ParallelCloneThreshold = 64;
+
+        ClonePlanCache() = default;
+        ClonePlanCache(const ClonePlanCache&) = delete;
+        ClonePlanCache& operator=(const ClonePlanCache&) = delete;
+
+        //! Clones an entity and remaps the entity ids in it using the provided map. Ids of objects that aren't in the map
+        //! yet get a newly generated id, which is added to the map. References to ids that aren't in the map are kept.
+        AZ::Entity* CloneEntity(const AZ::Entity& prototype, EntityIdMap& idMap, AZ::SerializeContext& serializeContext);
+        //! Clones a component and remaps the entity ids in it in the same way as CloneEntity.
+        AZ::Component* CloneComponent(const AZ::Component& prototype, EntityIdMap& idMap, AZ::SerializeContext& serializeContext);
+
+        //! Clones a batch of entities. Larger batches are cloned in parallel if the job system is available. The map isn't
+        //! updated while the batch is cloned, so the ids of the prototypes themselves should be in the map already. Other
+        //! generated ids are added to the map afterwards in the order of the prototypes, but aren't seen by references in
+        //! other entities of the same batch.
+        //! @param prototypes The entities to clone.
+        //! @param clones Receives the clones, needs to have the same size as prototypes.
+        void CloneEntities(AZStd::span<const AZ::Entity* const> prototypes, AZStd::span<AZ::Entity*> clones, EntityIdMap& idMap,
+            AZ::SerializeContext& serializeContext);
+
+        //! Returns the plan for the provided class, creating it if needed.
+        const ClonePlan& GetPlan(const AZ::SerializeContext::ClassData& classData, const AZ::SerializeContext& serializeContext);
+
+        //! Removes all plans.
+        void Clear();
+
+        size_t GetPlanCount() const;
+
+    private:
+        struct CloneState;
+
+        void BuildPlan(ClonePlan& plan, const AZ::SerializeContext& serializeContext);
+        bool AddMembers(ClonePlan& plan, const AZ::SerializeContext::ClassData& classData, size_t baseOffset,
+            const AZ::SerializeContext& serializeContext);
+        bool MayHoldEntityIds(const AZ::SerializeContext::ClassData& classData, const AZ::SerializeContext& serializeContext);
+
+        void* CloneObject(const void* source, const AZ::SerializeContext::ClassData& classData, CloneState& state);
+        void ExecutePlan(const ClonePlan& plan, void* target, const void* source, CloneState& state);
+        void* ClonePointer(const void* source, const AZ::SerializeContext::ClassElement& element, CloneState& state);
+        AZ::Entity* CloneEntityInternal(const AZ::Entity& prototype, CloneState& state);
+        void ResolveReferences(CloneState& state);
+
+        AZStd::unordered_map<const AZ::SerializeContext::ClassData*, AZStd::unique_ptr<ClonePlan>> m_plans;
+        //! Whether or not a class can hold entity ids, directly or through its members or elements.
+        AZStd::unordered_map<const AZ::SerializeContext::ClassData*, bool> m_holdsEntityIds;
+        mutable AZStd::shared_mutex m_mutex;
+        const AZ::SerializeContext* m_serializeContext{ nullptr };
+    };
+} // namespace AzFramework
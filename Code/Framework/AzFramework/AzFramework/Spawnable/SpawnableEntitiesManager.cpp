@@ -8,7 +8,6 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
-#include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/parallel/scoped_lock.h>
@@ -345,11 +344,8 @@ namespace AzFramework
     AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
         EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
     {
-        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
-        constexpr bool allowDuplicateIds = false;
-
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-            &entityPrototype, prototypeToCloneMap, &serializeContext);
+        // If the same ID gets remapped more than once, the clone plans preserve the original remapping instead of overwriting it.
+        return m_clonePlanCache.CloneEntity(entityPrototype, prototypeToCloneMap, serializeContext);
     }
 
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
@@ -399,12 +395,9 @@ namespace AzFramework
         AZ::SerializeContext& serializeContext)
     {
         // Only components are added and entities are looked up so no duplicate entity ids should be encountered.
-        constexpr bool allowDuplicateIds = false;
-
         for (const AZ::Component* component : componentPrototypes)
         {
-            AZ::Component* clone = AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-                component, prototypeToCloneMap, &serializeContext);
+            AZ::Component* clone = m_clonePlanCache.CloneComponent(*component, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone, "Unable to clone component for entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
             [[maybe_unused]] bool result = target.AddComponent(clone);
             AZ_Assert(result, "Unable to add cloned component to entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
@@ -478,16 +471,24 @@ namespace AzFramework
                 auto aliasEnd = aliases.end();
                 if (aliasIt == aliasEnd)
                 {
+                    // The entities in a spawnable have unique ids, so all ids in the reference map are known before cloning
+                    // starts and the entities can be cloned as a single batch.
+                    AZStd::vector<const AZ::Entity*> prototypes;
+                    prototypes.reserve(entitiesToSpawnSize);
                     for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                     {
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(
                             entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                        prototypes.push_back(entitiesToSpawn[i].get());
                         spawnedEntityIndices.push_back(i);
                     }
+
+                    spawnedEntities.resize(spawnedEntitiesInitialCount + entitiesToSpawnSize);
+                    m_clonePlanCache.CloneEntities(
+                        prototypes, AZStd::span<AZ::Entity*>(spawnedEntities.data() + spawnedEntitiesInitialCount, entitiesToSpawnSize),
+                        ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                 }
                 else
                 {
@@ -542,6 +543,9 @@ namespace AzFramework
                 {
                     AZ::Entity* clone = (*it);
                     clone->SetEntitySpawnTicketId(request.m_ticketId);
+                    // Clones of the same prototype only need their component order to be worked out once. If the sort fails
+                    // the entity is left as is, so the error is reported when it's activated.
+                    clone->EvaluateDependenciesGetDetails(m_dependencySortCache);
                     GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
                 }
 
@@ -675,6 +679,7 @@ namespace AzFramework
                 {
                     AZ::Entity* clone = (*it);
                     clone->SetEntitySpawnTicketId(request.m_ticketId);
+                    clone->EvaluateDependenciesGetDetails(m_dependencySortCache);
                     GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
                 }
 
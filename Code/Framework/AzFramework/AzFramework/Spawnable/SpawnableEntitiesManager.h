@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/Component/DependencySortCache.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
@@ -16,6 +17,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
 namespace AZ
@@ -312,6 +314,11 @@ namespace AzFramework
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
 
+        //! Shares the component activation order between clones of the same prototype entity.
+        AZ::DependencySortCache m_dependencySortCache;
+        //! Compiled per type descriptions of how to clone the prototype entities and their components.
+        ClonePlanCache m_clonePlanCache;
+
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
         AZStd::atomic_int m_ticketsPendingRegistration{ 0 };
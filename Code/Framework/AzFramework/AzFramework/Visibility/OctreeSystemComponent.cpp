@@ -7,8 +7,11 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 
 namespace AzFramework
 {
@@ -16,6 +19,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(bool,     bg_octreeDeferUpdates,       false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "If set to true, visibility octree updates are queued and applied once per tick so queries don't need to lock");
 
     static uint32_t GetChildNodeCount()
     {
@@ -35,7 +39,11 @@ namespace AzFramework
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
+        , m_packedEntries(AZStd::move(rhs.m_packedEntries))
     {
+        memcpy(m_childMin, rhs.m_childMin, sizeof(m_childMin));
+        memcpy(m_childMax, rhs.m_childMax, sizeof(m_childMax));
+
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
         {
@@ -49,6 +57,9 @@ namespace AzFramework
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
+        m_packedEntries = AZStd::move(rhs.m_packedEntries);
+        memcpy(m_childMin, rhs.m_childMin, sizeof(m_childMin));
+        memcpy(m_childMax, rhs.m_childMax, sizeof(m_childMax));
 
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -59,20 +70,19 @@ namespace AzFramework
         return *this;
     }
 
-    void OctreeNode::Insert(OctreeScene& octreeScene, VisibilityEntry* entry)
+    void OctreeNode::Insert(OctreeScene& octreeScene, VisibilityEntry* entry, const AZ::Aabb& boundingVolume, void* userData)
     {
         AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the OctreeScene");
 
         // If this is not a leaf node, try to insert into the child nodes
         if (m_children != nullptr)
         {
-            const AZ::Aabb boundingVolume = entry->m_boundingVolume;
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
                 if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
                 {
-                    return m_children[child].Insert(octreeScene, entry);
+                    return m_children[child].Insert(octreeScene, entry, boundingVolume, userData);
                 }
             }
         }
@@ -83,26 +93,27 @@ namespace AzFramework
         {
             // If we're not already split, and our entry list gets too large, split this node
             Split(octreeScene);
-            Insert(octreeScene, entry);
+            Insert(octreeScene, entry, boundingVolume, userData);
         }
         else
         {
             m_entries.push_back(entry);
+            m_packedEntries.PushBack(boundingVolume, userData);
             entry->m_internalNode = this;
             entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
         }
     }
 
-    void OctreeNode::Update(OctreeScene& octreeScene, VisibilityEntry* entry)
+    void OctreeNode::Update(OctreeScene& octreeScene, VisibilityEntry* entry, const AZ::Aabb& boundingVolume, void* userData)
     {
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
-        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
         if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
         {
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
+            m_packedEntries.Set(entry->m_internalNodeIndex, boundingVolume, userData);
             return;
         }
 
@@ -117,7 +128,7 @@ namespace AzFramework
             if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
-                return insertCheck->Insert(octreeScene, entry);
+                return insertCheck->Insert(octreeScene, entry, boundingVolume, userData);
             }
             insertCheck = insertCheck->m_parent;
         }
@@ -138,6 +149,7 @@ namespace AzFramework
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
         }
         m_entries.pop_back();
+        m_packedEntries.RemoveSwapLast(removeIndex);
 
         if (m_parent != nullptr)
         {
@@ -241,6 +253,175 @@ namespace AzFramework
         return m_children == nullptr;
     }
 
+    //! Gathers the entries found by a batched enumerate and passes them to the callback in batches.
+    class OctreeBatchCollector
+    {
+    public:
+        explicit OctreeBatchCollector(const OctreeScene::EnumerateBatchCallback& callback)
+            : m_callback(callback)
+        {
+        }
+
+        void Add(VisibilityEntry* entry, void* userData)
+        {
+            m_entries[m_count] = entry;
+            m_userData[m_count] = userData;
+            if (++m_count == OctreeScene::EnumerateBatchSize)
+            {
+                Flush();
+            }
+        }
+
+        void Flush()
+        {
+            if (m_count > 0)
+            {
+                m_callback({ AZStd::span<VisibilityEntry* const>(m_entries, m_count), AZStd::span<void* const>(m_userData, m_count) });
+                m_count = 0;
+            }
+        }
+
+        //! Returns a scratch mask large enough for the provided number of elements, reused between nodes.
+        AZStd::span<uint32_t> GetMask(size_t elementCount)
+        {
+            m_mask.resize_no_construct(AZStd::max(m_mask.size(), AZ::BatchMath::GetMaskWordCount(elementCount)));
+            return m_mask;
+        }
+
+    private:
+        const OctreeScene::EnumerateBatchCallback& m_callback;
+        VisibilityEntry* m_entries[OctreeScene::EnumerateBatchSize];
+        void* m_userData[OctreeScene::EnumerateBatchSize];
+        size_t m_count = 0;
+        AZStd::vector<uint32_t> m_mask;
+    };
+
+    static size_t OverlapsBatch(const AZ::Aabb& aabb, AZ::BatchMath::ConstAabbSpan aabbs, AZStd::span<uint32_t> outMask)
+    {
+        return AZ::BatchMath::OverlapsAabb(aabb, aabbs, outMask);
+    }
+
+    static size_t OverlapsBatch(const AZ::Frustum& frustum, AZ::BatchMath::ConstAabbSpan aabbs, AZStd::span<uint32_t> outMask)
+    {
+        return AZ::BatchMath::OverlapsFrustum(frustum, aabbs, outMask);
+    }
+
+    void OctreeNode::EnumerateBatched(const AZ::Aabb& aabb, OctreeBatchCollector& collector) const
+    {
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        {
+            EnumerateBatchedHelper(aabb, collector);
+        }
+    }
+
+    void OctreeNode::EnumerateBatched(const AZ::Frustum& frustum, OctreeBatchCollector& collector) const
+    {
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        {
+            EnumerateBatchedHelper(frustum, collector);
+        }
+    }
+
+    template <typename T>
+    void OctreeNode::EnumerateBatchedHelper(const T& boundingVolume, OctreeBatchCollector& collector) const
+    {
+        // Test all entries of the current node at once, then hand out the ones that passed
+        if (!m_entries.empty())
+        {
+            AZStd::span<uint32_t> entryMask = collector.GetMask(m_entries.size());
+            if (OverlapsBatch(boundingVolume, m_packedEntries.GetBounds(), entryMask) > 0)
+            {
+                const size_t wordCount = AZ::BatchMath::GetMaskWordCount(m_entries.size());
+                for (size_t word = 0; word < wordCount; ++word)
+                {
+                    for (uint32_t bits = entryMask[word]; bits != 0; bits &= bits - 1)
+                    {
+                        const size_t index = word * 32 + az_ctz_u32(bits);
+                        collector.Add(m_entries[index], m_packedEntries.m_userData[index]);
+                    }
+                }
+            }
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, test all children at once and recurse into the ones that intersect
+            uint32_t childMask = 0;
+            OverlapsBatch(boundingVolume, GetChildBounds(), AZStd::span<uint32_t>(&childMask, 1));
+            for (; childMask != 0; childMask &= childMask - 1)
+            {
+                m_children[az_ctz_u32(childMask)].EnumerateBatchedHelper(boundingVolume, collector);
+            }
+        }
+    }
+
+    AZ::BatchMath::ConstAabbSpan OctreeNode::GetChildBounds() const
+    {
+        const size_t childCount = GetChildNodeCount();
+        return AZ::BatchMath::ConstAabbSpan(
+            { { m_childMin[0], childCount }, { m_childMin[1], childCount }, { m_childMin[2], childCount } },
+            { { m_childMax[0], childCount }, { m_childMax[1], childCount }, { m_childMax[2], childCount } });
+    }
+
+    void OctreeNode::PackedEntries::PushBack(const AZ::Aabb& boundingVolume, void* userData)
+    {
+        const AZ::Vector3& min = boundingVolume.GetMin();
+        const AZ::Vector3& max = boundingVolume.GetMax();
+        for (int32_t axis = 0; axis < 3; ++axis)
+        {
+            m_min[axis].push_back(min.GetElement(axis));
+            m_max[axis].push_back(max.GetElement(axis));
+        }
+        m_userData.push_back(userData);
+    }
+
+    void OctreeNode::PackedEntries::Set(uint32_t index, const AZ::Aabb& boundingVolume, void* userData)
+    {
+        const AZ::Vector3& min = boundingVolume.GetMin();
+        const AZ::Vector3& max = boundingVolume.GetMax();
+        for (int32_t axis = 0; axis < 3; ++axis)
+        {
+            m_min[axis][index] = min.GetElement(axis);
+            m_max[axis][index] = max.GetElement(axis);
+        }
+        m_userData[index] = userData;
+    }
+
+    AZ::Aabb OctreeNode::PackedEntries::GetBoundsAt(uint32_t index) const
+    {
+        return AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(m_min[0][index], m_min[1][index], m_min[2][index]),
+            AZ::Vector3(m_max[0][index], m_max[1][index], m_max[2][index]));
+    }
+
+    void OctreeNode::PackedEntries::RemoveSwapLast(uint32_t index)
+    {
+        for (int32_t axis = 0; axis < 3; ++axis)
+        {
+            m_min[axis][index] = m_min[axis].back();
+            m_min[axis].pop_back();
+            m_max[axis][index] = m_max[axis].back();
+            m_max[axis].pop_back();
+        }
+        m_userData[index] = m_userData.back();
+        m_userData.pop_back();
+    }
+
+    void OctreeNode::PackedEntries::Clear()
+    {
+        for (int32_t axis = 0; axis < 3; ++axis)
+        {
+            m_min[axis].clear();
+            m_max[axis].clear();
+        }
+        m_userData.clear();
+    }
+
+    AZ::BatchMath::ConstAabbSpan OctreeNode::PackedEntries::GetBounds() const
+    {
+        return AZ::BatchMath::ConstAabbSpan({ m_min[0], m_min[1], m_min[2] }, { m_max[0], m_max[1], m_max[2] });
+    }
+
     void OctreeNode::TryMerge(OctreeScene& octreeScene)
     {
         if (IsLeaf())
@@ -329,16 +510,28 @@ namespace AzFramework
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
                 m_children[child].m_parent = this;
+
+                const AZ::Vector3& childMin = m_children[child].m_bounds.GetMin();
+                const AZ::Vector3& childMax = m_children[child].m_bounds.GetMax();
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    m_childMin[axis][child] = childMin.GetElement(axis);
+                    m_childMax[axis][child] = childMax.GetElement(axis);
+                }
             }
         }
 
-        // Re-partition our entry set across ourself and our child nodes
+        // Re-partition our entry set across ourself and our child nodes, using the bounds they were inserted with
         AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(m_entries));
-        for (VisibilityEntry* entry : entrySet)
+        PackedEntries packedEntrySet(AZStd::move(m_packedEntries));
+        m_entries.clear();
+        m_packedEntries.Clear();
+        for (uint32_t index = 0; index < entrySet.size(); ++index)
         {
+            VisibilityEntry* entry = entrySet[index];
             entry->m_internalNode = nullptr;
             entry->m_internalNodeIndex = 0;
-            Insert(octreeScene, entry);
+            Insert(octreeScene, entry, packedEntrySet.GetBoundsAt(index), packedEntrySet.m_userData[index]);
         }
     }
 
@@ -350,13 +543,17 @@ namespace AzFramework
         const uint32_t childCount = GetChildNodeCount();
         for (uint32_t child = 0; child < childCount; ++child)
         {
-            for (VisibilityEntry* childEntry : m_children[child].m_entries)
+            const PackedEntries& childPackedEntries = m_children[child].m_packedEntries;
+            for (uint32_t index = 0; index < m_children[child].m_entries.size(); ++index)
             {
+                VisibilityEntry* childEntry = m_children[child].m_entries[index];
                 childEntry->m_internalNode = this;
                 childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size());
                 m_entries.push_back(childEntry);
+                m_packedEntries.PushBack(childPackedEntries.GetBoundsAt(index), childPackedEntries.m_userData[index]);
             }
             m_children[child].m_entries.clear();
+            m_children[child].m_packedEntries.Clear();
         }
 
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
@@ -364,8 +561,59 @@ namespace AzFramework
         m_children = nullptr;
     }
 
-    OctreeScene::OctreeScene(const AZ::Name& sceneName)
-        : m_sceneName(sceneName)
+    thread_local const OctreeScene::QueryGuard* OctreeScene::QueryGuard::s_innermostGuard = nullptr;
+
+    OctreeScene::QueryGuard::QueryGuard(const OctreeScene& scene)
+        : m_scene(scene)
+        , m_outerGuard(s_innermostGuard)
+    {
+        // Locking again for a nested query could wait on an update that is itself waiting for the outer query to finish
+        m_ownsLock = !IsQueryingOnThisThread(m_scene);
+        if (m_ownsLock)
+        {
+            if (m_scene.m_deferUpdates)
+            {
+                m_scene.m_queryEpochs.lock_shared();
+            }
+            else
+            {
+                m_scene.m_sharedMutex.lock_shared();
+            }
+        }
+        s_innermostGuard = this;
+    }
+
+    OctreeScene::QueryGuard::~QueryGuard()
+    {
+        s_innermostGuard = m_outerGuard;
+        if (m_ownsLock)
+        {
+            if (m_scene.m_deferUpdates)
+            {
+                m_scene.m_queryEpochs.unlock_shared();
+            }
+            else
+            {
+                m_scene.m_sharedMutex.unlock_shared();
+            }
+        }
+    }
+
+    bool OctreeScene::QueryGuard::IsQueryingOnThisThread(const OctreeScene& scene)
+    {
+        for (const QueryGuard* guard = s_innermostGuard; guard != nullptr; guard = guard->m_outerGuard)
+        {
+            if (&guard->m_scene == &scene)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    OctreeScene::OctreeScene(const AZ::Name& sceneName, bool deferUpdates)
+        : m_deferUpdates(deferUpdates)
+        , m_sceneName(sceneName)
         , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
@@ -388,89 +636,208 @@ namespace AzFramework
 
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
+        if (m_deferUpdates)
+        {
+            // Copy the bounds and user data now, the owner may change them again before the update is applied
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingUpdatesMutex);
+            m_pendingUpdates.push_back(PendingUpdate{ &entry, entry.m_boundingVolume, entry.m_userData });
+            return;
+        }
+
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryInternal(entry, entry.m_boundingVolume, entry.m_userData);
+    }
+
+    void OctreeScene::InsertOrUpdateEntryInternal(VisibilityEntry& entry, const AZ::Aabb& boundingVolume, void* userData)
+    {
         if (entry.m_internalNode != nullptr)
         {
-            static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
+            static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry, boundingVolume, userData);
         }
         else
         {
-            m_root.Insert(*this, &entry);
-            ++m_entryCount;
+            m_root.Insert(*this, &entry, boundingVolume, userData);
+            m_entryCount.fetch_add(1, AZStd::memory_order_relaxed);
         }
     }
 
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
+        if (m_deferUpdates)
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_pendingUpdatesMutex);
+                m_pendingUpdates.erase(AZStd::remove_if(m_pendingUpdates.begin(), m_pendingUpdates.end(),
+                    [&entry](const PendingUpdate& pendingUpdate) { return pendingUpdate.m_entry == &entry; }), m_pendingUpdates.end());
+                if (QueryGuard::IsQueryingOnThisThread(*this))
+                {
+                    // Waiting for the queries in flight would include the one this was called from, leave it to ApplyPendingUpdates
+                    m_pendingRemovals.push_back(&entry);
+                    return;
+                }
+                // The entry may be destroyed as soon as this returns, so it can't stay queued and has to leave the tree right away
+                m_pendingRemovals.erase(AZStd::remove(m_pendingRemovals.begin(), m_pendingRemovals.end(), &entry), m_pendingRemovals.end());
+            }
+
+            AZStd::lock_guard<AZ::EpochMutex> lock(m_queryEpochs);
+            RemoveEntryInternal(entry);
+            return;
+        }
+
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        RemoveEntryInternal(entry);
+    }
+
+    void OctreeScene::RemoveEntryInternal(VisibilityEntry& entry)
+    {
         if (entry.m_internalNode)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
-            --m_entryCount;
+            m_entryCount.fetch_sub(1, AZStd::memory_order_relaxed);
         }
     }
 
+    bool OctreeScene::IsDeferringUpdates() const
+    {
+        return m_deferUpdates;
+    }
+
+    void OctreeScene::ApplyPendingUpdates()
+    {
+        if (!m_deferUpdates)
+        {
+            return;
+        }
+
+        AZ_Assert(!QueryGuard::IsQueryingOnThisThread(*this), "Pending updates can't be applied from within an enumerate callback.");
+
+        // Wait for the queries in flight before taking the queue, removals also hold the writer lock so they can't interleave
+        m_queryEpochs.lock();
+
+        AZStd::vector<PendingUpdate> pendingUpdates;
+        AZStd::vector<VisibilityEntry*> pendingRemovals;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingUpdatesMutex);
+            pendingUpdates.swap(m_pendingUpdates);
+            pendingRemovals.swap(m_pendingRemovals);
+        }
+
+        // Removals go first, an entry that was inserted again after its removal is still queued as an update
+        AZStd::sort(pendingRemovals.begin(), pendingRemovals.end());
+        pendingRemovals.erase(AZStd::unique(pendingRemovals.begin(), pendingRemovals.end()), pendingRemovals.end());
+        for (VisibilityEntry* entry : pendingRemovals)
+        {
+            RemoveEntryInternal(*entry);
+        }
+
+        // Entries that moved several times since the last call only need to be updated once, with the most recently queued bounds.
+        // The sort is stable so the last update queued for an entry is still the last one in its run.
+        AZStd::stable_sort(pendingUpdates.begin(), pendingUpdates.end(),
+            [](const PendingUpdate& lhs, const PendingUpdate& rhs) { return lhs.m_entry < rhs.m_entry; });
+        for (size_t index = 0; index < pendingUpdates.size(); ++index)
+        {
+            const PendingUpdate& pendingUpdate = pendingUpdates[index];
+            if ((index + 1 < pendingUpdates.size()) && (pendingUpdates[index + 1].m_entry == pendingUpdate.m_entry))
+            {
+                continue;
+            }
+            InsertOrUpdateEntryInternal(*pendingUpdate.m_entry, pendingUpdate.m_boundingVolume, pendingUpdate.m_userData);
+        }
+
+        m_queryEpochs.unlock();
+
+        // Hand the storage back to the queue so it doesn't have to grow again next time
+        pendingUpdates.clear();
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingUpdatesMutex);
+        if (m_pendingUpdates.empty())
+        {
+            m_pendingUpdates.swap(pendingUpdates);
+        }
+    }
+
+    uint32_t OctreeScene::GetPendingUpdateCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingUpdatesMutex);
+        return aznumeric_cast<uint32_t>(m_pendingUpdates.size() + m_pendingRemovals.size());
+    }
+
     void OctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        QueryGuard guard(*this);
         m_root.Enumerate(aabb, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        QueryGuard guard(*this);
         m_root.Enumerate(sphere, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        QueryGuard guard(*this);
         m_root.Enumerate(hemisphere, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Capsule & capsule, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        QueryGuard guard(*this);
         m_root.Enumerate(capsule, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        QueryGuard guard(*this);
         m_root.Enumerate(frustum, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        QueryGuard guard(*this);
         m_root.Enumerate(includeFrustum, excludeFrustum, callback);
     }
 
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        QueryGuard guard(*this);
         m_root.EnumerateNoCull(callback);
     }
 
+    void OctreeScene::EnumerateBatched(const AZ::Aabb& aabb, const EnumerateBatchCallback& callback) const
+    {
+        QueryGuard guard(*this);
+        OctreeBatchCollector collector(callback);
+        m_root.EnumerateBatched(aabb, collector);
+        collector.Flush();
+    }
+
+    void OctreeScene::EnumerateBatched(const AZ::Frustum& frustum, const EnumerateBatchCallback& callback) const
+    {
+        QueryGuard guard(*this);
+        OctreeBatchCollector collector(callback);
+        m_root.EnumerateBatched(frustum, collector);
+        collector.Flush();
+    }
+
     uint32_t OctreeScene::GetEntryCount() const
     {
-        return m_entryCount;
+        return m_entryCount.load(AZStd::memory_order_relaxed);
     }
 
     uint32_t OctreeScene::GetNodeCount() const
     {
-        return m_nodeCount;
+        return m_nodeCount.load(AZStd::memory_order_relaxed);
     }
 
     uint32_t OctreeScene::GetFreeNodeCount() const
     {
         // Each entry represents GetChildNodeCount() nodes
-        return aznumeric_cast<uint32_t>(m_freeOctreeNodes.size() * GetChildNodeCount());
+        return m_freeNodeBlockCount.load(AZStd::memory_order_relaxed) * GetChildNodeCount();
     }
 
     uint32_t OctreeScene::GetPageCount() const
     {
-        return aznumeric_cast<uint32_t>(m_nodeCache.size());
+        return m_pageCount.load(AZStd::memory_order_relaxed);
     }
 
     uint32_t OctreeScene::GetChildNodeCount() const
@@ -502,11 +869,12 @@ namespace AzFramework
     uint32_t OctreeScene::AllocateChildNodes()
     {
         const uint32_t childCount = GetChildNodeCount();
-        m_nodeCount += childCount;
+        m_nodeCount.fetch_add(childCount, AZStd::memory_order_relaxed);
 
         if (m_nodeCache.empty())
         {
             m_nodeCache.push_back(new OctreeNodePage);
+            m_pageCount.fetch_add(1, AZStd::memory_order_relaxed);
         }
 
         uint32_t nextChildPage = aznumeric_cast<uint32_t>(m_nodeCache.size() - 1);
@@ -517,6 +885,7 @@ namespace AzFramework
             // Take a free block of child nodes from our free list
             ExtractPageAndOffsetFromIndex(m_freeOctreeNodes.top(), nextChildPage, nextChildOffset);
             m_freeOctreeNodes.pop();
+            m_freeNodeBlockCount.fetch_sub(1, AZStd::memory_order_relaxed);
         }
         else
         {
@@ -524,6 +893,7 @@ namespace AzFramework
             {
                 // Our last page is already full, so we need to allocate a new page
                 m_nodeCache.push_back(new OctreeNodePage);
+                m_pageCount.fetch_add(1, AZStd::memory_order_relaxed);
                 ++nextChildPage;
                 nextChildOffset = 0;
             }
@@ -544,8 +914,9 @@ namespace AzFramework
 
     void OctreeScene::ReleaseChildNodes(uint32_t nodeIndex)
     {
-        m_nodeCount -= GetChildNodeCount();
+        m_nodeCount.fetch_sub(GetChildNodeCount(), AZStd::memory_order_relaxed);
         m_freeOctreeNodes.push(nodeIndex);
+        m_freeNodeBlockCount.fetch_add(1, AZStd::memory_order_relaxed);
     }
 
     OctreeNode* OctreeScene::GetChildNodesAtIndex(uint32_t nodeIndex) const
@@ -580,7 +951,7 @@ namespace AzFramework
         AZ::Interface<IVisibilitySystem>::Register(this);
         IVisibilitySystemRequestBus::Handler::BusConnect();
 
-        m_defaultScene = aznew OctreeScene(AZ::Name("DefaultVisibilityScene"));
+        m_defaultScene = aznew OctreeScene(AZ::Name("DefaultVisibilityScene"), bg_octreeDeferUpdates);
     }
 
     OctreeSystemComponent::~OctreeSystemComponent()
@@ -595,12 +966,15 @@ namespace AzFramework
 
     void OctreeSystemComponent::Activate()
     {
-        ;
+        if (bg_octreeDeferUpdates)
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
     }
 
     void OctreeSystemComponent::Deactivate()
     {
-        ;
+        AZ::TickBus::Handler::BusDisconnect();
     }
 
     IVisibilityScene* OctreeSystemComponent::GetDefaultVisibilityScene()
@@ -611,7 +985,7 @@ namespace AzFramework
     IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
     {
         AZ_Assert(FindVisibilityScene(sceneName) == nullptr, "Scene with same name already created!");
-        OctreeScene* newScene = aznew OctreeScene(sceneName);
+        OctreeScene* newScene = aznew OctreeScene(sceneName, bg_octreeDeferUpdates);
         m_scenes.push_back(newScene);
         return newScene;
     }
@@ -642,6 +1016,21 @@ namespace AzFramework
         return nullptr;
     }
 
+    void OctreeSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_defaultScene->ApplyPendingUpdates();
+        for (OctreeScene* scene : m_scenes)
+        {
+            scene->ApplyPendingUpdates();
+        }
+    }
+
+    int OctreeSystemComponent::GetTickOrder()
+    {
+        // Apply the updates from gameplay, physics and animation before the render culling reads the scenes
+        return AZ::TICK_PRE_RENDER;
+    }
+
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
         for (OctreeScene* scene : m_scenes)
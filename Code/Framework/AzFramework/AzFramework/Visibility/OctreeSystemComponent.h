@@ -9,17 +9,24 @@
 #pragma once
 
 #include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Math/BatchMath.h>
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Threading/EpochMutex.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 
 namespace AzFramework
 {
     class OctreeSystemComponent;
     class OctreeScene;
+    class OctreeBatchCollector;
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
@@ -37,11 +44,12 @@ namespace AzFramework
         OctreeNode& operator=(OctreeNode&& rhs);
 
         //! Inserts a VisibilityEntry into this OctreeNode, potentially triggering a split.
-        void Insert(OctreeScene& octreeScene, VisibilityEntry* entry);
+        //! The tree only uses the given bounds and user data, the entry's own members aren't read.
+        void Insert(OctreeScene& octreeScene, VisibilityEntry* entry, const AZ::Aabb& boundingVolume, void* userData);
 
         //! Updates a VisibilityEntry that is currently bound to this OctreeNode.
         //! The provided entry must be bound to this node, but may no longer be bound to this node upon function exit.
-        void Update(OctreeScene& octreeScene, VisibilityEntry* entry);
+        void Update(OctreeScene& octreeScene, VisibilityEntry* entry, const AZ::Aabb& boundingVolume, void* userData);
 
         //! Removes a VisibilityEntry from this OctreeNode.
         //! The provided entry must be bound to this node.
@@ -60,6 +68,13 @@ namespace AzFramework
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Recursively enumerates the entries whose bounds intersect the provided bounding volume.
+        //! Child nodes and entries are tested in batches, the entries found are added to the collector.
+        //! @{
+        void EnumerateBatched(const AZ::Aabb& aabb, OctreeBatchCollector& collector) const;
+        void EnumerateBatched(const AZ::Frustum& frustum, OctreeBatchCollector& collector) const;
+        //! @}
+
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
@@ -76,9 +91,34 @@ namespace AzFramework
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
 
+        template <typename T>
+        void EnumerateBatchedHelper(const T& boundingVolume, OctreeBatchCollector& collector) const;
+
+        //! Returns the bounds of the child nodes, must only be called if this isn't a leaf node.
+        AZ::BatchMath::ConstAabbSpan GetChildBounds() const;
+
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
+        //! Copies of the bounds and user data of the entries in m_entries, in structure of arrays layout so the entries can be
+        //! tested in batches. These are kept in the same order as m_entries and refreshed whenever an entry is inserted or updated.
+        struct PackedEntries
+        {
+            void PushBack(const AZ::Aabb& boundingVolume, void* userData);
+            void Set(uint32_t index, const AZ::Aabb& boundingVolume, void* userData);
+            AZ::Aabb GetBoundsAt(uint32_t index) const;
+            //! Moves the last entry into the removed slot, the same way entries are removed from m_entries.
+            void RemoveSwapLast(uint32_t index);
+            void Clear();
+            AZ::BatchMath::ConstAabbSpan GetBounds() const;
+
+            AZStd::vector<float> m_min[3];
+            AZStd::vector<float> m_max[3];
+            AZStd::vector<void*> m_userData;
+        };
+
+        static constexpr uint32_t MaxChildNodeCount = 8;
+
         // The page is stored in the upper 16-bits of the child node index, the offset into the page is the lower 16-bits
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
@@ -87,10 +127,21 @@ namespace AzFramework
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+        PackedEntries m_packedEntries;
+        //! Bounds of the child nodes in structure of arrays layout, so all children can be tested at once.
+        float m_childMin[3][MaxChildNodeCount] = {};
+        float m_childMax[3][MaxChildNodeCount] = {};
     };
 
     //! Implementation of the visibility system interface.
     //! This uses a simple adaptive octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! By default every update takes an exclusive lock and every query a shared lock on the scene, so updates and queries block each other.
+    //! Scenes that defer updates instead queue inserts and updates until ApplyPendingUpdates is called, usually once per frame.
+    //! The bounds and user data of an entry are copied when it's queued, so the owner is free to change them again right away.
+    //! Queries on these scenes don't take a lock, they only wait while pending updates are applied or an entry is removed.
+    //! Between two calls to ApplyPendingUpdates queries see the tree as it was after the last call, so an entry is found in the node
+    //! that matched its bounds at that time. Entries removed from within an enumerate callback on a scene that defers updates are only
+    //! removed by the next call to ApplyPendingUpdates, so they have to stay alive until then.
     class OctreeScene
         : public IVisibilityScene
     {
@@ -99,7 +150,9 @@ namespace AzFramework
         AZ_CLASS_ALLOCATOR(OctreeScene, AZ::SystemAllocator);
         AZ_DISABLE_COPY_MOVE(OctreeScene);
 
-        explicit OctreeScene(const AZ::Name& sceneName);
+        //! @param sceneName The uniquely identifying name for the visibility scene.
+        //! @param deferUpdates If true, inserts and updates are queued until ApplyPendingUpdates is called.
+        explicit OctreeScene(const AZ::Name& sceneName, bool deferUpdates = false);
         virtual ~OctreeScene();
 
         //! IVisibilityScene overrides.
@@ -117,7 +170,36 @@ namespace AzFramework
         uint32_t GetEntryCount() const override;
         //! @}
 
-        //! Stats
+        //! A batch of entries found by EnumerateBatched, both spans have the same size.
+        struct EntryBatch
+        {
+            AZStd::span<VisibilityEntry* const> m_entries;
+            AZStd::span<void* const> m_userData;
+        };
+        using EnumerateBatchCallback = AZStd::function<void(const EntryBatch&)>;
+
+        //! The maximum number of entries passed to an EnumerateBatchCallback at once.
+        static constexpr size_t EnumerateBatchSize = 256;
+
+        //! Intersects a bounding volume against the visibility scene, like Enumerate, but returns the entries instead of the nodes.
+        //! Only entries whose own bounds intersect the volume are returned. Child nodes and entries are tested against the volume
+        //! in batches, and the entries found are passed to the callback in batches of up to EnumerateBatchSize entries.
+        //! @{
+        void EnumerateBatched(const AZ::Aabb& aabb, const EnumerateBatchCallback& callback) const;
+        void EnumerateBatched(const AZ::Frustum& frustum, const EnumerateBatchCallback& callback) const;
+        //! @}
+
+        //! Returns true if inserts and updates are queued until ApplyPendingUpdates is called.
+        bool IsDeferringUpdates() const;
+
+        //! Applies all queued inserts, updates and removals. Waits for queries in flight to finish and blocks new queries until done.
+        //! Does nothing if the scene doesn't defer updates.
+        void ApplyPendingUpdates();
+
+        //! Returns the number of queued inserts and updates, an entry that was updated multiple times may be counted more than once.
+        uint32_t GetPendingUpdateCount() const;
+
+        //! Stats, these can be read at any time without waiting for updates.
         //! @{
         uint32_t GetNodeCount() const;
         uint32_t GetFreeNodeCount() const;
@@ -127,17 +209,56 @@ namespace AzFramework
         //! @}
 
     private:
+        //! Protects the tree for the duration of a query, using the shared mutex or the query epochs depending on the update mode.
+        //! Only the outermost query on a scene locks, queries started from within an enumerate callback are already covered by it.
+        class QueryGuard
+        {
+        public:
+            explicit QueryGuard(const OctreeScene& scene);
+            ~QueryGuard();
+
+            //! Returns true if the calling thread is running a query on the scene.
+            static bool IsQueryingOnThisThread(const OctreeScene& scene);
+
+        private:
+            static thread_local const QueryGuard* s_innermostGuard; //< The innermost query running on this thread.
+
+            const OctreeScene& m_scene;
+            const QueryGuard* m_outerGuard = nullptr; //< The guard of the query this one was started from, if any.
+            bool m_ownsLock = false;
+        };
+
+        void InsertOrUpdateEntryInternal(VisibilityEntry& entry, const AZ::Aabb& boundingVolume, void* userData);
+        void RemoveEntryInternal(VisibilityEntry& entry);
+
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
         mutable AZStd::shared_mutex m_sharedMutex;
 
+        const bool m_deferUpdates = false;
+        mutable AZ::EpochMutex m_queryEpochs; //< Tracks queries in flight when updates are deferred.
+        //! An insert or update queued on a scene that defers updates, with the bounds and user data the entry had at the time.
+        struct PendingUpdate
+        {
+            VisibilityEntry* m_entry = nullptr;
+            AZ::Aabb m_boundingVolume;
+            void* m_userData = nullptr;
+        };
+
+        mutable AZStd::mutex m_pendingUpdatesMutex;
+        AZStd::vector<PendingUpdate> m_pendingUpdates; //< Entries inserted or updated since the last call to ApplyPendingUpdates.
+        AZStd::vector<VisibilityEntry*> m_pendingRemovals; //< Entries removed from within an enumerate callback since the last call to ApplyPendingUpdates.
+
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
         OctreeNode m_root; //< The root node for the octreeSystemComponent.
 
-        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
-        uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the octreeSystemComponent, at least one for the root node.
+        // The metrics are atomic so the stats can be read while the tree is being updated.
+        AZStd::atomic<uint32_t> m_entryCount{ 0 }; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
+        AZStd::atomic<uint32_t> m_nodeCount{ 1 }; //< Metric tracking the number of nodes allocated by the octreeSystemComponent, at least one for the root node.
+        AZStd::atomic<uint32_t> m_freeNodeBlockCount{ 0 }; //< Metric tracking the number of blocks in m_freeOctreeNodes.
+        AZStd::atomic<uint32_t> m_pageCount{ 0 }; //< Metric tracking the number of pages in m_nodeCache.
 
         static constexpr uint32_t BlockSize = 8192; //< This represents the number of nodes that can be stored in each page
         static_assert(BlockSize < 0xFFFF, "BlockSize must be less than 2^16");
@@ -151,9 +272,11 @@ namespace AzFramework
 
     //! Implementation of the visibility system interface.
     //! This manages creating, destroying, and finding the underlying octrees that are associated with specific scenes
+    //! If the scenes defer their updates, pending updates are applied for all scenes each tick before rendering.
     class OctreeSystemComponent
         : public AZ::Component
         , public IVisibilitySystemRequestBus::Handler
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(OctreeSystemComponent, "{CD4FF1C5-BAF4-421D-951B-1E05DAEEF67B}");
@@ -183,6 +306,12 @@ namespace AzFramework
         void DumpStats(const AZ::ConsoleCommandContainer& arguments) override;
         //! @}
 
+        //! AZ::TickBus overrides
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
     private:
         //! The default scene used for most entities (e.g. gameplay, networking)
         OctreeScene* m_defaultScene = nullptr;
@@ -364,6 +364,8 @@ set(FILES
     Spawnable/SpawnableAssetHandler.cpp
     Spawnable/SpawnableAssetUtils.h
     Spawnable/SpawnableAssetUtils.cpp
+    Spawnable/SpawnableClonePlan.h
+    Spawnable/SpawnableClonePlan.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
@@ -7,6 +7,8 @@
  */
 
 #include <AzTest/AzTest.h>
+#include <AzCore/Compression/zstd_dictionary.h>
+#include <AzCore/IO/FileIOStream.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
@@ -26,12 +28,11 @@ namespace UnitTest
         AZ::IO::INestedArchive::ECompressionLevels,
         int, int, int>>;
 
-    class ArchiveCompressionTestFixture
+    class ArchiveTestFixture
         : public LeakDetectionFixture
-        , public ArchiveCompressionParamInterface
     {
     public:
-        ArchiveCompressionTestFixture()
+        ArchiveTestFixture()
             : m_application { AZStd::make_unique<AzFramework::Application>() }
         {
             // Create a unique alias to the user cache directory to avoid race conditions between
@@ -45,6 +46,12 @@ namespace UnitTest
         AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
     };
 
+    class ArchiveCompressionTestFixture
+        : public ArchiveTestFixture
+        , public ArchiveCompressionParamInterface
+    {
+    };
+
     auto IsPackValid(const char* path)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
@@ -424,6 +431,86 @@ namespace UnitTest
         EXPECT_TRUE(IsPackValid(testArchivePath.c_str()));
     }
 
+    using ArchiveZStdDictionaryTestFixture = ArchiveTestFixture;
+
+    TEST_F(ArchiveZStdDictionaryTestFixture, TestArchivePacking_DictionaryNextToArchive_FilesRoundTripThroughDictionary)
+    {
+        AZStd::string testArchivePath = "@usercache@/dictionarytest.pak";
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        // Small material-like files that share their structure, which is what the dictionaries are trained for.
+        constexpr size_t FileCount = 200;
+        AZStd::vector<AZStd::string> files;
+        for (size_t index = 0; index < FileCount; ++index)
+        {
+            files.push_back(AZStd::string::format(
+                "{\n    \"materialType\": \"Materials/Types/StandardPBR.materialtype\",\n    \"propertyValues\": {\n"
+                "        \"baseColor.color\": [%.3f, %.3f, %.3f, 1.0],\n        \"baseColor.textureMap\": \"Textures/asset_%zu_basecolor.png\",\n"
+                "        \"roughness.factor\": %.3f\n    }\n}\n",
+                (index % 7) / 7.0f, (index % 11) / 11.0f, (index % 13) / 13.0f, index, (index % 17) / 17.0f));
+        }
+        AZStd::vector<AZStd::span<const AZ::u8>> samples;
+        for (const AZStd::string& file : files)
+        {
+            samples.emplace_back(reinterpret_cast<const AZ::u8*>(file.data()), file.size());
+        }
+
+        AZ::ZStdDictionarySet dictionaries;
+        ASSERT_TRUE(dictionaries.TrainDictionary(".azmaterial", samples, 4 * 1024).IsSuccess());
+        const AZ::IO::Path dictionaryPath = AZ::ZStdDictionarySet::GetDictionaryPath(testArchivePath);
+        {
+            AZ::IO::FileIOStream dictionaryStream(dictionaryPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+            ASSERT_TRUE(dictionaryStream.IsOpen());
+            ASSERT_TRUE(dictionaries.Save(dictionaryStream));
+        }
+
+        const AZStd::string uncoveredFile = "file of a type without a dictionary, file of a type without a dictionary";
+        auto pArchive = archive->OpenArchive(testArchivePath.c_str(), {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        for (size_t index = 0; index < FileCount; ++index)
+        {
+            auto fileName = AZStd::string::format("materials/asset_%zu.azmaterial", index);
+            EXPECT_EQ(0, pArchive->UpdateFile(fileName, files[index].data(), files[index].size(),
+                AZ::IO::INestedArchive::METHOD_DEFLATE, AZ::IO::INestedArchive::LEVEL_NORMAL));
+        }
+        EXPECT_EQ(0, pArchive->UpdateFile("uncovered.dat", uncoveredFile.data(), uncoveredFile.size(),
+            AZ::IO::INestedArchive::METHOD_DEFLATE, AZ::IO::INestedArchive::LEVEL_NORMAL));
+        pArchive.reset();
+
+        // Reopening the archive loads the dictionaries again for reading.
+        pArchive = archive->OpenArchive(testArchivePath.c_str(), {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        AZStd::string readBack;
+        for (size_t index = 0; index < FileCount; ++index)
+        {
+            auto fileName = AZStd::string::format("materials/asset_%zu.azmaterial", index);
+            AZ::IO::INestedArchive::Handle hand = pArchive->FindFile(fileName);
+            ASSERT_NE(nullptr, hand);
+            ASSERT_EQ(files[index].size(), pArchive->GetFileSize(hand));
+            readBack.resize_no_construct(files[index].size());
+            EXPECT_EQ(0, pArchive->ReadFile(hand, readBack.data()));
+            EXPECT_EQ(files[index], readBack);
+        }
+        AZ::IO::INestedArchive::Handle uncoveredHandle = pArchive->FindFile("uncovered.dat");
+        ASSERT_NE(nullptr, uncoveredHandle);
+        readBack.resize_no_construct(uncoveredFile.size());
+        EXPECT_EQ(0, pArchive->ReadFile(uncoveredHandle, readBack.data()));
+        EXPECT_EQ(uncoveredFile, readBack);
+        pArchive.reset();
+
+        // Without the dictionary the covered files can't be decompressed, which shows they were compressed with it.
+        fileIo->Remove(dictionaryPath.c_str());
+        pArchive = archive->OpenArchive(testArchivePath.c_str(), {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        AZ::IO::INestedArchive::Handle hand = pArchive->FindFile("materials/asset_0.azmaterial");
+        ASSERT_NE(nullptr, hand);
+        readBack.resize_no_construct(files[0].size());
+        EXPECT_NE(0, pArchive->ReadFile(hand, readBack.data()));
+        pArchive.reset();
+    }
+
     INSTANTIATE_TEST_CASE_P(
         ArchiveCompression,
         ArchiveCompressionTestFixture,
@@ -7,11 +7,13 @@
  */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
 
+#include <AzCore/std/parallel/thread.h>
 #include <random>
 #include <benchmark/benchmark.h>
 
@@ -332,6 +334,156 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    // The following compare the node based enumerate followed by a per entry test, which is what callers of Enumerate need to do to
+    // get the entries that are actually visible, with the batched enumerate that tests children and entries with BatchMath.
+    BENCHMARK_F(BM_Octree, EnumerateAabbPerEntry100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t visibleCount = 0;
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [&queryData, &visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                    {
+                        visibleCount += AZ::ShapeIntersection::Overlaps(queryData.aabb, entry->m_boundingVolume) ? 1 : 0;
+                    }
+                });
+            }
+            benchmark::DoNotOptimize(visibleCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateAabbBatched100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        auto* octreeScene = azrtti_cast<AzFramework::OctreeScene*>(m_visScene);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t visibleCount = 0;
+            for (auto& queryData : m_queryDataArray)
+            {
+                octreeScene->EnumerateBatched(queryData.aabb, [&visibleCount](const AzFramework::OctreeScene::EntryBatch& batch)
+                {
+                    visibleCount += batch.m_entries.size();
+                });
+            }
+            benchmark::DoNotOptimize(visibleCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumPerEntry100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t visibleCount = 0;
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [&queryData, &visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    for (const AzFramework::VisibilityEntry* entry : nodeData.m_entries)
+                    {
+                        visibleCount += AZ::ShapeIntersection::Overlaps(queryData.frustum, entry->m_boundingVolume) ? 1 : 0;
+                    }
+                });
+            }
+            benchmark::DoNotOptimize(visibleCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumBatched100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        auto* octreeScene = azrtti_cast<AzFramework::OctreeScene*>(m_visScene);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t visibleCount = 0;
+            for (auto& queryData : m_queryDataArray)
+            {
+                octreeScene->EnumerateBatched(queryData.frustum, [&visibleCount](const AzFramework::OctreeScene::EntryBatch& batch)
+                {
+                    visibleCount += batch.m_entries.size();
+                });
+            }
+            benchmark::DoNotOptimize(visibleCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    // Simulates a frame where job threads move entries while other threads run culling queries on the same scene.
+    // The argument selects the update mode of the scene: 0 locks the scene for every update, 1 defers updates to the end of the frame.
+    BENCHMARK_DEFINE_F(BM_Octree, ConcurrentMoveAndQuery10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        constexpr uint32_t MoverCount = 4;
+        constexpr uint32_t QueryThreadCount = 4;
+        constexpr uint32_t QueriesPerThread = 250;
+
+        AzFramework::OctreeScene scene(AZ::Name("OctreeConcurrentBenchmarkScene"), state.range(0) != 0);
+        for (uint32_t i = 0; i < EntryCount; ++i)
+        {
+            scene.InsertOrUpdateEntry(m_dataArray[i]);
+        }
+        scene.ApplyPendingUpdates();
+
+        const AZ::Vector3 moveOffsets[] = { AZ::Vector3(25.0f, 0.0f, 0.0f), AZ::Vector3(-25.0f, 0.0f, 0.0f) };
+        uint32_t frame = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const AZ::Vector3 moveOffset = moveOffsets[frame++ % 2];
+
+            AZStd::vector<AZStd::thread> threads;
+            for (uint32_t mover = 0; mover < MoverCount; ++mover)
+            {
+                threads.emplace_back([this, &scene, &moveOffset, mover]()
+                {
+                    for (uint32_t i = mover; i < EntryCount; i += MoverCount)
+                    {
+                        m_dataArray[i].m_boundingVolume.Translate(moveOffset);
+                        scene.InsertOrUpdateEntry(m_dataArray[i]);
+                    }
+                });
+            }
+            for (uint32_t queryThread = 0; queryThread < QueryThreadCount; ++queryThread)
+            {
+                threads.emplace_back([this, &scene, queryThread]()
+                {
+                    for (uint32_t i = 0; i < QueriesPerThread; ++i)
+                    {
+                        const QueryData& queryData = m_queryDataArray[(queryThread * QueriesPerThread + i) % m_queryDataArray.size()];
+                        scene.Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            scene.ApplyPendingUpdates();
+        }
+
+        for (uint32_t i = 0; i < EntryCount; ++i)
+        {
+            scene.RemoveEntry(m_dataArray[i]);
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_Octree, ConcurrentMoveAndQuery10000)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
 }
 
 #endif
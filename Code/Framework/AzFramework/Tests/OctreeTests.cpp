@@ -12,7 +12,11 @@
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 #include <random>
 
 using namespace AzFramework;
@@ -467,4 +471,360 @@ namespace UnitTest
         }
 
     }
+
+    AZStd::vector<VisibilityEntry*> GatherEntriesBatched(const OctreeScene* octreeScene, const AZ::Frustum& frustum, const AZ::Aabb& aabb, bool useFrustum)
+    {
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        auto gatherBatch = [&gatheredEntries](const OctreeScene::EntryBatch& batch)
+        {
+            EXPECT_EQ(batch.m_entries.size(), batch.m_userData.size());
+            EXPECT_LE(batch.m_entries.size(), OctreeScene::EnumerateBatchSize);
+            for (size_t i = 0; i < batch.m_entries.size(); ++i)
+            {
+                EXPECT_EQ(batch.m_entries[i]->m_userData, batch.m_userData[i]);
+                gatheredEntries.push_back(batch.m_entries[i]);
+            }
+        };
+
+        if (useFrustum)
+        {
+            octreeScene->EnumerateBatched(frustum, gatherBatch);
+        }
+        else
+        {
+            octreeScene->EnumerateBatched(aabb, gatherBatch);
+        }
+        AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+        return gatheredEntries;
+    }
+
+    TEST_F(OctreeTests, EnumerateBatched_MatchesPerEntryTests)
+    {
+        constexpr uint32_t EntryCount = 600;
+
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> position(-0.95f, 0.9f);
+        std::uniform_real_distribution<float> size(0.0f, 0.05f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        for (uint32_t i = 0; i < EntryCount; ++i)
+        {
+            const AZ::Vector3 min(position(rng), position(rng), position(rng));
+            visEntries[i].m_boundingVolume = AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(size(rng), size(rng), size(rng)));
+            visEntries[i].m_userData = &visEntries[i];
+            m_octreeScene->InsertOrUpdateEntry(visEntries[i]);
+        }
+
+        const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.5f, -0.7f, -0.2f), AZ::Vector3(0.3f, 0.1f, 0.6f));
+        const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(0.4f), AZ::Vector3(0.0f, -2.0f, 0.0f));
+        const AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.25f), 1.0f, 3.0f));
+
+        auto validate = [&]()
+        {
+            for (bool useFrustum : { false, true })
+            {
+                AZStd::vector<VisibilityEntry*> expectedEntries;
+                for (AzFramework::VisibilityEntry& entry : visEntries)
+                {
+                    const bool overlaps = useFrustum ? AZ::ShapeIntersection::Overlaps(frustum, entry.m_boundingVolume)
+                                                     : AZ::ShapeIntersection::Overlaps(aabb, entry.m_boundingVolume);
+                    if (entry.m_internalNode != nullptr && overlaps)
+                    {
+                        expectedEntries.push_back(&entry);
+                    }
+                }
+                AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+
+                // The test data should have entries on both sides of the volume
+                EXPECT_GT(expectedEntries.size(), 0);
+                EXPECT_LT(expectedEntries.size(), m_octreeScene->GetEntryCount());
+                EXPECT_EQ(GatherEntriesBatched(m_octreeScene, frustum, aabb, useFrustum), expectedEntries);
+            }
+        };
+        validate();
+
+        // Move half of the entries and remove a quarter, the copies of the entry bounds in the nodes have to follow
+        for (uint32_t i = 0; i < EntryCount; i += 2)
+        {
+            visEntries[i].m_boundingVolume.Translate(AZ::Vector3(0.02f, -0.01f, 0.03f));
+            m_octreeScene->InsertOrUpdateEntry(visEntries[i]);
+        }
+        for (uint32_t i = 1; i < EntryCount; i += 4)
+        {
+            m_octreeScene->RemoveEntry(visEntries[i]);
+        }
+        validate();
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
+    TEST_F(OctreeTests, EnumerateBatched_ManyEntriesInOneNode_SplitIntoBatches)
+    {
+        // Entries larger than the world all end up in the root node
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(OctreeScene::EnumerateBatchSize * 2 + 10);
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-2.0f), AZ::Vector3(2.0f));
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(entryCount, visEntry);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        AZStd::vector<size_t> batchSizes;
+        m_octreeScene->EnumerateBatched(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.1f), AZ::Vector3(0.1f)),
+            [&batchSizes](const OctreeScene::EntryBatch& batch)
+            {
+                batchSizes.push_back(batch.m_entries.size());
+            });
+
+        ASSERT_EQ(batchSizes.size(), 3);
+        EXPECT_EQ(batchSizes[0], OctreeScene::EnumerateBatchSize);
+        EXPECT_EQ(batchSizes[1], OctreeScene::EnumerateBatchSize);
+        EXPECT_EQ(batchSizes[2], 10);
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates_InsertAndUpdate_AppliedAtSyncPoint)
+    {
+        OctreeScene deferredScene(AZ::Name("OctreeDeferredUnitTestScene"), true);
+        EXPECT_TRUE(deferredScene.IsDeferringUpdates());
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+
+        // Inserting and updating the same entry several times is only applied once
+        deferredScene.InsertOrUpdateEntry(visEntry[0]);
+        deferredScene.InsertOrUpdateEntry(visEntry[1]);
+        deferredScene.InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+        EXPECT_EQ(deferredScene.GetPendingUpdateCount(), 3);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 0);
+
+        deferredScene.ApplyPendingUpdates();
+        EXPECT_TRUE(visEntry[0].m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode != nullptr);
+        EXPECT_EQ(deferredScene.GetPendingUpdateCount(), 0);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 2);
+
+        // Queries keep finding the entry in its old node until the next sync point
+        const AZ::Aabb oldBounds = visEntry[1].m_boundingVolume;
+        const AZ::Aabb newBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.4f), AZ::Vector3(-0.1f));
+        visEntry[1].m_boundingVolume = newBounds;
+        deferredScene.InsertOrUpdateEntry(visEntry[1]);
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        auto gatherEntries = [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            AppendEntries(gatheredEntries, nodeData);
+        };
+
+        deferredScene.Enumerate(oldBounds, gatherEntries);
+        EXPECT_EQ(gatheredEntries.size(), 1);
+        gatheredEntries.clear();
+        deferredScene.Enumerate(newBounds, gatherEntries);
+        EXPECT_EQ(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &visEntry[1]), gatheredEntries.end());
+        gatheredEntries.clear();
+
+        deferredScene.ApplyPendingUpdates();
+        deferredScene.Enumerate(oldBounds, gatherEntries);
+        EXPECT_TRUE(gatheredEntries.empty());
+        gatheredEntries.clear();
+        deferredScene.Enumerate(newBounds, gatherEntries);
+        ASSERT_EQ(gatheredEntries.size(), 1);
+        EXPECT_EQ(gatheredEntries[0], &visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 2);
+
+        deferredScene.RemoveEntry(visEntry[0]);
+        deferredScene.RemoveEntry(visEntry[1]);
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 0);
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates_RemovePendingEntry_EntryIsNotInserted)
+    {
+        OctreeScene deferredScene(AZ::Name("OctreeDeferredUnitTestScene"), true);
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+
+        deferredScene.InsertOrUpdateEntry(visEntry[0]);
+        deferredScene.InsertOrUpdateEntry(visEntry[1]);
+        deferredScene.RemoveEntry(visEntry[0]);
+        EXPECT_EQ(deferredScene.GetPendingUpdateCount(), 1);
+
+        deferredScene.ApplyPendingUpdates();
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode != nullptr);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 1);
+
+        deferredScene.RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 0);
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates_EntryChangedAfterQueueing_QueuedBoundsAndUserDataApplied)
+    {
+        OctreeScene deferredScene(AZ::Name("OctreeDeferredUnitTestScene"), true);
+
+        int userData[2] = {};
+        const AZ::Aabb queuedBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        const AZ::Aabb laterBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.1f), AZ::Vector3(0.4f));
+
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = queuedBounds;
+        visEntry.m_userData = &userData[0];
+        deferredScene.InsertOrUpdateEntry(visEntry);
+
+        // The owner moves on to the next frame's state before the update is applied, without queueing it
+        visEntry.m_boundingVolume = laterBounds;
+        visEntry.m_userData = &userData[1];
+        deferredScene.ApplyPendingUpdates();
+
+        AZStd::vector<void*> foundUserData;
+        auto gatherUserData = [&foundUserData](const OctreeScene::EntryBatch& batch)
+        {
+            foundUserData.insert(foundUserData.end(), batch.m_userData.begin(), batch.m_userData.end());
+        };
+        deferredScene.EnumerateBatched(queuedBounds, gatherUserData);
+        ASSERT_EQ(foundUserData.size(), 1);
+        EXPECT_EQ(foundUserData[0], &userData[0]);
+        foundUserData.clear();
+        deferredScene.EnumerateBatched(laterBounds, gatherUserData);
+        EXPECT_TRUE(foundUserData.empty());
+
+        // Of several queued updates the last one wins
+        deferredScene.InsertOrUpdateEntry(visEntry);
+        visEntry.m_boundingVolume = queuedBounds;
+        deferredScene.InsertOrUpdateEntry(visEntry);
+        visEntry.m_boundingVolume = laterBounds;
+        deferredScene.ApplyPendingUpdates();
+
+        deferredScene.EnumerateBatched(queuedBounds, gatherUserData);
+        ASSERT_EQ(foundUserData.size(), 1);
+        EXPECT_EQ(foundUserData[0], &userData[1]);
+
+        deferredScene.RemoveEntry(visEntry);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 0);
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates_RemoveFromEnumerateCallback_RemovedAtSyncPoint)
+    {
+        OctreeScene deferredScene(AZ::Name("OctreeDeferredUnitTestScene"), true);
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        deferredScene.InsertOrUpdateEntry(visEntry[0]);
+        deferredScene.InsertOrUpdateEntry(visEntry[1]);
+        deferredScene.ApplyPendingUpdates();
+
+        // Removing an entry while enumerating can't wait for the queries in flight, so the removal is queued instead
+        deferredScene.EnumerateNoCull([&deferredScene](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            for (VisibilityEntry* entry : nodeData.m_entries)
+            {
+                deferredScene.RemoveEntry(*entry);
+            }
+            // Nested queries from within the callback don't wait either
+            EXPECT_EQ(deferredScene.GetEntryCount(), 2);
+            deferredScene.EnumerateNoCull([](const AzFramework::IVisibilityScene::NodeData&) {});
+        });
+        EXPECT_EQ(deferredScene.GetPendingUpdateCount(), 2);
+        EXPECT_TRUE(visEntry[0].m_internalNode != nullptr);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 2);
+
+        // An entry inserted again after its removal stays in the scene
+        deferredScene.InsertOrUpdateEntry(visEntry[1]);
+        deferredScene.ApplyPendingUpdates();
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode != nullptr);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 1);
+
+        deferredScene.RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, 0);
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates_ConcurrentMoversAndQueries_AllEntriesFound)
+    {
+        OctreeScene deferredScene(AZ::Name("OctreeDeferredUnitTestScene"), true);
+
+        constexpr uint32_t EntryCount = 256;
+        constexpr uint32_t MoverCount = 4;
+        constexpr uint32_t FrameCount = 50;
+
+        // Small entries that all fit in the -1 to 1 world, spread along the diagonal
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        for (uint32_t i = 0; i < EntryCount; ++i)
+        {
+            const float offset = -0.95f + 1.8f * (static_cast<float>(i) / EntryCount);
+            visEntries[i].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(offset), AZ::Vector3(offset + 0.01f));
+            deferredScene.InsertOrUpdateEntry(visEntries[i]);
+        }
+        deferredScene.ApplyPendingUpdates();
+
+        const AZ::Aabb worldBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f));
+        AZStd::atomic_bool done{ false };
+        AZStd::atomic<uint32_t> mismatchCount{ 0 };
+        AZStd::thread queryThread([&]()
+        {
+            while (!done)
+            {
+                size_t foundCount = 0;
+                deferredScene.Enumerate(worldBounds, [&foundCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    foundCount += nodeData.m_entries.size();
+                });
+                if (foundCount != EntryCount)
+                {
+                    ++mismatchCount;
+                }
+            }
+        });
+
+        for (uint32_t frame = 0; frame < FrameCount; ++frame)
+        {
+            AZStd::vector<AZStd::thread> movers;
+            for (uint32_t mover = 0; mover < MoverCount; ++mover)
+            {
+                movers.emplace_back([&deferredScene, &visEntries, mover, frame]()
+                {
+                    for (uint32_t i = mover; i < EntryCount; i += MoverCount)
+                    {
+                        // Only the thread moving an entry touches it, so the bounds can be written without a lock
+                        const float offset = ((i + frame) % EntryCount) / static_cast<float>(EntryCount) * 1.8f - 0.95f;
+                        visEntries[i].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(offset), AZ::Vector3(offset + 0.01f));
+                        deferredScene.InsertOrUpdateEntry(visEntries[i]);
+                    }
+                });
+            }
+            for (AZStd::thread& moverThread : movers)
+            {
+                moverThread.join();
+            }
+            deferredScene.ApplyPendingUpdates();
+        }
+
+        done = true;
+        queryThread.join();
+
+        EXPECT_EQ(mismatchCount, 0);
+        ValidateEntryCountEqualsExpectedCount(&deferredScene, EntryCount);
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            deferredScene.RemoveEntry(entry);
+        }
+    }
 }
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    class ClonePlanTestComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ClonePlanTestComponent, "{3C2F8D5B-7E61-4B0A-9D48-1F6A2C7E9B30}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ClonePlanTestComponent, AZ::Component>()
+                    ->Field("Reference", &ClonePlanTestComponent::m_reference)
+                    ->Field("Name", &ClonePlanTestComponent::m_name)
+                    ->Field("Scale", &ClonePlanTestComponent::m_scale)
+                    ->Field("Position", &ClonePlanTestComponent::m_position)
+                    ->Field("Values", &ClonePlanTestComponent::m_values)
+                    ;
+            }
+        }
+
+        AZ::EntityId m_reference;
+        AZStd::string m_name;
+        float m_scale{ 1.0f };
+        AZ::Vector3 m_position{ AZ::Vector3::CreateZero() };
+        AZStd::vector<int> m_values;
+    };
+
+    class SpawnableClonePlanTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            AZ::Entity::Reflect(m_serializeContext.get());
+            ClonePlanTestComponent::Reflect(m_serializeContext.get());
+            m_cache = AZStd::make_unique<AzFramework::ClonePlanCache>();
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            m_serializeContext->EnableRemoveReflection();
+            ClonePlanTestComponent::Reflect(m_serializeContext.get());
+            AZ::Entity::Reflect(m_serializeContext.get());
+            m_serializeContext->DisableRemoveReflection();
+            m_serializeContext.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::unique_ptr<AZ::Entity> CreatePrototype(AZ::EntityId reference)
+        {
+            auto entity = AZStd::make_unique<AZ::Entity>("Prototype");
+            auto* component = entity->CreateComponent<ClonePlanTestComponent>();
+            component->m_reference = reference;
+            component->m_name = "A name that's long enough to not fit in the small string buffer";
+            component->m_scale = 2.5f;
+            component->m_position = AZ::Vector3(1.0f, 2.0f, 3.0f);
+            component->m_values = { 1, 2, 3 };
+            return entity;
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AzFramework::ClonePlanCache> m_cache;
+    };
+
+    TEST_F(SpawnableClonePlanTest, CloneEntity_CopiesAllMembers)
+    {
+        auto prototype = CreatePrototype(AZ::EntityId(42));
+        AzFramework::ClonePlanCache::EntityIdMap idMap;
+
+        AZStd::unique_ptr<AZ::Entity> clone(m_cache->CloneEntity(*prototype, idMap, *m_serializeContext));
+        ASSERT_NE(nullptr, clone);
+        EXPECT_EQ(prototype->GetName(), clone->GetName());
+
+        auto* source = prototype->FindComponent<ClonePlanTestComponent>();
+        auto* cloned = clone->FindComponent<ClonePlanTestComponent>();
+        ASSERT_NE(nullptr, cloned);
+        EXPECT_NE(source, cloned);
+        EXPECT_EQ(source->m_name, cloned->m_name);
+        EXPECT_NE(source->m_name.data(), cloned->m_name.data());
+        EXPECT_FLOAT_EQ(source->m_scale, cloned->m_scale);
+        EXPECT_EQ(source->m_position, cloned->m_position);
+        EXPECT_EQ(source->m_values, cloned->m_values);
+    }
+
+    TEST_F(SpawnableClonePlanTest, CloneEntity_GeneratesNewIds)
+    {
+        auto prototype = CreatePrototype(AZ::EntityId(42));
+        AzFramework::ClonePlanCache::EntityIdMap idMap;
+
+        AZStd::unique_ptr<AZ::Entity> clone(m_cache->CloneEntity(*prototype, idMap, *m_serializeContext));
+        ASSERT_NE(nullptr, clone);
+        EXPECT_NE(prototype->GetId(), clone->GetId());
+        ASSERT_NE(idMap.end(), idMap.find(prototype->GetId()));
+        EXPECT_EQ(clone->GetId(), idMap[prototype->GetId()]);
+        // Only entity ids are remapped, component ids are kept the same as when cloning through the Serialize Context.
+        EXPECT_EQ(
+            prototype->FindComponent<ClonePlanTestComponent>()->GetId(), clone->FindComponent<ClonePlanTestComponent>()->GetId());
+    }
+
+    TEST_F(SpawnableClonePlanTest, CloneEntity_RemapsReferences)
+    {
+        auto target = CreatePrototype(AZ::EntityId());
+        auto prototype = CreatePrototype(target->GetId());
+        auto external = CreatePrototype(AZ::EntityId(42));
+
+        AzFramework::ClonePlanCache::EntityIdMap idMap;
+        AZStd::unique_ptr<AZ::Entity> targetClone(m_cache->CloneEntity(*target, idMap, *m_serializeContext));
+        AZStd::unique_ptr<AZ::Entity> clone(m_cache->CloneEntity(*prototype, idMap, *m_serializeContext));
+        AZStd::unique_ptr<AZ::Entity> externalClone(m_cache->CloneEntity(*external, idMap, *m_serializeContext));
+
+        EXPECT_EQ(targetClone->GetId(), clone->FindComponent<ClonePlanTestComponent>()->m_reference);
+        // References to entities that weren't cloned are kept as is.
+        EXPECT_EQ(AZ::EntityId(42), externalClone->FindComponent<ClonePlanTestComponent>()->m_reference);
+    }
+
+    TEST_F(SpawnableClonePlanTest, CloneEntities_MatchesIndividualClones)
+    {
+        constexpr size_t EntityCount = AzFramework::ClonePlanCache::ParallelCloneThreshold * 2;
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> prototypes;
+        AZStd::vector<const AZ::Entity*> prototypePointers;
+        AzFramework::ClonePlanCache::EntityIdMap idMap;
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            // Every entity references the one before it.
+            AZ::EntityId reference = prototypes.empty() ? AZ::EntityId() : prototypes.back()->GetId();
+            prototypes.push_back(CreatePrototype(reference));
+            prototypePointers.push_back(prototypes.back().get());
+            idMap.emplace(prototypes.back()->GetId(), AZ::Entity::MakeId());
+        }
+
+        AZStd::vector<AZ::Entity*> clones(EntityCount, nullptr);
+        m_cache->CloneEntities(prototypePointers, clones, idMap, *m_serializeContext);
+
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            ASSERT_NE(nullptr, clones[i]);
+            EXPECT_EQ(idMap[prototypes[i]->GetId()], clones[i]->GetId());
+            if (i > 0)
+            {
+                EXPECT_EQ(clones[i - 1]->GetId(), clones[i]->FindComponent<ClonePlanTestComponent>()->m_reference);
+            }
+        }
+
+        for (AZ::Entity* clone : clones)
+        {
+            delete clone;
+        }
+    }
+
+    TEST_F(SpawnableClonePlanTest, GetPlan_ReusesPlansAcrossClones)
+    {
+        auto first = CreatePrototype(AZ::EntityId());
+        auto second = CreatePrototype(AZ::EntityId());
+        AzFramework::ClonePlanCache::EntityIdMap idMap;
+
+        AZStd::unique_ptr<AZ::Entity> firstClone(m_cache->CloneEntity(*first, idMap, *m_serializeContext));
+        size_t planCount = m_cache->GetPlanCount();
+        EXPECT_LT(0, planCount);
+        AZStd::unique_ptr<AZ::Entity> secondClone(m_cache->CloneEntity(*second, idMap, *m_serializeContext));
+        EXPECT_EQ(planCount, m_cache->GetPlanCount());
+
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<ClonePlanTestComponent>());
+        ASSERT_NE(nullptr, classData);
+        const AzFramework::ClonePlan& plan = m_cache->GetPlan(*classData, *m_serializeContext);
+        EXPECT_TRUE(plan.IsCompiled());
+        EXPECT_TRUE(plan.MayHoldEntityIds());
+        EXPECT_FALSE(plan.GetCopyRanges().empty());
+        EXPECT_FALSE(plan.GetEntityIdFields().empty());
+
+        m_cache->Clear();
+        EXPECT_EQ(0, m_cache->GetPlanCount());
+    }
+} // namespace UnitTest
@@ -33,6 +33,38 @@ namespace AzNetworking
         return *this;
     }
 
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator ==(const SelfType& rhs) const
+    {
+        if (m_count != rhs.m_count)
+        {
+            return false;
+        }
+        const uint32_t fullElementSize = GetSize() / BitsetType::ElementTypeBits;
+        for (uint32_t i = 0; i < fullElementSize; ++i)
+        {
+            if (m_bitset.GetContainer()[i] != rhs.m_bitset.GetContainer()[i])
+            {
+                return false;
+            }
+        }
+
+        // Resizing down doesn't clear the tail of the last partially used element, so mask it off
+        const uint32_t remainingBits = GetSize() % BitsetType::ElementTypeBits;
+        if (remainingBits > 0)
+        {
+            const ElementType mask = static_cast<ElementType>((ElementType(1) << remainingBits) - 1);
+            return (m_bitset.GetContainer()[fullElementSize] & mask) == (rhs.m_bitset.GetContainer()[fullElementSize] & mask);
+        }
+        return true;
+    }
+
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator !=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
     template <AZStd::size_t CAPACITY, typename ElementType>
     inline void FixedSizeVectorBitset<CAPACITY, ElementType>::SetBit(uint32_t index, bool value)
     {
@@ -36,6 +36,8 @@ namespace AzNetworking
         uint64_t m_sendBytesEncryptionInflation = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
+        //! Returns the total number of packets that could not be written to the socket and were dropped.
+        uint64_t m_sendFailures = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
         AZ::TimeMs m_recvTimeMs = AZ::Time::ZeroTimeMs;
         //! Returns the total number of packets received on this socket.
@@ -68,10 +68,12 @@ namespace AzNetworking
     void NetworkingSystemComponent::Activate()
     {
         AZ::SystemTickBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
     }
 
     void NetworkingSystemComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
         AZ::SystemTickBus::Handler::BusDisconnect();
     }
 
@@ -84,6 +86,23 @@ namespace AzNetworking
         }
     }
 
+    void NetworkingSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        // Transmit everything queued by game and multiplayer tick handlers this frame, rather than holding it until the next system tick
+        for (auto& networkInterface : m_networkInterfaces)
+        {
+            if (networkInterface.second->GetType() == ProtocolType::Udp)
+            {
+                static_cast<UdpNetworkInterface*>(networkInterface.second.get())->FlushSendBatch();
+            }
+        }
+    }
+
+    int NetworkingSystemComponent::GetTickOrder()
+    {
+        return AZ::TICK_LAST;
+    }
+
     INetworkInterface* NetworkingSystemComponent::CreateNetworkInterface(const AZ::Name& name, ProtocolType protocolType, TrustZone trustZone, IConnectionListener& listener)
     {
         AZ_Assert(RetrieveNetworkInterface(name) == nullptr, "A network interface with this name already exists");
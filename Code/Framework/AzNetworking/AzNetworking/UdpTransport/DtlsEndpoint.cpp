@@ -81,14 +81,19 @@ namespace AzNetworking
         ConnectResult result = ConnectResult::Failed;
 #if AZ_TRAIT_USE_OPENSSL
         UdpPacketEncodingBuffer outDtlsData;
-        if (dtlsData.GetSize() > 0)
+        DtlsEndpoint::HandshakeState prevState;
         {
-            const uint8_t* encryptedData = dtlsData.GetBuffer();
-            const uint32_t encryptedSize = static_cast<uint32_t>(dtlsData.GetSize());
-            BIO_write(m_readBio, encryptedData, encryptedSize);
+            // The handshake packet below is sent after unlocking, as sending encrypts through this endpoint
+            AZStd::lock_guard<AZStd::mutex> lock(m_sslMutex);
+            if (dtlsData.GetSize() > 0)
+            {
+                const uint8_t* encryptedData = dtlsData.GetBuffer();
+                const uint32_t encryptedSize = static_cast<uint32_t>(dtlsData.GetSize());
+                BIO_write(m_readBio, encryptedData, encryptedSize);
+            }
+            prevState = m_state;
+            result = PerformHandshakeInternal(outDtlsData);
         }
-        DtlsEndpoint::HandshakeState prevState = m_state;
-        result = PerformHandshakeInternal(outDtlsData);
 
         // Pass along any remaining handshake data
         // If we're the connecting endpoint and the handshake is complete, both sides are encrypted and this isn't necessary so skip it
@@ -107,6 +112,7 @@ namespace AzNetworking
 
     const uint8_t* DtlsEndpoint::DecodePacket([[maybe_unused]] UdpConnection& connection, const uint8_t* encryptedData, int32_t encryptedSize, uint8_t* outDecodedData, int32_t& outDecodedSize)
     {
+        AZStd::lock_guard<AZStd::mutex> lock(m_sslMutex);
         if (m_sslSocket == nullptr || IsConnecting())
         {
             // If the ssl socket is nullptr, it means encryption is not enabled, just passthrough the received data
@@ -129,6 +135,28 @@ namespace AzNetworking
         return outDecodedData;
     }
 
+    bool DtlsEndpoint::DecodePacketInPlace([[maybe_unused]] uint8_t* data, [[maybe_unused]] int32_t encryptedSize, [[maybe_unused]] int32_t& outDecodedSize)
+    {
+#if AZ_TRAIT_USE_OPENSSL
+        AZStd::lock_guard<AZStd::mutex> lock(m_sslMutex);
+        if (m_sslSocket == nullptr || m_state != HandshakeState::Complete)
+        {
+            return false;
+        }
+
+        // The BIO keeps its own copy of the record, so the received data can be overwritten by the decrypted payload
+        const int32_t bioWriteSize = BIO_write(m_readBio, data, encryptedSize);
+        if (bioWriteSize != encryptedSize)
+        {
+            AZLOG_ERROR("BIO did not write as many bytes as provided");
+        }
+        outDecodedSize = SSL_read(m_sslSocket, data, encryptedSize);
+        return true;
+#else
+        return false;
+#endif
+    }
+
     DtlsEndpoint::ConnectResult DtlsEndpoint::ConstructEndpointInternal([[maybe_unused]] const DtlsSocket& socket, [[maybe_unused]] const IpAddress& address)
     {
         if (m_sslSocket != nullptr)
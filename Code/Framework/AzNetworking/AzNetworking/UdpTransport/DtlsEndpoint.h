@@ -10,6 +10,7 @@
 
 #include <AzNetworking/Utilities/IpAddress.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/parallel/mutex.h>
 
 // OpenSSL forward declarations
 typedef struct ssl_st SSL;
@@ -83,6 +84,14 @@ namespace AzNetworking
         //! @return pointer to the decoded data
         const uint8_t* DecodePacket(UdpConnection& connection, const uint8_t* encryptedData, int32_t encryptedSize, uint8_t* outDecodedData, int32_t& outDecodedSize);
 
+        //! Decrypts the transmitted data in place if the handshake has completed, this is safe to call from a reader thread.
+        //! Packets received before the handshake completes are left for DecodePacket, which handles them in order with the handshake.
+        //! @param data           the encrypted data received from the socket, replaced by the decrypted data
+        //! @param encryptedSize  the size of the received raw data
+        //! @param outDecodedSize the size of the decrypted data, zero or negative if OpenSSL consumed or rejected the data
+        //! @return boolean true if the data was decrypted, false if the endpoint isn't encrypted or is still handshaking
+        bool DecodePacketInPlace(uint8_t* data, int32_t encryptedSize, int32_t& outDecodedSize);
+
     private:
 
         //! Performs internal common dtls endpoint setup.
@@ -96,6 +105,8 @@ namespace AzNetworking
         //! @return a connect result specifying whether the connection is still pending, failed, or complete
         ConnectResult PerformHandshakeInternal(UdpPacketEncodingBuffer& outHandshakeData);
 
+        //! Guards the OpenSSL state, which is shared by the send path, the game thread and the reader threads decrypting packets.
+        AZStd::mutex m_sslMutex;
         HandshakeState m_state;
         IpAddress m_address;
         SSL* m_sslSocket;
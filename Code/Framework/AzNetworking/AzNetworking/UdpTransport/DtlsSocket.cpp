@@ -77,17 +77,22 @@ namespace AzNetworking
             return UdpSocket::SendInternal(address, data, size, encrypt, dtlsEndpoint);
         }
 
-        if (dtlsEndpoint.m_sslSocket == nullptr)
-        {
-            AZLOG_ERROR("Trying to send on an open socketfd, but with a nullptr ssl socket wrapper!");
-            return SocketOpResultErrorNoSsl;
-        }
-
 #if AZ_TRAIT_USE_OPENSSL
         uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
-        // Write out the packet we were requested to send
-        SSL_write(dtlsEndpoint.m_sslSocket, data, size);
-        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
+        int32_t sentBytesEnc = 0;
+        {
+            // Reader threads may be decrypting packets received from this endpoint
+            AZStd::lock_guard<AZStd::mutex> lock(dtlsEndpoint.m_sslMutex);
+            if (dtlsEndpoint.m_sslSocket == nullptr)
+            {
+                AZLOG_ERROR("Trying to send on an open socketfd, but with a nullptr ssl socket wrapper!");
+                return SocketOpResultErrorNoSsl;
+            }
+
+            // Write out the packet we were requested to send
+            SSL_write(dtlsEndpoint.m_sslSocket, data, size);
+            sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
+        }
 
         // Track encryption metrics
         m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
@@ -95,7 +100,8 @@ namespace AzNetworking
 
         return UdpSocket::SendInternal(address, encrpytedSendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
 #else
-        return 0;
+        AZLOG_ERROR("Trying to send on an open socketfd, but with a nullptr ssl socket wrapper!");
+        return SocketOpResultErrorNoSsl;
 #endif
     }
 }
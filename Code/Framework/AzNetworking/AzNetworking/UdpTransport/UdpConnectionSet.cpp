@@ -27,6 +27,7 @@ namespace AzNetworking
         // Check for errors here, don't want to clobber an existing connection...
         AZ_Assert(GetConnection(connection->GetConnectionId()) == nullptr, "ConnectionId already exists in connection set");
         AZ_Assert(GetConnection(connection->GetRemoteAddress()) == nullptr, "Remote address already exists in connection set");
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_readerMutex);
         m_remoteAddressMap[connection->GetRemoteAddress()] = connection.get();
         m_connectionIdMap[connection->GetConnectionId()] = AZStd::move(connection);
         return true;
@@ -46,6 +47,7 @@ namespace AzNetworking
         );
 
         AZ_Assert(connection->GetRemoteAddress() == address, "Connection list is corrupt, mismatched remote endpoint addresses detected");
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_readerMutex);
         m_remoteAddressMap.erase(connection->GetRemoteAddress());
         m_connectionIdMap.erase(connection->GetConnectionId());
         return true;
@@ -73,6 +75,7 @@ namespace AzNetworking
         );
 
         AZ_Assert(connection->GetConnectionId() == connectionId, "Connection list is corrupt, mismatched connection identifiers detected");
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_readerMutex);
         m_remoteAddressMap.erase(connection->GetRemoteAddress());
         m_connectionIdMap.erase(connectionId);
         return true;
@@ -134,4 +137,16 @@ namespace AzNetworking
         }
         return nullptr;
     }
+
+    bool UdpConnectionSet::DecodePacketInPlace(const IpAddress& address, uint8_t* data, int32_t receivedBytes, int32_t& outDecodedSize) const
+    {
+        // Holding the lock keeps the connection alive until decryption completes
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_readerMutex);
+        UdpConnection* connection = GetConnection(address);
+        if (connection == nullptr)
+        {
+            return false;
+        }
+        return connection->GetDtlsEndpoint().DecodePacketInPlace(data, receivedBytes, outDecodedSize);
+    }
 }
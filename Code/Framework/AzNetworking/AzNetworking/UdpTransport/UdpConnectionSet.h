@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/IpAddress.h>
 #include <AzNetworking/ConnectionLayer/IConnectionSet.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzNetworking
@@ -19,6 +20,7 @@ namespace AzNetworking
 
     //! @class UdpConnectionSet
     //! @brief Tracks current UDP endpoints and allows fast lookups by connection identifier and remote address.
+    //! The set is owned by the thread updating its network interface, apart from DecodePacketInPlace which reader threads may call.
     class UdpConnectionSet final
         : public IConnectionSet
     {
@@ -55,8 +57,20 @@ namespace AzNetworking
         //! @return pointer to the requested connection instance on success, nullptr on failure
         UdpConnection* GetConnection(const IpAddress& address) const;
 
+        //! Decrypts a packet from the remote address in place, safe to call from a reader thread, \see DtlsEndpoint::DecodePacketInPlace.
+        //! @param address        address of the remote endpoint the packet was received from
+        //! @param data           the received data, replaced by the decrypted data
+        //! @param receivedBytes  the size of the received data
+        //! @param outDecodedSize the size of the decrypted data
+        //! @return boolean true if the packet was decrypted, false if it has to be decoded when it's processed
+        bool DecodePacketInPlace(const IpAddress& address, uint8_t* data, int32_t receivedBytes, int32_t& outDecodedSize) const;
+
     private:
 
+        //! Held exclusively while connections are added or deleted, and shared while a reader thread decrypts with a connection.
+        //! The owning thread is the only one modifying the set, so its own lookups don't need to lock.
+        mutable AZStd::shared_mutex m_readerMutex;
+
         ConnectionId     m_nextConnectionId = InvalidConnectionId;
         ConnectionIdMap  m_connectionIdMap;
         RemoteAddressMap m_remoteAddressMap;
@@ -58,6 +58,7 @@ namespace AzNetworking
                 };
 
                 udpInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+                udpInterface->FlushSendBatch();
             }
         }
     }
@@ -18,6 +18,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/parallel/lock.h>
 
 namespace AzNetworking
 {
@@ -38,6 +39,8 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+    AZ_CVAR(bool, net_UdpBatchSends, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, packets sent between updates are queued and transmitted together at the start and end of each network interface update and at the end of each frame. Must be set before creating the network interface");
+    AZ_CVAR(uint32_t, net_UdpReaderShards, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of sockets a listening network interface opens on its port with port reuse, each read by its own reader thread. Must be set before listening");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -64,9 +67,11 @@ namespace AzNetworking
         , m_readerThread(readerThread)
         , m_heartbeatThread(heartbeatThread)
         , m_timeoutMs(net_UdpDefaultTimeoutMs)
+        , m_readerShardCount(net_UdpReaderShards)
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor);
+        m_socket->SetSendBatching(net_UdpBatchSends);
         m_heartbeatThread.RegisterNetworkInterface(this);
     }
 
@@ -116,9 +121,17 @@ namespace AzNetworking
 
         m_port = port;
         m_allowIncomingConnections = true;
+
+        // Sharding requires a known port for the additional sockets to bind to
+        const bool useReaderShards = AZ_TRAIT_USE_SOCKET_REUSEPORT && (m_readerShardCount > 1) && (m_port != 0);
+        m_socket->SetReusePort(useReaderShards);
         if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
-            m_readerThread.RegisterSocket(m_socket.get());
+            m_readerThread.RegisterSocket(m_socket.get(), GetPacketDecoder());
+            if (useReaderShards)
+            {
+                OpenReaderShards();
+            }
             return true;
         }
         else
@@ -140,7 +153,7 @@ namespace AzNetworking
         {
             if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::False, m_trustZone))
             {
-                m_readerThread.RegisterSocket(m_socket.get());
+                m_readerThread.RegisterSocket(m_socket.get(), GetPacketDecoder());
             }
             else
             {
@@ -180,6 +193,9 @@ namespace AzNetworking
             return;
         }
 
+        // Transmit anything queued since the last update before processing received packets
+        FlushSendBatch();
+
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
@@ -188,16 +204,81 @@ namespace AzNetworking
             return;
         }
 
-        for (uint32_t i = 0; i < packets->size(); ++i)
+        // Each shard is only ever swapped here, so merging them requires no locking beyond that of the individual reader threads.
+        // The shards are only added and removed on this thread, so reading them here doesn't need m_readerShardsMutex either
+        for (ReaderShard& shard : m_readerShards)
         {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
+            shard.m_readerThread->SwapBuffers();
+        }
+
+        // All shards share the time slice, so start from a different shard every update to keep any one shard from being
+        // the one whose packets are discarded whenever the slice runs out
+        const uint32_t shardCount = GetReaderShardCount();
+        m_firstProcessedShard = (m_firstProcessedShard + 1) % shardCount;
+        for (uint32_t i = 0; i < shardCount; ++i)
+        {
+            const uint32_t shardIndex = (m_firstProcessedShard + i) % shardCount;
+            const UdpReaderThread::ReceivedPackets* shardPackets = (shardIndex == 0) ? packets
+                : m_readerShards[shardIndex - 1].m_readerThread->GetReceivedPackets(m_readerShards[shardIndex - 1].m_socket.get());
+            if (shardPackets != nullptr)
+            {
+                ProcessReceivedPackets(*shardPackets, startTimeMs);
+            }
+        }
+        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+
+        // Time out any stale client connections
+        m_connectionTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandleConnectionTimeout(item); });
+
+        // Time out any packets that haven't been acked within our timeout window
+        m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
+
+        // Delete any connections we've disconnected
+        for (RemovedConnection& removedConnection : m_removedConnections)
+        {
+            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
+            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
+        }
+        m_removedConnections.clear();
+
+        // Transmit acks, heartbeats and resends queued during this update
+        FlushSendBatch();
+
+        // Update metrics
+        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
+        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
+        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
+        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
+        GetMetrics().m_sendFailures = m_socket->GetSendFailures();
+        GetMetrics().m_recvTimeMs += receiveTimeMs;
+        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
+        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        for (const ReaderShard& shard : m_readerShards)
+        {
+            GetMetrics().m_sendPackets += shard.m_socket->GetSentPackets();
+            GetMetrics().m_sendBytes += shard.m_socket->GetSentBytes();
+            GetMetrics().m_sendPacketsEncrypted += shard.m_socket->GetSentPacketsEncrypted();
+            GetMetrics().m_sendBytesEncryptionInflation += shard.m_socket->GetSentBytesEncryptionInflation();
+            GetMetrics().m_sendFailures += shard.m_socket->GetSendFailures();
+            GetMetrics().m_recvPackets += shard.m_socket->GetRecvPackets();
+            GetMetrics().m_recvBytes += shard.m_socket->GetRecvBytes();
+        }
+        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
+        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+
+    void UdpNetworkInterface::ProcessReceivedPackets(const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs)
+    {
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
             const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
             // Don't exceed our timeslice, even if unprocessed data remains
             if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
             {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
+                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets.size() - i), aznumeric_cast<int32_t>(packets.size()));
+                GetMetrics().m_discardedPackets += packets.size() - i;
                 break;
             }
 
@@ -222,10 +303,15 @@ namespace AzNetworking
                 continue;
             }
 
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
+            int32_t decodedPacketSize = packet.m_decodedBytes;
+            const uint8_t* decodedPacketData = packet.m_buffer;
+            if (!packet.m_isDecoded)
+            {
+                // Packets received before the DTLS handshake completed are decoded here, in order with the handshake
+                m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
+                decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
+                m_decryptBuffer.Resize(decodedPacketSize);
+            }
 
             if (decodedPacketSize == 0)
             {
@@ -330,32 +416,6 @@ namespace AzNetworking
                 }
             }
         }
-        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
-
-        // Time out any stale client connections
-        m_connectionTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandleConnectionTimeout(item); });
-
-        // Time out any packets that haven't been acked within our timeout window
-        m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
-
-        // Delete any connections we've disconnected
-        for (RemovedConnection& removedConnection : m_removedConnections)
-        {
-            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
-            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
-        }
-        m_removedConnections.clear();
-
-        // Update metrics
-        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
-        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
-        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
-        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
-        GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
-        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
-        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
@@ -396,6 +456,7 @@ namespace AzNetworking
         }
 
         m_port = 0;
+        CloseReaderShards();
         m_readerThread.UnregisterSocket(m_socket.get());
         m_allowIncomingConnections = false;
         m_socket->Close();
@@ -623,7 +684,13 @@ namespace AzNetworking
         AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
         const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
-        if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
+        bool sent = false;
+        {
+            // The heartbeat thread sends as well, so the shard sockets have to stay open until the send is done
+            AZStd::shared_lock<AZStd::shared_mutex> readerShardsLock(m_readerShardsMutex);
+            sent = GetSocketForAddress(address).Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality());
+        }
+        if (sent)
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
             connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
@@ -795,6 +862,96 @@ namespace AzNetworking
         return TimeoutResult::Delete;
     }
 
+    void UdpNetworkInterface::FlushSendBatch()
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> readerShardsLock(m_readerShardsMutex);
+        m_socket->FlushSendBatch();
+        for (ReaderShard& shard : m_readerShards)
+        {
+            shard.m_socket->FlushSendBatch();
+        }
+    }
+
+    void UdpNetworkInterface::SetReaderShardCount(uint32_t shardCount)
+    {
+        AZ_Assert(!m_socket->IsOpen(), "The reader shard count must be set before the network interface is opened");
+        m_readerShardCount = AZStd::max(shardCount, 1u);
+    }
+
+    uint32_t UdpNetworkInterface::GetReaderShardCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_readerShards.size()) + 1;
+    }
+
+    void UdpNetworkInterface::OpenReaderShards()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> readerShardsLock(m_readerShardsMutex);
+        for (uint32_t shardIndex = 1; shardIndex < m_readerShardCount; ++shardIndex)
+        {
+            ReaderShard shard;
+            shard.m_socket.reset(m_socket->IsEncrypted() ? new DtlsSocket() : new UdpSocket());
+            shard.m_socket->SetReusePort(true);
+            shard.m_socket->SetSendBatching(m_socket->IsSendBatching());
+            if (!shard.m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+            {
+                AZLOG_WARN("Failed to open reader shard %u on port %u, continuing with %u shards",
+                    shardIndex, aznumeric_cast<uint32_t>(m_port), GetReaderShardCount());
+                break;
+            }
+
+            shard.m_readerThread = AZStd::make_unique<UdpReaderThread>();
+            shard.m_readerThread->RegisterSocket(shard.m_socket.get(), GetPacketDecoder());
+            m_readerShards.push_back(AZStd::move(shard));
+        }
+
+        // Without steering the kernel still distributes remote addresses between the sockets, just not predictably,
+        // in which case all sends use the primary socket
+        m_readerShardSteering = !m_readerShards.empty() && SetSocketReusePortSteering(m_socket->GetSocketFd(), GetReaderShardCount());
+    }
+
+    void UdpNetworkInterface::CloseReaderShards()
+    {
+        // Detach the shards first, once the heartbeat thread can't reach them they can be closed without holding the lock
+        AZStd::vector<ReaderShard> readerShards;
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> readerShardsLock(m_readerShardsMutex);
+            readerShards.swap(m_readerShards);
+            m_readerShardSteering = false;
+        }
+
+        for (ReaderShard& shard : readerShards)
+        {
+            shard.m_readerThread->UnregisterSocket(shard.m_socket.get());
+            shard.m_socket->Close();
+        }
+    }
+
+    UdpReaderThread::PacketDecoder UdpNetworkInterface::GetPacketDecoder()
+    {
+        if (!m_socket->IsEncrypted())
+        {
+            return {};
+        }
+        return [this](const IpAddress& address, uint8_t* data, int32_t receivedBytes, int32_t& outDecodedSize)
+        {
+            return m_connectionSet.DecodePacketInPlace(address, data, receivedBytes, outDecodedSize);
+        };
+    }
+
+    UdpSocket& UdpNetworkInterface::GetSocketForAddress(const IpAddress& address) const
+    {
+        if (m_readerShardSteering)
+        {
+            // Send from the socket that receives from this address, so each shard only handles its own connections
+            const uint32_t shardIndex = GetReusePortSocketIndex(address.GetAddress(ByteOrder::Host), address.GetPort(ByteOrder::Host), GetReaderShardCount());
+            if (shardIndex > 0)
+            {
+                return *m_readerShards[shardIndex - 1].m_socket;
+            }
+        }
+        return *m_socket;
+    }
+
     AZStd::atomic<AZ::TimeMs> UdpNetworkInterface::GetLastSystemTickUpdate() const
     {
         return m_lastSystemTickUpdate.load();
@@ -18,6 +18,7 @@
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 namespace AzNetworking
 {
@@ -85,6 +86,17 @@ namespace AzNetworking
     //! AzNetworking uses the [OpenSSL](https://www.openssl.org/) library to implement Datagram Layer Transport Security (DTLS) encryption
     //! on UDP traffic. Encryption operates as described in [O3DE Networking Encryption](http://o3de.org/docs/user-guide/networking/encryption)
     //! on the documentation website. Once both endpoints have completed their handshake, all traffic is expected to be fully encrypted.
+    //!
+    //! ### Reader shards
+    //!
+    //! On platforms that support port reuse, a listening interface can open several sockets on its port, controlled by the cvar
+    //! net_UdpReaderShards. Each additional socket is read by its own reader thread, so receiving scales across cores. Incoming
+    //! datagrams are steered to a socket by a hash of the remote address, which pins every connection to one shard, and the shards
+    //! are merged on the game thread during Update. Any process of the same user can join the port when port reuse is enabled.
+    //!
+    //! Once a connection's DTLS handshake has completed, its packets are decrypted by the reader thread that received them. Each
+    //! DtlsEndpoint locks its OpenSSL state, which is shared with the send path. Decompression and packet dispatch run on the game
+    //! thread, which starts from a different shard every update so the time slice is shared fairly between the shards.
     class UdpNetworkInterface final
         : public INetworkInterface
     {
@@ -120,6 +132,18 @@ namespace AzNetworking
         bool IsOpen() const override;
         //! @}
 
+        //! Transmits any packets queued on the socket when send batching is enabled, \see net_UdpBatchSends.
+        void FlushSendBatch();
+
+        //! Sets the number of sockets to open when listening, each read by its own reader thread, \see net_UdpReaderShards.
+        //! Must be called before the interface is opened.
+        //! @param shardCount the number of sockets to open on the listen port
+        void SetReaderShardCount(uint32_t shardCount);
+
+        //! Returns the number of sockets currently open on the listen port.
+        //! @return the number of sockets currently open on the listen port
+        uint32_t GetReaderShardCount() const;
+
         AZStd::atomic<AZ::TimeMs> GetLastSystemTickUpdate() const;
 
     private:
@@ -138,6 +162,25 @@ namespace AzNetworking
         //! @return boolean true on success, false on failure
         bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
 
+        //! Processes packets received by a reader thread, discarding any that exceed the packet processing time slice.
+        //! @param packets     the packets to process
+        //! @param startTimeMs the time the current update started processing packets
+        void ProcessReceivedPackets(const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs);
+
+        //! Opens the additional reader shard sockets on the listen port, registering each with its own reader thread.
+        void OpenReaderShards();
+
+        //! Closes all additional reader shard sockets and stops their reader threads.
+        void CloseReaderShards();
+
+        //! Returns the decoder the reader threads use to decrypt packets received on this interface's sockets, empty if unencrypted.
+        UdpReaderThread::PacketDecoder GetPacketDecoder();
+
+        //! Returns the socket to send to the provided address on, the socket that receives from that address if shards are steered.
+        //! @param address the address to send to
+        //! @return the socket to send on
+        UdpSocket& GetSocketForAddress(const IpAddress& address) const;
+
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
         //! @param packet             serializable object to transmit
@@ -185,6 +228,20 @@ namespace AzNetworking
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
         UdpReaderThread& m_readerThread;
+
+        //! Additional sockets on the listen port and the reader threads that own them, m_socket is always the first shard.
+        struct ReaderShard
+        {
+            AZStd::unique_ptr<UdpSocket> m_socket;
+            AZStd::unique_ptr<UdpReaderThread> m_readerThread;
+        };
+        //! Guards m_readerShards and m_readerShardSteering against the heartbeat thread, which sends and flushes on the shard
+        //! sockets while the game thread opens or closes them. The game thread itself only locks to modify them.
+        mutable AZStd::shared_mutex m_readerShardsMutex;
+        AZStd::vector<ReaderShard> m_readerShards;
+        uint32_t m_readerShardCount = 1;
+        uint32_t m_firstProcessedShard = 0;
+        bool m_readerShardSteering = false;
         UdpHeartbeatThread& m_heartbeatThread;
         AZStd::atomic<AZ::TimeMs> m_lastSystemTickUpdate;
 
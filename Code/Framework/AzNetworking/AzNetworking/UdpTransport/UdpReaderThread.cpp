@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -30,14 +31,14 @@ namespace AzNetworking
         Join();
     }
 
-    bool UdpReaderThread::RegisterSocket(UdpSocket* socket)
+    bool UdpReaderThread::RegisterSocket(UdpSocket* socket, PacketDecoder decoder)
     {
         if (SocketExists(socket))
         {
             AZLOG_ERROR("Attempting to add a duplicate socket to the UdpReaderThread");
             return false;
         }
-        m_pendingAdds.push_back(socket);
+        m_pendingAdds.emplace_back(socket, AZStd::move(decoder));
         if (!IsRunning())
         {
             Start();
@@ -102,10 +103,10 @@ namespace AzNetworking
         {
             // This scope is sync-safe between the main and reader threads
             ReaderBuffer& back = m_readerBuffers[m_backIndex];
-            for (UdpSocket* socket : m_pendingAdds)
+            for (const auto& [socket, decoder] : m_pendingAdds)
             {
-                front.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
-                back.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
+                front.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets(), decoder });
+                back.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets(), decoder });
             }
             m_pendingAdds.clear();
             AZStd::remove_if(front.m_entries.begin(), front.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
@@ -167,6 +168,7 @@ namespace AzNetworking
             }
 
             ReceivedPackets& receivedPackets = socketEntry.m_receivedPackets;
+            UdpSocket::ReceiveBatchEntry entries[UdpSocket::MaxBatchedDatagrams];
             for (;;)
             {
                 AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
@@ -176,27 +178,51 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
+                // Every packet in a batch is received into its own MTU sized slot at the end of the receive buffer
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
-                if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+                const uint32_t freeSlots = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit;
+                if (freeSlots == 0)
                 {
                     AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
                         aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
                     break;
                 }
 
+                const uint32_t freePackets = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchSize = AZStd::min(AZStd::min(freeSlots, freePackets), UdpSocket::MaxBatchedDatagrams);
+                if (batchSize == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + batchSize * MaxUdpTransmissionUnit);
+                for (uint32_t i = 0; i < batchSize; ++i)
+                {
+                    entries[i].m_data = dstData + i * MaxUdpTransmissionUnit;
+                    entries[i].m_size = MaxUdpTransmissionUnit;
+                }
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                const uint32_t receivedCount = socket->ReceiveBatch(entries, batchSize);
+                uint32_t bufferTail = bufferHead;
+                for (uint32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    if (entries[i].m_receivedBytes > 0)
+                    {
+                        ReceivedPacket& receivedPacket = receivedPackets.emplace_back(entries[i].m_address, entries[i].m_data, entries[i].m_receivedBytes);
+                        if (socketEntry.m_decoder)
+                        {
+                            receivedPacket.m_isDecoded = socketEntry.m_decoder(
+                                entries[i].m_address, entries[i].m_data, entries[i].m_receivedBytes, receivedPacket.m_decodedBytes);
+                        }
+                        bufferTail = bufferHead + i * MaxUdpTransmissionUnit + entries[i].m_receivedBytes;
+                    }
                 }
-                else
+                receiveBuffer.Resize(bufferTail);
+
+                if (receivedCount < batchSize)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has no more pending data
                     break;
                 }
             }
@@ -13,6 +13,7 @@
 #include <AzNetworking/Utilities/TimedThread.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/functional.h>
 
 namespace AzNetworking
 {
@@ -36,17 +37,27 @@ namespace AzNetworking
             IpAddress      m_address;
             const uint8_t* m_buffer = nullptr;
             int32_t        m_receivedBytes = 0;
+            int32_t        m_decodedBytes = 0; //!< Size of the decrypted data in m_buffer, only valid if m_isDecoded is set
+            bool           m_isDecoded = false;
         };
 
         using ReceivedPackets = AZStd::fixed_vector<ReceivedPacket, MaxUdpReceivePacketCount>;
 
+        //! Decrypts a received packet in place on the reader thread, returning false to leave it for the thread processing packets.
+        //! @param address        the address the packet was received from
+        //! @param data           the received data, replaced by the decrypted data
+        //! @param receivedBytes  the size of the received data
+        //! @param outDecodedSize the size of the decrypted data
+        using PacketDecoder = AZStd::function<bool(const IpAddress& address, uint8_t* data, int32_t receivedBytes, int32_t& outDecodedSize)>;
+
         UdpReaderThread();
         ~UdpReaderThread() override;
 
         //! Adds the provided socket to the socket reader for processing.
-        //! @param socket pointer to the UdpSocket to read incoming data from
+        //! @param socket  pointer to the UdpSocket to read incoming data from
+        //! @param decoder optional decoder run on this thread for every packet received on the socket
         //! @return boolean true on success, false for failure
-        bool RegisterSocket(UdpSocket* socket);
+        bool RegisterSocket(UdpSocket* socket, PacketDecoder decoder = {});
 
         //! Removes the provided socket from the socket reader for processing.
         //! @param socket pointer to the UdpSocket to read incoming data from
@@ -82,6 +93,7 @@ namespace AzNetworking
         {
             UdpSocket* m_socket;
             ReceivedPackets m_receivedPackets;
+            PacketDecoder m_decoder;
         };
 
         struct ReaderBuffer
@@ -93,7 +105,7 @@ namespace AzNetworking
         AZStd::recursive_mutex m_mutex;
         int32_t m_backIndex = 0;
         AZStd::array<ReaderBuffer, 2> m_readerBuffers;
-        AZStd::vector<UdpSocket*> m_pendingAdds;
+        AZStd::vector<AZStd::pair<UdpSocket*, PacketDecoder>> m_pendingAdds;
         AZ::TimeMs m_updateTimeMs = AZ::Time::ZeroTimeMs;
     };
 }
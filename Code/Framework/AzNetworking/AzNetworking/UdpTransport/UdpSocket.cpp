@@ -23,6 +23,48 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpSegmentationOffload, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, batched sends of consecutive packets to the same address will use UDP generic segmentation offload where supported");
+
+    // The largest payload the kernel accepts for a single segmented send, the IPv4 limit minus the IP and UDP headers
+    static constexpr uint32_t MaxSegmentedPayloadSize = 65507;
+
+    static int32_t SendTo(SocketFd socketFd, const IpAddress& address, const uint8_t* data, uint32_t size)
+    {
+        sockaddr_in destAddr;
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin_family = AF_INET;
+        destAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
+        destAddr.sin_port = address.GetPort(ByteOrder::Network);
+        return static_cast<int32_t>(sendto(static_cast<int32_t>(socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr)));
+    }
+
+    static void HandleSendError()
+    {
+        const int32_t error = GetLastNetworkError();
+        if (!ErrorIsWouldBlock(error)) // Filter would block messages
+        {
+            AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        }
+    }
+
+    static int32_t HandleReceiveError()
+    {
+        const int32_t error = GetLastNetworkError();
+
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
+        {
+            return 0;
+        }
+
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+        }
+
+        AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
+    }
 
     UdpSocket::~UdpSocket()
     {
@@ -68,6 +110,12 @@ namespace AzNetworking
             }
         }
 
+        if (m_reusePort && !SetSocketReusePort(m_socketFd))
+        {
+            Close();
+            return false;
+        }
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -91,11 +139,19 @@ namespace AzNetworking
             return false;
         }
 
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        // Probe for kernel support of segmentation offload, a segment size of 0 leaves segmentation disabled until requested per send
+        const int32_t segmentSize = 0;
+        m_segmentationOffload = net_UdpSegmentationOffload
+            && (::setsockopt(static_cast<int32_t>(m_socketFd), SOL_UDP, UDP_SEGMENT, &segmentSize, sizeof(segmentSize)) == 0);
+#endif
+
         return true;
     }
 
     void UdpSocket::Close()
     {
+        FlushSendBatch();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -142,6 +198,7 @@ namespace AzNetworking
 
             if (sentBytes < 0)
             {
+                m_sendFailures++;
                 const int32_t error = GetLastNetworkError();
 
                 if (ErrorIsWouldBlock(error)) // Filter would block messages
@@ -191,48 +248,291 @@ namespace AzNetworking
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
+            return HandleReceiveError();
+        }
+
+        if (receivedBytes == 0)
+        {
+            return 0;
+        }
+
+        m_recvPackets++;
+        m_recvBytes += receivedBytes;
+        return receivedBytes;
+    }
+
+    uint32_t UdpSocket::ReceiveBatch(ReceiveBatchEntry* entries, uint32_t count) const
+    {
+        AZ_Assert(entries != nullptr, "NULL entries pointer passed to receive");
 
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        count = AZStd::min(count, MaxBatchedDatagrams);
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        mmsghdr messages[MaxBatchedDatagrams];
+        iovec buffers[MaxBatchedDatagrams];
+        sockaddr_in from[MaxBatchedDatagrams];
+        memset(messages, 0, sizeof(mmsghdr) * count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            AZ_Assert(entries[i].m_size > 0, "Invalid data size for receive");
+            AZ_Assert(entries[i].m_data != nullptr, "NULL data pointer passed to receive");
+            buffers[i].iov_base = entries[i].m_data;
+            buffers[i].iov_len = entries[i].m_size;
+            messages[i].msg_hdr.msg_name = &from[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(from[i]);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int32_t receivedCount = ::recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, 0, nullptr);
+        if (receivedCount <= 0)
+        {
+            if (receivedCount < 0)
             {
-                return 0;
+                HandleReceiveError();
             }
+            return 0;
+        }
 
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            entries[i].m_address = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+            entries[i].m_receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+            m_recvPackets++;
+            m_recvBytes += messages[i].msg_len;
+        }
+        return static_cast<uint32_t>(receivedCount);
+#else
+        uint32_t receivedCount = 0;
+        for (; receivedCount < count; ++receivedCount)
+        {
+            ReceiveBatchEntry& entry = entries[receivedCount];
+            entry.m_receivedBytes = Receive(entry.m_address, entry.m_data, entry.m_size);
+            if (entry.m_receivedBytes <= 0)
             {
-                if (ignoreForciblyClosedError)
-                {
-                    return 0;
-                }
-                else
-                {
-                    return SocketOpResultError;
-                }
+                break;
             }
+        }
+        return receivedCount;
+#endif
+    }
 
-            AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+    void UdpSocket::SetSendBatching(bool enabled)
+    {
+        if (enabled == IsSendBatching())
+        {
+            return;
         }
 
-        if (receivedBytes <= 0)
+        if (enabled)
         {
-            return 0;
+            m_sendBatch = AZStd::make_unique<SendBatch>();
         }
+        else
+        {
+            FlushSendBatch();
+            m_sendBatch.reset();
+        }
+    }
 
-        m_recvPackets++;
-        m_recvBytes += receivedBytes;
-        return receivedBytes;
+    void UdpSocket::FlushSendBatch() const
+    {
+        if (m_sendBatch != nullptr)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatch->m_mutex);
+            FlushSendBatchInternal();
+        }
     }
 
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
-        sockaddr_in destAddr;
-        memset(&destAddr, 0, sizeof(destAddr));
-        destAddr.sin_family = AF_INET;
-        destAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
-        destAddr.sin_port = address.GetPort(ByteOrder::Network);
-        return static_cast<int32_t>(sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr)));
+        if (m_sendBatch != nullptr)
+        {
+            return QueueSend(address, data, size);
+        }
+        return SendTo(m_socketFd, address, data, size);
+    }
+
+    int32_t UdpSocket::QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const
+    {
+        if (size > MaxUdpTransmissionUnit)
+        {
+            // Oversized payloads don't fit in a batch slot, send them immediately
+            return SendTo(m_socketFd, address, data, size);
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatch->m_mutex);
+        if (m_sendBatch->m_sends.full())
+        {
+            FlushSendBatchInternal();
+            if (m_sendBatch->m_sends.full())
+            {
+                // The socket couldn't accept any queued payloads, drop this one just as a would block error drops an unbatched send
+                m_sendFailures++;
+                return SocketOpResultSuccess;
+            }
+        }
+
+        const uint32_t offset = aznumeric_cast<uint32_t>(m_sendBatch->m_sends.size()) * MaxUdpTransmissionUnit;
+        memcpy(m_sendBatch->m_data + offset, data, size);
+        m_sendBatch->m_sends.push_back(SendBatch::PendingSend{ address, offset, size });
+        return static_cast<int32_t>(size);
+    }
+
+    void UdpSocket::FlushSendBatchInternal() const
+    {
+        auto& sends = m_sendBatch->m_sends;
+        if (sends.empty() || !IsOpen())
+        {
+            m_sendFailures += aznumeric_cast<uint32_t>(sends.size());
+            sends.clear();
+            return;
+        }
+
+        // Index of the first payload the socket couldn't accept without blocking, those are kept queued for the next flush
+        uint32_t firstUnsent = aznumeric_cast<uint32_t>(sends.size());
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        mmsghdr messages[MaxBatchedDatagrams];
+        iovec buffers[MaxBatchedDatagrams];
+        sockaddr_in destAddrs[MaxBatchedDatagrams];
+        alignas(cmsghdr) uint8_t controls[MaxBatchedDatagrams][CMSG_SPACE(sizeof(uint16_t))];
+        uint32_t firstSends[MaxBatchedDatagrams];
+        uint32_t messageCount = 0;
+
+        memset(messages, 0, sizeof(messages));
+        for (uint32_t sendIndex = 0; sendIndex < sends.size();)
+        {
+            const SendBatch::PendingSend& first = sends[sendIndex];
+
+            // Consecutive packets to the same address can be coalesced into a single segmented send, as long as all but the
+            // last segment are the same size as the first
+            uint32_t segmentCount = 1;
+            uint32_t totalSize = first.m_size;
+            while (m_segmentationOffload && (sendIndex + segmentCount < sends.size()))
+            {
+                const SendBatch::PendingSend& next = sends[sendIndex + segmentCount];
+                if ((next.m_address != first.m_address) || (next.m_size > first.m_size)
+                 || (sends[sendIndex + segmentCount - 1].m_size != first.m_size)
+                 || (totalSize + next.m_size > MaxSegmentedPayloadSize))
+                {
+                    break;
+                }
+                totalSize += next.m_size;
+                ++segmentCount;
+            }
+
+            for (uint32_t i = sendIndex; i < sendIndex + segmentCount; ++i)
+            {
+                buffers[i].iov_base = m_sendBatch->m_data + sends[i].m_offset;
+                buffers[i].iov_len = sends[i].m_size;
+            }
+
+            sockaddr_in& destAddr = destAddrs[messageCount];
+            memset(&destAddr, 0, sizeof(destAddr));
+            destAddr.sin_family = AF_INET;
+            destAddr.sin_addr.s_addr = first.m_address.GetAddress(ByteOrder::Network);
+            destAddr.sin_port = first.m_address.GetPort(ByteOrder::Network);
+
+            msghdr& message = messages[messageCount].msg_hdr;
+            message.msg_name = &destAddr;
+            message.msg_namelen = sizeof(destAddr);
+            message.msg_iov = &buffers[sendIndex];
+            message.msg_iovlen = segmentCount;
+            if (segmentCount > 1)
+            {
+                message.msg_control = controls[messageCount];
+                message.msg_controllen = sizeof(controls[messageCount]);
+                cmsghdr* control = CMSG_FIRSTHDR(&message);
+                control->cmsg_level = SOL_UDP;
+                control->cmsg_type = UDP_SEGMENT;
+                control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                const uint16_t segmentSize = aznumeric_cast<uint16_t>(first.m_size);
+                memcpy(CMSG_DATA(control), &segmentSize, sizeof(segmentSize));
+            }
+
+            firstSends[messageCount] = sendIndex;
+            ++messageCount;
+            sendIndex += segmentCount;
+        }
+
+        uint32_t sentMessages = 0;
+        while (sentMessages < messageCount)
+        {
+            const int32_t result = ::sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentMessages, messageCount - sentMessages, 0);
+            m_sentBatches++;
+            if (result > 0)
+            {
+                sentMessages += static_cast<uint32_t>(result);
+                continue;
+            }
+
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error))
+            {
+                firstUnsent = firstSends[sentMessages];
+                break;
+            }
+
+            const msghdr& failedMessage = messages[sentMessages].msg_hdr;
+            if (failedMessage.msg_controllen > 0)
+            {
+                // Segmentation offload can fail on some devices despite being supported by the kernel, send the segments individually instead
+                AZLOG_WARN("Segmented send failed, disabling UDP segmentation offload (%d:%s)", error, GetNetworkErrorDesc(error));
+                m_segmentationOffload = false;
+                for (uint32_t i = 0; i < failedMessage.msg_iovlen; ++i)
+                {
+                    const SendBatch::PendingSend& pending = sends[firstSends[sentMessages] + i];
+                    if (SendTo(m_socketFd, pending.m_address, m_sendBatch->m_data + pending.m_offset, pending.m_size) < 0)
+                    {
+                        m_sendFailures++;
+                        HandleSendError();
+                    }
+                }
+            }
+            else
+            {
+                m_sendFailures++;
+                AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
+
+            // Skip the failed message and carry on with the rest of the batch
+            ++sentMessages;
+        }
+#else
+        for (uint32_t sendIndex = 0; sendIndex < sends.size(); ++sendIndex)
+        {
+            const SendBatch::PendingSend& pending = sends[sendIndex];
+            m_sentBatches++;
+            if (SendTo(m_socketFd, pending.m_address, m_sendBatch->m_data + pending.m_offset, pending.m_size) < 0)
+            {
+                if (ErrorIsWouldBlock(GetLastNetworkError()))
+                {
+                    firstUnsent = sendIndex;
+                    break;
+                }
+                m_sendFailures++;
+                HandleSendError();
+            }
+        }
+#endif
+
+        // Move the unsent payloads to the front of the queue, keeping each in the data slot matching its index
+        const uint32_t unsentCount = aznumeric_cast<uint32_t>(sends.size()) - firstUnsent;
+        for (uint32_t i = 0; i < unsentCount; ++i)
+        {
+            const SendBatch::PendingSend pending = sends[firstUnsent + i];
+            const uint32_t offset = i * MaxUdpTransmissionUnit;
+            memmove(m_sendBatch->m_data + offset, m_sendBatch->m_data + pending.m_offset, pending.m_size);
+            sends[i] = SendBatch::PendingSend{ pending.m_address, offset, pending.m_size };
+        }
+        sends.resize(unsentCount);
     }
 
 #ifdef ENABLE_LATENCY_DEBUG
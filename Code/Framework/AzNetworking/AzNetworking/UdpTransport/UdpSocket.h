@@ -14,6 +14,8 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +44,18 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! The maximum number of datagrams read or written by a single batched socket operation.
+        static constexpr uint32_t MaxBatchedDatagrams = 64;
+
+        //! A single datagram read by ReceiveBatch.
+        struct ReceiveBatchEntry
+        {
+            IpAddress m_address;
+            uint8_t*  m_data = nullptr;
+            uint32_t  m_size = 0;
+            int32_t   m_receivedBytes = 0;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -72,6 +86,10 @@ namespace AzNetworking
         //! Closes an open socket.
         virtual void Close();
 
+        //! Sets whether the socket shares its port with other sockets opened with port reuse, takes effect on the next call to Open.
+        //! @param reusePort if true, the socket will be opened with port reuse enabled, \see SetSocketReusePort
+        void SetReusePort(bool reusePort);
+
         //! Returns true if the UDP socket is currently in an open state.
         //! @return boolean true if the socket is in a connected state
         bool IsOpen() const;
@@ -93,6 +111,25 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to count payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param entries the entries to receive into, m_data and m_size describe the output buffer for each payload
+        //! @param count   the number of entries available, at most MaxBatchedDatagrams are received per call
+        //! @return number of entries received into, in order, 0 if no data was pending or on error
+        uint32_t ReceiveBatch(ReceiveBatchEntry* entries, uint32_t count) const;
+
+        //! Enables or disables send batching. While enabled, Send queues payloads, which are transmitted by FlushSendBatch
+        //! or once the queue is full, using as few system calls as the platform allows.
+        //! @param enabled if true Send will queue payloads, if false any queued payloads are flushed and Send transmits immediately
+        void SetSendBatching(bool enabled);
+
+        //! Returns true if send batching is enabled.
+        //! @return boolean true if send batching is enabled
+        bool IsSendBatching() const;
+
+        //! Transmits all payloads queued while send batching is enabled, safe to call from any thread.
+        //! Payloads the socket can't accept without blocking stay queued and are retried by the next flush.
+        void FlushSendBatch() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -113,6 +150,14 @@ namespace AzNetworking
         //! @return the total number of additional bytes sent on this socket due to SSL encryption
         uint32_t GetSentBytesEncryptionInflation() const;
 
+        //! Returns the total number of system calls made to transmit queued batches on this socket.
+        //! @return the total number of system calls made to transmit queued batches on this socket
+        uint32_t GetSentBatches() const;
+
+        //! Returns the total number of packets that could not be written to this socket and were dropped.
+        //! @return the total number of packets that could not be written to this socket and were dropped
+        uint32_t GetSendFailures() const;
+
         //! Returns the total number of packets received on this socket.
         //! @return the total number of packets received on this socket
         uint32_t GetRecvPackets() const;
@@ -130,9 +175,37 @@ namespace AzNetworking
 
     private:
 
+        //! Queues a payload for transmission by FlushSendBatch, flushing first if the queue is full.
+        //! The payload is dropped and counted as a send failure if the queue is still full after flushing.
+        int32_t QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        //! Transmits the queued payloads, the caller must hold m_sendBatch->m_mutex.
+        //! Payloads that would block are moved to the front of the queue to be retried by the next flush.
+        void FlushSendBatchInternal() const;
+
+        //! Payloads queued for transmission while send batching is enabled.
+        struct SendBatch
+        {
+            struct PendingSend
+            {
+                IpAddress m_address;
+                uint32_t  m_offset = 0;
+                uint32_t  m_size = 0;
+            };
+
+            AZStd::mutex m_mutex;
+            AZStd::fixed_vector<PendingSend, MaxBatchedDatagrams> m_sends;
+            uint8_t m_data[MaxBatchedDatagrams * MaxUdpTransmissionUnit];
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        AZStd::unique_ptr<SendBatch> m_sendBatch;
+        bool m_reusePort = false;
+        mutable bool m_segmentationOffload = false;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
+        mutable uint32_t m_sentBatches = 0;
+        mutable uint32_t m_sendFailures = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
@@ -15,6 +15,11 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline void UdpSocket::SetReusePort(bool reusePort)
+    {
+        m_reusePort = reusePort;
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
@@ -40,6 +45,21 @@ namespace AzNetworking
         return m_sentBytesEncryptionInflation;
     }
 
+    inline bool UdpSocket::IsSendBatching() const
+    {
+        return m_sendBatch != nullptr;
+    }
+
+    inline uint32_t UdpSocket::GetSentBatches() const
+    {
+        return m_sentBatches;
+    }
+
+    inline uint32_t UdpSocket::GetSendFailures() const
+    {
+        return m_sendFailures;
+    }
+
     inline uint32_t UdpSocket::GetRecvPackets() const
     {
         return m_recvPackets;
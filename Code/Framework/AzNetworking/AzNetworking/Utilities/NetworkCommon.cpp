@@ -90,6 +90,68 @@ namespace AzNetworking
         return true;
     }
 
+    bool SetSocketReusePort([[maybe_unused]] SocketFd socketFd)
+    {
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        int flag = 1;
+
+        if (setsockopt(int32_t(socketFd), SOL_SOCKET, SO_REUSEPORT, (const char *)&flag, sizeof(flag)) != SocketOpResultSuccess)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_ERROR("Failed to enable port reuse for socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return false;
+        }
+
+        return true;
+#else
+        AZLOG_ERROR("Port reuse is not supported on this platform");
+        return false;
+#endif
+    }
+
+    // Multiplier used to mix the remote address and port before selecting a socket
+    static constexpr uint32_t ReusePortHashMultiplier = 0x9E3779B1;
+
+    bool SetSocketReusePortSteering([[maybe_unused]] SocketFd socketFd, [[maybe_unused]] uint32_t socketCount)
+    {
+#if AZ_TRAIT_USE_SOCKET_REUSEPORT
+        // Classic BPF equivalent of GetReusePortSocketIndex, run by the kernel on every incoming datagram.
+        // The source port is read assuming an IPv4 header without options, which is consistent for any given sender
+        constexpr uint32_t SourceAddressOffset = static_cast<uint32_t>(SKF_NET_OFF + 12);
+        constexpr uint32_t SourcePortOffset = static_cast<uint32_t>(SKF_NET_OFF + 20);
+        sock_filter program[] =
+        {
+            BPF_STMT(BPF_LD | BPF_W | BPF_ABS, SourceAddressOffset), // A = source address
+            BPF_STMT(BPF_MISC | BPF_TAX, 0),                         // X = A
+            BPF_STMT(BPF_LD | BPF_H | BPF_ABS, SourcePortOffset),    // A = source port
+            BPF_STMT(BPF_ALU | BPF_XOR | BPF_X, 0),                  // A ^= X
+            BPF_STMT(BPF_ALU | BPF_MUL | BPF_K, ReusePortHashMultiplier),
+            BPF_STMT(BPF_ALU | BPF_RSH | BPF_K, 16),
+            BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, socketCount),
+            BPF_STMT(BPF_RET | BPF_A, 0)                             // Return the index of the socket to receive on
+        };
+        sock_fprog programDesc;
+        programDesc.len = aznumeric_cast<unsigned short>(sizeof(program) / sizeof(program[0]));
+        programDesc.filter = program;
+
+        if (setsockopt(int32_t(socketFd), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &programDesc, sizeof(programDesc)) != SocketOpResultSuccess)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_WARN("Failed to attach port reuse steering program for socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return false;
+        }
+
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    uint32_t GetReusePortSocketIndex(uint32_t address, uint16_t port, uint32_t socketCount)
+    {
+        return (((address ^ port) * ReusePortHashMultiplier) >> 16) % socketCount;
+    }
+
     void CloseSocket(SocketFd socketFd)
     {
         if (int32_t(socketFd) <= 0)
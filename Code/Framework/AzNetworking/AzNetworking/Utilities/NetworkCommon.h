@@ -82,6 +82,26 @@ namespace AzNetworking
     //! @return boolean true on success
     bool SetSocketBufferSizes(SocketFd socketFd, int32_t sendSize, int32_t recvSize);
 
+    //! Allows multiple sockets to bind to the same port, incoming datagrams are distributed between them.
+    //! Must be called before binding the socket, only supported on platforms with AZ_TRAIT_USE_SOCKET_REUSEPORT.
+    //! @param socketFd identifier of the socket to enable port reuse for
+    //! @return boolean true on success
+    bool SetSocketReusePort(SocketFd socketFd);
+
+    //! Steers incoming datagrams between the sockets sharing a port, so that each remote address is always received by the
+    //! socket at GetReusePortSocketIndex. Sockets are indexed in the order they were bound.
+    //! @param socketFd    identifier of any bound socket sharing the port
+    //! @param socketCount the number of sockets sharing the port
+    //! @return boolean true on success
+    bool SetSocketReusePortSteering(SocketFd socketFd, uint32_t socketCount);
+
+    //! Returns the index of the socket that receives datagrams from the provided remote address, \see SetSocketReusePortSteering.
+    //! @param address     remote IPv4 address in host byte order
+    //! @param port        remote port in host byte order
+    //! @param socketCount the number of sockets sharing the port
+    //! @return the index of the socket that receives datagrams from the provided remote address
+    uint32_t GetReusePortSocketIndex(uint32_t address, uint16_t port, uint32_t socketCount);
+
     //! Closes the provided socket.
     //! @param socketFd identifier of socket to close
     void CloseSocket(SocketFd socketFd);
@@ -9,3 +9,12 @@
 #pragma once
 
 #include <UnixLike/AzNetworking/Utilities/NetworkIncludes_UnixLike.h>
+
+#include <linux/filter.h>
+#include <netinet/udp.h>
+#include <sys/uio.h>
+
+// UDP generic segmentation offload, only defined by the kernel headers since Linux 4.18
+#ifndef UDP_SEGMENT
+#   define UDP_SEGMENT 103
+#endif
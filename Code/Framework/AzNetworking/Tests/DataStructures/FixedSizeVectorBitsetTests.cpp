@@ -11,4 +11,28 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitsetTests, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.Resize(20);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.Resize(20);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(17, true);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.SetBit(17, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        // Bits beyond the current size are dropped on resize and don't affect equality
+        lhs.SetBit(19, true);
+        lhs.Resize(18);
+        rhs.Resize(18);
+        EXPECT_TRUE(lhs == rhs);
+    }
 }
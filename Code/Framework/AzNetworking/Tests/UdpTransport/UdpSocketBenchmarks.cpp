@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Measures loopback throughput of a single thread sending and receiving on a pair of UDP sockets.
+    //! Arguments are the number of packets sent per tick and whether the sockets use batched sends and receives.
+    class UdpSocketBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint16_t ReceiverPort = 12350;
+        static constexpr uint16_t SenderPort = 12351;
+        static constexpr uint32_t PayloadSize = 512;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SocketLayerInit();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_receiver->Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_sender->Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            SetUp(static_cast<const benchmark::State&>(state));
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_sender.reset();
+            m_receiver.reset();
+            SocketLayerShutdown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            TearDown(static_cast<const benchmark::State&>(state));
+        }
+
+        void SendAndReceive(benchmark::State& state)
+        {
+            if (!m_receiver->IsOpen() || !m_sender->IsOpen())
+            {
+                state.SkipWithError("Failed to open loopback sockets");
+                return;
+            }
+
+            const uint32_t packetsPerTick = aznumeric_cast<uint32_t>(state.range(0));
+            const bool batched = state.range(1) != 0;
+            m_sender->SetSendBatching(batched);
+
+            const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+            const uint8_t payload[PayloadSize] = {};
+            DtlsEndpoint dtlsEndpoint;
+            const ConnectionQuality connectionQuality;
+
+            AZStd::vector<uint8_t> receiveBuffer(UdpSocket::MaxBatchedDatagrams * MaxUdpTransmissionUnit);
+            UdpSocket::ReceiveBatchEntry entries[UdpSocket::MaxBatchedDatagrams];
+            for (uint32_t i = 0; i < UdpSocket::MaxBatchedDatagrams; ++i)
+            {
+                entries[i].m_data = receiveBuffer.data() + i * MaxUdpTransmissionUnit;
+                entries[i].m_size = MaxUdpTransmissionUnit;
+            }
+
+            int64_t receivedPackets = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (uint32_t i = 0; i < packetsPerTick; ++i)
+                {
+                    m_sender->Send(receiverAddress, payload, PayloadSize, false, dtlsEndpoint, connectionQuality);
+                }
+                m_sender->FlushSendBatch();
+
+                // Loopback delivery is synchronous, so everything that wasn't dropped is pending by now
+                for (;;)
+                {
+                    uint32_t receivedCount = 0;
+                    if (batched)
+                    {
+                        receivedCount = m_receiver->ReceiveBatch(entries, UdpSocket::MaxBatchedDatagrams);
+                    }
+                    else
+                    {
+                        receivedCount = (m_receiver->Receive(entries[0].m_address, entries[0].m_data, entries[0].m_size) > 0) ? 1 : 0;
+                    }
+
+                    if (receivedCount == 0)
+                    {
+                        break;
+                    }
+                    receivedPackets += receivedCount;
+                }
+            }
+
+            state.SetItemsProcessed(receivedPackets);
+            state.counters["PacketsPerSecond"] = benchmark::Counter(aznumeric_cast<double>(receivedPackets), benchmark::Counter::kIsRate);
+            state.counters["SendSyscallsPerTick"] = batched
+                ? aznumeric_cast<double>(m_sender->GetSentBatches()) / aznumeric_cast<double>(state.iterations())
+                : aznumeric_cast<double>(packetsPerTick);
+        }
+
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<UdpSocket> m_sender;
+    };
+
+    BENCHMARK_DEFINE_F(UdpSocketBenchmarkFixture, LoopbackSendReceive)(benchmark::State& state)
+    {
+        SendAndReceive(state);
+    }
+    BENCHMARK_REGISTER_F(UdpSocketBenchmarkFixture, LoopbackSendReceive)
+        ->ArgNames({ "PacketsPerTick", "Batched" })
+        ->Args({ 16, 0 })
+        ->Args({ 16, 1 })
+        ->Args({ 128, 0 })
+        ->Args({ 128, 1 })
+        ->Args({ 512, 0 })
+        ->Args({ 512, 1 })
+        ->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif
@@ -9,9 +9,13 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystem.h>
@@ -80,9 +84,10 @@ namespace UnitTest
     class TestUdpServer
     {
     public:
-        TestUdpServer()
+        TestUdpServer(uint32_t readerShardCount = 1)
         {
             m_serverNetworkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_name, ProtocolType::Udp, TrustZone::ExternalClientToServer, m_connectionListener);
+            static_cast<UdpNetworkInterface*>(m_serverNetworkInterface)->SetReaderShardCount(readerShardCount);
             m_serverNetworkInterface->Listen(12345);
         }
 
@@ -320,4 +325,303 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestReaderThreadDecodesReceivedPackets)
+    {
+        constexpr uint16_t ReceiverPort = 12352;
+        constexpr uint16_t SenderPort = 12353;
+        constexpr uint8_t EncodedMarker = 0xFF;
+
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sender.Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        // Stands in for DTLS decryption, packets starting with the marker are decoded in place by dropping it
+        const AZStd::thread_id mainThreadId = AZStd::this_thread::get_id();
+        AZStd::atomic_bool decodedOnMainThread{ false };
+        UdpReaderThread readerThread;
+        readerThread.RegisterSocket(&receiver, [&](const IpAddress&, uint8_t* data, int32_t receivedBytes, int32_t& outDecodedSize)
+        {
+            decodedOnMainThread |= (AZStd::this_thread::get_id() == mainThreadId);
+            if (data[0] != EncodedMarker)
+            {
+                return false;
+            }
+            memmove(data, data + 1, receivedBytes - 1);
+            outDecodedSize = receivedBytes - 1;
+            return true;
+        });
+        readerThread.SwapBuffers();
+
+        const uint8_t encodedPacket[] = { EncodedMarker, 1, 2, 3 };
+        const uint8_t plainPacket[] = { 4, 5, 6 };
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        sender.Send(receiverAddress, encodedPacket, sizeof(encodedPacket), false, dtlsEndpoint, connectionQuality);
+        sender.Send(receiverAddress, plainPacket, sizeof(plainPacket), false, dtlsEndpoint, connectionQuality);
+
+        AZStd::vector<UdpReaderThread::ReceivedPacket> receivedPackets;
+        AZStd::vector<AZStd::vector<uint8_t>> receivedData;
+        for (uint32_t attempt = 0; (attempt < 100) && (receivedPackets.size() < 2); ++attempt)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+            readerThread.SwapBuffers();
+            if (const UdpReaderThread::ReceivedPackets* packets = readerThread.GetReceivedPackets(&receiver))
+            {
+                for (const UdpReaderThread::ReceivedPacket& packet : *packets)
+                {
+                    receivedPackets.push_back(packet);
+                    const int32_t size = packet.m_isDecoded ? packet.m_decodedBytes : packet.m_receivedBytes;
+                    receivedData.emplace_back(packet.m_buffer, packet.m_buffer + size);
+                }
+            }
+        }
+        readerThread.UnregisterSocket(&receiver);
+
+        ASSERT_EQ(receivedPackets.size(), 2);
+        EXPECT_FALSE(decodedOnMainThread);
+
+        EXPECT_TRUE(receivedPackets[0].m_isDecoded);
+        EXPECT_EQ(receivedPackets[0].m_receivedBytes, sizeof(encodedPacket));
+        EXPECT_EQ(receivedData[0], AZStd::vector<uint8_t>({ 1, 2, 3 }));
+
+        // Packets the decoder declines are left for the thread processing them
+        EXPECT_FALSE(receivedPackets[1].m_isDecoded);
+        EXPECT_EQ(receivedData[1], AZStd::vector<uint8_t>({ 4, 5, 6 }));
+    }
+
+    //! Receives everything pending on the socket, loopback delivery is synchronous so nothing sent beforehand is still in flight.
+    static AZStd::vector<AZStd::vector<uint8_t>> ReceiveAllPending(const UdpSocket& socket, uint16_t expectedPort)
+    {
+        AZStd::vector<uint8_t> receiveBuffer(UdpSocket::MaxBatchedDatagrams * MaxUdpTransmissionUnit);
+        UdpSocket::ReceiveBatchEntry entries[UdpSocket::MaxBatchedDatagrams];
+        for (uint32_t i = 0; i < UdpSocket::MaxBatchedDatagrams; ++i)
+        {
+            entries[i].m_data = receiveBuffer.data() + i * MaxUdpTransmissionUnit;
+            entries[i].m_size = MaxUdpTransmissionUnit;
+        }
+
+        AZStd::vector<AZStd::vector<uint8_t>> receivedData;
+        for (uint32_t receivedCount = socket.ReceiveBatch(entries, UdpSocket::MaxBatchedDatagrams); receivedCount > 0;
+            receivedCount = socket.ReceiveBatch(entries, UdpSocket::MaxBatchedDatagrams))
+        {
+            for (uint32_t i = 0; i < receivedCount; ++i)
+            {
+                EXPECT_EQ(entries[i].m_address.GetPort(ByteOrder::Host), expectedPort);
+                receivedData.emplace_back(entries[i].m_data, entries[i].m_data + entries[i].m_receivedBytes);
+            }
+        }
+        return receivedData;
+    }
+
+    TEST_F(UdpTransportTests, TestReceiveBatch)
+    {
+        constexpr uint16_t ReceiverPort = 12354;
+        constexpr uint16_t SenderPort = 12355;
+        constexpr uint32_t NumPackets = UdpSocket::MaxBatchedDatagrams + 4;
+
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sender.Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(ReceiveAllPending(receiver, SenderPort).empty());
+
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        for (uint32_t i = 0; i < NumPackets; ++i)
+        {
+            // Vary the size so that entries can't be mixed up
+            const uint8_t packet[] = { aznumeric_cast<uint8_t>(i), 1, 2, 3 };
+            sender.Send(receiverAddress, packet, 1 + i % sizeof(packet), false, dtlsEndpoint, connectionQuality);
+        }
+
+        // More packets than fit in a single batch are pending, so this takes more than one call
+        const AZStd::vector<AZStd::vector<uint8_t>> receivedData = ReceiveAllPending(receiver, SenderPort);
+        ASSERT_EQ(receivedData.size(), NumPackets);
+        for (uint32_t i = 0; i < NumPackets; ++i)
+        {
+            ASSERT_EQ(receivedData[i].size(), 1 + i % 4);
+            EXPECT_EQ(receivedData[i][0], aznumeric_cast<uint8_t>(i));
+        }
+        EXPECT_EQ(receiver.GetRecvPackets(), NumPackets);
+    }
+
+    TEST_F(UdpTransportTests, TestSendBatchFlushOrdering)
+    {
+        constexpr uint16_t ReceiverPort = 12356;
+        constexpr uint16_t SenderPort = 12357;
+        constexpr uint32_t NumPackets = UdpSocket::MaxBatchedDatagrams / 2;
+
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sender.Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        sender.SetSendBatching(true);
+
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        for (uint32_t i = 0; i < NumPackets; ++i)
+        {
+            // Alternate sizes so that runs of equal sized packets are both segmented and sent individually
+            const uint8_t packet[] = { aznumeric_cast<uint8_t>(i), 1, 2, 3 };
+            sender.Send(receiverAddress, packet, (i % 3 == 2) ? 2 : sizeof(packet), false, dtlsEndpoint, connectionQuality);
+        }
+
+        // Nothing is transmitted until the batch is flushed
+        EXPECT_TRUE(ReceiveAllPending(receiver, SenderPort).empty());
+        sender.FlushSendBatch();
+
+        const AZStd::vector<AZStd::vector<uint8_t>> receivedData = ReceiveAllPending(receiver, SenderPort);
+        ASSERT_EQ(receivedData.size(), NumPackets);
+        for (uint32_t i = 0; i < NumPackets; ++i)
+        {
+            EXPECT_EQ(receivedData[i][0], aznumeric_cast<uint8_t>(i));
+        }
+        EXPECT_EQ(sender.GetSendFailures(), 0);
+
+        // A second flush has nothing left to send
+        sender.FlushSendBatch();
+        EXPECT_TRUE(ReceiveAllPending(receiver, SenderPort).empty());
+    }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO && defined(SO_NO_CHECK)
+    TEST_F(UdpTransportTests, TestSegmentationOffloadFallback)
+    {
+        constexpr uint16_t ReceiverPort = 12358;
+        constexpr uint16_t SenderPort = 12359;
+        constexpr uint32_t NumPackets = 8;
+
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sender.Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        sender.SetSendBatching(true);
+
+        // The kernel rejects segmented sends on sockets with checksums disabled, the same way devices without support do
+        const int32_t noCheck = 1;
+        ASSERT_EQ(::setsockopt(static_cast<int32_t>(sender.GetSocketFd()), SOL_SOCKET, SO_NO_CHECK, &noCheck, sizeof(noCheck)), 0);
+
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        for (uint32_t flush = 0; flush < 2; ++flush)
+        {
+            // Equal sized packets to the same address would all be coalesced into a single segmented send
+            for (uint32_t i = 0; i < NumPackets; ++i)
+            {
+                const uint8_t packet[] = { aznumeric_cast<uint8_t>(i), 1, 2, 3 };
+                sender.Send(receiverAddress, packet, sizeof(packet), false, dtlsEndpoint, connectionQuality);
+            }
+            sender.FlushSendBatch();
+
+            // The first flush falls back to individual sends, the second doesn't attempt segmentation at all
+            const AZStd::vector<AZStd::vector<uint8_t>> receivedData = ReceiveAllPending(receiver, SenderPort);
+            ASSERT_EQ(receivedData.size(), NumPackets);
+            for (uint32_t i = 0; i < NumPackets; ++i)
+            {
+                EXPECT_EQ(receivedData[i], AZStd::vector<uint8_t>({ aznumeric_cast<uint8_t>(i), 1, 2, 3 }));
+            }
+        }
+        EXPECT_EQ(sender.GetSendFailures(), 0);
+    }
+#endif
+
+    TEST_F(UdpTransportTests, TestTickFlushesSendBatches)
+    {
+        constexpr uint16_t ReceiverPort = 12360;
+        constexpr uint16_t SenderPort = 12361;
+
+        AZ::Console console;
+        console.LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        AZ::Interface<AZ::IConsole>::Register(&console);
+        console.PerformCommand("net_UdpBatchSends true");
+
+        UdpSocket receiver;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        {
+            const AZ::Name name = AZ::Name(AZStd::string_view("UdpBatchedClient"));
+            TestUdpConnectionListener connectionListener;
+            INetworkInterface* clientInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(name, ProtocolType::Udp, TrustZone::ExternalClientToServer, connectionListener);
+            clientInterface->Connect(IpAddress(127, 0, 0, 1, ReceiverPort), SenderPort);
+
+            // Packets queued by game tick handlers go out at the end of the same frame, not at the next system tick
+            m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            EXPECT_FALSE(ReceiveAllPending(receiver, SenderPort).empty());
+
+            AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(name);
+        }
+
+        console.PerformCommand("net_UdpBatchSends false");
+        AZ::Interface<AZ::IConsole>::Unregister(&console);
+    }
+
+    TEST_F(UdpTransportTests, TestShardedReadersManyClients)
+    {
+        constexpr uint32_t NumReaderShards = 4;
+        constexpr uint32_t NumTestClients = 200;
+        constexpr uint32_t NumLoadTicks = 10;
+        constexpr uint32_t PacketsPerClientPerTick = 4;
+
+        TestUdpServer testServer(NumReaderShards);
+        UdpNetworkInterface* serverInterface = static_cast<UdpNetworkInterface*>(testServer.m_serverNetworkInterface);
+        EXPECT_EQ(serverInterface->GetReaderShardCount(), AZ_TRAIT_USE_SOCKET_REUSEPORT ? NumReaderShards : 1);
+
+        AZStd::unique_ptr<TestUdpClient[]> testClient = AZStd::make_unique<TestUdpClient[]>(NumTestClients);
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 10000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+            bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+            bool canTerminate = serverInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                canTerminate &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+            }
+            if (canTerminate || timeExpired)
+            {
+                break;
+            }
+        }
+
+        EXPECT_EQ(serverInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+        for (uint32_t i = 0; i < NumTestClients; ++i)
+        {
+            EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+        }
+
+        // Every client sends a burst of packets each tick, all of which have to be merged from the shards by the server
+        const uint64_t recvPacketsBeforeLoad = serverInterface->GetMetrics().m_recvPackets;
+        auto sendHeartbeats = [](IConnection& connection)
+        {
+            for (uint32_t i = 0; i < PacketsPerClientPerTick; ++i)
+            {
+                connection.SendUnreliablePacket(CorePackets::HeartbeatPacket(false));
+            }
+        };
+        for (uint32_t tick = 0; tick < NumLoadTicks; ++tick)
+        {
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                testClient[i].m_clientNetworkInterface->GetConnectionSet().VisitConnections(sendHeartbeats);
+            }
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+        }
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+        m_networkingSystemComponent->OnSystemTick();
+
+        EXPECT_GE(serverInterface->GetMetrics().m_recvPackets - recvPacketsBeforeLoad, NumTestClients * NumLoadTicks * PacketsPerClientPerTick);
+        EXPECT_EQ(serverInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+
+        EXPECT_TRUE(serverInterface->StopListening());
+        EXPECT_EQ(serverInterface->GetReaderShardCount(), 1);
+    }
 }
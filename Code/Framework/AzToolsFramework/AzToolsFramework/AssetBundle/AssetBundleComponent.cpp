@@ -8,12 +8,17 @@
 
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Compression/zstd_dictionary.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/FileIOStream.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -37,6 +42,15 @@ namespace AzToolsFramework
 
     constexpr int InjectFileRetryCount = 4;
 
+    // zstd needs a few hundred samples to train a useful dictionary. Asset types with fewer small files are compressed without one,
+    // and types with many are trained on a subset to bound the training time.
+    constexpr size_t ZStdDictionaryMinSampleCount = 100;
+    constexpr size_t ZStdDictionaryMaxSampleCount = 2000;
+
+    AZ_CVAR(bool, bundler_zstdDictionaries, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Train a zstd dictionary for every asset type with enough small files in a bundle, store the dictionaries next to the bundle "
+        "and compress the small files of those types with them. The dictionary file has to be shipped with the bundle.");
+
 
     bool MaxSizeExceeded(AZ::u64 totalFileSize, AZ::u64 bundleSize, AZ::u64 assetCatalogFileSizeBuffer, AZ::u64 maxSizeInBytes)
     {
@@ -57,6 +71,74 @@ namespace AzToolsFramework
         return true;
     }
 
+    //! Trains a zstd dictionary for every asset type in the list that has enough files small enough to benefit from one.
+    AZStd::shared_ptr<const AZ::ZStdDictionarySet> TrainZStdDictionaries(const AssetFileInfoList& assetFileInfoList, const AZStd::string& assetAlias)
+    {
+        AZStd::unordered_map<AZStd::string, AZStd::vector<AZStd::vector<AZ::u8>>> samplesByAssetType;
+        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        {
+            AZStd::string assetType(AZ::IO::PathView(assetFileInfo.m_assetRelativePath).Extension().Native());
+            AZStd::to_lower(assetType.begin(), assetType.end());
+            AZStd::vector<AZStd::vector<AZ::u8>>& samples = samplesByAssetType[assetType];
+            if (assetType.empty() || samples.size() >= ZStdDictionaryMaxSampleCount)
+            {
+                continue;
+            }
+
+            AZStd::string fullAssetFilePath;
+            AzFramework::StringFunc::Path::Join(assetAlias.c_str(), assetFileInfo.m_assetRelativePath.c_str(), fullAssetFilePath);
+            auto readOutcome = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(fullAssetFilePath, AZ::ZStdDictionarySet::MaxFileSize);
+            if (readOutcome.IsSuccess() && !readOutcome.GetValue().empty())
+            {
+                samples.push_back(readOutcome.TakeValue());
+            }
+        }
+
+        auto dictionaries = AZStd::make_shared<AZ::ZStdDictionarySet>();
+        for (const auto& [assetType, files] : samplesByAssetType)
+        {
+            if (files.size() < ZStdDictionaryMinSampleCount)
+            {
+                continue;
+            }
+
+            AZStd::vector<AZStd::span<const AZ::u8>> samples(files.begin(), files.end());
+            if (auto trainOutcome = dictionaries->TrainDictionary(assetType, samples); trainOutcome.IsSuccess())
+            {
+                AZ_TracePrintf(logWindowName, "Trained a zstd dictionary for asset type (%s) from %zu files.\n", assetType.c_str(), files.size());
+            }
+            else
+            {
+                AZ_Warning(logWindowName, false, "%s Files of this type will be compressed without a dictionary.\n", trainOutcome.GetError().c_str());
+            }
+        }
+        return dictionaries;
+    }
+
+    //! Saves the dictionaries next to the bundle, where the archive picks them up when the bundle is opened.
+    bool SaveZStdDictionaries(const AZ::ZStdDictionarySet& dictionaries, const AZStd::string& bundleFilePath)
+    {
+        const AZ::IO::Path dictionaryPath = AZ::ZStdDictionarySet::GetDictionaryPath(bundleFilePath);
+        AZ::IO::FileIOStream fileStream(dictionaryPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!fileStream.IsOpen() || !dictionaries.Save(fileStream))
+        {
+            AZ_Error(logWindowName, false, "Failed to save the zstd dictionaries (%s) of the bundle (%s).\n", dictionaryPath.c_str(), bundleFilePath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    //! Removes the dictionaries stored next to a bundle that is being deleted, so they aren't picked up by a new bundle of the same name.
+    void RemoveZStdDictionaries(const AZStd::string& bundleFilePath)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        const AZ::IO::Path dictionaryPath = AZ::ZStdDictionarySet::GetDictionaryPath(bundleFilePath);
+        if (fileIO->Exists(dictionaryPath.c_str()) && !fileIO->Remove(dictionaryPath.c_str()))
+        {
+            AZ_Warning(logWindowName, false, "Failed to delete zstd dictionary file (%s)", dictionaryPath.c_str());
+        }
+    }
+
     //! This helper class can be used to create a temp folder from a filename.
     //! It strips the extension and than adds _temp token to the name and tries to create that directory on disk.
     struct TemporaryDir
@@ -292,6 +374,21 @@ namespace AzToolsFramework
             }
         }
 
+        // Every bundle gets the same dictionaries, which have to be in place before the first file is added to it.
+        AZStd::shared_ptr<const AZ::ZStdDictionarySet> zstdDictionaries;
+        if (bundler_zstdDictionaries)
+        {
+            zstdDictionaries = TrainZStdDictionaries(assetFileInfoList, assetAlias);
+            if (zstdDictionaries->GetDictionaryCount() == 0)
+            {
+                zstdDictionaries.reset();
+            }
+            else if (!SaveZStdDictionaries(*zstdDictionaries, tempBundleFilePath))
+            {
+                return false;
+            }
+        }
+
         for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
         {
             AZ::u64 fileSize = 0;
@@ -371,6 +468,11 @@ namespace AzToolsFramework
 
                 dependentBundleNames.emplace_back(dependentBundleFileName);
 
+                if (zstdDictionaries && !SaveZStdDictionaries(*zstdDictionaries, tempBundleFilePath))
+                {
+                    return false;
+                }
+
                 AZStd::string currentDeltaCatalogName = DeltaCatalogName;
                 AzFramework::StringFunc::Path::ConstructFull(bundleFolder.c_str(), currentDeltaCatalogName.c_str(), deltaCatalogFilePath, true);
                 bundlePathDeltaCatalogPair.emplace_back(AZStd::make_pair(tempBundleFilePath, currentDeltaCatalogName));
@@ -412,6 +514,17 @@ namespace AzToolsFramework
                     constexpr auto SleepDuration = AZStd::chrono::seconds(1);
                     AZStd::this_thread::sleep_for(SleepDuration);
                 }
+
+                if (zstdDictionaries)
+                {
+                    const AZ::IO::Path tempDictionaryPath = AZ::ZStdDictionarySet::GetDictionaryPath(bundlePathDeltaCatalogPair[idx].first);
+                    const AZ::IO::Path dictionaryPath = AZ::ZStdDictionarySet::GetDictionaryPath(destinationBundleFullPath);
+                    if (!fileIO->Rename(tempDictionaryPath.c_str(), dictionaryPath.c_str()))
+                    {
+                        AZ_Error(logWindowName, false, "Failed to rename temporary zstd dictionary file (%s) to (%s)", tempDictionaryPath.c_str(), dictionaryPath.c_str());
+                        return false;
+                    }
+                }
             }
         }
 
@@ -566,6 +679,7 @@ namespace AzToolsFramework
                 {
                     AZ_Warning(logWindowName, false, "Failed to delete dependent bundle file (%s)", dependentBundlesFilePath.c_str());
                 }
+                RemoveZStdDictionaries(dependentBundlesFilePath);
             }
 
         }
@@ -576,6 +690,7 @@ namespace AzToolsFramework
             AZ_Error(logWindowName, false, "Failed to delete bundle file (%s)", assetBundleFilePath.c_str());
             return false;
         }
+        RemoveZStdDictionaries(assetBundleFilePath);
 
         return true;
     }
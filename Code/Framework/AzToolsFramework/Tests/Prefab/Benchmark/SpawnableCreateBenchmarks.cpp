@@ -9,6 +9,9 @@
 
 #include <Prefab/Benchmark/PrefabBenchmarkFixture.h>
 
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzToolsFramework/Prefab/Spawnable/SpawnableUtils.h>
 
 namespace Benchmark
@@ -48,6 +51,92 @@ namespace Benchmark
         ->Range(100, 10000)
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
+
+    class BM_SpawnableClone : public BM_Prefab
+    {
+    protected:
+        void SetupHarness(const benchmark::State& state) override
+        {
+            BM_Prefab::SetupHarness(state);
+
+            const unsigned int numEntities = static_cast<unsigned int>(state.range());
+            AZStd::vector<AZ::Entity*> entities;
+            CreateEntities(numEntities, entities);
+            AZStd::unique_ptr<Instance> instance(m_prefabSystemComponent->CreatePrefab(entities, {}, m_pathString));
+
+            m_spawnable = AZStd::make_unique<AzFramework::Spawnable>();
+            SpawnableUtils::CreateSpawnable(*m_spawnable, m_prefabSystemComponent->FindTemplateDom(instance->GetTemplateId()));
+            AZ::ComponentApplicationBus::BroadcastResult(m_serializeContext, &AZ::ComponentApplicationRequests::GetSerializeContext);
+        }
+
+        void TeardownHarness(const benchmark::State& state) override
+        {
+            m_spawnable.reset();
+            BM_Prefab::TeardownHarness(state);
+        }
+
+        AZStd::unique_ptr<AzFramework::Spawnable> m_spawnable;
+        AZ::SerializeContext* m_serializeContext = nullptr;
+    };
+
+    // Clones all entities in a spawnable the way spawning did before clone plans were introduced.
+    BENCHMARK_DEFINE_F(BM_SpawnableClone, CloneEntities_SerializeContext)(::benchmark::State& state)
+    {
+        const AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::unordered_map<AZ::EntityId, AZ::EntityId> idMap;
+            AZStd::vector<AZStd::unique_ptr<AZ::Entity>> clones;
+            clones.reserve(prototypes.size());
+            for (const auto& prototype : prototypes)
+            {
+                clones.emplace_back(AZ::IdUtils::Remapper<AZ::EntityId>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                    prototype.get(), idMap, m_serializeContext));
+            }
+        }
+
+        state.SetComplexityN(m_spawnable->GetEntities().size());
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableClone, CloneEntities_SerializeContext)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_SpawnableClone, CloneEntities_ClonePlan)(::benchmark::State& state)
+    {
+        const AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        AZStd::vector<const AZ::Entity*> prototypePointers;
+        prototypePointers.reserve(prototypes.size());
+        for (const auto& prototype : prototypes)
+        {
+            prototypePointers.push_back(prototype.get());
+        }
+
+        AzFramework::ClonePlanCache clonePlanCache;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AzFramework::ClonePlanCache::EntityIdMap idMap;
+            for (const AZ::Entity* prototype : prototypePointers)
+            {
+                idMap.emplace(prototype->GetId(), AZ::Entity::MakeId());
+            }
+
+            AZStd::vector<AZ::Entity*> clones(prototypePointers.size(), nullptr);
+            clonePlanCache.CloneEntities(prototypePointers, clones, idMap, *m_serializeContext);
+            for (AZ::Entity* clone : clones)
+            {
+                delete clone;
+            }
+        }
+
+        state.SetComplexityN(m_spawnable->GetEntities().size());
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableClone, CloneEntities_ClonePlan)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
 }
 
 #endif
@@ -271,6 +271,18 @@ namespace Multiplayer
         return (networkEntityManager != nullptr) ? networkEntityManager->GetMultiplayerComponentRegistry() : nullptr;
     }
 
+    inline EntitySerializationCache* GetEntitySerializationCache()
+    {
+        INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+        return (networkEntityManager != nullptr) ? networkEntityManager->GetEntitySerializationCache() : nullptr;
+    }
+
+    inline InterestGrid* GetInterestGrid()
+    {
+        INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+        return (networkEntityManager != nullptr) ? networkEntityManager->GetInterestGrid() : nullptr;
+    }
+
     //! @class ScopedAlterTime
     //! @brief This is a wrapper that temporarily adjusts global program time for backward reconciliation purposes.
     class ScopedAlterTime final
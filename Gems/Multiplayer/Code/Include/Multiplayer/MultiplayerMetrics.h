@@ -40,5 +40,8 @@ namespace Multiplayer
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
+
+        // Replication stats
+        MultiplayerStat_SerializationCacheHitRate,  // Percentage of entity state payloads reused between connections
     };
 }
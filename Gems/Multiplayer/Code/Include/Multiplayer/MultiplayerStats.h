@@ -49,15 +49,36 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Entity state payloads that were copied from, or had to be serialized into, the serialization cache shared by all connections.
+        //! Calls count payloads and bytes count payload bytes.
+        Metric m_serializationCacheHits;
+        Metric m_serializationCacheMisses;
+
+        //! A property update recorded by RecordPropertySent.
+        struct PropertySent
+        {
+            NetComponentId m_netComponentId;
+            PropertyIndex m_propertyIndex;
+            uint32_t m_totalBytes;
+        };
+        using PropertySentList = AZStd::vector<PropertySent>;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
         void RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
+        //! Records a list of property updates captured with SetPropertySentCapture, as if they had been sent again.
+        void RecordPropertiesSent(const PropertySentList& propertiesSent);
+        //! While a capture list is set, RecordPropertySent calls made on the calling thread are also appended to it, so the property
+        //! updates of a serialized payload can be recorded again whenever the payload is reused instead of serialized.
+        //! @param captureList the list to append to, or nullptr to stop capturing
+        static void SetPropertySentCapture(PropertySentList* captureList);
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
+        void RecordSerializationCacheResults(uint64_t hitCount, uint64_t hitBytes, uint64_t missCount, uint64_t missBytes);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
@@ -69,6 +90,10 @@ namespace Multiplayer
         Metric CalculateTotalRpcsSentMetrics() const;
         Metric CalculateTotalRpcsRecvMetrics() const;
 
+        //! Returns the fraction of entity state payloads served from the serialization cache over the metric history window.
+        //! @return the hit rate in the range [0, 1], 0 if nothing was serialized
+        float CalculateSerializationCacheHitRate() const;
+
         struct Events
         {
             AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*> m_entitySerializeStart;
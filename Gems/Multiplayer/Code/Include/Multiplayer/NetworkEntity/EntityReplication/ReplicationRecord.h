@@ -55,6 +55,10 @@ namespace Multiplayer
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
 
+        //! Returns true if both records target the same remote role and flag exactly the same properties.
+        //! Records that compare equal here serialize an entity's state to identical payloads.
+        bool HasSameChanges(const ReplicationRecord& rhs) const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         void ConsumeAuthorityToClientBits(uint32_t consumedBits);
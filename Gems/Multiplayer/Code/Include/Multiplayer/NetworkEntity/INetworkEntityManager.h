@@ -19,6 +19,8 @@ namespace Multiplayer
 {
     class NetworkEntityTracker;
     class NetworkEntityAuthorityTracker;
+    class EntitySerializationCache;
+    class InterestGrid;
     class NetworkEntityRpcMessage;
     class MultiplayerComponentRegistry;
     class IEntityDomain;
@@ -64,6 +66,14 @@ namespace Multiplayer
         //! @return the MultiplayerComponentRegistry for this INetworkEntityManager instance
         virtual MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() = 0;
 
+        //! Returns the EntitySerializationCache shared by all connections of this INetworkEntityManager instance.
+        //! @return the EntitySerializationCache for this INetworkEntityManager instance, nullptr if serialization is not cached
+        virtual EntitySerializationCache* GetEntitySerializationCache() = 0;
+
+        //! Returns the InterestGrid client replication windows gather relevant entities from.
+        //! @return the InterestGrid for this INetworkEntityManager instance, nullptr if interest is not gathered from a grid
+        virtual InterestGrid* GetInterestGrid() = 0;
+
         //! Returns the HostId for this INetworkEntityManager instance.
         //! @return the HostId for this INetworkEntityManager instance
         virtual const HostId& GetHostId() const = 0;
@@ -109,6 +109,10 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total send failures");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_sendFailures));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total receive time (ms)");
                     ImGui::TableNextColumn();
                     ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
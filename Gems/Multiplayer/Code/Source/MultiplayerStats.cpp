@@ -12,6 +12,8 @@
 
 namespace Multiplayer
 {
+    static thread_local MultiplayerStats::PropertySentList* s_propertySentCapture = nullptr;
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -63,9 +65,27 @@ namespace Multiplayer
                 "Component ID %u has fewer than %u sent propertyIndex. Mismatch by caller suspected.", netComponentIndex, propertyIndex);
         }
 
+        if (s_propertySentCapture)
+        {
+            s_propertySentCapture->push_back({ netComponentId, propertyId, totalBytes });
+        }
+
         m_events.m_propertySent.Signal(netComponentId, propertyId, totalBytes);
     }
 
+    void MultiplayerStats::RecordPropertiesSent(const PropertySentList& propertiesSent)
+    {
+        for (const PropertySent& propertySent : propertiesSent)
+        {
+            RecordPropertySent(propertySent.m_netComponentId, propertySent.m_propertyIndex, propertySent.m_totalBytes);
+        }
+    }
+
+    void MultiplayerStats::SetPropertySentCapture(PropertySentList* captureList)
+    {
+        s_propertySentCapture = captureList;
+    }
+
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
@@ -134,6 +154,10 @@ namespace Multiplayer
 
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
         m_recordMetricIndex = ++m_recordMetricIndex % RingbufferSamples;
+        m_serializationCacheHits.m_callHistory[m_recordMetricIndex] = 0;
+        m_serializationCacheHits.m_byteHistory[m_recordMetricIndex] = 0;
+        m_serializationCacheMisses.m_callHistory[m_recordMetricIndex] = 0;
+        m_serializationCacheMisses.m_byteHistory[m_recordMetricIndex] = 0;
         for (ComponentStats& componentStats : m_componentStats)
         {
             for (Metric& metric : componentStats.m_propertyUpdatesSent)
@@ -248,6 +272,18 @@ namespace Multiplayer
         return result;
     }
 
+    float MultiplayerStats::CalculateSerializationCacheHitRate() const
+    {
+        uint64_t hitCount = 0;
+        uint64_t totalCount = 0;
+        for (uint32_t index = 0; index < RingbufferSamples; ++index)
+        {
+            hitCount += m_serializationCacheHits.m_callHistory[index];
+            totalCount += m_serializationCacheHits.m_callHistory[index] + m_serializationCacheMisses.m_callHistory[index];
+        }
+        return (totalCount > 0) ? aznumeric_cast<float>(hitCount) / aznumeric_cast<float>(totalCount) : 0.0f;
+    }
+
     void MultiplayerStats::ConnectHandlers(EventHandlers& handlers)
     {
         handlers.m_entitySerializeStart.Connect(m_events.m_entitySerializeStart);
@@ -263,4 +299,19 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
+
+    void MultiplayerStats::RecordSerializationCacheResults(uint64_t hitCount, uint64_t hitBytes, uint64_t missCount, uint64_t missBytes)
+    {
+        m_serializationCacheHits.m_totalCalls += hitCount;
+        m_serializationCacheHits.m_totalBytes += hitBytes;
+        m_serializationCacheHits.m_callHistory[m_recordMetricIndex] += hitCount;
+        m_serializationCacheHits.m_byteHistory[m_recordMetricIndex] += hitBytes;
+
+        m_serializationCacheMisses.m_totalCalls += missCount;
+        m_serializationCacheMisses.m_totalBytes += missBytes;
+        m_serializationCacheMisses.m_callHistory[m_recordMetricIndex] += missCount;
+        m_serializationCacheMisses.m_byteHistory[m_recordMetricIndex] += missBytes;
+
+        SET_PERFORMANCE_STAT(MultiplayerStat_SerializationCacheHitRate, CalculateSerializationCacheHitRate() * 100.0f);
+    }
 } // namespace Multiplayer
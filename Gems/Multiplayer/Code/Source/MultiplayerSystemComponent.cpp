@@ -132,6 +132,14 @@ namespace Multiplayer
         "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
+    AZ_CVAR(bool, sv_cacheEntitySerialization, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, clients that share an acknowledged baseline reuse the same serialized entity state each tick. "
+        "Reused payloads still report their property updates to the per-property sent metrics.");
+    AZ_CVAR(bool, sv_useInterestGrid, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server buckets network entities into a grid each tick and client replication windows gather relevant entities from it, "
+        "instead of each running its own visibility system query");
+    AZ_CVAR(float, sv_interestGridCellSize, 100.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The width and depth of a single interest grid cell in world units, used when sv_useInterestGrid is enabled");
     
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -359,6 +367,7 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_SerializationCacheHitRate, "SerializationCacheHitRate");
     }
 
     void MultiplayerSystemComponent::Deactivate()
@@ -591,9 +600,38 @@ namespace Multiplayer
         // Metrics calculation, as update calls are threaded.
         UpdatedMetricsConnectionCount();
 
+        const bool isServer = (GetAgentType() == MultiplayerAgentType::ClientServer || GetAgentType() == MultiplayerAgentType::DedicatedServer);
+
+        // Bucket entities once so every client replication window can gather from the same grid
+        InterestGrid* interestGrid = m_networkEntityManager.GetInterestGrid();
+        if (sv_useInterestGrid && isServer)
+        {
+            interestGrid->Rebuild(*m_networkEntityManager.GetNetworkEntityTracker(), sv_interestGridCellSize);
+        }
+        else if (interestGrid->IsActive())
+        {
+            interestGrid->Clear();
+        }
+
         // Send out the game state update to all connections
+        // Entity state can't change while connections are updated, so connections sharing a baseline can share serialized state
+        EntitySerializationCache* serializationCache = m_networkEntityManager.GetEntitySerializationCache();
+        const bool cacheSerialization = sv_cacheEntitySerialization && isServer;
+        if (cacheSerialization)
+        {
+            serializationCache->BeginTick();
+        }
+
         UpdateConnections();
 
+        if (cacheSerialization)
+        {
+            serializationCache->EndTick();
+            stats.RecordSerializationCacheResults(
+                serializationCache->GetHitCount(), serializationCache->GetHitBytes(),
+                serializationCache->GetMissCount(), serializationCache->GetMissBytes());
+        }
+
         MultiplayerPackets::SyncConsole packet;
         AZ::ThreadSafeDeque<AZStd::string>::DequeType cvarUpdates;
         m_cvarCommands.Swap(cvarUpdates);
@@ -1553,6 +1591,10 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+        AZLOG_INFO("Total serialization cache hits: %llu", aznumeric_cast<AZ::u64>(stats.m_serializationCacheHits.m_totalCalls));
+        AZLOG_INFO("Total serialization cache reused bytes: %llu", aznumeric_cast<AZ::u64>(stats.m_serializationCacheHits.m_totalBytes));
+        AZLOG_INFO("Total serialization cache misses: %llu", aznumeric_cast<AZ::u64>(stats.m_serializationCacheMisses.m_totalCalls));
+        AZLOG_INFO("Recent serialization cache hit rate: %.1f%%", stats.CalculateSerializationCacheHitRate() * 100.0f);
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
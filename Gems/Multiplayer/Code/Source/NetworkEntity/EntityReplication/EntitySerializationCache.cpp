@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntitySerializationCache.h>
+
+namespace Multiplayer
+{
+    void EntitySerializationCache::BeginTick()
+    {
+        for (Bucket& bucket : m_buckets)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(bucket.m_mutex);
+            for (auto iter = bucket.m_entities.begin(); iter != bucket.m_entities.end();)
+            {
+                // Drop entities that weren't serialized last tick, they've likely stopped changing or been deleted
+                if (iter->second.m_tick != m_tick)
+                {
+                    iter = bucket.m_entities.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+        }
+
+        ++m_tick;
+        m_active = true;
+        m_hitCount = 0;
+        m_missCount = 0;
+        m_hitBytes = 0;
+        m_missBytes = 0;
+    }
+
+    void EntitySerializationCache::EndTick()
+    {
+        m_active = false;
+    }
+
+    bool EntitySerializationCache::IsActive() const
+    {
+        return m_active;
+    }
+
+    bool EntitySerializationCache::Read(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outBuffer,
+        MultiplayerStats::PropertySentList& outPropertiesSent)
+    {
+        if (!m_active)
+        {
+            return false;
+        }
+
+        Bucket& bucket = GetBucket(netEntityId);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(bucket.m_mutex);
+            auto iter = bucket.m_entities.find(netEntityId);
+            if ((iter != bucket.m_entities.end()) && (iter->second.m_tick == m_tick))
+            {
+                const EntityPayloads& entityPayloads = iter->second;
+                for (uint32_t index = 0; index < entityPayloads.m_payloadCount; ++index)
+                {
+                    const CachedPayload& cachedPayload = entityPayloads.m_payloads[index];
+                    if (cachedPayload.m_record.HasSameChanges(record))
+                    {
+                        outBuffer.CopyValues(cachedPayload.m_payload.data(), cachedPayload.m_payload.size());
+                        outPropertiesSent.assign(cachedPayload.m_propertiesSent.begin(), cachedPayload.m_propertiesSent.end());
+                        ++m_hitCount;
+                        m_hitBytes += cachedPayload.m_payload.size();
+                        return true;
+                    }
+                }
+            }
+        }
+
+        ++m_missCount;
+        return false;
+    }
+
+    void EntitySerializationCache::Store(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& buffer,
+        const MultiplayerStats::PropertySentList& propertiesSent)
+    {
+        if (!m_active)
+        {
+            return;
+        }
+
+        m_missBytes += buffer.GetSize();
+
+        Bucket& bucket = GetBucket(netEntityId);
+        AZStd::lock_guard<AZStd::mutex> lock(bucket.m_mutex);
+        EntityPayloads& entityPayloads = bucket.m_entities[netEntityId];
+        if (entityPayloads.m_tick != m_tick)
+        {
+            entityPayloads.m_tick = m_tick;
+            entityPayloads.m_payloadCount = 0;
+        }
+
+        for (uint32_t index = 0; index < entityPayloads.m_payloadCount; ++index)
+        {
+            if (entityPayloads.m_payloads[index].m_record.HasSameChanges(record))
+            {
+                // Another connection job serialized the same record concurrently
+                return;
+            }
+        }
+
+        if (entityPayloads.m_payloadCount >= MaxRecordsPerEntity)
+        {
+            return;
+        }
+
+        if (entityPayloads.m_payloadCount >= entityPayloads.m_payloads.size())
+        {
+            entityPayloads.m_payloads.emplace_back();
+        }
+
+        CachedPayload& cachedPayload = entityPayloads.m_payloads[entityPayloads.m_payloadCount++];
+        cachedPayload.m_record = record;
+        cachedPayload.m_payload.assign(buffer.GetBuffer(), buffer.GetBuffer() + buffer.GetSize());
+        cachedPayload.m_propertiesSent.assign(propertiesSent.begin(), propertiesSent.end());
+    }
+
+    uint64_t EntitySerializationCache::GetHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    uint64_t EntitySerializationCache::GetMissCount() const
+    {
+        return m_missCount;
+    }
+
+    uint64_t EntitySerializationCache::GetHitBytes() const
+    {
+        return m_hitBytes;
+    }
+
+    uint64_t EntitySerializationCache::GetMissBytes() const
+    {
+        return m_missBytes;
+    }
+
+    EntitySerializationCache::Bucket& EntitySerializationCache::GetBucket(NetEntityId netEntityId)
+    {
+        return m_buckets[aznumeric_cast<uint64_t>(netEntityId) % BucketCount];
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Multiplayer
+{
+    //! @class EntitySerializationCache
+    //! @brief Shares serialized entity state between connections within a single network tick.
+    //! Every connection replicating an entity serializes the properties flagged in its own pending ReplicationRecord.
+    //! Connections that have acknowledged the same baseline end up with the same record, and since entity state
+    //! doesn't change while connections are updated, they would all produce the same bytes. This cache lets the first
+    //! connection serialize the payload and every other connection copy it. The property updates recorded while serializing are
+    //! stored alongside the payload, so connections that copy it can still report them to the sent property metrics.
+    //! The cache is only active between BeginTick and EndTick, and is safe to use from the connection update jobs.
+    class EntitySerializationCache
+    {
+    public:
+        //! Maximum number of distinct records cached per entity each tick.
+        static constexpr uint32_t MaxRecordsPerEntity = 8;
+
+        EntitySerializationCache() = default;
+
+        //! Invalidates all payloads from the previous tick, resets the tick counters and activates the cache.
+        //! Must not be called while any connection is being updated.
+        void BeginTick();
+
+        //! Deactivates the cache until the next BeginTick, after which Read and Store do nothing.
+        void EndTick();
+
+        //! Returns true if the cache is between BeginTick and EndTick.
+        //! @return boolean true if the cache is active
+        bool IsActive() const;
+
+        //! Copies a payload stored this tick for the given entity and record into the output buffer.
+        //! @param netEntityId       the entity being serialized
+        //! @param record            the replication record that determines which properties are serialized
+        //! @param outBuffer         the buffer to copy the cached payload into
+        //! @param outPropertiesSent the list to copy the property updates serialized into the payload into
+        //! @return boolean true on a cache hit, false if the caller needs to serialize the payload
+        bool Read(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outBuffer,
+            MultiplayerStats::PropertySentList& outPropertiesSent);
+
+        //! Stores a freshly serialized payload so other connections with the same record can reuse it this tick.
+        //! @param netEntityId    the entity that was serialized
+        //! @param record         the replication record the payload was serialized with
+        //! @param buffer         the serialized payload
+        //! @param propertiesSent the property updates recorded while serializing the payload
+        void Store(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& buffer,
+            const MultiplayerStats::PropertySentList& propertiesSent);
+
+        //! Returns the number of payloads copied from the cache since the last BeginTick.
+        //! @return the number of cache hits
+        uint64_t GetHitCount() const;
+
+        //! Returns the number of payloads that had to be serialized since the last BeginTick.
+        //! @return the number of cache misses
+        uint64_t GetMissCount() const;
+
+        //! Returns the number of payload bytes copied from the cache since the last BeginTick.
+        //! @return the number of bytes that did not need to be serialized
+        uint64_t GetHitBytes() const;
+
+        //! Returns the number of payload bytes serialized since the last BeginTick.
+        //! @return the number of bytes that were serialized
+        uint64_t GetMissBytes() const;
+
+    private:
+        struct CachedPayload
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_payload;
+            MultiplayerStats::PropertySentList m_propertiesSent;
+        };
+
+        struct EntityPayloads
+        {
+            uint64_t m_tick = 0;
+            uint32_t m_payloadCount = 0;
+            //! Payloads are reused between ticks to avoid reallocating, only the first m_payloadCount are valid.
+            AZStd::vector<CachedPayload> m_payloads;
+        };
+
+        //! The cache is split into buckets by entity id so that connection jobs rarely contend on the same lock.
+        struct Bucket
+        {
+            AZStd::mutex m_mutex;
+            AZStd::unordered_map<NetEntityId, EntityPayloads> m_entities;
+        };
+
+        static constexpr uint32_t BucketCount = 16;
+        Bucket& GetBucket(NetEntityId netEntityId);
+
+        AZStd::array<Bucket, BucketCount> m_buckets;
+        uint64_t m_tick = 0;
+        bool m_active = false;
+
+        AZStd::atomic<uint64_t> m_hitCount{ 0 };
+        AZStd::atomic<uint64_t> m_missCount{ 0 };
+        AZStd::atomic<uint64_t> m_hitBytes{ 0 };
+        AZStd::atomic<uint64_t> m_missBytes{ 0 };
+    };
+}
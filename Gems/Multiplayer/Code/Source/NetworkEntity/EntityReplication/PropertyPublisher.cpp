@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySerializationCache.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -203,6 +204,30 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    bool PropertyPublisher::SerializeEntityRecordCached(NetBindComponent* netBindComponent, AzNetworking::PacketEncodingBuffer& payload)
+    {
+        EntitySerializationCache* serializationCache = GetEntitySerializationCache();
+        if (serializationCache && serializationCache->Read(netBindComponent->GetNetEntityId(), m_pendingRecord, payload, m_propertiesSent))
+        {
+            // The connection that serialized the payload recorded its property updates, record them again for this connection
+            GetMultiplayer()->GetStats().RecordPropertiesSent(m_propertiesSent);
+            return true;
+        }
+
+        m_propertiesSent.clear();
+        MultiplayerStats::SetPropertySentCapture(serializationCache ? &m_propertiesSent : nullptr);
+        InputSerializer inputSerializer(payload.GetBuffer(), static_cast<uint32_t>(payload.GetCapacity()));
+        const bool serialized = SerializeEntityRecord(inputSerializer, netBindComponent);
+        MultiplayerStats::SetPropertySentCapture(nullptr);
+        payload.Resize(inputSerializer.GetSize());
+
+        if (serializationCache && serialized)
+        {
+            serializationCache->Store(netBindComponent->GetNetEntityId(), m_pendingRecord, payload, m_propertiesSent);
+        }
+        return serialized;
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
         // Fill in the packet id for the last sent update
@@ -372,11 +397,8 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        InputSerializer inputSerializer(
-            updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        SerializeEntityRecord(inputSerializer, netBindComponent);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
-
+        // Other connections that share our baseline have the same pending record, so they may have serialized this payload already
+        SerializeEntityRecordCached(netBindComponent, updateMessage.ModifyData());
         return updateMessage;
     }
 
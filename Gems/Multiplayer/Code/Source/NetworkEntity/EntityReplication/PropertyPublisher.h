@@ -117,6 +117,11 @@ namespace Multiplayer
         //! Add/update/delete all use the same serialization path.
         bool SerializeEntityRecord(AzNetworking::ISerializer& serializer, NetBindComponent* netBindComponent);
 
+        //! Serializes the pending record into the payload, or copies the payload from the serialization cache if another connection
+        //! already serialized the same record this tick. The sent property metrics are recorded either way.
+        //! @return false if serialization failed
+        bool SerializeEntityRecordCached(NetBindComponent* netBindComponent, AzNetworking::PacketEncodingBuffer& payload);
+
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
@@ -141,6 +146,9 @@ namespace Multiplayer
         //! True if the remote replicator has acknowledged at least one packet, which means that it exists and created the entity.
         bool m_remoteReplicatorEstablished = false;
 
+        //! Property updates of the last payload serialized or copied through the serialization cache, kept to avoid reallocating.
+        MultiplayerStats::PropertySentList m_propertiesSent;
+
         // In the case of deletes, we need to produce our update message at the point of deletion
         // and then keep it around until it's requested. By the time the message is requested, the entity
         // is likely already deleted, so the data to serialize from it would no longer be available.
@@ -91,6 +91,16 @@ namespace Multiplayer
         return &m_multiplayerComponentRegistry;
     }
 
+    EntitySerializationCache* NetworkEntityManager::GetEntitySerializationCache()
+    {
+        return &m_entitySerializationCache;
+    }
+
+    InterestGrid* NetworkEntityManager::GetInterestGrid()
+    {
+        return &m_interestGrid;
+    }
+
     const HostId& NetworkEntityManager::GetHostId() const
     {
         return m_hostId;
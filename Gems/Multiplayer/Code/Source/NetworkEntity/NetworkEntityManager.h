@@ -15,6 +15,8 @@
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Source/NetworkEntity/NetworkSpawnableLibrary.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySerializationCache.h>
+#include <Source/ReplicationWindows/InterestGrid.h>
 #include <Multiplayer/Components/MultiplayerComponentRegistry.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -43,6 +45,8 @@ namespace Multiplayer
         NetworkEntityTracker* GetNetworkEntityTracker() override;
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override;
         MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() override;
+        EntitySerializationCache* GetEntitySerializationCache() override;
+        InterestGrid* GetInterestGrid() override;
         const HostId& GetHostId() const override;
         ConstNetworkEntityHandle GetEntity(NetEntityId netEntityId) const override;
         NetEntityId GetNetEntityIdById(const AZ::EntityId& entityId) const override;
@@ -127,6 +131,8 @@ namespace Multiplayer
         NetworkEntityTracker m_networkEntityTracker;
         NetworkEntityAuthorityTracker m_networkEntityAuthorityTracker;
         MultiplayerComponentRegistry m_multiplayerComponentRegistry;
+        EntitySerializationCache m_entitySerializationCache;
+        InterestGrid m_interestGrid;
 
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToClients;
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToServers;
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    void InterestGrid::Clear()
+    {
+        m_pendingEntries.clear();
+        m_pendingEntryCells.clear();
+        m_entries.clear();
+        m_cells.clear();
+        m_active = false;
+    }
+
+    bool InterestGrid::IsActive() const
+    {
+        return m_active;
+    }
+
+    float InterestGrid::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    uint32_t InterestGrid::GetEntryCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entries.size());
+    }
+
+    uint32_t InterestGrid::GetCellCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_cells.size());
+    }
+
+    void InterestGrid::Rebuild(const NetworkEntityTracker& networkEntityTracker, float cellSize)
+    {
+        m_pendingEntries.clear();
+        m_pendingEntries.reserve(networkEntityTracker.size());
+        for (const auto& [netEntityId, entity] : networkEntityTracker)
+        {
+            if ((entity == nullptr) || (entity->GetState() != AZ::Entity::State::Active))
+            {
+                continue;
+            }
+
+            AZ::TransformInterface* transformInterface = entity->GetTransform();
+            if (transformInterface == nullptr)
+            {
+                continue;
+            }
+
+            m_pendingEntries.push_back({ ConstNetworkEntityHandle(entity, &networkEntityTracker), transformInterface->GetWorldTranslation() });
+        }
+
+        BuildCells(cellSize);
+    }
+
+    void InterestGrid::Rebuild(const AZStd::vector<Entry>& entries, float cellSize)
+    {
+        m_pendingEntries.assign(entries.begin(), entries.end());
+        BuildCells(cellSize);
+    }
+
+    void InterestGrid::Gather(const AZ::Vector3& position, float radius, AZStd::vector<const Entry*>& outEntries) const
+    {
+        if (!m_active || m_entries.empty())
+        {
+            return;
+        }
+
+        const float radiusSquared = radius * radius;
+        const int32_t minX = GetCellCoordinate(position.GetX() - radius);
+        const int32_t maxX = GetCellCoordinate(position.GetX() + radius);
+        const int32_t minY = GetCellCoordinate(position.GetY() - radius);
+        const int32_t maxY = GetCellCoordinate(position.GetY() + radius);
+
+        // If the query covers more cells than are occupied, it's cheaper to walk the occupied cells directly
+        const int64_t queryCellCount = (int64_t(maxX) - int64_t(minX) + 1) * (int64_t(maxY) - int64_t(minY) + 1);
+        if (queryCellCount > aznumeric_cast<int64_t>(m_cells.size()))
+        {
+            for (const auto& [cellKey, cell] : m_cells)
+            {
+                GatherCell(cell, position, radiusSquared, outEntries);
+            }
+            return;
+        }
+
+        for (int32_t x = minX; x <= maxX; ++x)
+        {
+            for (int32_t y = minY; y <= maxY; ++y)
+            {
+                auto cellIter = m_cells.find(GetCellKey(x, y));
+                if (cellIter != m_cells.end())
+                {
+                    GatherCell(cellIter->second, position, radiusSquared, outEntries);
+                }
+            }
+        }
+    }
+
+    void InterestGrid::BuildCells(float cellSize)
+    {
+        m_cellSize = AZStd::max(cellSize, MinCellSize);
+        m_inverseCellSize = 1.0f / m_cellSize;
+        m_cells.clear();
+
+        // Count the entries in each cell
+        m_pendingEntryCells.resize(m_pendingEntries.size());
+        for (size_t index = 0; index < m_pendingEntries.size(); ++index)
+        {
+            const AZ::Vector3& position = m_pendingEntries[index].m_position;
+            Cell& cell = m_cells[GetCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()))];
+            ++cell.m_count;
+            m_pendingEntryCells[index] = &cell;
+        }
+
+        // Assign each cell a contiguous range of entries
+        uint32_t offset = 0;
+        for (auto& [cellKey, cell] : m_cells)
+        {
+            cell.m_begin = offset;
+            offset += cell.m_count;
+            cell.m_count = 0;
+        }
+
+        // Scatter the entries into their cell ranges
+        m_entries.resize(m_pendingEntries.size());
+        for (size_t index = 0; index < m_pendingEntries.size(); ++index)
+        {
+            Cell& cell = *m_pendingEntryCells[index];
+            m_entries[cell.m_begin + cell.m_count] = m_pendingEntries[index];
+            ++cell.m_count;
+        }
+
+        m_active = true;
+    }
+
+    int32_t InterestGrid::GetCellCoordinate(float value) const
+    {
+        // Converting a float outside the range of int32_t is undefined, so positions far out of the world are clamped to the
+        // outermost cells and non-finite positions are bucketed at the origin. Gathers still check the actual distance.
+        const float coordinate = AZStd::floor(value * m_inverseCellSize);
+        if (AZStd::isnan(coordinate))
+        {
+            return 0;
+        }
+        return static_cast<int32_t>(AZStd::clamp(coordinate, static_cast<float>(-MaxCellCoordinate), static_cast<float>(MaxCellCoordinate)));
+    }
+
+    InterestGrid::CellKey InterestGrid::GetCellKey(int32_t x, int32_t y) const
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(x)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(y));
+    }
+
+    void InterestGrid::GatherCell(const Cell& cell, const AZ::Vector3& position, float radiusSquared, AZStd::vector<const Entry*>& outEntries) const
+    {
+        const uint32_t end = cell.m_begin + cell.m_count;
+        for (uint32_t index = cell.m_begin; index < end; ++index)
+        {
+            const Entry& entry = m_entries[index];
+            if (position.GetDistanceSq(entry.m_position) <= radiusSquared)
+            {
+                outEntries.push_back(&entry);
+            }
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class NetworkEntityTracker;
+
+    //! @class InterestGrid
+    //! @brief Buckets network entities into a uniform grid of cells on the world XY plane.
+    //! The server rebuilds the grid once per tick, after which every ServerToClientReplicationWindow gathers its
+    //! relevancy candidates from the cells overlapping its awareness radius rather than running its own spatial query.
+    //! Entries are stored contiguously per cell, so gathering a cell is a linear walk over its entries.
+    class InterestGrid
+    {
+    public:
+        //! Smallest cell size the grid will use, guards against degenerate cvar values.
+        static constexpr float MinCellSize = 1.0f;
+
+        struct Entry
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        };
+
+        InterestGrid() = default;
+
+        //! Removes all entries and deactivates the grid.
+        void Clear();
+
+        //! Returns true if the grid has been rebuilt since the last Clear.
+        //! @return boolean true if the grid can be gathered from
+        bool IsActive() const;
+
+        //! Returns the cell size used by the last rebuild.
+        //! @return the width and depth of a single cell in world units
+        float GetCellSize() const;
+
+        //! Returns the number of entries in the grid.
+        //! @return the number of entities bucketed by the last rebuild
+        uint32_t GetEntryCount() const;
+
+        //! Returns the number of occupied cells in the grid.
+        //! @return the number of cells that contain at least one entity
+        uint32_t GetCellCount() const;
+
+        //! Rebuilds the grid from every active network entity with a transform.
+        //! @param networkEntityTracker the tracker holding all network entities on this host
+        //! @param cellSize             the width and depth of a single cell in world units
+        void Rebuild(const NetworkEntityTracker& networkEntityTracker, float cellSize);
+
+        //! Rebuilds the grid from an explicit set of entries.
+        //! @param entries  the entity handles and positions to bucket
+        //! @param cellSize the width and depth of a single cell in world units
+        void Rebuild(const AZStd::vector<Entry>& entries, float cellSize);
+
+        //! Appends every entry within radius of the provided position to outEntries.
+        //! Pointers remain valid until the next Rebuild or Clear.
+        //! @param position   the center of the query
+        //! @param radius     the maximum distance from position an entry can be
+        //! @param outEntries the vector to append the gathered entries to
+        void Gather(const AZ::Vector3& position, float radius, AZStd::vector<const Entry*>& outEntries) const;
+
+    private:
+        struct Cell
+        {
+            uint32_t m_begin = 0;
+            uint32_t m_count = 0;
+        };
+
+        using CellKey = uint64_t;
+
+        //! Cell coordinates are clamped to this range, which leaves headroom for iterating over a range of cells.
+        static constexpr int32_t MaxCellCoordinate = 1 << 30;
+
+        void BuildCells(float cellSize);
+        int32_t GetCellCoordinate(float value) const;
+        CellKey GetCellKey(int32_t x, int32_t y) const;
+        void GatherCell(const Cell& cell, const AZ::Vector3& position, float radiusSquared, AZStd::vector<const Entry*>& outEntries) const;
+
+        //! Unsorted entries collected during a rebuild, kept between ticks to avoid reallocating.
+        AZStd::vector<Entry> m_pendingEntries;
+        AZStd::vector<Cell*> m_pendingEntryCells;
+
+        //! Entries sorted by cell, each cell references a contiguous range.
+        AZStd::vector<Entry> m_entries;
+        AZStd::unordered_map<CellKey, Cell> m_cells;
+
+        float m_cellSize = MinCellSize;
+        float m_inverseCellSize = 1.0f / MinCellSize;
+        bool m_active = false;
+    };
+}
@@ -13,6 +13,7 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/sort.h>
 
 namespace Multiplayer
@@ -24,6 +25,7 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_PacketsToIntegrateQos, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of packets to accumulate before updating connection quality of service metrics");
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR(float, sv_ClientAwarenessHysteresis, 25.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The distance beyond the awareness radius a relevant entity can move before it stops being relevant, only used with the interest grid");
 
     const char* GetConnectionStateString(bool isPoor)
     {
@@ -98,6 +100,7 @@ namespace Multiplayer
         // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
         ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
         m_candidateQueue.swap(clearQueue);
+        m_previousReplicationSet.swap(m_replicationSet);
         m_replicationSet.clear();
 
         NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
@@ -112,52 +115,14 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
-        if (visibilitySystem)
+        InterestGrid* interestGrid = GetInterestGrid();
+        if ((interestGrid != nullptr) && interestGrid->IsActive())
         {
-            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
-                awarenessSphere,
-                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-                {
-                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                    {
-                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                        {
-                            gatheredEntries.push_back(visEntry);
-                        }
-                    }
-                });
+            AddEntitiesFromInterestGrid(*interestGrid, controlledEntityPosition);
         }
-
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
-        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
-
-        // Add all the neighbours
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        else
         {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-            if (entityHandle.GetNetBindComponent() == nullptr)
-            {
-                // Entity does not have netbinding, skip this entity
-                continue;
-            }
-
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
-            {
-                continue;
-            }
-
-            // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
-            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+            AddEntitiesFromVisibilitySystem(controlledEntityPosition);
         }
 
         // Add in all entities that have forced relevancy
@@ -314,6 +279,117 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::AddEntitiesFromVisibilitySystem(const AZ::Vector3& controlledEntityPosition)
+    {
+        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem)
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
+                awarenessSphere,
+                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
+                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                    {
+                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                        {
+                            gatheredEntries.push_back(visEntry);
+                        }
+                    }
+                });
+        }
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+
+        // Add all the neighbours
+        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        {
+            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
+            if (entityHandle.GetNetBindComponent() == nullptr)
+            {
+                // Entity does not have netbinding, skip this entity
+                continue;
+            }
+
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
+            }
+
+            // We want to find the closest extent to the player and prioritize using that distance
+            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
+            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
+            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
+            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
+                
+            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+        }
+    }
+
+    void ServerToClientReplicationWindow::AddEntitiesFromInterestGrid(const InterestGrid& interestGrid, const AZ::Vector3& controlledEntityPosition)
+    {
+        // Entities already in the window stay relevant until they move past the hysteresis band, so they don't flap at the edge
+        const float awarenessRadiusSquared = sv_ClientAwarenessRadius * sv_ClientAwarenessRadius;
+        const float retainRadius = sv_ClientAwarenessRadius + AZStd::max(static_cast<float>(sv_ClientAwarenessHysteresis), 0.0f);
+
+        m_gatheredGridEntries.clear();
+        interestGrid.Gather(controlledEntityPosition, retainRadius, m_gatheredGridEntries);
+
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        const AzNetworking::ConnectionId connectionId = m_connection->GetConnectionId();
+
+        ReplicationCandidateQueue::container_type candidates;
+        candidates.reserve(m_gatheredGridEntries.size());
+        for (const InterestGrid::Entry* gridEntry : m_gatheredGridEntries)
+        {
+            // Copy the handle, validating it updates cached state and the grid is shared by every connection
+            ConstNetworkEntityHandle entityHandle = gridEntry->m_entityHandle;
+            NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+            if (netBindComponent == nullptr)
+            {
+                // Entity was removed since the grid was built, or does not have netbinding
+                continue;
+            }
+
+            const float distanceSquared = controlledEntityPosition.GetDistanceSq(gridEntry->m_position);
+            if ((distanceSquared > awarenessRadiusSquared) && (m_previousReplicationSet.find(entityHandle) == m_previousReplicationSet.end()))
+            {
+                continue;
+            }
+
+            if (!sv_ReplicateServerProxies && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
+            {
+                continue;
+            }
+
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entityHandle.GetEntity(), m_controlledEntity, connectionId))
+            {
+                continue;
+            }
+
+            const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+            candidates.emplace_back(entityHandle, priority);
+        }
+
+        // Keep the highest priority candidates and heapify them once, rather than pushing and popping them one at a time
+        const size_t maxCandidates = sv_MaxEntitiesToTrackReplication;
+        if (candidates.size() > maxCandidates)
+        {
+            AZStd::nth_element(candidates.begin(), candidates.begin() + maxCandidates, candidates.end());
+            candidates.erase(candidates.begin() + maxCandidates, candidates.end());
+        }
+
+        for (const PrioritizedReplicationCandidate& candidate : candidates)
+        {
+            m_replicationSet[candidate.m_entityHandle] = { NetEntityRole::Client, candidate.m_priority };
+        }
+        m_candidateQueue = ReplicationCandidateQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(candidates));
+    }
+
     void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, [[maybe_unused]] float distanceSquared)
     {
         // Assumption: the entity has been checked for filtering prior to this call.
@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -61,6 +62,8 @@ namespace Multiplayer
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
         void EvaluateConnection();
+        void AddEntitiesFromVisibilitySystem(const AZ::Vector3& controlledEntityPosition);
+        void AddEntitiesFromInterestGrid(const InterestGrid& interestGrid, const AZ::Vector3& controlledEntityPosition);
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
@@ -68,6 +71,9 @@ namespace Multiplayer
         // sorted in reverse, lowest priority is the top()
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
+        // the replication set from the previous update, used to keep entities near the edge of the awareness radius relevant
+        ReplicationSet m_previousReplicationSet;
+        AZStd::vector<const InterestGrid::Entry*> m_gatheredGridEntries;
 
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
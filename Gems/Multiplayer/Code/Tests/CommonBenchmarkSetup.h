@@ -21,6 +21,8 @@
 #include <Multiplayer/Components/NetworkHierarchyChildComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <NetworkEntity/EntityReplication/EntitySerializationCache.h>
+#include <ReplicationWindows/InterestGrid.h>
 
 namespace Multiplayer
 {
@@ -206,6 +208,8 @@ namespace Multiplayer
         NetworkEntityTracker* GetNetworkEntityTracker() override { return &m_tracker; }
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override { return &m_authorityTracker; }
         MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() override { return &m_multiplayerComponentRegistry; }
+        EntitySerializationCache* GetEntitySerializationCache() override { return &m_serializationCache; }
+        InterestGrid* GetInterestGrid() override { return &m_interestGrid; }
         const HostId& GetHostId() const override { return m_hostId; }
 
         mutable AZStd::map<NetEntityId, AZ::Entity*> m_networkEntityMap;
@@ -295,6 +299,8 @@ namespace Multiplayer
         NetworkEntityTracker m_tracker;
         NetworkEntityAuthorityTracker m_authorityTracker;
         MultiplayerComponentRegistry m_multiplayerComponentRegistry;
+        EntitySerializationCache m_serializationCache;
+        InterestGrid m_interestGrid;
         HostId m_hostId;
     };
 
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+
+namespace Multiplayer
+{
+    /*
+     * A server replicating 64 entities to a varying number of clients.
+     * Every client has the same acknowledgement history, so they all share a baseline for every entity.
+     */
+    class ServerReplicationTickBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        static constexpr uint32_t EntityCount = 64;
+
+        struct Client
+        {
+            AZStd::unique_ptr<BenchmarkMultiplayerConnection> m_connection;
+            AZStd::unique_ptr<EntityReplicationManager> m_replicationManager;
+            AZStd::vector<AZStd::unique_ptr<EntityReplicator>> m_replicators;
+        };
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            for (uint32_t index = 0; index < EntityCount; ++index)
+            {
+                const NetEntityId netEntityId = NetEntityId{ index + 1 };
+                m_entities.push_back(AZStd::make_unique<EntityInfo>(index + 1, "entity", netEntityId, EntityInfo::Role::None));
+                EntityInfo& entityInfo = *m_entities.back();
+                PopulateHierarchicalEntity(entityInfo);
+                SetupEntity(entityInfo.m_entity, entityInfo.m_netId, NetEntityRole::Authority);
+                entityInfo.m_entity->Activate();
+            }
+        }
+
+        void internalTearDown() override
+        {
+            m_clients.clear();
+            m_entities.clear();
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        void CreateClients(uint32_t clientCount)
+        {
+            for (uint32_t clientIndex = 0; clientIndex < clientCount; ++clientIndex)
+            {
+                Client& client = m_clients.emplace_back();
+                const IpAddress address("localhost", aznumeric_cast<uint16_t>(clientIndex + 2), ProtocolType::Udp);
+                client.m_connection = AZStd::make_unique<BenchmarkMultiplayerConnection>(
+                    ConnectionId{ clientIndex + 2 }, address, ConnectionRole::Acceptor);
+                client.m_replicationManager = AZStd::make_unique<EntityReplicationManager>(
+                    *client.m_connection, *m_ConnectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+
+                for (const AZStd::unique_ptr<EntityInfo>& entityInfo : m_entities)
+                {
+                    const NetworkEntityHandle entityHandle(entityInfo->m_entity.get(), m_NetworkEntityManager->GetNetworkEntityTracker());
+                    client.m_replicators.push_back(AZStd::make_unique<EntityReplicator>(
+                        *client.m_replicationManager, client.m_connection.get(), NetEntityRole::Client, entityHandle));
+                    client.m_replicators.back()->Initialize(entityHandle);
+                }
+            }
+        }
+
+        void ServerTick(bool cacheSerialization)
+        {
+            EntitySerializationCache& serializationCache = m_NetworkEntityManager->m_serializationCache;
+            if (cacheSerialization)
+            {
+                serializationCache.BeginTick();
+            }
+
+            m_sentPacketId = AzNetworking::PacketId{ aznumeric_cast<uint32_t>(m_sentPacketId) + 1 };
+            for (Client& client : m_clients)
+            {
+                for (AZStd::unique_ptr<EntityReplicator>& replicator : client.m_replicators)
+                {
+                    if (replicator->PrepareToGenerateUpdatePacket())
+                    {
+                        NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+                        benchmark::DoNotOptimize(updateMessage.GetData());
+                        replicator->RecordSentPacketId(m_sentPacketId);
+                    }
+                }
+            }
+
+            if (cacheSerialization)
+            {
+                serializationCache.EndTick();
+                m_hitCount += serializationCache.GetHitCount();
+                m_missCount += serializationCache.GetMissCount();
+            }
+        }
+
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entities;
+        AZStd::vector<Client> m_clients;
+        AzNetworking::PacketId m_sentPacketId = AzNetworking::PacketId{ 0 };
+        uint64_t m_hitCount = 0;
+        uint64_t m_missCount = 0;
+    };
+
+    BENCHMARK_DEFINE_F(ServerReplicationTickBenchmark, GenerateEntityUpdates)(benchmark::State& state)
+    {
+        const uint32_t clientCount = aznumeric_cast<uint32_t>(state.range(0));
+        const bool cacheSerialization = state.range(1) != 0;
+        CreateClients(clientCount);
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            ServerTick(cacheSerialization);
+        }
+
+        state.SetItemsProcessed(state.iterations() * clientCount * EntityCount);
+        const uint64_t totalCount = m_hitCount + m_missCount;
+        state.counters["CacheHitRate"] = (totalCount > 0) ? aznumeric_cast<double>(m_hitCount) / aznumeric_cast<double>(totalCount) : 0.0;
+    }
+
+    BENCHMARK_REGISTER_F(ServerReplicationTickBenchmark, GenerateEntityUpdates)
+        ->ArgNames({ "Clients", "Cached" })
+        ->Args({ 1, 0 })
+        ->Args({ 1, 1 })
+        ->Args({ 10, 0 })
+        ->Args({ 10, 1 })
+        ->Args({ 50, 0 })
+        ->Args({ 50, 1 })
+        ->Args({ 100, 0 })
+        ->Args({ 100, 1 })
+        ->Unit(benchmark::kMicrosecond);
+}
+
+#endif
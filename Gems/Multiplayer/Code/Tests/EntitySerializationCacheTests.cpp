@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntitySerializationCache.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntitySerializationCacheTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_cache = AZStd::make_unique<EntitySerializationCache>();
+
+            m_record = ReplicationRecord(NetEntityRole::Client);
+            m_record.m_authorityToClient.AddBits(8);
+            m_record.m_authorityToClient.SetBit(3, true);
+
+            const uint8_t payload[] = { 1, 2, 3, 4, 5 };
+            m_payload.CopyValues(payload, sizeof(payload));
+            m_propertiesSent = { { NetComponentId{ 1 }, PropertyIndex{ 3 }, 5 } };
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::unique_ptr<EntitySerializationCache> m_cache;
+        ReplicationRecord m_record;
+        AzNetworking::PacketEncodingBuffer m_payload;
+        MultiplayerStats::PropertySentList m_propertiesSent;
+    };
+
+    TEST_F(EntitySerializationCacheTests, InactiveCacheIsBypassed)
+    {
+        AzNetworking::PacketEncodingBuffer outBuffer;
+        m_cache->Store(NetEntityId{ 1 }, m_record, m_payload, m_propertiesSent);
+        EXPECT_FALSE(m_cache->Read(NetEntityId{ 1 }, m_record, outBuffer, m_propertiesSent));
+        EXPECT_EQ(m_cache->GetMissCount(), 0u);
+    }
+
+    TEST_F(EntitySerializationCacheTests, SameRecordHits)
+    {
+        AzNetworking::PacketEncodingBuffer outBuffer;
+        m_cache->BeginTick();
+        EXPECT_FALSE(m_cache->Read(NetEntityId{ 1 }, m_record, outBuffer, m_propertiesSent));
+        m_cache->Store(NetEntityId{ 1 }, m_record, m_payload, m_propertiesSent);
+
+        // A different connection with the same baseline copies the stored payload
+        ReplicationRecord sameRecord = m_record;
+        sameRecord.m_sentPacketId = AzNetworking::PacketId{ 12 };
+        MultiplayerStats::PropertySentList propertiesSent;
+        EXPECT_TRUE(m_cache->Read(NetEntityId{ 1 }, sameRecord, outBuffer, propertiesSent));
+        EXPECT_EQ(outBuffer, m_payload);
+
+        // The property updates of the payload are handed out with it, so they can be reported for every connection that sends it
+        ASSERT_EQ(propertiesSent.size(), 1u);
+        EXPECT_EQ(propertiesSent[0].m_netComponentId, NetComponentId{ 1 });
+        EXPECT_EQ(propertiesSent[0].m_propertyIndex, PropertyIndex{ 3 });
+        EXPECT_EQ(propertiesSent[0].m_totalBytes, 5u);
+        m_cache->EndTick();
+
+        EXPECT_EQ(m_cache->GetHitCount(), 1u);
+        EXPECT_EQ(m_cache->GetMissCount(), 1u);
+        EXPECT_EQ(m_cache->GetHitBytes(), m_payload.GetSize());
+        EXPECT_EQ(m_cache->GetMissBytes(), m_payload.GetSize());
+    }
+
+    TEST_F(EntitySerializationCacheTests, DifferentRecordOrEntityMisses)
+    {
+        AzNetworking::PacketEncodingBuffer outBuffer;
+        m_cache->BeginTick();
+        m_cache->Store(NetEntityId{ 1 }, m_record, m_payload, m_propertiesSent);
+
+        ReplicationRecord otherBaseline = m_record;
+        otherBaseline.m_authorityToClient.SetBit(5, true);
+        EXPECT_FALSE(m_cache->Read(NetEntityId{ 1 }, otherBaseline, outBuffer, m_propertiesSent));
+
+        ReplicationRecord otherRole = m_record;
+        otherRole.SetRemoteNetworkRole(NetEntityRole::Autonomous);
+        EXPECT_FALSE(m_cache->Read(NetEntityId{ 1 }, otherRole, outBuffer, m_propertiesSent));
+
+        EXPECT_FALSE(m_cache->Read(NetEntityId{ 2 }, m_record, outBuffer, m_propertiesSent));
+        m_cache->EndTick();
+
+        EXPECT_EQ(m_cache->GetHitCount(), 0u);
+        EXPECT_EQ(m_cache->GetMissCount(), 3u);
+    }
+
+    TEST_F(EntitySerializationCacheTests, PayloadsExpireEachTick)
+    {
+        AzNetworking::PacketEncodingBuffer outBuffer;
+        m_cache->BeginTick();
+        m_cache->Store(NetEntityId{ 1 }, m_record, m_payload, m_propertiesSent);
+        m_cache->EndTick();
+
+        m_cache->BeginTick();
+        EXPECT_FALSE(m_cache->Read(NetEntityId{ 1 }, m_record, outBuffer, m_propertiesSent));
+        m_cache->EndTick();
+    }
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <benchmark/benchmark.h>
+
+namespace Multiplayer
+{
+    /*
+     * Gathers the relevant entities for 200 clients among 20k entities, the way ServerToClientReplicationWindow does.
+     * The visibility path runs a sphere query on an octree per client and pushes each candidate into a bounded priority queue.
+     * The interest grid path rebuilds the grid once per tick, then each client gathers from it and selects its candidates in one pass.
+     */
+    class InterestManagementBenchmark
+        : public benchmark::Fixture
+        , public UnitTest::LeakDetectionBase
+    {
+    public:
+        static constexpr uint32_t ClientCount = 200;
+        static constexpr uint32_t EntityCount = 20000;
+        static constexpr float WorldExtents = 2000.0f;
+        static constexpr float AwarenessRadius = 500.0f;
+        static constexpr float CellSize = 100.0f;
+        static constexpr size_t MaxCandidates = 512;
+
+        using Candidate = ServerToClientReplicationWindow::PrioritizedReplicationCandidate;
+        using CandidateQueue = ServerToClientReplicationWindow::ReplicationCandidateQueue;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void internalSetUp()
+        {
+            AZ::NameDictionary::Create();
+            m_octreeScene = AZStd::make_unique<AzFramework::OctreeScene>(AZ::Name("InterestManagementBenchmark"));
+            m_interestGrid = AZStd::make_unique<InterestGrid>();
+
+            AZ::SimpleLcgRandom random;
+            m_visibilityEntries.resize(EntityCount);
+            m_gridEntries.resize(EntityCount);
+            for (uint32_t index = 0; index < EntityCount; ++index)
+            {
+                const AZ::Vector3 position = CreateRandomPosition(random);
+                AzFramework::VisibilityEntry& visibilityEntry = m_visibilityEntries[index];
+                visibilityEntry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(position, AZ::Vector3(0.5f));
+                visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity;
+                m_octreeScene->InsertOrUpdateEntry(visibilityEntry);
+                m_gridEntries[index].m_position = position;
+            }
+
+            for (uint32_t index = 0; index < ClientCount; ++index)
+            {
+                m_clientPositions.push_back(CreateRandomPosition(random));
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_octreeScene.reset();
+            m_interestGrid.reset();
+            m_visibilityEntries = {};
+            m_gridEntries = {};
+            m_clientPositions = {};
+            AZ::NameDictionary::Destroy();
+        }
+
+        AZ::Vector3 CreateRandomPosition(AZ::SimpleLcgRandom& random) const
+        {
+            const float x = (random.GetRandomFloat() * 2.0f - 1.0f) * WorldExtents;
+            const float y = (random.GetRandomFloat() * 2.0f - 1.0f) * WorldExtents;
+            return AZ::Vector3(x, y, 0.0f);
+        }
+
+        size_t GatherFromVisibilitySystem()
+        {
+            size_t candidateCount = 0;
+            AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+            for (const AZ::Vector3& clientPosition : m_clientPositions)
+            {
+                gatheredEntries.clear();
+                m_octreeScene->Enumerate(
+                    AZ::Sphere(clientPosition, AwarenessRadius),
+                    [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                        {
+                            if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                            {
+                                gatheredEntries.push_back(visEntry);
+                            }
+                        }
+                    });
+
+                CandidateQueue::container_type queueContainer;
+                queueContainer.reserve(MaxCandidates);
+                CandidateQueue candidateQueue(CandidateQueue::value_compare{}, AZStd::move(queueContainer));
+                for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+                {
+                    const AZ::Vector3 supportNormal = clientPosition - visEntry->m_boundingVolume.GetCenter();
+                    const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
+                    const float distanceSquared = clientPosition.GetDistanceSq(closestPosition);
+                    const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+                    if (candidateQueue.size() >= MaxCandidates)
+                    {
+                        candidateQueue.pop();
+                    }
+                    candidateQueue.push(Candidate(ConstNetworkEntityHandle(), priority));
+                }
+                candidateCount += candidateQueue.size();
+                benchmark::DoNotOptimize(candidateQueue);
+            }
+            return candidateCount;
+        }
+
+        size_t GatherFromInterestGrid()
+        {
+            size_t candidateCount = 0;
+            m_interestGrid->Rebuild(m_gridEntries, CellSize);
+
+            AZStd::vector<const InterestGrid::Entry*> gatheredEntries;
+            for (const AZ::Vector3& clientPosition : m_clientPositions)
+            {
+                gatheredEntries.clear();
+                m_interestGrid->Gather(clientPosition, AwarenessRadius, gatheredEntries);
+
+                CandidateQueue::container_type candidates;
+                candidates.reserve(gatheredEntries.size());
+                for (const InterestGrid::Entry* gridEntry : gatheredEntries)
+                {
+                    const float distanceSquared = clientPosition.GetDistanceSq(gridEntry->m_position);
+                    const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+                    candidates.emplace_back(gridEntry->m_entityHandle, priority);
+                }
+
+                if (candidates.size() > MaxCandidates)
+                {
+                    AZStd::nth_element(candidates.begin(), candidates.begin() + MaxCandidates, candidates.end());
+                    candidates.erase(candidates.begin() + MaxCandidates, candidates.end());
+                }
+                CandidateQueue candidateQueue(CandidateQueue::value_compare{}, AZStd::move(candidates));
+                candidateCount += candidateQueue.size();
+                benchmark::DoNotOptimize(candidateQueue);
+            }
+            return candidateCount;
+        }
+
+        AZStd::unique_ptr<AzFramework::OctreeScene> m_octreeScene;
+        AZStd::unique_ptr<InterestGrid> m_interestGrid;
+        AZStd::vector<AzFramework::VisibilityEntry> m_visibilityEntries;
+        AZStd::vector<InterestGrid::Entry> m_gridEntries;
+        AZStd::vector<AZ::Vector3> m_clientPositions;
+    };
+
+    BENCHMARK_DEFINE_F(InterestManagementBenchmark, GatherRelevantEntities)(benchmark::State& state)
+    {
+        const bool useInterestGrid = state.range(0) != 0;
+
+        size_t candidateCount = 0;
+        for ([[maybe_unused]] auto value : state)
+        {
+            candidateCount += useInterestGrid ? GatherFromInterestGrid() : GatherFromVisibilitySystem();
+        }
+
+        state.SetItemsProcessed(state.iterations() * ClientCount);
+        state.counters["CandidatesPerClient"] = aznumeric_cast<double>(candidateCount) / aznumeric_cast<double>(state.iterations() * ClientCount);
+    }
+
+    BENCHMARK_REGISTER_F(InterestManagementBenchmark, GatherRelevantEntities)
+        ->ArgNames({ "InterestGrid" })
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+}
+
+#endif
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/limits.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class InterestGridTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_grid = AZStd::make_unique<InterestGrid>();
+        }
+
+        void TearDown() override
+        {
+            m_grid.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::vector<InterestGrid::Entry> CreateRandomEntries(uint32_t count, float extents)
+        {
+            AZ::SimpleLcgRandom random;
+            AZStd::vector<InterestGrid::Entry> entries;
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                const float x = (random.GetRandomFloat() * 2.0f - 1.0f) * extents;
+                const float y = (random.GetRandomFloat() * 2.0f - 1.0f) * extents;
+                const float z = (random.GetRandomFloat() * 2.0f - 1.0f) * 10.0f;
+                entries.push_back({ ConstNetworkEntityHandle(), AZ::Vector3(x, y, z) });
+            }
+            return entries;
+        }
+
+        AZStd::unique_ptr<InterestGrid> m_grid;
+    };
+
+    TEST_F(InterestGridTests, InactiveGridGathersNothing)
+    {
+        AZStd::vector<const InterestGrid::Entry*> gathered;
+        EXPECT_FALSE(m_grid->IsActive());
+        m_grid->Gather(AZ::Vector3::CreateZero(), 100.0f, gathered);
+        EXPECT_TRUE(gathered.empty());
+
+        m_grid->Rebuild(CreateRandomEntries(16, 10.0f), 5.0f);
+        EXPECT_TRUE(m_grid->IsActive());
+        EXPECT_EQ(m_grid->GetEntryCount(), 16u);
+
+        m_grid->Clear();
+        EXPECT_FALSE(m_grid->IsActive());
+        m_grid->Gather(AZ::Vector3::CreateZero(), 100.0f, gathered);
+        EXPECT_TRUE(gathered.empty());
+    }
+
+    TEST_F(InterestGridTests, GatherMatchesBruteForce)
+    {
+        const AZStd::vector<InterestGrid::Entry> entries = CreateRandomEntries(1000, 500.0f);
+        m_grid->Rebuild(entries, 40.0f);
+        EXPECT_EQ(m_grid->GetEntryCount(), 1000u);
+
+        // Query positions on both sides of the origin exercise negative cell coordinates
+        const AZ::Vector3 queryPositions[] = { AZ::Vector3(0.0f), AZ::Vector3(-230.0f, 115.0f, 0.0f), AZ::Vector3(480.0f, -480.0f, 5.0f) };
+        const float queryRadius = 120.0f;
+        for (const AZ::Vector3& queryPosition : queryPositions)
+        {
+            AZStd::vector<const InterestGrid::Entry*> gathered;
+            m_grid->Gather(queryPosition, queryRadius, gathered);
+
+            uint32_t expectedCount = 0;
+            for (const InterestGrid::Entry& entry : entries)
+            {
+                expectedCount += (queryPosition.GetDistance(entry.m_position) <= queryRadius) ? 1 : 0;
+            }
+
+            EXPECT_EQ(gathered.size(), expectedCount);
+            for (const InterestGrid::Entry* entry : gathered)
+            {
+                EXPECT_LE(queryPosition.GetDistance(entry->m_position), queryRadius);
+            }
+        }
+    }
+
+    TEST_F(InterestGridTests, LargeQueryWalksOccupiedCells)
+    {
+        m_grid->Rebuild(CreateRandomEntries(200, 50.0f), 10.0f);
+        EXPECT_GT(m_grid->GetCellCount(), 1u);
+
+        // The query covers far more cells than are occupied
+        AZStd::vector<const InterestGrid::Entry*> gathered;
+        m_grid->Gather(AZ::Vector3::CreateZero(), 100000.0f, gathered);
+        EXPECT_EQ(gathered.size(), 200u);
+    }
+
+    TEST_F(InterestGridTests, CellSizeIsClamped)
+    {
+        m_grid->Rebuild(CreateRandomEntries(4, 10.0f), 0.0f);
+        EXPECT_EQ(m_grid->GetCellSize(), InterestGrid::MinCellSize);
+    }
+
+    TEST_F(InterestGridTests, OutOfRangePositionsAreClamped)
+    {
+        const float infinity = AZStd::numeric_limits<float>::infinity();
+        const float nan = AZStd::numeric_limits<float>::quiet_NaN();
+        AZStd::vector<InterestGrid::Entry> entries = CreateRandomEntries(16, 10.0f);
+        entries.push_back({ ConstNetworkEntityHandle(), AZ::Vector3(1.0e12f, -1.0e12f, 0.0f) });
+        entries.push_back({ ConstNetworkEntityHandle(), AZ::Vector3(infinity, -infinity, 0.0f) });
+        entries.push_back({ ConstNetworkEntityHandle(), AZ::Vector3(nan, nan, 0.0f) });
+        m_grid->Rebuild(entries, 10.0f);
+        EXPECT_EQ(m_grid->GetEntryCount(), 19u);
+
+        // Entities far outside the range of cell coordinates are still found by queries next to them
+        AZStd::vector<const InterestGrid::Entry*> gathered;
+        m_grid->Gather(AZ::Vector3(1.0e12f, -1.0e12f, 0.0f), 10.0f, gathered);
+        ASSERT_EQ(gathered.size(), 1u);
+        EXPECT_EQ(gathered[0]->m_position.GetX(), 1.0e12f);
+
+        // Non-finite queries don't gather any of the finite entries
+        gathered.clear();
+        m_grid->Gather(AZ::Vector3(nan, 0.0f, 0.0f), 100.0f, gathered);
+        EXPECT_TRUE(gathered.empty());
+
+        gathered.clear();
+        m_grid->Gather(AZ::Vector3::CreateZero(), infinity, gathered);
+        EXPECT_GE(gathered.size(), 16u);
+    }
+}
@@ -60,6 +60,8 @@ namespace UnitTest
         MOCK_METHOD0(GetNetworkEntityTracker, Multiplayer::NetworkEntityTracker* ());
         MOCK_METHOD0(GetNetworkEntityAuthorityTracker, Multiplayer::NetworkEntityAuthorityTracker* ());
         MOCK_METHOD0(GetMultiplayerComponentRegistry, Multiplayer::MultiplayerComponentRegistry* ());
+        MOCK_METHOD0(GetEntitySerializationCache, Multiplayer::EntitySerializationCache* ());
+        MOCK_METHOD0(GetInterestGrid, Multiplayer::InterestGrid* ());
         MOCK_CONST_METHOD0(GetHostId, const Multiplayer::HostId&());
         MOCK_CONST_METHOD1(GetEntity, Multiplayer::ConstNetworkEntityHandle(Multiplayer::NetEntityId));
         MOCK_CONST_METHOD1(GetNetEntityIdById, Multiplayer::NetEntityId(const AZ::EntityId&));
@@ -58,12 +58,16 @@ set(FILES
     Source/NetworkEntity/NetworkSpawnableLibrary.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
+    Source/NetworkEntity/EntityReplication/EntitySerializationCache.cpp
+    Source/NetworkEntity/EntityReplication/EntitySerializationCache.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/ReplicationWindows/InterestGrid.cpp
+    Source/ReplicationWindows/InterestGrid.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
@@ -14,6 +14,10 @@ set(FILES
     Include/Multiplayer/AutoGen/AutoComponent_Source.jinja
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
+    Tests/EntityReplicationBenchmarks.cpp
+    Tests/EntitySerializationCacheTests.cpp
+    Tests/InterestGridBenchmarks.cpp
+    Tests/InterestGridTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
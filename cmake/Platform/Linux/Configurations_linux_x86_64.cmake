@@ -6,6 +6,11 @@
 #
 #
 
+set(LY_SIMD_AVX2 FALSE CACHE BOOL "Compile for CPUs with AVX2 and FMA support (Haswell and newer), this enables the AVX2 backend of AZ::Simd")
+if(LY_SIMD_AVX2)
+    set(LY_SIMD_AVX2_FLAGS -mavx2 -mfma)
+endif()
+
 if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
 
     include(cmake/Platform/Common/Clang/Configurations_clang.cmake)
@@ -24,6 +29,7 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
                 LINUX64
             COMPILATION
                 -msse4.1
+                ${LY_SIMD_AVX2_FLAGS}
             LINK_NON_STATIC
                 ${SPECIFY_LINKER_FLAG}
                 -Wl,--no-undefined
@@ -49,6 +55,7 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
                 LINUX64
             COMPILATION
                 -msse4.1
+                ${LY_SIMD_AVX2_FLAGS}
             LINK_NON_STATIC
                 ${SPECIFY_LINKER_FLAG}
                 -Wl,--no-undefined
@@ -83,6 +90,7 @@ elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
             LINUX64
         COMPILATION
             -msse4.1
+            ${LY_SIMD_AVX2_FLAGS}
         LINK_NON_STATIC
             ${LY_GCC_GCOV_LFLAGS}
             ${LY_GCC_GPROF_LFLAGS}